@@ -0,0 +1,154 @@
+#ifndef HDLTYPES_BENCH_HARNESS_HPP
+#define HDLTYPES_BENCH_HARNESS_HPP
+
+// Timing harness of the benchmarks: runs the body of each benchmark in batches long
+// enough to time reliably, keeps the best of several batches, and prints one CSV row
+// or JSON object per benchmark.
+
+#include <atomic>    // atomic_signal_fence
+#include <chrono>    // steady_clock, duration
+#include <cstddef>   // size_t
+#include <cstdio>    // printf, fflush
+#include <cstdlib>   // atof, atoi, exit
+#include <cstring>   // strncmp, strcmp
+#include <string>    // string
+
+namespace bench {
+
+/** Keeps the compiler from removing the computation of a value, or the writes to the memory it refers to. */
+template <typename T>
+inline void keep(const T& value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/** Command line options of a benchmark program. */
+struct Options {
+    /** Print JSON rather than CSV. */
+    bool json { false };
+
+    /** Only run the benchmarks whose names contain this string. */
+    std::string filter {};
+
+    /** Minimum time of each timed batch, in milliseconds. */
+    double batch_ms { 10.0 };
+
+    /** Number of timed batches, of which the fastest is reported. */
+    int batches { 5 };
+};
+
+/** Parses `--format=csv|json`, `--filter=<substring>`, `--batch-ms=<ms>`, and `--batches=<n>`; prints the usage and exits on anything else. */
+inline Options parse_options(const int argc, const char* const* const argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const char* const arg = argv[i];
+        if (std::strcmp(arg, "--format=json") == 0) {
+            options.json = true;
+        } else if (std::strcmp(arg, "--format=csv") == 0) {
+            options.json = false;
+        } else if (std::strncmp(arg, "--filter=", 9) == 0) {
+            options.filter = arg + 9;
+        } else if ((std::strncmp(arg, "--batch-ms=", 11) == 0) && (std::atof(arg + 11) > 0)) {
+            options.batch_ms = std::atof(arg + 11);
+        } else if ((std::strncmp(arg, "--batches=", 10) == 0) && (std::atoi(arg + 10) > 0)) {
+            options.batches = std::atoi(arg + 10);
+        } else {
+            std::printf("usage: %s [--format=csv|json] [--filter=<substring>] [--batch-ms=<ms>] [--batches=<n>]\n", argv[0]);
+            std::exit(std::strcmp(arg, "--help") == 0 ? 0 : 2);
+        }
+    }
+    return options;
+}
+
+/** Runs benchmarks and prints their results
+
+    A benchmark is a name, a size (the length or width of its operands), the number of
+    elements (values, bits, or characters) one call of its body processes, and the body.
+    Every result reports the nanoseconds per call of the body and the elements per
+    second.
+    */
+class Runner {
+
+public: // constructors
+    /** Prints the CSV header or opens the JSON array. */
+    explicit Runner(const Options& options)
+        : options_(options)
+    {
+        if (options_.json) {
+            std::printf("[");
+        } else {
+            std::printf("name,size,elements,ns_per_op,elements_per_s\n");
+        }
+    }
+
+    /** Closes the JSON array. */
+    ~Runner()
+    {
+        if (options_.json) {
+            std::printf("\n]\n");
+        }
+    }
+
+    Runner(const Runner&) = delete;
+    Runner& operator=(const Runner&) = delete;
+
+public: // benchmarks
+    /** Times `body` unless the name does not match the filter. */
+    template <typename Body>
+    void run(const std::string& name, const std::size_t size, const std::size_t elements, Body body)
+    {
+        if (name.find(options_.filter) == std::string::npos) {
+            return;
+        }
+
+        // double the calls per batch until a batch takes long enough to time
+        std::size_t calls = 1;
+        while ((time(body, calls) < options_.batch_ms * 1e6) && (calls < (std::size_t(1) << 40))) {
+            calls *= 2;
+        }
+        double best = 1e300;
+        for (int n = 0; n < options_.batches; ++n) {
+            const double t = time(body, calls);
+            best = (t < best) ? t : best;
+        }
+
+        const double ns = best / double(calls);
+        const double rate = double(elements) * 1e9 / ns;
+        if (options_.json) {
+            std::printf("%s\n  {\"name\": \"%s\", \"size\": %zu, \"elements\": %zu, \"ns_per_op\": %.3f, \"elements_per_s\": %.6g}",
+                first_ ? "" : ",", name.c_str(), size, elements, ns, rate);
+        } else {
+            std::printf("%s,%zu,%zu,%.3f,%.6g\n", name.c_str(), size, elements, ns, rate);
+        }
+        std::fflush(stdout);
+        first_ = false;
+    }
+
+private: // helpers
+    /** Nanoseconds taken by `calls` calls of the body. */
+    template <typename Body>
+    static double time(Body& body, const std::size_t calls)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < calls; ++i) {
+            body();
+        }
+        const std::chrono::duration<double, std::nano> t = std::chrono::steady_clock::now() - start;
+        return t.count();
+    }
+
+private: // members
+    Options options_;
+    bool first_ { true };
+};
+
+}
+
+#endif
@@ -0,0 +1,544 @@
+// Throughput of the scalar and bulk operations of the library across sizes, printing
+// one CSV row (or JSON object, with --format=json) per benchmark. See harness.hpp for
+// the options and the columns.
+
+#include "harness.hpp"
+
+#include <hdltypes.hpp>
+#if BENCH_WAVE
+#include <hdltypes/wave.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace hdltypes;
+
+namespace {
+
+const Logic logic_values[9] = {
+    'U'_l, 'X'_l, '0'_l, '1'_l, 'Z'_l, 'W'_l, 'L'_l, 'H'_l, '-'_l
+};
+
+uint64_t next_random(uint64_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+/** Random Logic values, only `0` and `1` if `known`. */
+std::vector<Logic> random_logic(const std::size_t n, const bool known, uint64_t& state)
+{
+    std::vector<Logic> r(n);
+    for (auto& v : r) {
+        v = known ? logic_values[2 + next_random(state) % 2] : logic_values[next_random(state) % 9];
+    }
+    return r;
+}
+
+std::vector<Bit> random_bit(const std::size_t n, uint64_t& state)
+{
+    std::vector<Bit> r(n);
+    for (auto& v : r) {
+        v = to_bit(bool(next_random(state) & 1));
+    }
+    return r;
+}
+
+/** Random LogicVector with the bounds `n-1 downto 0`, only `0` and `1` if `known`. */
+LogicVector random_logic_vector(const std::size_t n, const bool known, uint64_t& state)
+{
+    const auto values = random_logic(n, known, state);
+    LogicVector r(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        r.set(LogicVector::index_type(n - 1 - i), values[i]);
+    }
+    return r;
+}
+
+BitVector random_bit_vector(const std::size_t n, uint64_t& state)
+{
+    BitVector r(n);
+    for (std::size_t i = 0; i < r.words(); ++i) {
+        r.set_word(i, next_random(state));
+    }
+    return r;
+}
+
+template <typename Integer>
+Integer random_integer(const std::size_t width, uint64_t& state)
+{
+    Integer r(width);
+    for (std::size_t i = 0; i < r.limbs(); ++i) {
+        r.set_limb(i, next_random(state));
+    }
+    return r;
+}
+
+/** Random odd Unsigned with the top bit set, a valid Montgomery modulus of the full width. */
+Unsigned random_modulus(const std::size_t width, uint64_t& state)
+{
+    Unsigned r = random_integer<Unsigned>(width, state);
+    r.set_limb(0, r.limb(0) | 1);
+    r.set_limb(r.limbs() - 1, r.limb(r.limbs() - 1) | (Unsigned::limb_type(1) << ((width - 1) % 64)));
+    return r;
+}
+
+template <typename F>
+std::vector<F> random_fixed(const std::size_t n, uint64_t& state)
+{
+    std::vector<F> r(n);
+    for (auto& v : r) {
+        typename F::integer_type bits;
+        bits.set_limb(0, next_random(state));
+        v = F::from_bits(bits);
+    }
+    return r;
+}
+
+std::string name(const char* const group, const char* const operation)
+{
+    return std::string(group) + "/" + operation;
+}
+
+/** Logic and Bit operators and conversions over arrays, one element at a time. */
+void scalar(bench::Runner& runner, uint64_t& state)
+{
+    const std::size_t n = 4096;
+    const auto a = random_logic(n, false, state);
+    const auto b = random_logic(n, false, state);
+    const auto known = random_logic(n, true, state);
+    std::vector<Logic> r(n);
+    const auto binary = [&](const char* const operation, const auto op) {
+        runner.run(name("logic", operation), n, n, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                r[i] = op(a[i], b[i]);
+            }
+            bench::keep(r[0]);
+        });
+    };
+    binary("and", [](const Logic x, const Logic y) { return x & y; });
+    binary("or", [](const Logic x, const Logic y) { return x | y; });
+    binary("xor", [](const Logic x, const Logic y) { return x ^ y; });
+    binary("resolve", [](const Logic x, const Logic y) { return resolve(x, y); });
+    runner.run("logic/not", n, n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            r[i] = ~a[i];
+        }
+        bench::keep(r[0]);
+    });
+
+    const auto lut = make_logic_lut<3>([](const Logic s, const Logic x, const Logic y) { return (x & ~s) | (y & s); });
+    runner.run("logic_lut/mux2", n, n, [&] {
+        lut.apply(r.data(), n, a.data(), b.data(), known.data());
+        bench::keep(r[0]);
+    });
+
+    const auto x = random_bit(n, state);
+    const auto y = random_bit(n, state);
+    std::vector<Bit> s(n);
+    const auto bit_binary = [&](const char* const operation, const auto op) {
+        runner.run(name("bit", operation), n, n, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                s[i] = op(x[i], y[i]);
+            }
+            bench::keep(s[0]);
+        });
+    };
+    bit_binary("and", [](const Bit p, const Bit q) { return p & q; });
+    bit_binary("or", [](const Bit p, const Bit q) { return p | q; });
+    bit_binary("xor", [](const Bit p, const Bit q) { return p ^ q; });
+    runner.run("bit/not", n, n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            s[i] = ~x[i];
+        }
+        bench::keep(s[0]);
+    });
+
+    std::string chars(n, '0');
+    for (std::size_t i = 0; i < n; ++i) {
+        chars[i] = to_char(a[i]);
+    }
+    runner.run("logic/to_logic", n, n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            r[i] = to_logic(chars[i]);
+        }
+        bench::keep(r[0]);
+    });
+    runner.run("logic/to_char", n, n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            chars[i] = to_char(a[i]);
+        }
+        bench::keep(chars[0]);
+    });
+    runner.run("logic/try_to_bit", n, n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            try_to_bit(a[i], s[i]);
+        }
+        bench::keep(s[0]);
+    });
+    runner.run("logic/validate01", n, n, [&] {
+        const std::size_t k = validate01(known.data(), n);
+        bench::keep(k);
+    });
+    runner.run("logic/convert01", n, n, [&] {
+        const std::size_t k = convert01(known.data(), n, s.data());
+        bench::keep(k);
+    });
+    runner.run("text/parse_logic", n, n, [&] {
+        const std::size_t k = parse_logic(chars.data(), n, r.data());
+        bench::keep(k);
+    });
+    runner.run("text/to_chars_logic", n, n, [&] {
+        char* const end = to_chars(&chars[0], a.data(), n);
+        bench::keep(end);
+    });
+
+    using Lanes = LogicLanes<64>;
+    std::vector<Lanes> la(n / 64);
+    std::vector<Lanes> lb(n / 64);
+    std::vector<Lanes> lr(n / 64);
+    for (std::size_t i = 0; i < n / 64; ++i) {
+        for (std::size_t lane = 0; lane < 64; ++lane) {
+            packed::LogicWord wa = la[i].word();
+            packed::LogicWord wb = lb[i].word();
+            packed::set(wa, lane, a[i * 64 + lane]);
+            packed::set(wb, lane, b[i * 64 + lane]);
+            la[i] = Lanes(wa);
+            lb[i] = Lanes(wb);
+        }
+    }
+    runner.run("logic_lanes/mux2", n, n, [&] {
+        for (std::size_t i = 0; i < n / 64; ++i) {
+            lr[i] = (la[i] & ~lb[i]) | (lb[i] & la[i]);
+        }
+        bench::keep(lr[0]);
+    });
+}
+
+/** LogicVector and BitVector operations, 64 elements per word. */
+void vectors(bench::Runner& runner, uint64_t& state)
+{
+    for (const std::size_t n : { std::size_t(64), std::size_t(1024), std::size_t(65536) }) {
+        for (const bool known : { true, false }) {
+            const char* const group = known ? "logic_vector_01" : "logic_vector";
+            const LogicVector a = random_logic_vector(n, known, state);
+            const LogicVector b = random_logic_vector(n, known, state);
+            const LogicVector c = random_logic_vector(n, true, state);
+            LogicVector r(n);
+            runner.run(name(group, "and"), n, n, [&] {
+                r = a & b;
+                bench::keep(r);
+            });
+            runner.run(name(group, "xor"), n, n, [&] {
+                r = a ^ b;
+                bench::keep(r);
+            });
+            runner.run(name(group, "not"), n, n, [&] {
+                r = ~a;
+                bench::keep(r);
+            });
+            runner.run(name(group, "mux2"), n, n, [&] {
+                r = (a & ~c) | (b & c);
+                bench::keep(r);
+            });
+            runner.run(name(group, "and_assign"), n, n, [&] {
+                r &= a;
+                bench::keep(r);
+            });
+            runner.run(name(group, "and_new"), n, n, [&] {
+                const LogicVector t = a & b;
+                bench::keep(t);
+            });
+            runner.run(name(group, "and_reduce"), n, n, [&] {
+                const Logic t = and_reduce(a);
+                bench::keep(t);
+            });
+            runner.run(name(group, "xor_reduce"), n, n, [&] {
+                const Logic t = xor_reduce(a);
+                bench::keep(t);
+            });
+        }
+
+        {
+            const BitVector a = random_bit_vector(n, state);
+            const BitVector b = random_bit_vector(n, state);
+            BitVector r(n);
+            runner.run("bit_vector/and", n, n, [&] {
+                r = a & b;
+                bench::keep(r);
+            });
+            runner.run("bit_vector/xor", n, n, [&] {
+                r = a ^ b;
+                bench::keep(r);
+            });
+            runner.run("bit_vector/not", n, n, [&] {
+                r = ~a;
+                bench::keep(r);
+            });
+            runner.run("bit_vector/xor_reduce", n, n, [&] {
+                const Bit t = xor_reduce(a);
+                bench::keep(t);
+            });
+            runner.run("bit_vector/to_logic_vector", n, n, [&] {
+                const LogicVector t = a;
+                bench::keep(t);
+            });
+        }
+
+        {
+            // views of a vector one word wider, aligned and not
+            LogicVector a = random_logic_vector(n + 64, false, state);
+            const LogicVector b = random_logic_vector(n, false, state);
+            const auto bound = LogicVector::index_type(n);
+            runner.run("vector_view/copy_aligned", n, n, [&] {
+                LogicVectorView(a).slice(downto(bound + 63, 64)) = b;
+                bench::keep(a);
+            });
+            runner.run("vector_view/copy_unaligned", n, n, [&] {
+                LogicVectorView(a).slice(downto(bound + 2, 3)) = b;
+                bench::keep(a);
+            });
+            runner.run("vector_view/copy_reversed", n, n, [&] {
+                LogicVectorView(a).slice(downto(bound - 1, 0)).reversed() = b;
+                bench::keep(a);
+            });
+            runner.run("vector_view/and_unaligned", n, n, [&] {
+                const LogicVector t = ConstLogicVectorView(a).slice(downto(bound + 2, 3)) & b;
+                bench::keep(t);
+            });
+        }
+
+        {
+            const LogicVector a = random_logic_vector(n, false, state);
+            std::string chars = to_string(a);
+            std::string hex(to_chars_length(n, Radix::hexadecimal), '0');
+            LogicVector r(n);
+            runner.run("text/parse_logic_vector", n, n, [&] {
+                const std::size_t k = parse_logic_vector(chars.data(), n, r);
+                bench::keep(k);
+            });
+            runner.run("text/to_chars_logic_vector", n, n, [&] {
+                char* const end = to_chars(&chars[0], a);
+                bench::keep(end);
+            });
+            runner.run("text/to_chars_logic_vector_hex", n, n, [&] {
+                char* const end = to_chars(&hex[0], a, Radix::hexadecimal);
+                bench::keep(end);
+            });
+        }
+
+        {
+            LogicBus bus(n, 4);
+            const LogicVector a = random_logic_vector(n, false, state);
+            const LogicVector b = random_logic_vector(n, false, state);
+            bus.drive(0, a);
+            bool toggle = false;
+            runner.run("logic_bus/drive", n, n, [&] {
+                bus.drive(1, toggle ? a : b);
+                toggle = !toggle;
+                bench::keep(bus.value());
+            });
+        }
+    }
+}
+
+/** Unsigned and Signed arithmetic, 64 bits per limb. */
+void integers(bench::Runner& runner, uint64_t& state)
+{
+    for (const std::size_t width : { std::size_t(64), std::size_t(256), std::size_t(1024), std::size_t(4096), std::size_t(16384) }) {
+        const Unsigned a = random_integer<Unsigned>(width, state);
+        const Unsigned b = random_integer<Unsigned>(width, state);
+        const Unsigned d = random_integer<Unsigned>(width / 2, state) + 1u;
+        Unsigned r(width);
+        runner.run("unsigned/add", width, width, [&] {
+            r = a + b;
+            bench::keep(r);
+        });
+        runner.run("unsigned/add_assign", width, width, [&] {
+            r += b;
+            bench::keep(r);
+        });
+        runner.run("unsigned/sub", width, width, [&] {
+            r = a - b;
+            bench::keep(r);
+        });
+        runner.run("unsigned/mul", width, width, [&] {
+            r = a * b;
+            bench::keep(r);
+        });
+        runner.run("unsigned/div", width, width, [&] {
+            r = a / d;
+            bench::keep(r);
+        });
+        runner.run("unsigned/shift_left", width, width, [&] {
+            r = a << 13;
+            bench::keep(r);
+        });
+        runner.run("unsigned/compare", width, width, [&] {
+            const bool t = a < b;
+            bench::keep(t);
+        });
+
+        ArenaResource arena;
+        runner.run("unsigned/mul_add_arena", width, width, [&] {
+            {
+                ResourceScope scope(arena);
+                r = (a * b) + (b * a);
+            }
+            arena.reset();
+            bench::keep(r);
+        });
+        runner.run("unsigned/mul_add", width, width, [&] {
+            r = (a * b) + (b * a);
+            bench::keep(r);
+        });
+
+        const Signed sa = random_integer<Signed>(width, state);
+        const Signed sb = random_integer<Signed>(width, state);
+        Signed sr(width);
+        runner.run("signed/add", width, width, [&] {
+            sr = sa + sb;
+            bench::keep(sr);
+        });
+        runner.run("signed/mul", width, width, [&] {
+            sr = sa * sb;
+            bench::keep(sr);
+        });
+
+        std::vector<char> chars(to_chars_max_length(width, 10));
+        runner.run("text/to_chars_unsigned_hex", width, width, [&] {
+            const auto t = to_chars(chars.data(), chars.data() + chars.size(), a, 16);
+            bench::keep(t);
+        });
+        runner.run("text/to_chars_unsigned_dec", width, width, [&] {
+            const auto t = to_chars(chars.data(), chars.data() + chars.size(), a, 10);
+            bench::keep(t);
+        });
+        const auto end = to_chars(chars.data(), chars.data() + chars.size(), a, 10).ptr;
+        runner.run("text/from_chars_unsigned_dec", width, width, [&] {
+            const auto t = from_chars(chars.data(), end, r, 10);
+            bench::keep(t);
+        });
+
+        if ((width >= 256) && (width <= 4096)) {
+            const Unsigned m = random_modulus(width, state);
+            const Montgomery context(m);
+            const Unsigned x = a % m;
+            const Unsigned e = random_integer<Unsigned>(64, state);
+            runner.run("montgomery/mod_pow64", width, width, [&] {
+                r = context.mod_pow(x, e);
+                bench::keep(r);
+            });
+        }
+    }
+
+    const std::size_t n = 1024;
+    std::vector<StaticUnsigned<128>> a(n);
+    std::vector<StaticUnsigned<128>> b(n);
+    std::vector<StaticUnsigned<128>> r(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i].set_limb(0, next_random(state));
+        a[i].set_limb(1, next_random(state));
+        b[i].set_limb(0, next_random(state));
+        b[i].set_limb(1, next_random(state));
+    }
+    runner.run("static_unsigned128/add", 128, n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            r[i] = a[i] + b[i];
+        }
+        bench::keep(r[0]);
+    });
+    // the product is twice as wide as the operands
+    std::vector<decltype(a[0] * b[0])> p(n);
+    runner.run("static_unsigned128/mul", 128, n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            p[i] = a[i] * b[i];
+        }
+        bench::keep(p[0]);
+    });
+
+    using Q15 = StaticSfixed<0, -15>;
+    const std::size_t samples = 4096;
+    const std::size_t taps = 32;
+    const auto x = random_fixed<Q15>(samples, state);
+    const auto h = random_fixed<Q15>(taps, state);
+    std::vector<StaticSfixed<1, -15>> y(samples - taps + 1);
+    runner.run("dsp/dot_q15", samples, samples, [&] {
+        const auto t = dot(x.data(), x.data(), samples);
+        bench::keep(t);
+    });
+    runner.run("dsp/fir32_q15", samples, samples - taps + 1, [&] {
+        fir(y.data(), x.data(), samples, h.data(), taps);
+        bench::keep(y[0]);
+    });
+}
+
+#if BENCH_WAVE
+
+/** Waveform tracing of a step of 256 Logic and 64 LogicVector signals, to a sink that discards the output. */
+void waves(bench::Runner& runner, uint64_t& state)
+{
+    const std::size_t scalars = 256;
+    const std::size_t vectors = 64;
+    // the values of odd and even steps, so most signals change every step
+    const std::vector<Logic> s[2] = { random_logic(scalars, false, state), random_logic(scalars, false, state) };
+    std::vector<LogicVector> v[2];
+    for (std::size_t i = 0; i < vectors; ++i) {
+        v[0].push_back(random_logic_vector(32, i % 4 != 0, state));
+        v[1].push_back(random_logic_vector(32, i % 4 != 0, state));
+    }
+
+    for (const WaveFormat format : { WaveFormat::vcd, WaveFormat::delta }) {
+        for (const bool background : { false, true }) {
+            WaveOptions options;
+            options.format = format;
+            options.background = background;
+            std::size_t bytes = 0;
+            WaveWriter w([&bytes](const char*, const std::size_t n) { bytes += n; }, options);
+            std::vector<WaveWriter::signal_type> ids;
+            for (std::size_t i = 0; i < scalars; ++i) {
+                ids.push_back(w.add_logic("top.s" + std::to_string(i)));
+            }
+            for (std::size_t i = 0; i < vectors; ++i) {
+                ids.push_back(w.add_logic("top.v" + std::to_string(i), downto(31, 0)));
+            }
+
+            WaveWriter::time_type t = 0;
+            const std::string group = (format == WaveFormat::vcd) ? "wave/vcd" : "wave/delta";
+            runner.run(group + (background ? "_background" : ""), scalars + vectors, scalars + vectors, [&] {
+                w.time(++t);
+                for (std::size_t i = 0; i < scalars; ++i) {
+                    w.change(ids[i], s[t & 1][i]);
+                }
+                for (std::size_t i = 0; i < vectors; ++i) {
+                    w.change(ids[scalars + i], v[t & 1][i]);
+                }
+            });
+            w.flush();
+            bench::keep(bytes);
+        }
+    }
+}
+
+#endif
+
+}
+
+int main(int argc, char** argv)
+{
+    const bench::Options options = bench::parse_options(argc, argv);
+    bench::Runner runner(options);
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    scalar(runner, state);
+    vectors(runner, state);
+    integers(runner, state);
+#if BENCH_WAVE
+    waves(runner, state);
+#endif
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Compares the lookup table and bit operation backends of the Logic operators over
+// arrays of Logic, printing one CSV row per operation, backend, and array length.
+
+#include <hdltypes.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace hdltypes;
+
+namespace {
+
+uint64_t next_random(uint64_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+std::vector<Logic> random_logic(const std::size_t n, uint64_t& state)
+{
+    std::vector<Logic> r(n);
+    for (auto& v : r) {
+        v = Logic(Logic::value_type(next_random(state) % 9));
+    }
+    return r;
+}
+
+/** Nanoseconds per element of `op` applied element-wise, best of several runs of about 1M elements. */
+template <typename Operation>
+double time_binary(std::vector<Logic>& r, const std::vector<Logic>& a, const std::vector<Logic>& b, const Operation op)
+{
+    const std::size_t n = r.size();
+    const std::size_t repeat = (std::size_t(1) << 20) / n + 1;
+    double best = 1e300;
+    for (int run = 0; run < 5; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t k = 0; k < repeat; ++k) {
+            Logic* const pr = r.data();
+            const Logic* const pa = a.data();
+            const Logic* const pb = b.data();
+            for (std::size_t i = 0; i < n; ++i) {
+                pr[i] = op(pa[i], pb[i]);
+            }
+#if defined(__GNUC__)
+            // the results of every repeat are observable, so no repeat can be removed
+            asm volatile("" : : "r"(pr) : "memory");
+#endif
+        }
+        const std::chrono::duration<double, std::nano> t = std::chrono::steady_clock::now() - start;
+        best = (t.count() < best) ? t.count() : best;
+    }
+    return best / double(repeat * n);
+}
+
+template <typename Operation>
+void report(const char* const operation, const char* const backend, std::vector<Logic>& r, const std::vector<Logic>& a, const std::vector<Logic>& b, const Operation op)
+{
+    std::printf("%s,%s,%zu,%.3f\n", operation, backend, r.size(), time_binary(r, a, b, op));
+}
+
+}
+
+int main()
+{
+    std::printf("operation,backend,length,ns_per_op\n");
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (const std::size_t n : { std::size_t(64), std::size_t(4096), std::size_t(262144) }) {
+        const auto a = random_logic(n, state);
+        const auto b = random_logic(n, state);
+        std::vector<Logic> r(n);
+        report("and", "table", r, a, b, [](const Logic x, const Logic y) { return detail::logic_and_table(x, y); });
+        report("and", "formula", r, a, b, [](const Logic x, const Logic y) { return detail::logic_and_formula(x, y); });
+        report("or", "table", r, a, b, [](const Logic x, const Logic y) { return detail::logic_or_table(x, y); });
+        report("or", "formula", r, a, b, [](const Logic x, const Logic y) { return detail::logic_or_formula(x, y); });
+        report("xor", "table", r, a, b, [](const Logic x, const Logic y) { return detail::logic_xor_table(x, y); });
+        report("xor", "formula", r, a, b, [](const Logic x, const Logic y) { return detail::logic_xor_formula(x, y); });
+        report("not", "table", r, a, b, [](const Logic x, const Logic) { return detail::logic_not_table(x); });
+        report("not", "formula", r, a, b, [](const Logic x, const Logic) { return detail::logic_not_formula(x); });
+    }
+    return 0;
+}
@@ -1,7 +1,25 @@
 #ifndef HDLTYPES_HPP
 #define HDLTYPES_HPP
 
+#include "hdltypes/bit_vector.hpp"
+#include "hdltypes/bounds.hpp"
+#include "hdltypes/dsp.hpp"
+#include "hdltypes/instrument.hpp"
+#include "hdltypes/lanes.hpp"
 #include "hdltypes/logic.hpp"
+#include "hdltypes/logic_lut.hpp"
+#include "hdltypes/logic_vector.hpp"
+#include "hdltypes/memory.hpp"
+#include "hdltypes/numeric.hpp"
+#include "hdltypes/packed.hpp"
+#include "hdltypes/resolution.hpp"
+#include "hdltypes/static_fixed.hpp"
+#include "hdltypes/static_float.hpp"
+#include "hdltypes/static_numeric.hpp"
+#include "hdltypes/static_vector.hpp"
+#include "hdltypes/text.hpp"
+#include "hdltypes/vector_expression.hpp"
+#include "hdltypes/vector_view.hpp"
 #include "hdltypes/version.hpp"
 
 #endif
@@ -0,0 +1,190 @@
+#ifndef HDLTYPES_BIT_VECTOR_HPP
+#define HDLTYPES_BIT_VECTOR_HPP
+
+#include "hdltypes/bounds.hpp"       // Bounds
+#include "hdltypes/logic.hpp"        // Bit
+#include "hdltypes/logic_vector.hpp" // LogicVector
+#include "hdltypes/memory.hpp"       // ResourceAllocator
+#include "hdltypes/packed.hpp"       // word_type
+#include "hdltypes/utils.hpp"        // is_char_type
+#include <cstddef>                   // size_t
+#include <string>                    // basic_string
+#include <type_traits>               // enable_if
+#include <vector>                    // vector
+
+namespace hdltypes {
+
+template <typename Operation, typename A, typename B>
+class BitVectorExpression;
+
+/** Array of Bit values
+
+    Roughly equivalent to VHDL's bit_vector. Elements are indexed using the Bounds
+    given at construction; the length of a BitVector is fixed.
+
+    Elements are stored one bit each in 64-bit words, packed from the left. Bits past
+    the end of the array are always `0`. Element-wise and reduction operations are
+    done with SIMD kernels selected at runtime for the running CPU.
+
+    Like Bit, a BitVector can be used where a LogicVector is expected, where it is
+    implicitly converted to a LogicVector with the same bounds.
+
+    Like LogicVector, the words are allocated from a MemoryResource.
+    */
+class BitVector {
+
+public: // types
+    /** Type of the elements. */
+    using value_type = Bit;
+
+    /** Type of index values. */
+    using index_type = Bounds::index_type;
+
+    /** Type of lengths and offsets. */
+    using size_type = Bounds::size_type;
+
+    /** Type of the words that hold the packed elements. */
+    using word_type = packed::word_type;
+
+    /** Type of the allocator of the words. */
+    using allocator_type = ResourceAllocator<word_type>;
+
+public: // constructors
+    /** Default to a null array. */
+    BitVector() = default;
+
+    /** Create a BitVector with the given bounds, with all elements set to `init`. */
+    explicit BitVector(Bounds bounds, Bit init = Bit(), const allocator_type& alloc = allocator_type());
+
+    /** Create a BitVector with the bounds `length-1 downto 0`, with all elements set to `init`. */
+    explicit BitVector(size_type length, Bit init = Bit(), const allocator_type& alloc = allocator_type());
+
+    /** Evaluates an expression of element-wise operations, with the bounds of the expression. */
+    template <typename Operation, typename A, typename B>
+    BitVector(const BitVectorExpression<Operation, A, B>& e, const allocator_type& alloc = allocator_type());
+
+    /** Copies an array, allocating from the given allocator. Copies made without one allocate from the default resource of the calling thread. */
+    BitVector(const BitVector& a, const allocator_type& alloc);
+
+    /** Moves an array, allocating from the given allocator if it is not equal to that of `a`. */
+    BitVector(BitVector&& a, const allocator_type& alloc);
+
+    BitVector(const BitVector& a) = default;
+    BitVector(BitVector&& a) = default;
+    BitVector& operator=(const BitVector& a) = default;
+    BitVector& operator=(BitVector&& a) = default;
+
+    /** Evaluates an expression of element-wise operations, taking its bounds. The expression may refer to this array, also through views of it. */
+    template <typename Operation, typename A, typename B>
+    BitVector& operator=(const BitVectorExpression<Operation, A, B>& e);
+
+public: // attributes
+    /** The allocator of the words. Copying or moving an array into this one keeps the allocator. */
+    allocator_type get_allocator() const noexcept;
+
+    /** The bounds of the array. */
+    Bounds bounds() const noexcept;
+
+    /** The leftmost index. */
+    index_type left() const noexcept;
+
+    /** The rightmost index. */
+    index_type right() const noexcept;
+
+    /** The direction of the bounds. */
+    Direction direction() const noexcept;
+
+    /** The lowest index. */
+    index_type low() const noexcept;
+
+    /** The highest index. */
+    index_type high() const noexcept;
+
+    /** The number of elements. */
+    size_type length() const noexcept;
+
+public: // element access
+    /** Returns the element at the index. There is *no* bounds checking. */
+    Bit operator[](index_type index) const noexcept;
+
+    /** Returns the element at the index. Fails if the index is not in the bounds. */
+    Bit at(index_type index) const;
+
+    /** Sets the element at the index. Fails if the index is not in the bounds. */
+    void set(index_type index, Bit value);
+
+    /** Sets all elements to the given value. */
+    void fill(Bit value) noexcept;
+
+public: // packed access
+    /** The number of words. */
+    size_type words() const noexcept;
+
+    /** Returns the `n`th word of packed elements. Elements are packed from the left. */
+    word_type word(size_type n) const noexcept;
+
+    /** Sets the `n`th word of packed elements. Bits past the end of the array are ignored. */
+    void set_word(size_type n, word_type w) noexcept;
+
+    /** Returns a pointer to the words. */
+    const word_type* data() const noexcept;
+
+    /** Returns a pointer to the words. Bits past the end of the array must be kept `0`. */
+    word_type* data() noexcept;
+
+public: // LogicVector conversion
+    /** Allows a LogicVector to be converted to a BitVector. Fails if any element is not `0` or `1`. */
+    explicit BitVector(const LogicVector& a);
+
+    /** Allows a BitVector to be converted *implicitly* to a LogicVector. */
+    operator LogicVector() const;
+
+private: // members
+    Bounds bounds_ {};
+    std::vector<word_type, allocator_type> words_ {};
+};
+
+/** \relates BitVector Converts a string of characters into a BitVector with the bounds `length-1 downto 0`. See to_bit for details. */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+BitVector to_bit_vector(const CharType* str, std::size_t length);
+
+/** \relates BitVector Converts a string into a BitVector with the bounds `length-1 downto 0`. See to_bit for details. */
+template <typename CharType>
+BitVector to_bit_vector(const std::basic_string<CharType>& str);
+
+/** \relates BitVector Converts a LogicVector into a BitVector. Fails if any element is not `0` or `1`. */
+BitVector to_bit_vector(const LogicVector& a);
+
+/** \relates BitVector UDL convenience syntax for to_bit_vector. */
+BitVector operator""_bv(const char* str, std::size_t length);
+
+/** \relates BitVector Converts a BitVector into a string, from left to right. */
+template <typename CharType = char>
+std::basic_string<CharType> to_string(const BitVector& a);
+
+/** \relates BitVector Value equality. Arrays of different lengths are never equal; bounds are not compared. */
+bool operator==(const BitVector& a, const BitVector& b) noexcept;
+
+/** \relates BitVector Value inequality. */
+bool operator!=(const BitVector& a, const BitVector& b) noexcept;
+
+/** \relates BitVector Inplace version of the element-wise logical inversion operation. */
+BitVector& inplace_invert(BitVector& a) noexcept;
+
+/** \relates BitVector Logical "and" of all elements. Returns `1` for a null array. */
+Bit and_reduce(const BitVector& a) noexcept;
+
+/** \relates BitVector Logical "or" of all elements. Returns `0` for a null array. */
+Bit or_reduce(const BitVector& a) noexcept;
+
+/** \relates BitVector Logical "xor" of all elements. Returns `0` for a null array. */
+Bit xor_reduce(const BitVector& a) noexcept;
+
+}
+
+#include "hdltypes/impl/bit_vector.hpp"
+
+// element-wise operations
+#include "hdltypes/vector_expression.hpp"
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef HDLTYPES_BOUNDS_HPP
+#define HDLTYPES_BOUNDS_HPP
+
+#include <cstddef> // ptrdiff_t, size_t
+#include <cstdint> // uint8_t
+
+namespace hdltypes {
+
+/** Direction of the range of indexes of an array type. */
+enum class Direction : uint8_t {
+    ascending, ///< Like VHDL's `to`. The left index is the lowest index.
+    descending ///< Like VHDL's `downto`. The left index is the highest index.
+};
+
+/** Bounds of an array type
+
+    This models the index constraint on a VHDL array type: a left index, a right index,
+    and a direction. Elements are stored in order from left to right, so the "offset"
+    of an index is its distance from the left bound.
+
+    Bounds where the right index is "before" the left index (given the direction) are
+    null ranges and have a length of zero.
+    */
+class Bounds {
+
+public: // types
+    /** Type of index values. */
+    using index_type = std::ptrdiff_t;
+
+    /** Type of lengths and offsets. */
+    using size_type = std::size_t;
+
+public: // constructors
+    /** Default to the null range `0 to -1`. */
+    constexpr Bounds() noexcept = default;
+
+    /** Create bounds from a left index, a direction, and a right index. */
+    constexpr Bounds(index_type left, Direction direction, index_type right) noexcept;
+
+public: // attributes
+    /** The leftmost index. */
+    constexpr index_type left() const noexcept;
+
+    /** The rightmost index. */
+    constexpr index_type right() const noexcept;
+
+    /** The direction of the range. */
+    constexpr Direction direction() const noexcept;
+
+    /** The lowest index. */
+    constexpr index_type low() const noexcept;
+
+    /** The highest index. */
+    constexpr index_type high() const noexcept;
+
+    /** The number of indexes in the range. */
+    constexpr size_type length() const noexcept;
+
+    /** Returns `true` if the index is in the range. */
+    constexpr bool contains(index_type index) const noexcept;
+
+    /** Returns the distance of the index from the left bound. The index must be in the range. */
+    constexpr size_type offset(index_type index) const noexcept;
+
+    /** Returns the index at the given distance from the left bound. */
+    constexpr index_type index(size_type offset) const noexcept;
+
+private: // members
+    index_type left_ { 0 };
+    index_type right_ { -1 };
+    Direction direction_ { Direction::ascending };
+};
+
+/** \relates Bounds Ascending bounds, like VHDL's `left to right`. */
+constexpr Bounds to(Bounds::index_type left, Bounds::index_type right) noexcept;
+
+/** \relates Bounds Descending bounds, like VHDL's `left downto right`. */
+constexpr Bounds downto(Bounds::index_type left, Bounds::index_type right) noexcept;
+
+/** \relates Bounds Bounds equality. Null ranges are only equal if all attributes are equal. */
+constexpr bool operator==(Bounds a, Bounds b) noexcept;
+
+/** \relates Bounds Bounds inequality. */
+constexpr bool operator!=(Bounds a, Bounds b) noexcept;
+
+}
+
+#include "hdltypes/impl/bounds.hpp"
+
+#endif
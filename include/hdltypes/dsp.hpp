@@ -0,0 +1,68 @@
+#ifndef HDLTYPES_DSP_HPP
+#define HDLTYPES_DSP_HPP
+
+#include "hdltypes/static_fixed.hpp" // StaticUfixed, StaticSfixed, FixedOverflow, FixedRound
+#include <cstddef>                   // size_t
+
+namespace hdltypes {
+
+/*
+  Bulk kernels over arrays of fixed point values of one format.
+
+  Operands must be at most 32 bits wide. Each value is then a single 64-bit integer, and
+  the kernels multiply 4 values at a time in the 64-bit lanes of AVX2 registers when the
+  running CPU supports them. Results are bit-identical to the same computation written
+  with the scalar types.
+*/
+
+/** Format of the sums of dot and fir over StaticSfixed operands with the right bounds R1 and R2
+
+    The bounds of the products widened to 64 bits, so sums of up to `2^(64-W1-W2)` terms
+    are exact. Longer sums wrap.
+    */
+template <int R1, int R2>
+using StaticSfixedAccumulator = StaticSfixed<R1 + R2 + 63, R1 + R2>;
+
+/** Format of the sums of dot and fir over StaticUfixed operands with the right bounds R1 and R2. See StaticSfixedAccumulator. */
+template <int R1, int R2>
+using StaticUfixedAccumulator = StaticUfixed<R1 + R2 + 63, R1 + R2>;
+
+/** \relates StaticSfixed Sum of the products `a[i]*b[i]` of `n` pairs.
+
+    Equivalent to adding each product to a StaticSfixedAccumulator and resizing it back
+    with FixedOverflow::wrap.
+    */
+template <int L1, int R1, int L2, int R2>
+StaticSfixedAccumulator<R1, R2> dot(const StaticSfixed<L1, R1>* a, const StaticSfixed<L2, R2>* b, std::size_t n) noexcept;
+
+/** \relates StaticUfixed Sum of the products `a[i]*b[i]` of `n` pairs. See dot(const StaticSfixed<L1, R1>*, const StaticSfixed<L2, R2>*, std::size_t). */
+template <int L1, int R1, int L2, int R2>
+StaticUfixedAccumulator<R1, R2> dot(const StaticUfixed<L1, R1>* a, const StaticUfixed<L2, R2>* b, std::size_t n) noexcept;
+
+/** \relates StaticSfixed Writes `resize<L3, R3>(a[i] * b[i], overflow, round)` to `r[i]` for `n` pairs. `r` may alias neither operand. */
+template <int L3, int R3, int L1, int R1, int L2, int R2>
+void multiply(StaticSfixed<L3, R3>* r, const StaticSfixed<L1, R1>* a, const StaticSfixed<L2, R2>* b, std::size_t n, FixedOverflow overflow = FixedOverflow::saturate, FixedRound round = FixedRound::round) noexcept;
+
+/** \relates StaticUfixed Writes `resize<L3, R3>(a[i] * b[i], overflow, round)` to `r[i]` for `n` pairs. `r` may alias neither operand. */
+template <int L3, int R3, int L1, int R1, int L2, int R2>
+void multiply(StaticUfixed<L3, R3>* r, const StaticUfixed<L1, R1>* a, const StaticUfixed<L2, R2>* b, std::size_t n, FixedOverflow overflow = FixedOverflow::saturate, FixedRound round = FixedRound::round) noexcept;
+
+/** \relates StaticSfixed Finite impulse response filter over the `length` samples of `x` with the `taps` coefficients `h`.
+
+    Writes the `length - taps + 1` outputs for which every coefficient has a sample,
+    and none if `taps` is 0 or `length` is less than `taps`. Output `y[i]` is the sum
+    of `h[j] * x[i + taps - 1 - j]` in a StaticSfixedAccumulator, resized to the format
+    of `y` by `overflow` and `round`. `y` may not alias `x`.
+    */
+template <int L3, int R3, int L1, int R1, int L2, int R2>
+void fir(StaticSfixed<L3, R3>* y, const StaticSfixed<L1, R1>* x, std::size_t length, const StaticSfixed<L2, R2>* h, std::size_t taps, FixedOverflow overflow = FixedOverflow::saturate, FixedRound round = FixedRound::round) noexcept;
+
+/** \relates StaticUfixed Finite impulse response filter. See fir(StaticSfixed<L3, R3>*, const StaticSfixed<L1, R1>*, std::size_t, const StaticSfixed<L2, R2>*, std::size_t, FixedOverflow, FixedRound). */
+template <int L3, int R3, int L1, int R1, int L2, int R2>
+void fir(StaticUfixed<L3, R3>* y, const StaticUfixed<L1, R1>* x, std::size_t length, const StaticUfixed<L2, R2>* h, std::size_t taps, FixedOverflow overflow = FixedOverflow::saturate, FixedRound round = FixedRound::round) noexcept;
+
+}
+
+#include "hdltypes/impl/dsp.hpp"
+
+#endif
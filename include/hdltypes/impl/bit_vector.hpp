@@ -0,0 +1,287 @@
+#ifndef HDLTYPES_IMPL_BIT_VECTOR_HPP
+#define HDLTYPES_IMPL_BIT_VECTOR_HPP
+#include "hdltypes/bit_vector.hpp"
+
+#include <algorithm>   // equal, fill
+#include <cassert>
+#include <cstddef>     // size_t
+#include <stdexcept>   // invalid_argument, out_of_range
+#include <string>      // basic_string
+#include <type_traits> // enable_if
+#include <utility>     // move
+
+#include "hdltypes/bounds.hpp"            // Bounds
+#include "hdltypes/impl/simd.hpp"         // word_kernels
+#include "hdltypes/impl/text_kernels.hpp" // pack_bit_chars, unpack_bit_chars
+#include "hdltypes/instrument.hpp"        // instrument_counters
+#include "hdltypes/logic.hpp"             // Bit
+#include "hdltypes/logic_vector.hpp"      // LogicVector, check_lengths
+#include "hdltypes/packed.hpp"            // word_count, tail_mask
+#include "hdltypes/utils.hpp"             // is_char_type, HDLTYPES_THROW
+
+namespace hdltypes {
+
+namespace detail {
+
+/** Counts the evaluation of an expression into the array, and the values of its elements, if HDLTYPES_INSTRUMENT is 1. */
+inline void count_evaluation(const BitVector& a) noexcept
+{
+#if HDLTYPES_INSTRUMENT
+    const std::size_t ones = simd::scalar::popcount(a.data(), a.words());
+    InstrumentCounters& counters = instrument_counters();
+    counters.add_call(InstrumentedOperation::bit_vector);
+    counters.add_results(InstrumentedOperation::bit_vector, Logic::_0, a.length() - ones);
+    counters.add_results(InstrumentedOperation::bit_vector, Logic::_1, ones);
+#else
+    (void)a;
+#endif
+}
+
+}
+
+inline BitVector::BitVector(const Bounds bounds, const Bit init, const allocator_type& alloc)
+    : bounds_(bounds)
+    , words_(packed::word_count(bounds.length()), alloc)
+{
+    fill(init);
+}
+
+inline BitVector::BitVector(const size_type length, const Bit init, const allocator_type& alloc)
+    : BitVector(downto(Bounds::index_type(length) - 1, 0), init, alloc)
+{
+}
+
+template <typename Operation, typename A, typename B>
+BitVector::BitVector(const BitVectorExpression<Operation, A, B>& e, const allocator_type& alloc)
+    : bounds_(e.bounds())
+    , words_(e.words(), alloc)
+{
+    e.evaluate(words_.data());
+    if (!words_.empty()) {
+        words_.back() &= packed::tail_mask(length());
+    }
+    detail::count_evaluation(*this);
+}
+
+template <typename Operation, typename A, typename B>
+BitVector& BitVector::operator=(const BitVectorExpression<Operation, A, B>& e)
+{
+    // a view of this array at other positions would read elements already written
+    if ((e.length() != length()) || e.aliases(this, 0, 1)) {
+        return (*this = BitVector(e, get_allocator()));
+    }
+    // each word of the result depends only on the same word of the operands
+    e.evaluate(words_.data());
+    if (!words_.empty()) {
+        words_.back() &= packed::tail_mask(length());
+    }
+    detail::count_evaluation(*this);
+    bounds_ = e.bounds();
+    return *this;
+}
+
+inline BitVector::BitVector(const BitVector& a, const allocator_type& alloc)
+    : bounds_(a.bounds_)
+    , words_(a.words_, alloc)
+{
+}
+
+inline BitVector::BitVector(BitVector&& a, const allocator_type& alloc)
+    : bounds_(a.bounds_)
+    , words_(std::move(a.words_), alloc)
+{
+}
+
+inline BitVector::allocator_type BitVector::get_allocator() const noexcept
+{
+    return words_.get_allocator();
+}
+
+inline Bounds BitVector::bounds() const noexcept
+{
+    return bounds_;
+}
+
+inline BitVector::index_type BitVector::left() const noexcept
+{
+    return bounds_.left();
+}
+
+inline BitVector::index_type BitVector::right() const noexcept
+{
+    return bounds_.right();
+}
+
+inline Direction BitVector::direction() const noexcept
+{
+    return bounds_.direction();
+}
+
+inline BitVector::index_type BitVector::low() const noexcept
+{
+    return bounds_.low();
+}
+
+inline BitVector::index_type BitVector::high() const noexcept
+{
+    return bounds_.high();
+}
+
+inline BitVector::size_type BitVector::length() const noexcept
+{
+    return bounds_.length();
+}
+
+inline Bit BitVector::operator[](const index_type index) const noexcept
+{
+    const size_type offset = bounds_.offset(index);
+    return to_bit(bool((words_[offset / packed::word_bits] >> (offset % packed::word_bits)) & 1));
+}
+
+inline Bit BitVector::at(const index_type index) const
+{
+    if (!bounds_.contains(index)) {
+        HDLTYPES_THROW(std::out_of_range("Index is not in the bounds of the array"));
+    }
+    return (*this)[index];
+}
+
+inline void BitVector::set(const index_type index, const Bit value)
+{
+    if (!bounds_.contains(index)) {
+        HDLTYPES_THROW(std::out_of_range("Index is not in the bounds of the array"));
+    }
+    const size_type offset = bounds_.offset(index);
+    const word_type m = word_type(1) << (offset % packed::word_bits);
+    word_type& w = words_[offset / packed::word_bits];
+    w = (value == '1'_b) ? (w | m) : (w & ~m);
+}
+
+inline void BitVector::fill(const Bit value) noexcept
+{
+    std::fill(words_.begin(), words_.end(), (value == '1'_b) ? ~word_type(0) : word_type(0));
+    if (!words_.empty()) {
+        words_.back() &= packed::tail_mask(length());
+    }
+}
+
+inline BitVector::size_type BitVector::words() const noexcept
+{
+    return words_.size();
+}
+
+inline BitVector::word_type BitVector::word(const size_type n) const noexcept
+{
+    assert(n < words_.size());
+    return words_[n];
+}
+
+inline void BitVector::set_word(const size_type n, const word_type w) noexcept
+{
+    assert(n < words_.size());
+    words_[n] = (n + 1 == words_.size()) ? (w & packed::tail_mask(length())) : w;
+}
+
+inline const BitVector::word_type* BitVector::data() const noexcept
+{
+    return words_.data();
+}
+
+inline BitVector::word_type* BitVector::data() noexcept
+{
+    return words_.data();
+}
+
+inline BitVector::BitVector(const LogicVector& a)
+    : bounds_(a.bounds())
+    , words_(a.plane(1), a.plane(1) + a.words())
+{
+    if (!a.is01()) {
+        HDLTYPES_THROW(std::invalid_argument("LogicVector value cannot be converted to BitVector"));
+    }
+}
+
+inline BitVector::operator LogicVector() const
+{
+    LogicVector r(bounds_, '0'_l);
+    for (size_type i = 0; i < words_.size(); ++i) {
+        r.set_word(i, packed::LogicWord { 0, words_[i], 0, 0 });
+    }
+    return r;
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+BitVector to_bit_vector(const CharType* const str, const std::size_t length)
+{
+    BitVector r(length);
+    if (detail::pack_bit_chars(str, length, r.data()) != length) {
+        HDLTYPES_THROW(std::invalid_argument("Given value is not a Bit"));
+    }
+    return r;
+}
+
+template <typename CharType>
+BitVector to_bit_vector(const std::basic_string<CharType>& str)
+{
+    return to_bit_vector(str.data(), str.size());
+}
+
+inline BitVector to_bit_vector(const LogicVector& a)
+{
+    return BitVector(a);
+}
+
+inline BitVector operator""_bv(const char* const str, const std::size_t length)
+{
+    return to_bit_vector(str, length);
+}
+
+template <typename CharType>
+std::basic_string<CharType> to_string(const BitVector& a)
+{
+    std::basic_string<CharType> r(a.length(), CharType());
+    detail::unpack_bit_chars(a.data(), a.length(), &r[0]);
+    return r;
+}
+
+inline bool operator==(const BitVector& a, const BitVector& b) noexcept
+{
+    return (a.length() == b.length()) && std::equal(a.data(), a.data() + a.words(), b.data());
+}
+
+inline bool operator!=(const BitVector& a, const BitVector& b) noexcept
+{
+    return !(a == b);
+}
+
+inline BitVector& inplace_invert(BitVector& a) noexcept
+{
+    simd::word_kernels().bit_not(a.data(), a.data(), a.words());
+    if (a.words() != 0) {
+        a.set_word(a.words() - 1, a.word(a.words() - 1));
+    }
+    return a;
+}
+
+inline Bit and_reduce(const BitVector& a) noexcept
+{
+    const std::size_t n = a.words();
+    if (n == 0) {
+        return '1'_b;
+    }
+    return to_bit(simd::word_kernels().all_ones(a.data(), n - 1) && (a.word(n - 1) == packed::tail_mask(a.length())));
+}
+
+inline Bit or_reduce(const BitVector& a) noexcept
+{
+    return to_bit(simd::word_kernels().any_ones(a.data(), a.words()));
+}
+
+inline Bit xor_reduce(const BitVector& a) noexcept
+{
+    return to_bit(bool(simd::word_kernels().popcount(a.data(), a.words()) & 1));
+}
+
+}
+
+#endif
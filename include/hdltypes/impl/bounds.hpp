@@ -0,0 +1,85 @@
+#ifndef HDLTYPES_IMPL_BOUNDS_HPP
+#define HDLTYPES_IMPL_BOUNDS_HPP
+#include "hdltypes/bounds.hpp"
+
+#include <cassert>
+#include <cstddef> // ptrdiff_t, size_t
+
+namespace hdltypes {
+
+constexpr Bounds::Bounds(const index_type left, const Direction direction, const index_type right) noexcept
+    : left_(left)
+    , right_(right)
+    , direction_(direction)
+{
+}
+
+constexpr Bounds::index_type Bounds::left() const noexcept
+{
+    return left_;
+}
+
+constexpr Bounds::index_type Bounds::right() const noexcept
+{
+    return right_;
+}
+
+constexpr Direction Bounds::direction() const noexcept
+{
+    return direction_;
+}
+
+constexpr Bounds::index_type Bounds::low() const noexcept
+{
+    return (direction_ == Direction::ascending) ? left_ : right_;
+}
+
+constexpr Bounds::index_type Bounds::high() const noexcept
+{
+    return (direction_ == Direction::ascending) ? right_ : left_;
+}
+
+constexpr Bounds::size_type Bounds::length() const noexcept
+{
+    return (high() < low()) ? 0 : size_type(high() - low()) + 1;
+}
+
+constexpr bool Bounds::contains(const index_type index) const noexcept
+{
+    return (low() <= index) && (index <= high());
+}
+
+constexpr Bounds::size_type Bounds::offset(const index_type index) const noexcept
+{
+    assert(contains(index));
+    return (direction_ == Direction::ascending) ? size_type(index - left_) : size_type(left_ - index);
+}
+
+constexpr Bounds::index_type Bounds::index(const size_type offset) const noexcept
+{
+    return (direction_ == Direction::ascending) ? left_ + index_type(offset) : left_ - index_type(offset);
+}
+
+constexpr Bounds to(const Bounds::index_type left, const Bounds::index_type right) noexcept
+{
+    return Bounds(left, Direction::ascending, right);
+}
+
+constexpr Bounds downto(const Bounds::index_type left, const Bounds::index_type right) noexcept
+{
+    return Bounds(left, Direction::descending, right);
+}
+
+constexpr bool operator==(const Bounds a, const Bounds b) noexcept
+{
+    return (a.left() == b.left()) && (a.right() == b.right()) && (a.direction() == b.direction());
+}
+
+constexpr bool operator!=(const Bounds a, const Bounds b) noexcept
+{
+    return !(a == b);
+}
+
+}
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef HDLTYPES_IMPL_DSP_HPP
+#define HDLTYPES_IMPL_DSP_HPP
+#include "hdltypes/dsp.hpp"
+
+#include <cstddef> // size_t
+
+#include "hdltypes/impl/dsp_kernels.hpp" // dsp_kernels
+#include "hdltypes/packed.hpp"           // word_type
+
+namespace hdltypes {
+
+namespace detail {
+
+/** Number of products or sums computed into a buffer on the stack before they are resized. */
+constexpr std::size_t dsp_block = 256;
+
+/** The bits of an array of fixed point values as an array of words, one per value. */
+template <typename F>
+const packed::word_type* fixed_words(const F* const a) noexcept
+{
+    static_assert(F::width() <= 32, "Bulk kernels hold operands in 32-bit lanes");
+    static_assert(sizeof(F) == sizeof(packed::word_type), "Bulk kernels read one word per value");
+    return reinterpret_cast<const packed::word_type*>(a);
+}
+
+/** Fixed point value of the format F with the bits in a word. */
+template <typename F>
+constexpr F fixed_from_word(const packed::word_type w) noexcept
+{
+    return F::from_bits(F::integer_type::from_value(w));
+}
+
+template <typename P, typename F>
+void resize_words(F* const r, const packed::word_type* const w, const std::size_t n, const FixedOverflow overflow, const FixedRound round) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = resize<F::left(), F::right()>(fixed_from_word<P>(w[i]), overflow, round);
+    }
+}
+
+template <typename P, typename F, typename A, typename B>
+void multiply_fixed(F* const r, const A* const a, const B* const b, const std::size_t n, const FixedOverflow overflow, const FixedRound round, const bool is_signed) noexcept
+{
+    const auto& k = simd::dsp_kernels();
+    const auto multiply = is_signed ? k.multiply_signed : k.multiply_unsigned;
+    packed::word_type buffer[dsp_block];
+    for (std::size_t i = 0; i < n; i += dsp_block) {
+        const std::size_t m = (n - i < dsp_block) ? n - i : dsp_block;
+        multiply(buffer, fixed_words(a + i), fixed_words(b + i), m);
+        resize_words<P>(r + i, buffer, m, overflow, round);
+    }
+}
+
+template <typename P, typename F, typename A, typename B>
+void fir_fixed(F* const y, const A* const x, const std::size_t length, const B* const h, const std::size_t taps, const FixedOverflow overflow, const FixedRound round, const bool is_signed) noexcept
+{
+    if ((taps == 0) || (length < taps)) {
+        return;
+    }
+    const auto& k = simd::dsp_kernels();
+    const auto fir = is_signed ? k.fir_signed : k.fir_unsigned;
+    const std::size_t n = length - taps + 1;
+    packed::word_type buffer[dsp_block];
+    for (std::size_t i = 0; i < n; i += dsp_block) {
+        const std::size_t m = (n - i < dsp_block) ? n - i : dsp_block;
+        fir(buffer, fixed_words(x + i), fixed_words(h), m, taps);
+        resize_words<P>(y + i, buffer, m, overflow, round);
+    }
+}
+
+}
+
+template <int L1, int R1, int L2, int R2>
+StaticSfixedAccumulator<R1, R2> dot(const StaticSfixed<L1, R1>* const a, const StaticSfixed<L2, R2>* const b, const std::size_t n) noexcept
+{
+    const auto s = simd::dsp_kernels().dot_signed(detail::fixed_words(a), detail::fixed_words(b), n);
+    return detail::fixed_from_word<StaticSfixedAccumulator<R1, R2>>(s);
+}
+
+template <int L1, int R1, int L2, int R2>
+StaticUfixedAccumulator<R1, R2> dot(const StaticUfixed<L1, R1>* const a, const StaticUfixed<L2, R2>* const b, const std::size_t n) noexcept
+{
+    const auto s = simd::dsp_kernels().dot_unsigned(detail::fixed_words(a), detail::fixed_words(b), n);
+    return detail::fixed_from_word<StaticUfixedAccumulator<R1, R2>>(s);
+}
+
+template <int L3, int R3, int L1, int R1, int L2, int R2>
+void multiply(StaticSfixed<L3, R3>* const r, const StaticSfixed<L1, R1>* const a, const StaticSfixed<L2, R2>* const b, const std::size_t n, const FixedOverflow overflow, const FixedRound round) noexcept
+{
+    detail::multiply_fixed<StaticSfixed<L1 + L2 + 1, R1 + R2>>(r, a, b, n, overflow, round, true);
+}
+
+template <int L3, int R3, int L1, int R1, int L2, int R2>
+void multiply(StaticUfixed<L3, R3>* const r, const StaticUfixed<L1, R1>* const a, const StaticUfixed<L2, R2>* const b, const std::size_t n, const FixedOverflow overflow, const FixedRound round) noexcept
+{
+    detail::multiply_fixed<StaticUfixed<L1 + L2 + 1, R1 + R2>>(r, a, b, n, overflow, round, false);
+}
+
+template <int L3, int R3, int L1, int R1, int L2, int R2>
+void fir(StaticSfixed<L3, R3>* const y, const StaticSfixed<L1, R1>* const x, const std::size_t length, const StaticSfixed<L2, R2>* const h, const std::size_t taps, const FixedOverflow overflow, const FixedRound round) noexcept
+{
+    detail::fir_fixed<StaticSfixedAccumulator<R1, R2>>(y, x, length, h, taps, overflow, round, true);
+}
+
+template <int L3, int R3, int L1, int R1, int L2, int R2>
+void fir(StaticUfixed<L3, R3>* const y, const StaticUfixed<L1, R1>* const x, const std::size_t length, const StaticUfixed<L2, R2>* const h, const std::size_t taps, const FixedOverflow overflow, const FixedRound round) noexcept
+{
+    detail::fir_fixed<StaticUfixedAccumulator<R1, R2>>(y, x, length, h, taps, overflow, round, false);
+}
+
+}
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef HDLTYPES_IMPL_DSP_KERNELS_HPP
+#define HDLTYPES_IMPL_DSP_KERNELS_HPP
+
+#include <cstddef> // size_t
+
+#include "hdltypes/impl/simd.hpp" // Isa, detect_isa
+#include "hdltypes/packed.hpp"    // word_type
+
+namespace hdltypes {
+namespace simd {
+
+/** Multiply-accumulate kernels over arrays of fixed point bits
+
+    Operands are words holding integers of at most 32 bits, sign-extended by the
+    `*_signed` kernels and zero-extended by the `*_unsigned` kernels, which is how
+    StaticSigned and StaticUnsigned hold them. Products and sums are computed modulo
+    `2^64`, so they are exact until a sum leaves the range of a 64-bit integer.
+
+    `dot_*` returns the sum of the `n` products `a[i]*b[i]`. `multiply_*` writes the `n`
+    products to `r`, which may alias an operand. `fir_*` writes `n` sums to `r`, where
+    `r[i]` is the sum of `h[j]*x[i+taps-1-j]` over the `taps` coefficients; it reads
+    `n + taps - 1` samples of `x`.
+    */
+struct DspKernels {
+    word_type (*dot_signed)(const word_type* a, const word_type* b, std::size_t n) noexcept;
+    word_type (*dot_unsigned)(const word_type* a, const word_type* b, std::size_t n) noexcept;
+    void (*multiply_signed)(word_type* r, const word_type* a, const word_type* b, std::size_t n) noexcept;
+    void (*multiply_unsigned)(word_type* r, const word_type* a, const word_type* b, std::size_t n) noexcept;
+    void (*fir_signed)(word_type* r, const word_type* x, const word_type* h, std::size_t n, std::size_t taps) noexcept;
+    void (*fir_unsigned)(word_type* r, const word_type* x, const word_type* h, std::size_t n, std::size_t taps) noexcept;
+};
+
+namespace scalar {
+
+// Sign-extended operands multiply to the signed product modulo 2^64, so the same
+// kernels serve both signednesses.
+
+inline word_type dot(const word_type* const a, const word_type* const b, const std::size_t n) noexcept
+{
+    word_type s0 = 0, s1 = 0;
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        s0 += a[i] * b[i];
+        s1 += a[i + 1] * b[i + 1];
+    }
+    if (i < n) {
+        s0 += a[i] * b[i];
+    }
+    return s0 + s1;
+}
+
+inline void multiply(word_type* const r, const word_type* const a, const word_type* const b, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = a[i] * b[i];
+    }
+}
+
+inline void fir(word_type* const r, const word_type* const x, const word_type* const h, const std::size_t n, const std::size_t taps) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        word_type s = 0;
+        for (std::size_t j = 0; j < taps; ++j) {
+            s += h[j] * x[i + taps - 1 - j];
+        }
+        r[i] = s;
+    }
+}
+
+}
+
+#if HDLTYPES_SIMD_X86
+
+namespace avx2 {
+
+/** Products of the low 32 bits of each 64-bit lane, as signed or unsigned integers. */
+template <bool Signed>
+__attribute__((target("avx2"))) inline __m256i multiply_lanes(const __m256i a, const __m256i b) noexcept
+{
+    return Signed ? _mm256_mul_epi32(a, b) : _mm256_mul_epu32(a, b);
+}
+
+__attribute__((target("avx2"))) inline word_type sum_lanes(const __m256i a) noexcept
+{
+    const __m128i s = _mm_add_epi64(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1));
+    return word_type(_mm_cvtsi128_si64(s)) + word_type(_mm_cvtsi128_si64(_mm_unpackhi_epi64(s, s)));
+}
+
+template <bool Signed>
+__attribute__((target("avx2"))) inline word_type dot(const word_type* const a, const word_type* const b, const std::size_t n) noexcept
+{
+    // 2 independent accumulators to hide the latency of the multiply
+    __m256i s0 = _mm256_setzero_si256();
+    __m256i s1 = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 4));
+        const __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 4));
+        s0 = _mm256_add_epi64(s0, multiply_lanes<Signed>(a0, b0));
+        s1 = _mm256_add_epi64(s1, multiply_lanes<Signed>(a1, b1));
+    }
+    return sum_lanes(_mm256_add_epi64(s0, s1)) + scalar::dot(a + i, b + i, n - i);
+}
+
+template <bool Signed>
+__attribute__((target("avx2"))) inline void multiply(word_type* const r, const word_type* const a, const word_type* const b, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), multiply_lanes<Signed>(x, y));
+    }
+    scalar::multiply(r + i, a + i, b + i, n - i);
+}
+
+template <bool Signed>
+__attribute__((target("avx2"))) inline void fir(word_type* const r, const word_type* const x, const word_type* const h, const std::size_t n, const std::size_t taps) noexcept
+{
+    // 16 outputs at a time in registers, each coefficient broadcast once per block
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i s0 = _mm256_setzero_si256();
+        __m256i s1 = _mm256_setzero_si256();
+        __m256i s2 = _mm256_setzero_si256();
+        __m256i s3 = _mm256_setzero_si256();
+        for (std::size_t j = 0; j < taps; ++j) {
+            const __m256i c = _mm256_set1_epi64x(static_cast<long long>(h[j]));
+            const word_type* const p = x + i + taps - 1 - j;
+            s0 = _mm256_add_epi64(s0, multiply_lanes<Signed>(c, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))));
+            s1 = _mm256_add_epi64(s1, multiply_lanes<Signed>(c, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 4))));
+            s2 = _mm256_add_epi64(s2, multiply_lanes<Signed>(c, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 8))));
+            s3 = _mm256_add_epi64(s3, multiply_lanes<Signed>(c, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 12))));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), s0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i + 4), s1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i + 8), s2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i + 12), s3);
+    }
+    scalar::fir(r + i, x + i, h, n - i, taps);
+}
+
+}
+
+#endif
+
+/** Returns the DSP kernels for the given level. The running CPU must support the level.
+
+    SSE2 has no signed 32-bit multiply into 64 bits, so levels below AVX2 use the scalar
+    kernels.
+    */
+inline const DspKernels& dsp_kernels(const Isa isa) noexcept
+{
+    static const DspKernels scalar_kernels {
+        scalar::dot, scalar::dot, scalar::multiply, scalar::multiply, scalar::fir, scalar::fir
+    };
+#if HDLTYPES_SIMD_X86
+    static const DspKernels avx2_kernels {
+        avx2::dot<true>, avx2::dot<false>, avx2::multiply<true>, avx2::multiply<false>,
+        avx2::fir<true>, avx2::fir<false>
+    };
+    switch (isa) {
+    case Isa::avx2:
+        return avx2_kernels;
+    case Isa::ssse3:
+    case Isa::sse2:
+    case Isa::scalar:
+        break;
+    }
+#else
+    (void)isa;
+#endif
+    return scalar_kernels;
+}
+
+/** Returns the best DSP kernels for the running CPU. */
+inline const DspKernels& dsp_kernels() noexcept
+{
+    static const DspKernels& kernels = dsp_kernels(detect_isa());
+    return kernels;
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef HDLTYPES_IMPL_INSTRUMENT_HPP
+#define HDLTYPES_IMPL_INSTRUMENT_HPP
+#include "hdltypes/instrument.hpp"
+
+#include <cassert>
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <string>  // string, to_string
+
+namespace hdltypes {
+
+inline std::uint64_t InstrumentCounters::calls(const InstrumentedOperation op) const noexcept
+{
+    return calls_[std::size_t(op)];
+}
+
+inline std::uint64_t InstrumentCounters::results(const InstrumentedOperation op, const unsigned value) const noexcept
+{
+    assert(value < instrumented_values);
+    return results_[std::size_t(op)][value];
+}
+
+inline std::uint64_t InstrumentCounters::results(const InstrumentedOperation op) const noexcept
+{
+    std::uint64_t n = 0;
+    for (const std::uint64_t r : results_[std::size_t(op)]) {
+        n += r;
+    }
+    return n;
+}
+
+inline void InstrumentCounters::add_call(const InstrumentedOperation op) noexcept
+{
+    ++calls_[std::size_t(op)];
+}
+
+inline void InstrumentCounters::add_results(const InstrumentedOperation op, const unsigned value, const std::uint64_t n) noexcept
+{
+    assert(value < instrumented_values);
+    results_[std::size_t(op)][value] += n;
+}
+
+inline void InstrumentCounters::reset() noexcept
+{
+    *this = InstrumentCounters();
+}
+
+inline InstrumentCounters& InstrumentCounters::operator+=(const InstrumentCounters& a) noexcept
+{
+    for (std::size_t op = 0; op < instrumented_operations; ++op) {
+        calls_[op] += a.calls_[op];
+        for (std::size_t value = 0; value < instrumented_values; ++value) {
+            results_[op][value] += a.results_[op][value];
+        }
+    }
+    return *this;
+}
+
+inline InstrumentCounters& instrument_counters() noexcept
+{
+    static thread_local InstrumentCounters counters;
+    return counters;
+}
+
+inline void reset_instrument_counters() noexcept
+{
+    instrument_counters().reset();
+}
+
+inline const char* to_string(const InstrumentedOperation op) noexcept
+{
+    static const char* const names[instrumented_operations] = {
+        "logic_and", "logic_or", "logic_xor", "logic_not", "logic_resolve",
+        "bit_and", "bit_or", "bit_xor", "bit_not",
+        "logic_vector", "bit_vector"
+    };
+    return names[std::size_t(op)];
+}
+
+inline std::string to_string(const InstrumentCounters& a)
+{
+    std::string s = "operation,calls,U,X,0,1,Z,W,L,H,-\n";
+    for (std::size_t op = 0; op < instrumented_operations; ++op) {
+        const InstrumentedOperation o = InstrumentedOperation(op);
+        s += to_string(o);
+        s += ',';
+        s += std::to_string(a.calls(o));
+        for (unsigned value = 0; value < instrumented_values; ++value) {
+            s += ',';
+            s += std::to_string(a.results(o, value));
+        }
+        s += '\n';
+    }
+    return s;
+}
+
+namespace detail {
+
+/** Counts a call of the operation with a result of the given Logic::value_type value. */
+inline void count_operation(const InstrumentedOperation op, const unsigned value) noexcept
+{
+    InstrumentCounters& counters = instrument_counters();
+    counters.add_call(op);
+    counters.add_results(op, value);
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,338 @@
+#ifndef HDLTYPES_IMPL_LANES_HPP
+#define HDLTYPES_IMPL_LANES_HPP
+#include "hdltypes/lanes.hpp"
+
+#include <cstddef>   // size_t
+#include <stdexcept> // invalid_argument, out_of_range
+
+#include "hdltypes/logic.hpp"  // Logic, Bit
+#include "hdltypes/packed.hpp" // LogicWord, broadcast, mask, mask01, tail_mask
+#include "hdltypes/utils.hpp"  // HDLTYPES_THROW
+
+namespace hdltypes {
+
+template <std::size_t N>
+constexpr LogicLanes<N>::LogicLanes() noexcept
+    : LogicLanes(Logic())
+{
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N>::LogicLanes(const Logic a) noexcept
+    : word_(packed::mask(packed::broadcast(a), packed::tail_mask(N)))
+{
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N>::LogicLanes(const packed::LogicWord& w) noexcept
+    : word_(packed::mask(w, packed::tail_mask(N)))
+{
+}
+
+template <std::size_t N>
+constexpr typename LogicLanes<N>::size_type LogicLanes<N>::lanes() noexcept
+{
+    return N;
+}
+
+template <std::size_t N>
+constexpr Logic LogicLanes<N>::operator[](const size_type lane) const noexcept
+{
+    return packed::get(word_, lane);
+}
+
+template <std::size_t N>
+constexpr Logic LogicLanes<N>::at(const size_type lane) const
+{
+    if (lane >= N) {
+        HDLTYPES_THROW(std::out_of_range("No such lane"));
+    }
+    return (*this)[lane];
+}
+
+template <std::size_t N>
+constexpr void LogicLanes<N>::set(const size_type lane, const Logic value)
+{
+    if (lane >= N) {
+        HDLTYPES_THROW(std::out_of_range("No such lane"));
+    }
+    packed::set(word_, lane, value);
+}
+
+template <std::size_t N>
+constexpr packed::LogicWord LogicLanes<N>::word() const noexcept
+{
+    return word_;
+}
+
+template <std::size_t N>
+constexpr BitLanes<N>::BitLanes(const Bit a) noexcept
+    : word_((a == '1'_b) ? packed::tail_mask(N) : packed::word_type(0))
+{
+}
+
+template <std::size_t N>
+constexpr BitLanes<N>::BitLanes(const packed::word_type w) noexcept
+    : word_(w & packed::tail_mask(N))
+{
+}
+
+template <std::size_t N>
+constexpr typename BitLanes<N>::size_type BitLanes<N>::lanes() noexcept
+{
+    return N;
+}
+
+template <std::size_t N>
+constexpr Bit BitLanes<N>::operator[](const size_type lane) const noexcept
+{
+    return to_bit(bool((word_ >> lane) & 1));
+}
+
+template <std::size_t N>
+constexpr Bit BitLanes<N>::at(const size_type lane) const
+{
+    if (lane >= N) {
+        HDLTYPES_THROW(std::out_of_range("No such lane"));
+    }
+    return (*this)[lane];
+}
+
+template <std::size_t N>
+constexpr void BitLanes<N>::set(const size_type lane, const Bit value)
+{
+    if (lane >= N) {
+        HDLTYPES_THROW(std::out_of_range("No such lane"));
+    }
+    const packed::word_type m = packed::word_type(1) << lane;
+    word_ = (value == '1'_b) ? (word_ | m) : (word_ & ~m);
+}
+
+template <std::size_t N>
+constexpr packed::word_type BitLanes<N>::word() const noexcept
+{
+    return word_;
+}
+
+template <std::size_t N>
+constexpr BitLanes<N>::BitLanes(const LogicLanes<N>& a)
+    : word_(a.word().value)
+{
+    if (~packed::mask01(a.word()) & packed::tail_mask(N)) {
+        HDLTYPES_THROW(std::invalid_argument("LogicLanes value cannot be converted to BitLanes"));
+    }
+}
+
+template <std::size_t N>
+constexpr BitLanes<N>::operator LogicLanes<N>() const noexcept
+{
+    return LogicLanes<N>(packed::LogicWord { 0, word_, 0, 0 });
+}
+
+template <std::size_t N>
+constexpr bool operator==(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept
+{
+    return a.word() == b.word();
+}
+
+template <std::size_t N>
+constexpr bool operator!=(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept
+{
+    return !(a == b);
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> operator&(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept
+{
+    return LogicLanes<N>(a.word() & b.word());
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> operator&(const Logic a, const LogicLanes<N>& b) noexcept
+{
+    return LogicLanes<N>(a) & b;
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> operator&(const BitLanes<N>& a, const LogicLanes<N>& b) noexcept
+{
+    return LogicLanes<N>(a) & b;
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N>& operator&=(LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept
+{
+    return (a = a & b);
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> operator|(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept
+{
+    return LogicLanes<N>(a.word() | b.word());
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> operator|(const Logic a, const LogicLanes<N>& b) noexcept
+{
+    return LogicLanes<N>(a) | b;
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> operator|(const BitLanes<N>& a, const LogicLanes<N>& b) noexcept
+{
+    return LogicLanes<N>(a) | b;
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N>& operator|=(LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept
+{
+    return (a = a | b);
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> operator^(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept
+{
+    return LogicLanes<N>(a.word() ^ b.word());
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> operator^(const Logic a, const LogicLanes<N>& b) noexcept
+{
+    return LogicLanes<N>(a) ^ b;
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> operator^(const BitLanes<N>& a, const LogicLanes<N>& b) noexcept
+{
+    return LogicLanes<N>(a) ^ b;
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N>& operator^=(LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept
+{
+    return (a = a ^ b);
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> operator~(const LogicLanes<N>& a) noexcept
+{
+    return LogicLanes<N>(~a.word());
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N>& inplace_invert(LogicLanes<N>& a) noexcept
+{
+    return (a = ~a);
+}
+
+template <std::size_t N>
+constexpr LogicLanes<N> resolve(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept
+{
+    return LogicLanes<N>(packed::resolve(a.word(), b.word()));
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> is01(const LogicLanes<N>& a) noexcept
+{
+    return BitLanes<N>(packed::mask01(a.word()));
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> to_bool(const LogicLanes<N>& a)
+{
+    return BitLanes<N>(a);
+}
+
+template <std::size_t N>
+constexpr bool operator==(const BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept
+{
+    return a.word() == b.word();
+}
+
+template <std::size_t N>
+constexpr bool operator!=(const BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept
+{
+    return !(a == b);
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> operator&(const BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept
+{
+    return BitLanes<N>(a.word() & b.word());
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> operator&(const Bit a, const BitLanes<N>& b) noexcept
+{
+    return BitLanes<N>(a) & b;
+}
+
+template <std::size_t N>
+constexpr BitLanes<N>& operator&=(BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept
+{
+    return (a = a & b);
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> operator|(const BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept
+{
+    return BitLanes<N>(a.word() | b.word());
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> operator|(const Bit a, const BitLanes<N>& b) noexcept
+{
+    return BitLanes<N>(a) | b;
+}
+
+template <std::size_t N>
+constexpr BitLanes<N>& operator|=(BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept
+{
+    return (a = a | b);
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> operator^(const BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept
+{
+    return BitLanes<N>(a.word() ^ b.word());
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> operator^(const Bit a, const BitLanes<N>& b) noexcept
+{
+    return BitLanes<N>(a) ^ b;
+}
+
+template <std::size_t N>
+constexpr BitLanes<N>& operator^=(BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept
+{
+    return (a = a ^ b);
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> operator~(const BitLanes<N>& a) noexcept
+{
+    return BitLanes<N>(~a.word());
+}
+
+template <std::size_t N>
+constexpr BitLanes<N>& inplace_invert(BitLanes<N>& a) noexcept
+{
+    return (a = ~a);
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> is01(const BitLanes<N>&) noexcept
+{
+    return BitLanes<N>('1'_b);
+}
+
+template <std::size_t N>
+constexpr BitLanes<N> to_bool(const BitLanes<N>& a) noexcept
+{
+    return a;
+}
+
+}
+
+#endif
@@ -0,0 +1,489 @@
+#ifndef HDLTYPES_IMPL_LIMBS_HPP
+#define HDLTYPES_IMPL_LIMBS_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <vector>  // vector
+
+#include "hdltypes/memory.hpp" // ResourceAllocator
+#include "hdltypes/packed.hpp" // word_type, word_bits
+
+namespace hdltypes {
+namespace limbs {
+
+/*
+  Kernels over little-endian arrays of 64-bit limbs, the storage of the arbitrary
+  precision integer types.
+
+  Operands shorter than the result are extended with a "fill" limb: 0 for unsigned and
+  non-negative values, all ones for negative values. The result may alias an operand.
+*/
+
+using limb_type = packed::word_type;
+
+constexpr std::size_t limb_bits = packed::word_bits;
+
+/** Array of scratch or temporary limbs, allocated from the default resource of the calling thread. */
+using limb_buffer = std::vector<limb_type, ResourceAllocator<limb_type>>;
+
+/** Fill limb of a value whose most significant limb is `top`, extended as a signed value. */
+constexpr limb_type sign_fill(const limb_type top) noexcept
+{
+    return (top >> (limb_bits - 1)) ? ~limb_type(0) : limb_type(0);
+}
+
+#if defined(__SIZEOF_INT128__)
+#define HDLTYPES_HAS_INT128 1
+/** Native integer twice the width of a limb. */
+__extension__ typedef unsigned __int128 wide_limb_type;
+#else
+#define HDLTYPES_HAS_INT128 0
+#endif
+
+/** Product of two limbs as a high and low limb. */
+constexpr void multiply_limbs(const limb_type a, const limb_type b, limb_type& hi, limb_type& lo) noexcept
+{
+#if HDLTYPES_HAS_INT128
+    const wide_limb_type p = wide_limb_type(a) * b;
+    hi = limb_type(p >> limb_bits);
+    lo = limb_type(p);
+#else
+    const limb_type a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+    const limb_type b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+    const limb_type ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+    const limb_type mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+    lo = (mid << 32) | (ll & 0xFFFFFFFF);
+    hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/** Number of `0` bits above the most significant `1` bit. `a` must not be 0. */
+inline unsigned count_leading_zeros(const limb_type a) noexcept
+{
+#if defined(__GNUC__)
+    return unsigned(__builtin_clzll(a));
+#else
+    unsigned n = 0;
+    for (limb_type m = limb_type(1) << (limb_bits - 1); (a & m) == 0; m >>= 1) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/** Divides the two-limb value `hi:lo` by `d`. `d` must have its top bit set and `hi < d`. The remainder is written to `remainder`. */
+inline limb_type divide_limbs(const limb_type hi, const limb_type lo, const limb_type d, limb_type& remainder) noexcept
+{
+#if HDLTYPES_HAS_INT128
+    const wide_limb_type n = (wide_limb_type(hi) << limb_bits) | lo;
+    remainder = limb_type(n % d);
+    return limb_type(n / d);
+#else
+    // Hacker's Delight divlu: two steps of dividing three half-limbs by two
+    const limb_type b = limb_type(1) << 32;
+    const limb_type d1 = d >> 32, d0 = d & 0xFFFFFFFF;
+    const limb_type n1 = lo >> 32, n0 = lo & 0xFFFFFFFF;
+    limb_type q1 = hi / d1, rhat = hi - q1 * d1;
+    while ((q1 >= b) || (q1 * d0 > b * rhat + n1)) {
+        --q1;
+        rhat += d1;
+        if (rhat >= b) {
+            break;
+        }
+    }
+    const limb_type n21 = hi * b + n1 - q1 * d;
+    limb_type q0 = n21 / d1;
+    rhat = n21 - q0 * d1;
+    while ((q0 >= b) || (q0 * d0 > b * rhat + n0)) {
+        --q0;
+        rhat += d1;
+        if (rhat >= b) {
+            break;
+        }
+    }
+    remainder = n21 * b + n0 - q0 * d;
+    return q1 * b + q0;
+#endif
+}
+
+/** Sum of two limbs and a carry of 0 or 1. The carry out is written to `carry`. */
+inline limb_type add_carry(const limb_type a, const limb_type b, limb_type& carry) noexcept
+{
+#if defined(__GNUC__)
+    limb_type s = 0;
+    const bool c1 = __builtin_add_overflow(a, b, &s);
+    const bool c2 = __builtin_add_overflow(s, carry, &s);
+    carry = limb_type(c1 || c2);
+    return s;
+#else
+    const limb_type t = a + b;
+    const limb_type s = t + carry;
+    carry = limb_type((t < a) || (s < t));
+    return s;
+#endif
+}
+
+/** Difference of two limbs and a borrow of 0 or 1. The borrow out is written to `borrow`. */
+inline limb_type sub_borrow(const limb_type a, const limb_type b, limb_type& borrow) noexcept
+{
+#if defined(__GNUC__)
+    limb_type d = 0;
+    const bool b1 = __builtin_sub_overflow(a, b, &d);
+    const bool b2 = __builtin_sub_overflow(d, borrow, &d);
+    borrow = limb_type(b1 || b2);
+    return d;
+#else
+    const limb_type t = a - b;
+    const limb_type d = t - borrow;
+    borrow = limb_type((a < b) || (t < borrow));
+    return d;
+#endif
+}
+
+/** `r = a + b` over `n` limbs, where `b` has `nb <= n` limbs extended with `b_fill`. Returns the carry out. */
+inline limb_type add(limb_type* const r, const limb_type* const a, const std::size_t n, const limb_type* const b, const std::size_t nb, const limb_type b_fill) noexcept
+{
+    limb_type carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = add_carry(a[i], (i < nb) ? b[i] : b_fill, carry);
+    }
+    return carry;
+}
+
+/** `r = a - b` over `n` limbs, where `b` has `nb <= n` limbs extended with `b_fill`. Returns the borrow out. */
+inline limb_type sub(limb_type* const r, const limb_type* const a, const std::size_t n, const limb_type* const b, const std::size_t nb, const limb_type b_fill) noexcept
+{
+    limb_type borrow = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = sub_borrow(a[i], (i < nb) ? b[i] : b_fill, borrow);
+    }
+    return borrow;
+}
+
+/** `r = -a` over `n` limbs. */
+inline void negate(limb_type* const r, const limb_type* const a, const std::size_t n) noexcept
+{
+    limb_type borrow = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = sub_borrow(0, a[i], borrow);
+    }
+}
+
+/** Three-way unsigned comparison of `a` and `b`, each extended with its fill limb to the longer length. */
+inline int compare(const limb_type* const a, const std::size_t na, const limb_type a_fill, const limb_type* const b, const std::size_t nb, const limb_type b_fill) noexcept
+{
+    for (std::size_t i = (na > nb) ? na : nb; i-- > 0;) {
+        const limb_type x = (i < na) ? a[i] : a_fill;
+        const limb_type y = (i < nb) ? b[i] : b_fill;
+        if (x != y) {
+            return (x < y) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+/** `r = a << shift` over `n` limbs, dropping bits shifted past the last limb. */
+inline void shift_left(limb_type* const r, const limb_type* const a, const std::size_t n, const std::size_t shift) noexcept
+{
+    const std::size_t ls = shift / limb_bits;
+    const std::size_t bs = shift % limb_bits;
+    // from the top so that r may alias a
+    for (std::size_t i = n; i-- > 0;) {
+        limb_type v = 0;
+        if (i >= ls) {
+            v = a[i - ls] << bs;
+            if ((bs != 0) && (i > ls)) {
+                v |= a[i - ls - 1] >> (limb_bits - bs);
+            }
+        }
+        r[i] = v;
+    }
+}
+
+/** `r = a >> shift` over `n` limbs, shifting in `fill` bits at the top. */
+inline void shift_right(limb_type* const r, const limb_type* const a, const std::size_t n, const std::size_t shift, const limb_type fill) noexcept
+{
+    const std::size_t ls = shift / limb_bits;
+    const std::size_t bs = shift % limb_bits;
+    for (std::size_t i = 0; i < n; ++i) {
+        const limb_type lo = (i + ls < n) ? a[i + ls] : fill;
+        const limb_type hi = (i + ls + 1 < n) ? a[i + ls + 1] : fill;
+        r[i] = (bs == 0) ? lo : ((lo >> bs) | (hi << (limb_bits - bs)));
+    }
+}
+
+/** `r += a * b` over `n` limbs. Returns the carry limb out. */
+inline limb_type add_multiply(limb_type* const r, const limb_type* const a, const std::size_t n, const limb_type b) noexcept
+{
+    limb_type carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        limb_type hi = 0, lo = 0;
+        multiply_limbs(a[i], b, hi, lo);
+        lo += carry;
+        hi += limb_type(lo < carry);
+        r[i] += lo;
+        hi += limb_type(r[i] < lo);
+        carry = hi;
+    }
+    return carry;
+}
+
+/** `r = a * b` by the schoolbook method. `r` has `na + nb` limbs and must not alias an operand. */
+inline void multiply_schoolbook(limb_type* const r, const limb_type* const a, const std::size_t na, const limb_type* const b, const std::size_t nb) noexcept
+{
+    for (std::size_t i = 0; i < na + nb; ++i) {
+        r[i] = 0;
+    }
+    for (std::size_t j = 0; j < nb; ++j) {
+        r[na + j] = add_multiply(r + j, a, na, b[j]);
+    }
+}
+
+/** Operand length, in limbs, from which multiply switches from the schoolbook method to Karatsuba. */
+constexpr std::size_t karatsuba_threshold = 32;
+
+/** Limbs of scratch used by multiply_karatsuba for operands of `n` limbs. */
+inline std::size_t karatsuba_scratch(std::size_t n) noexcept
+{
+    std::size_t size = 0;
+    while (n >= karatsuba_threshold) {
+        const std::size_t h = n - n / 2 + 1;
+        size += 4 * h;
+        n = h;
+    }
+    return size;
+}
+
+/** `r = a * b` for operands of `n` limbs by Karatsuba's method. `r` has `2n` limbs and must not alias an operand. */
+inline void multiply_karatsuba(limb_type* const r, const limb_type* const a, const limb_type* const b, const std::size_t n, limb_type* const scratch) noexcept
+{
+    if (n < karatsuba_threshold) {
+        multiply_schoolbook(r, a, n, b, n);
+        return;
+    }
+    // a = a1*B^lo + a0, where a0 has the low `lo` limbs and a1 the high `hi >= lo` limbs
+    const std::size_t lo = n / 2;
+    const std::size_t hi = n - lo;
+    limb_type* const sa = scratch;
+    limb_type* const sb = sa + hi + 1;
+    limb_type* const mid = sb + hi + 1;
+    limb_type* const next = mid + 2 * (hi + 1);
+
+    // z0 = a0*b0 and z2 = a1*b1 go straight into the low and high halves of r
+    multiply_karatsuba(r, a, b, lo, next);
+    multiply_karatsuba(r + 2 * lo, a + lo, b + lo, hi, next);
+
+    // z1 = (a0 + a1)(b0 + b1) - z0 - z2
+    sa[hi] = add(sa, a + lo, hi, a, lo, 0);
+    sb[hi] = add(sb, b + lo, hi, b, lo, 0);
+    multiply_karatsuba(mid, sa, sb, hi + 1, next);
+    sub(mid, mid, 2 * (hi + 1), r, 2 * lo, 0);
+    sub(mid, mid, 2 * (hi + 1), r + 2 * lo, 2 * hi, 0);
+
+    // z1 is at most 2*hi + 1 limbs; the product fits in r so the final carry is dropped
+    add(r + lo, r + lo, n + hi, mid, 2 * hi + 1, 0);
+}
+
+/** Limbs of scratch used by multiply for operands of `na` and `nb` limbs. */
+inline std::size_t multiply_scratch(const std::size_t na, const std::size_t nb) noexcept
+{
+    const std::size_t n = (na < nb) ? na : nb;
+    const std::size_t m = (na < nb) ? nb : na;
+    if (n < karatsuba_threshold) {
+        return 0;
+    }
+    if (n == m) {
+        return karatsuba_scratch(n);
+    }
+    const std::size_t tail = multiply_scratch(n, m % n);
+    const std::size_t chunk = karatsuba_scratch(n);
+    return 2 * n + ((tail > chunk) ? tail : chunk);
+}
+
+/** `r = a * b`, choosing the method by operand length. `r` has `na + nb` limbs and must not alias an operand. */
+inline void multiply(limb_type* const r, const limb_type* const a, const std::size_t na, const limb_type* const b, const std::size_t nb, limb_type* const scratch) noexcept
+{
+    if (na < nb) {
+        multiply(r, b, nb, a, na, scratch);
+        return;
+    }
+    if (nb < karatsuba_threshold) {
+        multiply_schoolbook(r, a, na, b, nb);
+        return;
+    }
+    if (na == nb) {
+        multiply_karatsuba(r, a, b, na, scratch);
+        return;
+    }
+    // split the longer operand into chunks as long as the shorter one
+    limb_type* const product = scratch;
+    for (std::size_t i = 0; i < na + nb; ++i) {
+        r[i] = 0;
+    }
+    for (std::size_t i = 0; i < na; i += nb) {
+        const std::size_t len = (na - i < nb) ? na - i : nb;
+        if (len == nb) {
+            multiply_karatsuba(product, a + i, b, nb, scratch + 2 * nb);
+        } else {
+            multiply(product, b, nb, a + i, len, scratch + 2 * nb);
+        }
+        add(r + i, r + i, na + nb - i, product, len + nb, 0);
+    }
+}
+
+/** `r = a * b`, allocating any scratch needed. */
+inline void multiply(limb_type* const r, const limb_type* const a, const std::size_t na, const limb_type* const b, const std::size_t nb)
+{
+    limb_buffer scratch(multiply_scratch(na, nb));
+    multiply(r, a, na, b, nb, scratch.data());
+}
+
+/** `q = a / d` over `n` limbs for a single limb divisor `d != 0`. Returns the remainder. `q` may alias `a`. */
+inline limb_type divide_limb(limb_type* const q, const limb_type* const a, const std::size_t n, const limb_type d) noexcept
+{
+    if (n == 0) {
+        return 0;
+    }
+    // normalize so the top bit of the divisor is set, shifting the dividend as it is read
+    const unsigned s = count_leading_zeros(d);
+    const limb_type dn = d << s;
+    limb_type r = (s == 0) ? 0 : (a[n - 1] >> (limb_bits - s));
+    for (std::size_t i = n; i-- > 0;) {
+        const limb_type u = (s == 0 || i == 0) ? (a[i] << s) : ((a[i] << s) | (a[i - 1] >> (limb_bits - s)));
+        q[i] = divide_limbs(r, u, dn, r);
+    }
+    return r >> s;
+}
+
+/** Limbs of scratch used by divide for operands of `na` and `nb` limbs. */
+constexpr std::size_t divide_scratch(const std::size_t na, const std::size_t nb) noexcept
+{
+    return na + 1 + nb;
+}
+
+/** Knuth's Algorithm D: `q = a / b` and `r = a % b`
+
+    `b` has `nb >= 2` limbs with a non-zero top limb and `na >= nb`. `q` has `na - nb + 1`
+    limbs and `r` has `nb` limbs; neither may alias an operand.
+    */
+inline void divide(limb_type* const q, limb_type* const r, const limb_type* const a, const std::size_t na, const limb_type* const b, const std::size_t nb, limb_type* const scratch) noexcept
+{
+    // D1: normalize so the top bit of the divisor is set
+    const unsigned s = count_leading_zeros(b[nb - 1]);
+    limb_type* const u = scratch;
+    limb_type* const v = scratch + na + 1;
+    shift_left(v, b, nb, s);
+    u[na] = (s == 0) ? 0 : (a[na - 1] >> (limb_bits - s));
+    shift_left(u, a, na, s);
+
+    const limb_type v1 = v[nb - 1];
+    const limb_type v2 = v[nb - 2];
+    for (std::size_t j = na - nb + 1; j-- > 0;) {
+        // D3: estimate the quotient limb from the top two limbs, correct to at most one too large
+        limb_type qhat = 0, rhat = 0;
+        bool rhat_overflow = false;
+        if (u[j + nb] >= v1) {
+            qhat = ~limb_type(0);
+            rhat = u[j + nb - 1] + v1;
+            rhat_overflow = (rhat < v1);
+        } else {
+            qhat = divide_limbs(u[j + nb], u[j + nb - 1], v1, rhat);
+        }
+        while (!rhat_overflow) {
+            limb_type p_hi = 0, p_lo = 0;
+            multiply_limbs(qhat, v2, p_hi, p_lo);
+            if ((p_hi < rhat) || ((p_hi == rhat) && (p_lo <= u[j + nb - 2]))) {
+                break;
+            }
+            --qhat;
+            rhat += v1;
+            rhat_overflow = (rhat < v1);
+        }
+
+        // D4: multiply and subtract
+        limb_type carry = 0, borrow = 0;
+        for (std::size_t i = 0; i < nb; ++i) {
+            limb_type p_hi = 0, p_lo = 0;
+            multiply_limbs(qhat, v[i], p_hi, p_lo);
+            p_lo += carry;
+            p_hi += limb_type(p_lo < carry);
+            carry = p_hi;
+            u[j + i] = sub_borrow(u[j + i], p_lo, borrow);
+        }
+        u[j + nb] = sub_borrow(u[j + nb], carry, borrow);
+
+        // D6: add back in the rare case the estimate was one too large
+        if (borrow != 0) {
+            --qhat;
+            limb_type c = 0;
+            for (std::size_t i = 0; i < nb; ++i) {
+                u[j + i] = add_carry(u[j + i], v[i], c);
+            }
+            u[j + nb] += c;
+        }
+        q[j] = qhat;
+    }
+
+    // D8: unnormalize the remainder
+    shift_right(r, u, nb, s, 0);
+    if (s != 0) {
+        r[nb - 1] |= u[nb] << (limb_bits - s);
+    }
+}
+
+/** `-m^-1 mod 2^64` for an odd limb `m`, the Montgomery reduction constant. */
+constexpr limb_type montgomery_inverse(const limb_type m) noexcept
+{
+    // Newton's iteration doubles the correct low bits each step, starting from 3
+    limb_type x = m;
+    for (int i = 0; i < 5; ++i) {
+        x *= 2 - m * x;
+    }
+    return 0 - x;
+}
+
+/** Limbs of scratch used by montgomery_multiply for a modulus of `n` limbs. */
+constexpr std::size_t montgomery_scratch(const std::size_t n) noexcept
+{
+    return n + 2;
+}
+
+/** Montgomery product `r = a * b * 2^(-64n) mod m`
+
+    Coarsely integrated operand scanning over `n` limbs. `a` and `b` must be less than the
+    odd modulus `m` and `inverse` must be montgomery_inverse of its low limb. `r` may alias
+    an operand.
+    */
+inline void montgomery_multiply(limb_type* const r, const limb_type* const a, const limb_type* const b, const limb_type* const m, const std::size_t n, const limb_type inverse, limb_type* const scratch) noexcept
+{
+    limb_type* const t = scratch;
+    for (std::size_t i = 0; i < n + 2; ++i) {
+        t[i] = 0;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        limb_type carry = 0;
+        t[n] = add_carry(t[n], add_multiply(t, a, n, b[i]), carry);
+        t[n + 1] = carry;
+        const limb_type k = t[0] * inverse;
+        carry = 0;
+        t[n] = add_carry(t[n], add_multiply(t, m, n, k), carry);
+        t[n + 1] += carry;
+        // t is now divisible by 2^64
+        for (std::size_t j = 0; j <= n; ++j) {
+            t[j] = t[j + 1];
+        }
+        t[n + 1] = 0;
+    }
+    if ((t[n] != 0) || (compare(t, n, 0, m, n, 0) >= 0)) {
+        sub(r, t, n, m, n, 0);
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            r[i] = t[i];
+        }
+    }
+}
+
+}
+}
+
+#endif
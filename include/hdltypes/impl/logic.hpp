@@ -3,11 +3,17 @@
 #include "hdltypes/logic.hpp"
 
 #include <cassert>
-#include <cstdint>     // uint8_t
+#include <cstddef>     // size_t
+#include <cstdint>     // uint8_t, uint64_t
+#include <cstring>     // memcpy
 #include <stdexcept>   // invalid_argument
-#include <type_traits> // enable_if, is_same
+#include <type_traits> // enable_if, is_same, is_trivially_copyable
 
-#include "hdltypes/utils.hpp" // is_char_type, is_integer_type
+#include "hdltypes/utils.hpp" // is_char_type, is_integer_type, HDLTYPES_THROW
+
+#if defined(HDLTYPES_INSTRUMENT) && HDLTYPES_INSTRUMENT
+#include "hdltypes/instrument.hpp" // InstrumentedOperation, count_operation
+#endif
 
 namespace hdltypes {
 
@@ -29,42 +35,55 @@ constexpr Logic::Logic(const value_type value) noexcept
 }
 
 template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
-constexpr Logic to_logic(const CharType& c)
+constexpr bool try_to_logic(const CharType& c, Logic& r) noexcept
 {
     switch (c) {
     case 'U':
-        return Logic(Logic::U);
     case 'u':
-        return Logic(Logic::U);
+        r = Logic(Logic::U);
+        return true;
     case 'X':
-        return Logic(Logic::X);
     case 'x':
-        return Logic(Logic::X);
+        r = Logic(Logic::X);
+        return true;
     case '0':
-        return Logic(Logic::_0);
+        r = Logic(Logic::_0);
+        return true;
     case '1':
-        return Logic(Logic::_1);
+        r = Logic(Logic::_1);
+        return true;
     case 'Z':
-        return Logic(Logic::Z);
     case 'z':
-        return Logic(Logic::Z);
+        r = Logic(Logic::Z);
+        return true;
     case 'W':
-        return Logic(Logic::W);
     case 'w':
-        return Logic(Logic::W);
+        r = Logic(Logic::W);
+        return true;
     case 'L':
-        return Logic(Logic::L);
     case 'l':
-        return Logic(Logic::L);
+        r = Logic(Logic::L);
+        return true;
     case 'H':
-        return Logic(Logic::H);
     case 'h':
-        return Logic(Logic::H);
+        r = Logic(Logic::H);
+        return true;
     case '-':
-        return Logic(Logic::DC);
+        r = Logic(Logic::DC);
+        return true;
     default:
-        throw std::invalid_argument("Given value is not a Logic");
+        return false;
+    }
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+constexpr Logic to_logic(const CharType& c)
+{
+    Logic r;
+    if (!try_to_logic(c, r)) {
+        HDLTYPES_THROW(std::invalid_argument("Given value is not a Logic"));
     }
+    return r;
 }
 
 constexpr Logic::value_type Logic::value() const noexcept
@@ -88,18 +107,30 @@ constexpr Logic operator""_l(const char c)
 }
 
 template <typename IntType, typename std::enable_if<is_integer_type<IntType>::value, int>::type>
-constexpr Logic to_logic(const IntType& i)
+constexpr bool try_to_logic(const IntType& i, Logic& r) noexcept
 {
     switch (i) {
     case 0:
-        return '0'_l;
+        r = '0'_l;
+        return true;
     case 1:
-        return '1'_l;
+        r = '1'_l;
+        return true;
     default:
-        throw std::invalid_argument("Given value is not a Logic");
+        return false;
     }
 }
 
+template <typename IntType, typename std::enable_if<is_integer_type<IntType>::value, int>::type>
+constexpr Logic to_logic(const IntType& i)
+{
+    Logic r;
+    if (!try_to_logic(i, r)) {
+        HDLTYPES_THROW(std::invalid_argument("Given value is not a Logic"));
+    }
+    return r;
+}
+
 constexpr Logic to_logic(const bool b) noexcept
 {
     return b ? '1'_l : '0'_l;
@@ -120,7 +151,9 @@ constexpr bool operator!=(const Logic a, const Logic b) noexcept
     return a.value() != b.value();
 }
 
-constexpr Logic operator&(const Logic a, const Logic b) noexcept
+namespace detail {
+
+constexpr Logic logic_and_table(const Logic a, const Logic b) noexcept
 {
     constexpr Logic table[9][9] = {
         { 'U'_l, 'U'_l, '0'_l, 'U'_l, 'U'_l, 'U'_l, '0'_l, 'U'_l, 'U'_l }, // U
@@ -137,12 +170,7 @@ constexpr Logic operator&(const Logic a, const Logic b) noexcept
     return table[int(a.value())][int(b.value())];
 }
 
-constexpr Logic& operator&=(Logic& a, const Logic b) noexcept
-{
-    return (a = a & b);
-}
-
-constexpr Logic operator|(const Logic a, const Logic b) noexcept
+constexpr Logic logic_or_table(const Logic a, const Logic b) noexcept
 {
     constexpr Logic table[9][9] = {
         { 'U'_l, 'U'_l, 'U'_l, '1'_l, 'U'_l, 'U'_l, 'U'_l, '1'_l, 'U'_l }, // U
@@ -159,12 +187,7 @@ constexpr Logic operator|(const Logic a, const Logic b) noexcept
     return table[int(a.value())][int(b.value())];
 }
 
-constexpr Logic& operator|=(Logic& a, const Logic b) noexcept
-{
-    return (a = a | b);
-}
-
-constexpr Logic operator^(const Logic a, const Logic b) noexcept
+constexpr Logic logic_xor_table(const Logic a, const Logic b) noexcept
 {
     constexpr Logic table[9][9] = {
         { 'U'_l, 'U'_l, 'U'_l, 'U'_l, 'U'_l, 'U'_l, 'U'_l, 'U'_l, 'U'_l }, // U
@@ -181,6 +204,124 @@ constexpr Logic operator^(const Logic a, const Logic b) noexcept
     return table[int(a.value())][int(b.value())];
 }
 
+constexpr Logic logic_not_table(const Logic a) noexcept
+{
+    constexpr Logic table[9] = {
+        'U'_l, 'X'_l, '1'_l, '0'_l, 'X'_l, 'X'_l, '1'_l, '0'_l, 'X'_l
+    };
+    //   U      X      0      1      Z      W      L      H      -
+    return table[int(a.value())];
+}
+
+/*
+  The ordering of Logic::value_type puts `0`, `1`, `L`, and `H` at 2, 3, 6, and 7: the
+  only values with bit 1 set, with the logical value in bit 0. `U` is 0. The operators
+  only yield `U`, `X`, `0`, or `1`, so each is a few bit operations on the value that
+  compilers can vectorize over arrays, rather than a table lookup.
+*/
+
+/** 1 if the value is `0`, `1`, `L`, or `H`. */
+constexpr unsigned logic_known(const Logic a) noexcept
+{
+    return (unsigned(a.value()) >> 1) & 1;
+}
+
+/** 1 if the value is `U`. */
+constexpr unsigned logic_unassigned(const Logic a) noexcept
+{
+    return unsigned(a.value() == Logic::U);
+}
+
+/** Result of an operation: `0` or `1` if either is set, else `U` if unassigned, else `X`. */
+constexpr Logic logic_result(const unsigned zero, const unsigned one, const unsigned unassigned) noexcept
+{
+    return Logic(Logic::value_type(((zero | one) << 1) | one | (~(zero | one | unassigned) & 1)));
+}
+
+constexpr Logic logic_and_formula(const Logic a, const Logic b) noexcept
+{
+    const unsigned ka = logic_known(a), kb = logic_known(b);
+    const unsigned va = unsigned(a.value()) & 1, vb = unsigned(b.value()) & 1;
+    const unsigned zero = (ka & ~va) | (kb & ~vb);
+    return logic_result(zero, ka & va & kb & vb, logic_unassigned(a) | logic_unassigned(b));
+}
+
+constexpr Logic logic_or_formula(const Logic a, const Logic b) noexcept
+{
+    const unsigned ka = logic_known(a), kb = logic_known(b);
+    const unsigned va = unsigned(a.value()) & 1, vb = unsigned(b.value()) & 1;
+    const unsigned one = (ka & va) | (kb & vb);
+    return logic_result(ka & ~va & kb & ~vb, one, logic_unassigned(a) | logic_unassigned(b));
+}
+
+constexpr Logic logic_xor_formula(const Logic a, const Logic b) noexcept
+{
+    const unsigned known = logic_known(a) & logic_known(b);
+    const unsigned v = (unsigned(a.value()) ^ unsigned(b.value())) & 1;
+    return logic_result(known & ~v, known & v, logic_unassigned(a) | logic_unassigned(b));
+}
+
+constexpr Logic logic_not_formula(const Logic a) noexcept
+{
+    const unsigned k = logic_known(a);
+    const unsigned v = unsigned(a.value()) & 1;
+    return logic_result(k & v, k & ~v, logic_unassigned(a));
+}
+
+}
+
+#if defined(HDLTYPES_INSTRUMENT) && HDLTYPES_INSTRUMENT
+
+namespace detail {
+
+/** Returns the result of an operation, counting it if the operation is not evaluated at compile time. */
+constexpr Logic counted(const InstrumentedOperation op, const Logic r) noexcept
+{
+    if (!HDLTYPES_CONSTANT_EVALUATED()) {
+        count_operation(op, r.value());
+    }
+    return r;
+}
+
+}
+
+/** The result `r` of the operation `op`, counted in instrument_counters(). */
+#define HDLTYPES_COUNTED(op, r) detail::counted(InstrumentedOperation::op, r)
+#else
+#define HDLTYPES_COUNTED(op, r) (r)
+#endif
+
+#if HDLTYPES_LOGIC_TABLES
+#define HDLTYPES_LOGIC_OPERATION(kind) detail::logic_##kind##_table
+#else
+#define HDLTYPES_LOGIC_OPERATION(kind) detail::logic_##kind##_formula
+#endif
+
+constexpr Logic operator&(const Logic a, const Logic b) noexcept
+{
+    return HDLTYPES_COUNTED(logic_and, HDLTYPES_LOGIC_OPERATION(and)(a, b));
+}
+
+constexpr Logic& operator&=(Logic& a, const Logic b) noexcept
+{
+    return (a = a & b);
+}
+
+constexpr Logic operator|(const Logic a, const Logic b) noexcept
+{
+    return HDLTYPES_COUNTED(logic_or, HDLTYPES_LOGIC_OPERATION(or)(a, b));
+}
+
+constexpr Logic& operator|=(Logic& a, const Logic b) noexcept
+{
+    return (a = a | b);
+}
+
+constexpr Logic operator^(const Logic a, const Logic b) noexcept
+{
+    return HDLTYPES_COUNTED(logic_xor, HDLTYPES_LOGIC_OPERATION(xor)(a, b));
+}
+
 constexpr Logic& operator^=(Logic& a, const Logic b) noexcept
 {
     return (a = a ^ b);
@@ -188,38 +329,78 @@ constexpr Logic& operator^=(Logic& a, const Logic b) noexcept
 
 constexpr Logic operator~(const Logic a) noexcept
 {
-    constexpr Logic table[9] = {
-        'U'_l, 'X'_l, '1'_l, '0'_l, 'X'_l, 'X'_l, '1'_l, '0'_l, 'X'_l
-    };
-    //   U      X      0      1      Z      W      L      H      -
-    return table[int(a.value())];
+    return HDLTYPES_COUNTED(logic_not, HDLTYPES_LOGIC_OPERATION(not)(a));
 }
 
+#undef HDLTYPES_LOGIC_OPERATION
+
 constexpr Logic& inplace_invert(Logic& a) noexcept
 {
     return (a = ~a);
 }
 
+constexpr Logic resolve(const Logic a, const Logic b) noexcept
+{
+    constexpr Logic table[9][9] = {
+        { 'U'_l, 'U'_l, 'U'_l, 'U'_l, 'U'_l, 'U'_l, 'U'_l, 'U'_l, 'U'_l }, // U
+        { 'U'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l }, // X
+        { 'U'_l, 'X'_l, '0'_l, 'X'_l, '0'_l, '0'_l, '0'_l, '0'_l, 'X'_l }, // 0
+        { 'U'_l, 'X'_l, 'X'_l, '1'_l, '1'_l, '1'_l, '1'_l, '1'_l, 'X'_l }, // 1
+        { 'U'_l, 'X'_l, '0'_l, '1'_l, 'Z'_l, 'W'_l, 'L'_l, 'H'_l, 'X'_l }, // Z
+        { 'U'_l, 'X'_l, '0'_l, '1'_l, 'W'_l, 'W'_l, 'W'_l, 'W'_l, 'X'_l }, // W
+        { 'U'_l, 'X'_l, '0'_l, '1'_l, 'L'_l, 'W'_l, 'L'_l, 'W'_l, 'X'_l }, // L
+        { 'U'_l, 'X'_l, '0'_l, '1'_l, 'H'_l, 'W'_l, 'W'_l, 'H'_l, 'X'_l }, // H
+        { 'U'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l }  // -
+    };
+    //     U      X      0      1      Z      W      L      H      -
+    return HDLTYPES_COUNTED(logic_resolve, table[int(a.value())][int(b.value())]);
+}
+
+constexpr Logic resolve(const Logic* const drivers, const std::size_t n) noexcept
+{
+    Logic r = 'Z'_l;
+    for (std::size_t i = 0; (i < n) && (r != 'U'_l); ++i) {
+        r = resolve(r, drivers[i]);
+    }
+    return r;
+}
+
 constexpr bool is01(const Logic a) noexcept
 {
     return (a == '0'_l) || (a == '1'_l);
 }
 
 template <typename IntType>
-constexpr IntType to_int(const Logic a)
+constexpr bool try_to_int(const Logic a, IntType& r) noexcept
 {
     if (a == '0'_l) {
-        return 0;
+        r = 0;
     } else if (a == '1'_l) {
-        return 1;
+        r = 1;
     } else {
-        throw std::invalid_argument("Logic value cannot be converted to an integer.");
+        return false;
+    }
+    return true;
+}
+
+template <typename IntType>
+constexpr IntType to_int(const Logic a)
+{
+    IntType r = 0;
+    if (!try_to_int(a, r)) {
+        HDLTYPES_THROW(std::invalid_argument("Logic value cannot be converted to an integer."));
     }
+    return r;
+}
+
+constexpr bool try_to_bool(const Logic a, bool& r) noexcept
+{
+    return try_to_int(a, r);
 }
 
 constexpr bool to_bool(const Logic a)
 {
-    return to_int(a);
+    return to_int<bool>(a);
 }
 
 namespace {
@@ -238,18 +419,30 @@ constexpr Bit::Bit(const value_type value) noexcept
 }
 
 template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
-constexpr Bit to_bit(const CharType& c)
+constexpr bool try_to_bit(const CharType& c, Bit& r) noexcept
 {
     switch (c) {
     case '0':
-        return Bit(Bit::_0);
+        r = Bit(Bit::_0);
+        return true;
     case '1':
-        return Bit(Bit::_1);
+        r = Bit(Bit::_1);
+        return true;
     default:
-        throw std::invalid_argument("Given value is not a Bit");
+        return false;
     }
 }
 
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+constexpr Bit to_bit(const CharType& c)
+{
+    Bit r;
+    if (!try_to_bit(c, r)) {
+        HDLTYPES_THROW(std::invalid_argument("Given value is not a Bit"));
+    }
+    return r;
+}
+
 constexpr Bit::value_type Bit::value() const noexcept
 {
     assert(bit_value_valid(value_));
@@ -267,15 +460,25 @@ constexpr Bit operator""_b(const char c)
     return to_bit(c);
 }
 
-constexpr Bit to_bit(const Logic a)
+constexpr bool try_to_bit(const Logic a, Bit& r) noexcept
 {
     if (a == '0'_l) {
-        return '0'_b;
+        r = '0'_b;
     } else if (a == '1'_l) {
-        return '1'_b;
+        r = '1'_b;
     } else {
-        throw std::invalid_argument("Logic value cannot be converted to Bit");
+        return false;
     }
+    return true;
+}
+
+constexpr Bit to_bit(const Logic a)
+{
+    Bit r;
+    if (!try_to_bit(a, r)) {
+        HDLTYPES_THROW(std::invalid_argument("Logic value cannot be converted to Bit"));
+    }
+    return r;
 }
 
 constexpr Logic to_logic(const Bit a) noexcept
@@ -303,16 +506,28 @@ constexpr Bit to_bit(const bool b) noexcept
 }
 
 template <typename IntType, typename std::enable_if<is_integer_type<IntType>::value, int>::type>
-constexpr Bit to_bit(const IntType& i)
+constexpr bool try_to_bit(const IntType& i, Bit& r) noexcept
 {
     switch (i) {
     case 0:
-        return '0'_b;
+        r = '0'_b;
+        return true;
     case 1:
-        return '1'_b;
+        r = '1'_b;
+        return true;
     default:
-        throw std::invalid_argument("Given value is not a Bit");
+        return false;
+    }
+}
+
+template <typename IntType, typename std::enable_if<is_integer_type<IntType>::value, int>::type>
+constexpr Bit to_bit(const IntType& i)
+{
+    Bit r;
+    if (!try_to_bit(i, r)) {
+        HDLTYPES_THROW(std::invalid_argument("Given value is not a Bit"));
     }
+    return r;
 }
 
 constexpr Bit to_bit(const Bit a) noexcept
@@ -330,9 +545,26 @@ constexpr bool operator!=(const Bit a, const Bit b) noexcept
     return a.value() != b.value();
 }
 
+#if defined(HDLTYPES_INSTRUMENT) && HDLTYPES_INSTRUMENT
+
+namespace detail {
+
+/** Returns the result of an operation, counting it as a Logic `0` or `1` if the operation is not evaluated at compile time. */
+constexpr Bit counted(const InstrumentedOperation op, const Bit r) noexcept
+{
+    if (!HDLTYPES_CONSTANT_EVALUATED()) {
+        count_operation(op, (r == '1'_b) ? Logic::_1 : Logic::_0);
+    }
+    return r;
+}
+
+}
+
+#endif
+
 constexpr Bit operator&(const Bit a, const Bit b) noexcept
 {
-    return to_bit((a == '1'_b) && (b == '1'_b));
+    return HDLTYPES_COUNTED(bit_and, to_bit((a == '1'_b) && (b == '1'_b)));
 }
 
 constexpr Bit& operator&=(Bit& a, const Bit b) noexcept
@@ -342,7 +574,7 @@ constexpr Bit& operator&=(Bit& a, const Bit b) noexcept
 
 constexpr Bit operator|(const Bit a, const Bit b) noexcept
 {
-    return to_bit((a == '1'_b) || (b == '1'_b));
+    return HDLTYPES_COUNTED(bit_or, to_bit((a == '1'_b) || (b == '1'_b)));
 }
 
 constexpr Bit& operator|=(Bit& a, const Bit b) noexcept
@@ -352,7 +584,7 @@ constexpr Bit& operator|=(Bit& a, const Bit b) noexcept
 
 constexpr Bit operator^(const Bit a, const Bit b) noexcept
 {
-    return to_bit(a != b);
+    return HDLTYPES_COUNTED(bit_xor, to_bit(a != b));
 }
 
 constexpr Bit& operator^=(Bit& a, const Bit b) noexcept
@@ -362,7 +594,7 @@ constexpr Bit& operator^=(Bit& a, const Bit b) noexcept
 
 constexpr Bit operator~(const Bit a) noexcept
 {
-    return to_bit(a == '0'_b);
+    return HDLTYPES_COUNTED(bit_not, to_bit(a == '0'_b));
 }
 
 constexpr Bit& inplace_invert(Bit& a) noexcept
@@ -386,6 +618,52 @@ constexpr bool to_bool(const Bit a) noexcept
     return to_int(a);
 }
 
+namespace detail {
+
+static_assert((sizeof(Logic) == 1) && (sizeof(Bit) == 1), "Logic and Bit values are single bytes");
+static_assert(std::is_trivially_copyable<Logic>::value && std::is_trivially_copyable<Bit>::value, "Logic and Bit values can be copied as bytes");
+
+/** Bytes of a word that are not the values of Logic `0` or `1`; those are `2` and `3`. */
+inline uint64_t non01_bytes(const Logic* const a) noexcept
+{
+    uint64_t x;
+    std::memcpy(&x, a, sizeof(x));
+    return (x & ~0x0101010101010101ULL) ^ 0x0202020202020202ULL;
+}
+
+}
+
+inline std::size_t validate01(const Logic* const a, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    while ((i + 8 <= n) && !detail::non01_bytes(a + i)) {
+        i += 8;
+    }
+    while ((i < n) && is01(a[i])) {
+        ++i;
+    }
+    return i;
 }
 
+inline std::size_t convert01(const Logic* const a, const std::size_t n, Bit* const out) noexcept
+{
+    std::size_t i = 0;
+    while ((i + 8 <= n) && !detail::non01_bytes(a + i)) {
+        // Logic `0` and `1` are 2 and 3, Bit `0` and `1` are 0 and 1
+        uint64_t x;
+        std::memcpy(&x, a + i, sizeof(x));
+        x -= 0x0202020202020202ULL;
+        std::memcpy(static_cast<void*>(out + i), &x, sizeof(x));
+        i += 8;
+    }
+    while ((i < n) && try_to_bit(a[i], out[i])) {
+        ++i;
+    }
+    return i;
+}
+
+}
+
+#undef HDLTYPES_COUNTED
+
 #endif
@@ -0,0 +1,148 @@
+#ifndef HDLTYPES_IMPL_LOGIC_LUT_HPP
+#define HDLTYPES_IMPL_LOGIC_LUT_HPP
+#include "hdltypes/logic_lut.hpp"
+
+#include <cstddef> // size_t
+#include <utility> // index_sequence, make_index_sequence
+
+#include "hdltypes/logic.hpp"        // Logic
+#include "hdltypes/logic_vector.hpp" // LogicVector, check_lengths
+#include "hdltypes/packed.hpp"       // LogicWord, word_type, word_bits, encode, get, set, mask, tail_mask
+
+namespace hdltypes {
+
+namespace detail {
+
+constexpr std::size_t lut_entries(const std::size_t arity) noexcept
+{
+    return (arity == 0) ? 1 : 9 * lut_entries(arity - 1);
+}
+
+}
+
+template <std::size_t Arity>
+template <typename Function>
+constexpr LogicLut<Arity>::LogicLut(Function f)
+{
+    for (size_type index = 0; index < size(); ++index) {
+        table_[index] = call(f, index, std::make_index_sequence<Arity>());
+    }
+
+    // tabulate the 0/1 entries by plane; argument 0 is the most significant bit of c
+    for (size_type c = 0; c < (size_type(1) << Arity); ++c) {
+        size_type index = 0;
+        for (size_type n = 0; n < Arity; ++n) {
+            index = index * 9 + size_type(((c >> (Arity - 1 - n)) & 1) ? Logic::_1 : Logic::_0);
+        }
+        const unsigned code = packed::encode(table_[index]);
+        for (size_type p = 0; p < packed::logic_planes; ++p) {
+            minterms_[p] |= packed::word_type((code >> p) & 1) << c;
+        }
+    }
+}
+
+template <std::size_t Arity>
+constexpr typename LogicLut<Arity>::size_type LogicLut<Arity>::arity() noexcept
+{
+    return Arity;
+}
+
+template <std::size_t Arity>
+constexpr typename LogicLut<Arity>::size_type LogicLut<Arity>::size() noexcept
+{
+    return detail::lut_entries(Arity);
+}
+
+template <std::size_t Arity>
+template <typename... Args, detail::enable_if_arguments_t<detail::is_logic_convertible, Arity, Args...>>
+constexpr Logic LogicLut<Arity>::operator()(Args... args) const noexcept
+{
+    const Logic values[] = { Logic(args)... };
+    size_type index = 0;
+    for (const Logic a : values) {
+        index = index * 9 + size_type(a.value());
+    }
+    return table_[index];
+}
+
+template <std::size_t Arity>
+template <typename... Args, detail::enable_if_arguments_t<detail::is_logic_vector, Arity, Args...>>
+LogicVector LogicLut<Arity>::operator()(const Args&... args) const
+{
+    const LogicVector* const operands[] = { &args... };
+    bool all01 = true;
+    for (const LogicVector* const a : operands) {
+        detail::check_lengths(operands[0]->length(), a->length());
+        all01 = all01 && a->is01();
+    }
+
+    LogicVector r(operands[0]->bounds());
+    const size_type words = r.words();
+    for (size_type i = 0; i < words; ++i) {
+        const packed::word_type tail = (i + 1 == words) ? packed::tail_mask(r.length()) : ~packed::word_type(0);
+        packed::LogicWord w {};
+        if (all01) {
+            // sum-of-products over the value planes, 64 elements at a time
+            packed::word_type planes[packed::logic_planes] = {};
+            for (size_type c = 0; c < (size_type(1) << Arity); ++c) {
+                packed::word_type m = ~packed::word_type(0);
+                for (size_type n = 0; n < Arity; ++n) {
+                    const packed::word_type v = operands[n]->plane(1)[i];
+                    m &= ((c >> (Arity - 1 - n)) & 1) ? v : ~v;
+                }
+                for (size_type p = 0; p < packed::logic_planes; ++p) {
+                    planes[p] |= (packed::word_type(0) - ((minterms_[p] >> c) & 1)) & m;
+                }
+            }
+            w = packed::LogicWord { planes[0], planes[1], planes[2], planes[3] };
+        } else {
+            packed::LogicWord in[Arity];
+            for (size_type n = 0; n < Arity; ++n) {
+                in[n] = operands[n]->word(i);
+            }
+            const size_type count = (i + 1 == words) ? r.length() - i * packed::word_bits : packed::word_bits;
+            for (size_type bit = 0; bit < count; ++bit) {
+                size_type index = 0;
+                for (size_type n = 0; n < Arity; ++n) {
+                    index = index * 9 + size_type(packed::get(in[n], bit).value());
+                }
+                packed::set(w, bit, table_[index]);
+            }
+        }
+        r.set_word(i, packed::mask(w, tail));
+    }
+    return r;
+}
+
+template <std::size_t Arity>
+template <typename... Args, detail::enable_if_arguments_t<detail::is_logic, Arity, Args...>>
+void LogicLut<Arity>::apply(Logic* const r, const size_type n, const Args*... args) const noexcept
+{
+    for (size_type i = 0; i < n; ++i) {
+        r[i] = (*this)(args[i]...);
+    }
+}
+
+template <std::size_t Arity>
+template <typename Function, std::size_t... I>
+constexpr Logic LogicLut<Arity>::call(Function& f, const size_type index, std::index_sequence<I...>)
+{
+    return Logic(f(argument(index, I)...));
+}
+
+template <std::size_t Arity>
+constexpr Logic LogicLut<Arity>::argument(const size_type index, const size_type n) noexcept
+{
+    // argument 0 is the most significant digit of the index
+    return Logic(Logic::value_type((index / detail::lut_entries(Arity - 1 - n)) % 9));
+}
+
+template <std::size_t Arity, typename Function>
+constexpr LogicLut<Arity> make_logic_lut(Function f)
+{
+    return LogicLut<Arity>(f);
+}
+
+}
+
+#endif
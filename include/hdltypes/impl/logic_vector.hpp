@@ -0,0 +1,414 @@
+#ifndef HDLTYPES_IMPL_LOGIC_VECTOR_HPP
+#define HDLTYPES_IMPL_LOGIC_VECTOR_HPP
+#include "hdltypes/logic_vector.hpp"
+
+#include <algorithm>   // fill
+#include <cassert>
+#include <cstddef>     // size_t
+#include <stdexcept>   // invalid_argument, out_of_range
+#include <string>      // basic_string
+#include <type_traits> // enable_if
+#include <utility>     // move
+
+#include "hdltypes/bounds.hpp"            // Bounds
+#include "hdltypes/impl/simd.hpp"         // word_kernels
+#include "hdltypes/impl/text_kernels.hpp" // pack_logic_chars, unpack_logic_chars
+#include "hdltypes/instrument.hpp"        // instrument_counters
+#include "hdltypes/logic.hpp"             // Logic
+#include "hdltypes/packed.hpp"            // LogicWord
+#include "hdltypes/utils.hpp"             // is_char_type, HDLTYPES_THROW
+
+namespace hdltypes {
+
+namespace detail {
+
+inline void check_lengths(const std::size_t a, const std::size_t b)
+{
+    if (a != b) {
+        HDLTYPES_THROW(std::invalid_argument("Array lengths do not match"));
+    }
+}
+
+/** Counts the evaluation of an expression into the array, and the values of its elements, if HDLTYPES_INSTRUMENT is 1. */
+inline void count_evaluation(const LogicVector& a) noexcept
+{
+#if HDLTYPES_INSTRUMENT
+    InstrumentCounters& counters = instrument_counters();
+    counters.add_call(InstrumentedOperation::logic_vector);
+    for (std::size_t n = 0; n < a.words(); ++n) {
+        const packed::LogicWord w = a.word(n);
+        const packed::word_type used = (n + 1 == a.words()) ? packed::tail_mask(a.length()) : ~packed::word_type(0);
+        for (unsigned value = 0; value < instrumented_values; ++value) {
+            const unsigned code = packed::encode(Logic(Logic::value_type(value)));
+            const packed::word_type m = used
+                & ((code & 1) ? w.unknown : ~w.unknown)
+                & ((code & 2) ? w.value : ~w.value)
+                & ((code & 4) ? w.weak : ~w.weak)
+                & ((code & 8) ? w.unassigned : ~w.unassigned);
+            counters.add_results(InstrumentedOperation::logic_vector, value, simd::scalar::popcount(m));
+        }
+    }
+#else
+    (void)a;
+#endif
+}
+
+}
+
+inline LogicVector::LogicVector(const Bounds bounds, const Logic init, const allocator_type& alloc)
+    : bounds_(bounds)
+    , words_per_plane_(packed::word_count(bounds.length()))
+    , words_(packed::logic_planes * packed::word_count(bounds.length()), alloc)
+{
+    fill(init);
+}
+
+inline LogicVector::LogicVector(const size_type length, const Logic init, const allocator_type& alloc)
+    : LogicVector(downto(Bounds::index_type(length) - 1, 0), init, alloc)
+{
+}
+
+template <typename Operation, typename A, typename B>
+LogicVector::LogicVector(const LogicVectorExpression<Operation, A, B>& e, const allocator_type& alloc)
+    : bounds_(e.bounds())
+    , words_per_plane_(e.words())
+    , words_(packed::logic_planes * e.words(), alloc)
+{
+    assign(e);
+}
+
+inline LogicVector::LogicVector(const LogicVector& a, const allocator_type& alloc)
+    : bounds_(a.bounds_)
+    , words_per_plane_(a.words_per_plane_)
+    , words_(a.words_, alloc)
+    , non01_(a.non01_)
+{
+}
+
+inline LogicVector::LogicVector(LogicVector&& a, const allocator_type& alloc)
+    : bounds_(a.bounds_)
+    , words_per_plane_(a.words_per_plane_)
+    , words_(std::move(a.words_), alloc)
+    , non01_(a.non01_)
+{
+}
+
+template <typename Operation, typename A, typename B>
+LogicVector& LogicVector::operator=(const LogicVectorExpression<Operation, A, B>& e)
+{
+    // a view of this array at other positions would read elements already written
+    if ((e.length() != length()) || e.aliases(this, 0, 1)) {
+        return (*this = LogicVector(e, get_allocator()));
+    }
+    assign(e);
+    bounds_ = e.bounds();
+    return *this;
+}
+
+template <typename Expression>
+void LogicVector::assign(const Expression& e) noexcept
+{
+    // each word of the result depends only on the same word of the operands, so the expression may refer to this
+    // array as long as it reads each element at its own position
+    if (e.is01()) {
+        word_type* const values = words_.data() + words_per_plane_;
+        e.evaluate_values(values);
+        if (words_per_plane_ != 0) {
+            values[words_per_plane_ - 1] &= packed::tail_mask(length());
+        }
+        std::fill(words_.data(), values, word_type(0));
+        std::fill(values + words_per_plane_, words_.data() + words_.size(), word_type(0));
+        non01_ = 0;
+    } else {
+        size_type non01 = 0;
+        for (size_type i = 0; i < words_per_plane_; ++i) {
+            non01 += simd::scalar::popcount(store_word(i, e.word(i)));
+        }
+        non01_ = non01;
+    }
+    detail::count_evaluation(*this);
+}
+
+inline LogicVector::allocator_type LogicVector::get_allocator() const noexcept
+{
+    return words_.get_allocator();
+}
+
+inline Bounds LogicVector::bounds() const noexcept
+{
+    return bounds_;
+}
+
+inline LogicVector::index_type LogicVector::left() const noexcept
+{
+    return bounds_.left();
+}
+
+inline LogicVector::index_type LogicVector::right() const noexcept
+{
+    return bounds_.right();
+}
+
+inline Direction LogicVector::direction() const noexcept
+{
+    return bounds_.direction();
+}
+
+inline LogicVector::index_type LogicVector::low() const noexcept
+{
+    return bounds_.low();
+}
+
+inline LogicVector::index_type LogicVector::high() const noexcept
+{
+    return bounds_.high();
+}
+
+inline LogicVector::size_type LogicVector::length() const noexcept
+{
+    return bounds_.length();
+}
+
+inline bool LogicVector::is01() const noexcept
+{
+    return non01_ == 0;
+}
+
+inline Logic LogicVector::operator[](const index_type index) const noexcept
+{
+    const size_type offset = bounds_.offset(index);
+    return packed::get(word(offset / packed::word_bits), offset % packed::word_bits);
+}
+
+inline Logic LogicVector::at(const index_type index) const
+{
+    if (!bounds_.contains(index)) {
+        HDLTYPES_THROW(std::out_of_range("Index is not in the bounds of the array"));
+    }
+    return (*this)[index];
+}
+
+inline void LogicVector::set(const index_type index, const Logic value)
+{
+    if (!bounds_.contains(index)) {
+        HDLTYPES_THROW(std::out_of_range("Index is not in the bounds of the array"));
+    }
+    const size_type offset = bounds_.offset(index);
+    auto w = word(offset / packed::word_bits);
+    packed::set(w, offset % packed::word_bits, value);
+    set_word(offset / packed::word_bits, w);
+}
+
+inline void LogicVector::fill(const Logic value) noexcept
+{
+    const auto w = packed::broadcast(value);
+    for (size_type i = 0; i < words_per_plane_; ++i) {
+        store_word(i, w);
+    }
+    non01_ = hdltypes::is01(value) ? 0 : length();
+}
+
+inline LogicVector::size_type LogicVector::words() const noexcept
+{
+    return words_per_plane_;
+}
+
+inline packed::LogicWord LogicVector::word(const size_type n) const noexcept
+{
+    assert(n < words_per_plane_);
+    const word_type* const p = words_.data() + n;
+    return packed::LogicWord {
+        p[0 * words_per_plane_],
+        p[1 * words_per_plane_],
+        p[2 * words_per_plane_],
+        p[3 * words_per_plane_]
+    };
+}
+
+inline void LogicVector::set_word(const size_type n, const packed::LogicWord& w) noexcept
+{
+    // bits past the end of the array are stored as `0`
+    const word_type before = ~packed::mask01(word(n));
+    const word_type after = store_word(n, w);
+    if (before != after) {
+        non01_ = non01_ + simd::scalar::popcount(after) - simd::scalar::popcount(before);
+    }
+}
+
+inline const LogicVector::word_type* LogicVector::plane(const size_type p) const noexcept
+{
+    assert(p < packed::logic_planes);
+    return words_.data() + p * words_per_plane_;
+}
+
+inline LogicVector::PlaneWriter LogicVector::write_planes() noexcept
+{
+    return PlaneWriter(*this);
+}
+
+inline void LogicVector::recount() noexcept
+{
+    size_type non01 = 0;
+    for (size_type i = 0; i < words_per_plane_; ++i) {
+        non01 += simd::scalar::popcount(~packed::mask01(word(i)) & ((i + 1 == words_per_plane_) ? packed::tail_mask(length()) : ~word_type(0)));
+    }
+    non01_ = non01;
+}
+
+inline LogicVector::PlaneWriter::PlaneWriter(LogicVector& a) noexcept
+    : a_(&a)
+{
+}
+
+inline LogicVector::PlaneWriter::PlaneWriter(PlaneWriter&& a) noexcept
+    : a_(a.a_)
+{
+    a.a_ = nullptr;
+}
+
+inline LogicVector::PlaneWriter::~PlaneWriter()
+{
+    if (a_ != nullptr) {
+        a_->recount();
+    }
+}
+
+inline LogicVector::word_type* LogicVector::PlaneWriter::plane(const size_type p) const noexcept
+{
+    assert(p < packed::logic_planes);
+    return a_->words_.data() + p * a_->words_per_plane_;
+}
+
+inline LogicVector::word_type LogicVector::store_word(const size_type n, const packed::LogicWord& w) noexcept
+{
+    assert(n < words_per_plane_);
+    const auto m = (n + 1 == words_per_plane_) ? packed::tail_mask(length()) : ~word_type(0);
+    word_type* const p = words_.data() + n;
+    p[0 * words_per_plane_] = w.unknown & m;
+    p[1 * words_per_plane_] = w.value & m;
+    p[2 * words_per_plane_] = w.weak & m;
+    p[3 * words_per_plane_] = w.unassigned & m;
+    return ~packed::mask01(w) & m;
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+LogicVector to_logic_vector(const CharType* const str, const std::size_t length)
+{
+    LogicVector r(length);
+    if (detail::pack_logic_chars(str, length, r.write_planes().plane(0), r.words()) != length) {
+        HDLTYPES_THROW(std::invalid_argument("Given value is not a Logic"));
+    }
+    return r;
+}
+
+template <typename CharType>
+LogicVector to_logic_vector(const std::basic_string<CharType>& str)
+{
+    return to_logic_vector(str.data(), str.size());
+}
+
+inline LogicVector operator""_lv(const char* const str, const std::size_t length)
+{
+    return to_logic_vector(str, length);
+}
+
+template <typename CharType>
+std::basic_string<CharType> to_string(const LogicVector& a)
+{
+    std::basic_string<CharType> r(a.length(), CharType());
+    detail::unpack_logic_chars(a.plane(0), a.words(), a.length(), &r[0]);
+    return r;
+}
+
+inline bool is01(const LogicVector& a) noexcept
+{
+    return a.is01();
+}
+
+inline bool operator==(const LogicVector& a, const LogicVector& b) noexcept
+{
+    if (a.length() != b.length()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        if (a.word(i) != b.word(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool operator!=(const LogicVector& a, const LogicVector& b) noexcept
+{
+    return !(a == b);
+}
+
+inline LogicVector& inplace_invert(LogicVector& a) noexcept
+{
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        a.set_word(i, ~a.word(i));
+    }
+    return a;
+}
+
+namespace detail {
+
+/** Result of a reduction in which no element dominated: `U` if any element is `U`, `X` if any is otherwise unknown. */
+inline Logic reduce_unknowns(const LogicVector& a, const Logic otherwise) noexcept
+{
+    const auto& kernels = simd::word_kernels();
+    if (a.is01()) {
+        return otherwise;
+    } else if (kernels.any_ones(a.plane(3), a.words())) {
+        return 'U'_l;
+    } else if (kernels.any_ones(a.plane(0), a.words())) {
+        return 'X'_l;
+    }
+    return otherwise;
+}
+
+}
+
+inline Logic and_reduce(const LogicVector& a) noexcept
+{
+    if (a.is01()) {
+        const std::size_t n = a.words();
+        const bool all = (n == 0) || (simd::word_kernels().all_ones(a.plane(1), n - 1) && (a.plane(1)[n - 1] == packed::tail_mask(a.length())));
+        return all ? '1'_l : '0'_l;
+    }
+    // '0' and 'L' dominate, padding bits read as '0' so are masked off the last word
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        const packed::LogicWord w = a.word(i);
+        const packed::word_type m = (i + 1 == a.words()) ? packed::tail_mask(a.length()) : ~packed::word_type(0);
+        if ((~(w.unknown | w.value) & m) != 0) {
+            return '0'_l;
+        }
+    }
+    return detail::reduce_unknowns(a, '1'_l);
+}
+
+inline Logic or_reduce(const LogicVector& a) noexcept
+{
+    if (a.is01()) {
+        return simd::word_kernels().any_ones(a.plane(1), a.words()) ? '1'_l : '0'_l;
+    }
+    // '1' and 'H' dominate
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        const packed::LogicWord w = a.word(i);
+        if ((w.value & ~w.unknown) != 0) {
+            return '1'_l;
+        }
+    }
+    return detail::reduce_unknowns(a, '0'_l);
+}
+
+inline Logic xor_reduce(const LogicVector& a) noexcept
+{
+    // the value plane of known elements is 1 exactly for '1' and 'H'
+    const bool parity = bool(simd::word_kernels().popcount(a.plane(1), a.words()) & 1);
+    return detail::reduce_unknowns(a, parity ? '1'_l : '0'_l);
+}
+
+}
+
+#endif
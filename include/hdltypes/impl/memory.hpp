@@ -0,0 +1,278 @@
+#ifndef HDLTYPES_IMPL_MEMORY_HPP
+#define HDLTYPES_IMPL_MEMORY_HPP
+#include "hdltypes/memory.hpp"
+
+#include <cstddef> // size_t, max_align_t
+#include <cstdint> // uintptr_t
+#include <new>     // operator new, operator delete, bad_alloc, bad_array_new_length
+
+#include "hdltypes/utils.hpp" // HDLTYPES_THROW
+
+namespace hdltypes {
+
+#if !HDLTYPES_STD_MEMORY_RESOURCE
+
+inline void* MemoryResource::allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    return do_allocate(bytes, alignment);
+}
+
+inline void MemoryResource::deallocate(void* const p, const std::size_t bytes, const std::size_t alignment)
+{
+    do_deallocate(p, bytes, alignment);
+}
+
+inline bool MemoryResource::is_equal(const MemoryResource& other) const noexcept
+{
+    return do_is_equal(other);
+}
+
+inline bool operator==(const MemoryResource& a, const MemoryResource& b) noexcept
+{
+    return (&a == &b) || a.is_equal(b);
+}
+
+inline bool operator!=(const MemoryResource& a, const MemoryResource& b) noexcept
+{
+    return !(a == b);
+}
+
+namespace detail {
+
+/** Allocates with the global `operator new`; alignments above that of `std::max_align_t` are not supported before C++17. */
+class NewDeleteResource : public MemoryResource {
+
+private: // overrides
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        if (alignment > alignof(std::max_align_t)) {
+            HDLTYPES_THROW(std::bad_alloc());
+        }
+        return ::operator new(bytes);
+    }
+
+    void do_deallocate(void* const p, std::size_t, std::size_t) override
+    {
+        ::operator delete(p);
+    }
+
+    bool do_is_equal(const MemoryResource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+}
+
+inline MemoryResource* new_delete_resource() noexcept
+{
+    static detail::NewDeleteResource resource;
+    return &resource;
+}
+
+#else
+
+inline MemoryResource* new_delete_resource() noexcept
+{
+    return std::pmr::new_delete_resource();
+}
+
+#endif
+
+namespace detail {
+
+/** The default resource of the calling thread. */
+inline MemoryResource*& thread_resource_slot() noexcept
+{
+    static thread_local MemoryResource* resource = new_delete_resource();
+    return resource;
+}
+
+}
+
+inline MemoryResource* thread_resource() noexcept
+{
+    return detail::thread_resource_slot();
+}
+
+inline MemoryResource* set_thread_resource(MemoryResource* const r) noexcept
+{
+    MemoryResource* const previous = detail::thread_resource_slot();
+    detail::thread_resource_slot() = (r != nullptr) ? r : new_delete_resource();
+    return previous;
+}
+
+inline ResourceScope::ResourceScope(MemoryResource& r) noexcept
+    : previous_(set_thread_resource(&r))
+{
+}
+
+inline ResourceScope::~ResourceScope()
+{
+    set_thread_resource(previous_);
+}
+
+template <typename T>
+ResourceAllocator<T>::ResourceAllocator() noexcept
+    : resource_(thread_resource())
+{
+}
+
+template <typename T>
+ResourceAllocator<T>::ResourceAllocator(MemoryResource* const r) noexcept
+    : resource_(r)
+{
+}
+
+template <typename T>
+template <typename U>
+ResourceAllocator<T>::ResourceAllocator(const ResourceAllocator<U>& a) noexcept
+    : resource_(a.resource())
+{
+}
+
+template <typename T>
+T* ResourceAllocator<T>::allocate(const std::size_t n)
+{
+    if (n > ~std::size_t(0) / sizeof(T)) {
+        HDLTYPES_THROW(std::bad_array_new_length());
+    }
+    return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+}
+
+template <typename T>
+void ResourceAllocator<T>::deallocate(T* const p, const std::size_t n) noexcept
+{
+    resource_->deallocate(p, n * sizeof(T), alignof(T));
+}
+
+template <typename T>
+ResourceAllocator<T> ResourceAllocator<T>::select_on_container_copy_construction() const noexcept
+{
+    return ResourceAllocator();
+}
+
+template <typename T>
+MemoryResource* ResourceAllocator<T>::resource() const noexcept
+{
+    return resource_;
+}
+
+template <typename T, typename U>
+bool operator==(const ResourceAllocator<T>& a, const ResourceAllocator<U>& b) noexcept
+{
+    return (a.resource() == b.resource()) || a.resource()->is_equal(*b.resource());
+}
+
+template <typename T, typename U>
+bool operator!=(const ResourceAllocator<T>& a, const ResourceAllocator<U>& b) noexcept
+{
+    return !(a == b);
+}
+
+/** Header of a block of an arena; the memory handed out follows it. */
+struct ArenaResource::Block {
+    Block* next;
+    size_type size;
+};
+
+inline ArenaResource::ArenaResource(const size_type block_size, MemoryResource* const upstream) noexcept
+    : upstream_(upstream)
+    , block_size_(block_size)
+    , next_size_(block_size)
+{
+}
+
+inline ArenaResource::~ArenaResource()
+{
+    release();
+}
+
+inline MemoryResource* ArenaResource::upstream_resource() const noexcept
+{
+    return upstream_;
+}
+
+inline ArenaResource::size_type ArenaResource::capacity() const noexcept
+{
+    return capacity_;
+}
+
+inline void ArenaResource::reset() noexcept
+{
+    if (first_ != nullptr) {
+        use(first_);
+    }
+}
+
+inline void ArenaResource::release() noexcept
+{
+    for (Block* block = first_; block != nullptr;) {
+        Block* const next = block->next;
+        upstream_->deallocate(block, block->size, alignof(std::max_align_t));
+        block = next;
+    }
+    first_ = nullptr;
+    current_ = nullptr;
+    cursor_ = nullptr;
+    end_ = nullptr;
+    capacity_ = 0;
+    next_size_ = block_size_;
+}
+
+inline void* ArenaResource::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    for (;;) {
+        if (current_ != nullptr) {
+            const std::uintptr_t cursor = reinterpret_cast<std::uintptr_t>(cursor_);
+            const std::size_t padding = std::size_t(((cursor + (alignment - 1)) & ~std::uintptr_t(alignment - 1)) - cursor);
+            const std::size_t available = std::size_t(end_ - cursor_);
+            if ((padding <= available) && (bytes <= available - padding)) {
+                char* const p = cursor_ + padding;
+                cursor_ = p + bytes;
+                return p;
+            }
+            // blocks kept by reset() are reused in order before new ones are added
+            if (current_->next != nullptr) {
+                use(current_->next);
+                continue;
+            }
+        }
+
+        if (bytes > ~std::size_t(0) - sizeof(Block) - alignment) {
+            HDLTYPES_THROW(std::bad_alloc());
+        }
+        const size_type needed = sizeof(Block) + bytes + alignment;
+        const size_type size = (next_size_ < needed) ? needed : next_size_;
+        Block* const block = ::new (upstream_->allocate(size, alignof(std::max_align_t))) Block { nullptr, size };
+        if (current_ != nullptr) {
+            current_->next = block;
+        } else {
+            first_ = block;
+        }
+        capacity_ += size;
+        next_size_ = (size <= ~size_type(0) / 2) ? 2 * size : size;
+        use(block);
+    }
+}
+
+inline void ArenaResource::do_deallocate(void*, std::size_t, std::size_t)
+{
+    // memory is freed all at once by reset() or release()
+}
+
+inline bool ArenaResource::do_is_equal(const MemoryResource& other) const noexcept
+{
+    return this == &other;
+}
+
+inline void ArenaResource::use(Block* const block) noexcept
+{
+    current_ = block;
+    cursor_ = reinterpret_cast<char*>(block) + sizeof(Block);
+    end_ = reinterpret_cast<char*>(block) + block->size;
+}
+
+}
+
+#endif
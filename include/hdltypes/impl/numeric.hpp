@@ -0,0 +1,1034 @@
+#ifndef HDLTYPES_IMPL_NUMERIC_HPP
+#define HDLTYPES_IMPL_NUMERIC_HPP
+#include "hdltypes/numeric.hpp"
+
+#include <algorithm> // copy, fill, min, max
+#include <cassert>
+#include <cstddef>   // size_t
+#include <stdexcept> // domain_error, invalid_argument, out_of_range
+#include <utility>   // move
+
+#include "hdltypes/impl/limbs.hpp" // add, sub, compare, shift_left, shift_right, multiply, divide, montgomery_multiply
+#include "hdltypes/packed.hpp"     // word_count, tail_mask
+#include "hdltypes/utils.hpp"      // HDLTYPES_THROW
+
+namespace hdltypes {
+
+namespace detail {
+
+inline LimbStorage::LimbStorage() noexcept
+    : inline_ {}
+{
+}
+
+inline LimbStorage::LimbStorage(const size_type width, const allocator_type& alloc)
+    : width_(width)
+    , alloc_(alloc)
+    , inline_ {}
+{
+    if (!is_inline()) {
+        heap_ = alloc_.allocate(size());
+        std::fill(heap_, heap_ + size(), limb_type(0));
+    }
+}
+
+inline LimbStorage::LimbStorage(const LimbStorage& other)
+    : LimbStorage(other, allocator_type())
+{
+}
+
+inline LimbStorage::LimbStorage(const LimbStorage& other, const allocator_type& alloc)
+    : width_(other.width_)
+    , alloc_(alloc)
+    , inline_ {}
+{
+    if (is_inline()) {
+        std::copy(other.inline_, other.inline_ + inline_limbs, inline_);
+    } else {
+        heap_ = alloc_.allocate(size());
+        std::copy(other.heap_, other.heap_ + size(), heap_);
+    }
+}
+
+inline LimbStorage::LimbStorage(LimbStorage&& other) noexcept
+    : width_(other.width_)
+    , alloc_(other.alloc_)
+    , inline_ {}
+{
+    if (is_inline()) {
+        std::copy(other.inline_, other.inline_ + inline_limbs, inline_);
+    } else {
+        heap_ = other.heap_;
+        other.width_ = 0;
+        other.inline_[0] = 0;
+        other.inline_[1] = 0;
+    }
+}
+
+inline LimbStorage::LimbStorage(LimbStorage&& other, const allocator_type& alloc)
+    : width_(other.width_)
+    , alloc_(alloc)
+    , inline_ {}
+{
+    if (is_inline()) {
+        std::copy(other.inline_, other.inline_ + inline_limbs, inline_);
+    } else if (alloc_ == other.alloc_) {
+        heap_ = other.heap_;
+        other.width_ = 0;
+        other.inline_[0] = 0;
+        other.inline_[1] = 0;
+    } else {
+        heap_ = alloc_.allocate(size());
+        std::copy(other.heap_, other.heap_ + size(), heap_);
+    }
+}
+
+inline LimbStorage& LimbStorage::operator=(const LimbStorage& other)
+{
+    if (this == &other) {
+        return *this;
+    }
+    if (!is_inline() && !other.is_inline() && (size() == other.size())) {
+        // reuse the allocation
+        width_ = other.width_;
+        std::copy(other.heap_, other.heap_ + size(), heap_);
+        return *this;
+    }
+    LimbStorage copy(other, alloc_);
+    return (*this = std::move(copy));
+}
+
+inline LimbStorage& LimbStorage::operator=(LimbStorage&& other)
+{
+    if (this == &other) {
+        return *this;
+    }
+    if (!other.is_inline() && (alloc_ != other.alloc_)) {
+        // the allocator is kept, so the limbs can not be taken from another resource
+        return (*this = static_cast<const LimbStorage&>(other));
+    }
+    release();
+    width_ = other.width_;
+    if (is_inline()) {
+        std::copy(other.inline_, other.inline_ + inline_limbs, inline_);
+    } else {
+        heap_ = other.heap_;
+        other.width_ = 0;
+        other.inline_[0] = 0;
+        other.inline_[1] = 0;
+    }
+    return *this;
+}
+
+inline LimbStorage::~LimbStorage()
+{
+    release();
+}
+
+inline void LimbStorage::release() noexcept
+{
+    if (!is_inline()) {
+        alloc_.deallocate(heap_, size());
+    }
+    width_ = 0;
+    inline_[0] = 0;
+    inline_[1] = 0;
+}
+
+inline LimbStorage::allocator_type LimbStorage::get_allocator() const noexcept
+{
+    return alloc_;
+}
+
+inline LimbStorage::size_type LimbStorage::width() const noexcept
+{
+    return width_;
+}
+
+inline LimbStorage::size_type LimbStorage::size() const noexcept
+{
+    return packed::word_count(width_);
+}
+
+inline bool LimbStorage::is_inline() const noexcept
+{
+    return size() <= inline_limbs;
+}
+
+inline const LimbStorage::limb_type* LimbStorage::data() const noexcept
+{
+    return is_inline() ? inline_ : heap_;
+}
+
+inline LimbStorage::limb_type* LimbStorage::data() noexcept
+{
+    return is_inline() ? inline_ : heap_;
+}
+
+inline void check_widths(const std::size_t a, const std::size_t b)
+{
+    if (a != b) {
+        HDLTYPES_THROW(std::invalid_argument("Widths do not match"));
+    }
+}
+
+/** Sign-extends the top limb of a value of the given width from its sign bit. */
+constexpr limbs::limb_type sign_extend(const limbs::limb_type top, const std::size_t width) noexcept
+{
+    return ((top & packed::tail_mask(width)) ^ (limbs::limb_type(1) << ((width - 1) % limbs::limb_bits))) - (limbs::limb_type(1) << ((width - 1) % limbs::limb_bits));
+}
+
+/** Limb that extends a value past its top limb. */
+inline limbs::limb_type fill(const Unsigned&) noexcept
+{
+    return 0;
+}
+
+/** \copydoc fill(const Unsigned&) */
+inline limbs::limb_type fill(const Signed& a) noexcept
+{
+    return (a.limbs() == 0) ? 0 : limbs::sign_fill(a.limb(a.limbs() - 1));
+}
+
+/** Restores the padding of the top limb after kernels wrote the limbs directly. */
+template <typename T>
+void normalize(T& a) noexcept
+{
+    if (a.limbs() != 0) {
+        a.set_limb(a.limbs() - 1, a.limb(a.limbs() - 1));
+    }
+}
+
+/** Copies the value into a new width, extending with the fill limb or dropping high bits. */
+template <typename T>
+T resize_limbs(const T& a, const std::size_t width)
+{
+    T r(width);
+    const std::size_t n = std::min(a.limbs(), r.limbs());
+    std::copy(a.data(), a.data() + n, r.data());
+    std::fill(r.data() + n, r.data() + r.limbs(), fill(a));
+    normalize(r);
+    return r;
+}
+
+/** `a += b`, where `b` is `nb` limbs extended with `b_fill`, wrapping to the width of `a`. */
+template <typename T>
+T& add_assign(T& a, const limbs::limb_type* const b, const std::size_t nb, const limbs::limb_type b_fill) noexcept
+{
+    if (a.limbs() == 1) {
+        a.set_limb(0, a.limb(0) + ((nb != 0) ? b[0] : b_fill));
+    } else {
+        limbs::add(a.data(), a.data(), a.limbs(), b, std::min(nb, a.limbs()), b_fill);
+        normalize(a);
+    }
+    return a;
+}
+
+/** `a -= b`, where `b` is `nb` limbs extended with `b_fill`, wrapping to the width of `a`. */
+template <typename T>
+T& sub_assign(T& a, const limbs::limb_type* const b, const std::size_t nb, const limbs::limb_type b_fill) noexcept
+{
+    if (a.limbs() == 1) {
+        a.set_limb(0, a.limb(0) - ((nb != 0) ? b[0] : b_fill));
+    } else {
+        limbs::sub(a.data(), a.data(), a.limbs(), b, std::min(nb, a.limbs()), b_fill);
+        normalize(a);
+    }
+    return a;
+}
+
+template <typename T>
+T add(const T& a, const T& b)
+{
+    // addition commutes, so start from a copy of the wider operand
+    const bool a_wider = (a.width() >= b.width());
+    T r(a_wider ? a : b);
+    const T& n = a_wider ? b : a;
+    return add_assign(r, n.data(), n.limbs(), fill(n));
+}
+
+template <typename T>
+T sub(const T& a, const T& b)
+{
+    T r = (a.width() >= b.width()) ? a : resize_limbs(a, b.width());
+    return sub_assign(r, b.data(), b.limbs(), fill(b));
+}
+
+template <typename T>
+int compare(const T& a, const limbs::limb_type* const b, const std::size_t nb, const limbs::limb_type b_fill) noexcept
+{
+    const limbs::limb_type a_fill = fill(a);
+    if (a_fill != b_fill) {
+        // only differs for Signed values of different signs
+        return (a_fill != 0) ? -1 : 1;
+    }
+    if ((a.limbs() == 1) && (nb == 1)) {
+        return (a.limb(0) < b[0]) ? -1 : (a.limb(0) > b[0]);
+    }
+    return limbs::compare(a.data(), a.limbs(), a_fill, b, nb, b_fill);
+}
+
+template <typename T, typename Op>
+T bitwise(const T& a, const T& b, const Op& op)
+{
+    check_widths(a.width(), b.width());
+    T r(a);
+    for (std::size_t i = 0; i < r.limbs(); ++i) {
+        r.data()[i] = op(a.limb(i), b.limb(i));
+    }
+    return r;
+}
+
+template <typename T>
+T invert(const T& a)
+{
+    T r(a);
+    for (std::size_t i = 0; i < r.limbs(); ++i) {
+        r.data()[i] = ~a.limb(i);
+    }
+    normalize(r);
+    return r;
+}
+
+template <typename T>
+T shift_left(const T& a, const std::size_t n)
+{
+    T r(a.width());
+    if (n < a.width()) {
+        limbs::shift_left(r.data(), a.data(), a.limbs(), n);
+        normalize(r);
+    }
+    return r;
+}
+
+template <typename T>
+T shift_right(const T& a, const std::size_t n)
+{
+    T r(a.width());
+    limbs::shift_right(r.data(), a.data(), a.limbs(), std::min(n, a.width()), fill(a));
+    normalize(r);
+    return r;
+}
+
+/** A value of the width of `a` holding the integer, wrapped to that width. */
+inline Unsigned wrap_integer(const Unsigned& a, const unsigned long long value)
+{
+    Unsigned r(a.width());
+    if (r.limbs() != 0) {
+        r.set_limb(0, value);
+    }
+    return r;
+}
+
+/** \copydoc wrap_integer(const Unsigned&, unsigned long long) */
+inline Signed wrap_integer(const Signed& a, const long long value)
+{
+    Signed r(a.width());
+    const limbs::limb_type v = limbs::limb_type(value);
+    std::fill(r.data(), r.data() + r.limbs(), limbs::sign_fill(v));
+    if (r.limbs() != 0) {
+        r.set_limb(0, v);
+    }
+    return r;
+}
+
+/** A divisor of `a` holding the integer, at the width of `a` or at the width the integer needs if wider, like numeric_std. */
+inline Unsigned integer_divisor(const Unsigned& a, const unsigned long long value)
+{
+    const std::size_t bits = (value == 0) ? 1 : limbs::limb_bits - limbs::count_leading_zeros(value);
+    return Unsigned(std::max(a.width(), bits), value);
+}
+
+/** \copydoc integer_divisor(const Unsigned&, unsigned long long) */
+inline Signed integer_divisor(const Signed& a, const long long value)
+{
+    // the magnitude bits of the integer plus a sign bit
+    const unsigned long long magnitude = (value < 0) ? ~static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+    const std::size_t bits = 1 + ((magnitude == 0) ? 0 : limbs::limb_bits - limbs::count_leading_zeros(magnitude));
+    return Signed(std::max(a.width(), bits), value);
+}
+
+/** The number of limbs below the most significant non-zero limb. */
+inline std::size_t significant_limbs(const limbs::limb_type* const a, std::size_t n) noexcept
+{
+    while ((n != 0) && (a[n - 1] == 0)) {
+        --n;
+    }
+    return n;
+}
+
+/** `r = a * b`. `r` is zero and at least as wide as the sum of the widths. */
+inline void multiply(Unsigned& r, const Unsigned& a, const Unsigned& b)
+{
+    const std::size_t na = significant_limbs(a.data(), a.limbs());
+    const std::size_t nb = significant_limbs(b.data(), b.limbs());
+    if ((na == 0) || (nb == 0)) {
+        return;
+    }
+    if ((na == 1) && (nb == 1)) {
+        limbs::limb_type hi = 0, lo = 0;
+        limbs::multiply_limbs(a.limb(0), b.limb(0), hi, lo);
+        r.data()[0] = lo;
+        if (r.limbs() > 1) {
+            r.data()[1] = hi;
+        }
+        return;
+    }
+    if (na + nb <= r.limbs()) {
+        limbs::multiply(r.data(), a.data(), na, b.data(), nb);
+        return;
+    }
+    // the top limb of the product is zero but does not fit in r
+    limbs::limb_buffer product(na + nb);
+    limbs::multiply(product.data(), a.data(), na, b.data(), nb);
+    std::copy(product.begin(), product.begin() + std::ptrdiff_t(r.limbs()), r.data());
+}
+
+/** `q = a / b` and `r = a % b`. `q` and `r` are zero, `q` at least as wide as `a` and `r` at least as wide as `b`. Fails if `b` is zero. */
+inline void divide(const Unsigned& a, const Unsigned& b, Unsigned& q, Unsigned& r)
+{
+    const std::size_t na = significant_limbs(a.data(), a.limbs());
+    const std::size_t nb = significant_limbs(b.data(), b.limbs());
+    if (nb == 0) {
+        HDLTYPES_THROW(std::domain_error("Division by zero"));
+    }
+    if ((na < nb) || ((na == nb) && (limbs::compare(a.data(), na, 0, b.data(), nb, 0) < 0))) {
+        std::copy(a.data(), a.data() + na, r.data());
+        return;
+    }
+    if (nb == 1) {
+        r.data()[0] = limbs::divide_limb(q.data(), a.data(), na, b.limb(0));
+        return;
+    }
+    limbs::limb_buffer scratch(limbs::divide_scratch(na, nb));
+    limbs::divide(q.data(), r.data(), a.data(), na, b.data(), nb, scratch.data());
+}
+
+/** Whether a Signed value is negative. */
+inline bool is_negative(const Signed& a) noexcept
+{
+    return fill(a) != 0;
+}
+
+}
+
+inline Unsigned::Unsigned(const size_type width, const allocator_type& alloc)
+    : limbs_(width, alloc)
+{
+}
+
+inline Unsigned::Unsigned(const size_type width, const unsigned long long value, const allocator_type& alloc)
+    : limbs_(width, alloc)
+{
+    if ((width < limbs::limb_bits) && ((value >> width) != 0)) {
+        HDLTYPES_THROW(std::out_of_range("Value does not fit in the width"));
+    }
+    if (width != 0) {
+        limbs_.data()[0] = value;
+    }
+}
+
+inline Unsigned::Unsigned(const Unsigned& a, const allocator_type& alloc)
+    : limbs_(a.limbs_, alloc)
+{
+}
+
+inline Unsigned::Unsigned(Unsigned&& a, const allocator_type& alloc)
+    : limbs_(std::move(a.limbs_), alloc)
+{
+}
+
+inline Unsigned::allocator_type Unsigned::get_allocator() const noexcept
+{
+    return limbs_.get_allocator();
+}
+
+inline Unsigned::size_type Unsigned::width() const noexcept
+{
+    return limbs_.width();
+}
+
+inline Unsigned::size_type Unsigned::limbs() const noexcept
+{
+    return limbs_.size();
+}
+
+inline Unsigned::limb_type Unsigned::limb(const size_type n) const noexcept
+{
+    assert(n < limbs());
+    return limbs_.data()[n];
+}
+
+inline void Unsigned::set_limb(const size_type n, const limb_type value) noexcept
+{
+    assert(n < limbs());
+    limbs_.data()[n] = (n + 1 == limbs()) ? (value & packed::tail_mask(width())) : value;
+}
+
+inline const Unsigned::limb_type* Unsigned::data() const noexcept
+{
+    return limbs_.data();
+}
+
+inline Unsigned::limb_type* Unsigned::data() noexcept
+{
+    return limbs_.data();
+}
+
+inline Signed::Signed(const size_type width, const allocator_type& alloc)
+    : limbs_(width, alloc)
+{
+}
+
+inline Signed::Signed(const size_type width, const long long value, const allocator_type& alloc)
+    : limbs_(width, alloc)
+{
+    if (width == 0) {
+        if (value != 0) {
+            HDLTYPES_THROW(std::out_of_range("Value does not fit in the width"));
+        }
+        return;
+    }
+    if (width < limbs::limb_bits) {
+        const long long limit = 1ll << (width - 1);
+        if ((value < -limit) || (value >= limit)) {
+            HDLTYPES_THROW(std::out_of_range("Value does not fit in the width"));
+        }
+    }
+    {
+        const limb_type v = limb_type(value);
+        std::fill(data(), data() + limbs(), limbs::sign_fill(v));
+        set_limb(0, v);
+    }
+}
+
+inline Signed::Signed(const Signed& a, const allocator_type& alloc)
+    : limbs_(a.limbs_, alloc)
+{
+}
+
+inline Signed::Signed(Signed&& a, const allocator_type& alloc)
+    : limbs_(std::move(a.limbs_), alloc)
+{
+}
+
+inline Signed::allocator_type Signed::get_allocator() const noexcept
+{
+    return limbs_.get_allocator();
+}
+
+inline Signed::size_type Signed::width() const noexcept
+{
+    return limbs_.width();
+}
+
+inline Signed::size_type Signed::limbs() const noexcept
+{
+    return limbs_.size();
+}
+
+inline Signed::limb_type Signed::limb(const size_type n) const noexcept
+{
+    assert(n < limbs());
+    return limbs_.data()[n];
+}
+
+inline void Signed::set_limb(const size_type n, const limb_type value) noexcept
+{
+    assert(n < limbs());
+    limbs_.data()[n] = (n + 1 == limbs()) ? detail::sign_extend(value, width()) : value;
+}
+
+inline const Signed::limb_type* Signed::data() const noexcept
+{
+    return limbs_.data();
+}
+
+inline Signed::limb_type* Signed::data() noexcept
+{
+    return limbs_.data();
+}
+
+inline unsigned long long to_integer(const Unsigned& a)
+{
+    for (std::size_t i = 1; i < a.limbs(); ++i) {
+        if (a.limb(i) != 0) {
+            HDLTYPES_THROW(std::out_of_range("Value does not fit in the integer type"));
+        }
+    }
+    return (a.limbs() == 0) ? 0 : a.limb(0);
+}
+
+inline long long to_integer(const Signed& a)
+{
+    if (a.limbs() == 0) {
+        return 0;
+    }
+    for (std::size_t i = 1; i < a.limbs(); ++i) {
+        if (a.limb(i) != limbs::sign_fill(a.limb(0))) {
+            HDLTYPES_THROW(std::out_of_range("Value does not fit in the integer type"));
+        }
+    }
+    return static_cast<long long>(a.limb(0));
+}
+
+inline Unsigned to_unsigned(const Signed& a)
+{
+    Unsigned r(a.width());
+    std::copy(a.data(), a.data() + a.limbs(), r.data());
+    detail::normalize(r);
+    return r;
+}
+
+inline Signed to_signed(const Unsigned& a)
+{
+    Signed r(a.width());
+    std::copy(a.data(), a.data() + a.limbs(), r.data());
+    detail::normalize(r);
+    return r;
+}
+
+inline Unsigned resize(const Unsigned& a, const Unsigned::size_type width)
+{
+    return detail::resize_limbs(a, width);
+}
+
+inline Signed resize(const Signed& a, const Signed::size_type width)
+{
+    Signed r = detail::resize_limbs(a, width);
+    if ((width < a.width()) && (width != 0)) {
+        // numeric_std keeps the sign bit when narrowing
+        const std::size_t top = r.limbs() - 1;
+        const Signed::limb_type sign_bit = Signed::limb_type(1) << ((width - 1) % limbs::limb_bits);
+        r.set_limb(top, (detail::fill(a) != 0) ? (r.limb(top) | sign_bit) : (r.limb(top) & ~sign_bit));
+    }
+    return r;
+}
+
+inline Unsigned operator+(const Unsigned& a, const Unsigned& b)
+{
+    return detail::add(a, b);
+}
+
+inline Unsigned operator+(const Unsigned& a, const unsigned long long b)
+{
+    Unsigned r(a);
+    return (r += b);
+}
+
+inline Unsigned& operator+=(Unsigned& a, const Unsigned& b)
+{
+    return detail::add_assign(a, b.data(), b.limbs(), detail::fill(b));
+}
+
+inline Unsigned& operator+=(Unsigned& a, const unsigned long long b)
+{
+    const limbs::limb_type v = b;
+    return detail::add_assign(a, &v, 1, 0);
+}
+
+inline Unsigned operator-(const Unsigned& a, const Unsigned& b)
+{
+    return detail::sub(a, b);
+}
+
+inline Unsigned operator-(const Unsigned& a, const unsigned long long b)
+{
+    Unsigned r(a);
+    return (r -= b);
+}
+
+inline Unsigned& operator-=(Unsigned& a, const Unsigned& b)
+{
+    return detail::sub_assign(a, b.data(), b.limbs(), detail::fill(b));
+}
+
+inline Unsigned& operator-=(Unsigned& a, const unsigned long long b)
+{
+    const limbs::limb_type v = b;
+    return detail::sub_assign(a, &v, 1, 0);
+}
+
+inline Signed operator+(const Signed& a, const Signed& b)
+{
+    return detail::add(a, b);
+}
+
+inline Signed operator+(const Signed& a, const long long b)
+{
+    Signed r(a);
+    return (r += b);
+}
+
+inline Signed& operator+=(Signed& a, const Signed& b)
+{
+    return detail::add_assign(a, b.data(), b.limbs(), detail::fill(b));
+}
+
+inline Signed& operator+=(Signed& a, const long long b)
+{
+    const limbs::limb_type v = limbs::limb_type(b);
+    return detail::add_assign(a, &v, 1, limbs::sign_fill(v));
+}
+
+inline Signed operator-(const Signed& a, const Signed& b)
+{
+    return detail::sub(a, b);
+}
+
+inline Signed operator-(const Signed& a, const long long b)
+{
+    Signed r(a);
+    return (r -= b);
+}
+
+inline Signed& operator-=(Signed& a, const Signed& b)
+{
+    return detail::sub_assign(a, b.data(), b.limbs(), detail::fill(b));
+}
+
+inline Signed& operator-=(Signed& a, const long long b)
+{
+    const limbs::limb_type v = limbs::limb_type(b);
+    return detail::sub_assign(a, &v, 1, limbs::sign_fill(v));
+}
+
+inline Signed operator-(const Signed& a)
+{
+    Signed r(a);
+    limbs::negate(r.data(), a.data(), a.limbs());
+    detail::normalize(r);
+    return r;
+}
+
+inline Signed abs(const Signed& a)
+{
+    return (detail::fill(a) != 0) ? -a : a;
+}
+
+inline Unsigned operator*(const Unsigned& a, const Unsigned& b)
+{
+    Unsigned r(a.width() + b.width());
+    detail::multiply(r, a, b);
+    return r;
+}
+
+inline Unsigned operator*(const Unsigned& a, const unsigned long long b)
+{
+    return a * detail::wrap_integer(a, b);
+}
+
+inline Unsigned operator/(const Unsigned& a, const Unsigned& b)
+{
+    Unsigned q(a.width());
+    Unsigned r(b.width());
+    detail::divide(a, b, q, r);
+    return q;
+}
+
+inline Unsigned operator/(const Unsigned& a, const unsigned long long b)
+{
+    const Unsigned d = detail::integer_divisor(a, b);
+    if (d.width() > a.width()) {
+        // numeric_std yields 0 for a divisor wider than the dividend
+        return Unsigned(a.width());
+    }
+    return a / d;
+}
+
+inline Unsigned operator%(const Unsigned& a, const Unsigned& b)
+{
+    Unsigned q(a.width());
+    Unsigned r(b.width());
+    detail::divide(a, b, q, r);
+    return r;
+}
+
+inline Unsigned operator%(const Unsigned& a, const unsigned long long b)
+{
+    const Unsigned d = detail::integer_divisor(a, b);
+    return resize(resize(a, d.width()) % d, a.width());
+}
+
+inline Unsigned mod(const Unsigned& a, const Unsigned& b)
+{
+    return a % b;
+}
+
+inline Unsigned mod(const Unsigned& a, const unsigned long long b)
+{
+    return a % b;
+}
+
+inline Signed operator*(const Signed& a, const Signed& b)
+{
+    // the product of the magnitudes is at most 2^(width-2), so it never reaches the sign bit
+    const Signed r = to_signed(to_unsigned(abs(a)) * to_unsigned(abs(b)));
+    return (detail::is_negative(a) != detail::is_negative(b)) ? -r : r;
+}
+
+inline Signed operator*(const Signed& a, const long long b)
+{
+    return a * detail::wrap_integer(a, b);
+}
+
+inline Signed operator/(const Signed& a, const Signed& b)
+{
+    Unsigned q(a.width());
+    Unsigned r(b.width());
+    detail::divide(to_unsigned(abs(a)), to_unsigned(abs(b)), q, r);
+    const Signed s = to_signed(q);
+    return (detail::is_negative(a) != detail::is_negative(b)) ? -s : s;
+}
+
+inline Signed operator/(const Signed& a, const long long b)
+{
+    const Signed d = detail::integer_divisor(a, b);
+    if (d.width() > a.width()) {
+        // numeric_std yields 0 for a divisor wider than the dividend, even for -2^(width-1) / 2^(width-1)
+        return Signed(a.width());
+    }
+    return a / d;
+}
+
+inline Signed operator%(const Signed& a, const Signed& b)
+{
+    Unsigned q(a.width());
+    Unsigned r(b.width());
+    detail::divide(to_unsigned(abs(a)), to_unsigned(abs(b)), q, r);
+    const Signed s = to_signed(r);
+    return detail::is_negative(a) ? -s : s;
+}
+
+inline Signed operator%(const Signed& a, const long long b)
+{
+    const Signed d = detail::integer_divisor(a, b);
+    return resize(resize(a, d.width()) % d, a.width());
+}
+
+inline Signed mod(const Signed& a, const Signed& b)
+{
+    const Signed r = a % b;
+    if ((r != 0) && (detail::is_negative(a) != detail::is_negative(b))) {
+        return r + b;
+    }
+    return r;
+}
+
+inline Signed mod(const Signed& a, const long long b)
+{
+    const Signed d = detail::integer_divisor(a, b);
+    return resize(mod(resize(a, d.width()), d), a.width());
+}
+
+inline int compare(const Unsigned& a, const Unsigned& b) noexcept
+{
+    return detail::compare(a, b.data(), b.limbs(), detail::fill(b));
+}
+
+inline int compare(const Unsigned& a, const unsigned long long b) noexcept
+{
+    const limbs::limb_type v = b;
+    return detail::compare(a, &v, 1, 0);
+}
+
+inline int compare(const Signed& a, const Signed& b) noexcept
+{
+    return detail::compare(a, b.data(), b.limbs(), detail::fill(b));
+}
+
+inline int compare(const Signed& a, const long long b) noexcept
+{
+    const limbs::limb_type v = limbs::limb_type(b);
+    return detail::compare(a, &v, 1, limbs::sign_fill(v));
+}
+
+#define HDLTYPES_NUMERIC_COMPARISONS(type, integer)                                                    \
+    inline bool operator==(const type& a, const type& b) noexcept { return compare(a, b) == 0; }      \
+    inline bool operator!=(const type& a, const type& b) noexcept { return compare(a, b) != 0; }      \
+    inline bool operator<(const type& a, const type& b) noexcept { return compare(a, b) < 0; }        \
+    inline bool operator<=(const type& a, const type& b) noexcept { return compare(a, b) <= 0; }      \
+    inline bool operator>(const type& a, const type& b) noexcept { return compare(a, b) > 0; }        \
+    inline bool operator>=(const type& a, const type& b) noexcept { return compare(a, b) >= 0; }      \
+    inline bool operator==(const type& a, const integer b) noexcept { return compare(a, b) == 0; }    \
+    inline bool operator!=(const type& a, const integer b) noexcept { return compare(a, b) != 0; }    \
+    inline bool operator<(const type& a, const integer b) noexcept { return compare(a, b) < 0; }      \
+    inline bool operator<=(const type& a, const integer b) noexcept { return compare(a, b) <= 0; }    \
+    inline bool operator>(const type& a, const integer b) noexcept { return compare(a, b) > 0; }      \
+    inline bool operator>=(const type& a, const integer b) noexcept { return compare(a, b) >= 0; }
+
+HDLTYPES_NUMERIC_COMPARISONS(Unsigned, unsigned long long)
+HDLTYPES_NUMERIC_COMPARISONS(Signed, long long)
+
+#undef HDLTYPES_NUMERIC_COMPARISONS
+
+inline Unsigned operator&(const Unsigned& a, const Unsigned& b)
+{
+    return detail::bitwise(a, b, [](const limbs::limb_type x, const limbs::limb_type y) { return x & y; });
+}
+
+inline Unsigned operator|(const Unsigned& a, const Unsigned& b)
+{
+    return detail::bitwise(a, b, [](const limbs::limb_type x, const limbs::limb_type y) { return x | y; });
+}
+
+inline Unsigned operator^(const Unsigned& a, const Unsigned& b)
+{
+    return detail::bitwise(a, b, [](const limbs::limb_type x, const limbs::limb_type y) { return x ^ y; });
+}
+
+inline Unsigned operator~(const Unsigned& a)
+{
+    return detail::invert(a);
+}
+
+inline Signed operator&(const Signed& a, const Signed& b)
+{
+    return detail::bitwise(a, b, [](const limbs::limb_type x, const limbs::limb_type y) { return x & y; });
+}
+
+inline Signed operator|(const Signed& a, const Signed& b)
+{
+    return detail::bitwise(a, b, [](const limbs::limb_type x, const limbs::limb_type y) { return x | y; });
+}
+
+inline Signed operator^(const Signed& a, const Signed& b)
+{
+    return detail::bitwise(a, b, [](const limbs::limb_type x, const limbs::limb_type y) { return x ^ y; });
+}
+
+inline Signed operator~(const Signed& a)
+{
+    return detail::invert(a);
+}
+
+inline Unsigned shift_left(const Unsigned& a, const Unsigned::size_type n)
+{
+    return detail::shift_left(a, n);
+}
+
+inline Unsigned shift_right(const Unsigned& a, const Unsigned::size_type n)
+{
+    return detail::shift_right(a, n);
+}
+
+inline Unsigned rotate_left(const Unsigned& a, const Unsigned::size_type n)
+{
+    if (a.width() == 0 || (n % a.width()) == 0) {
+        return a;
+    }
+    const std::size_t s = n % a.width();
+    return shift_left(a, s) | shift_right(a, a.width() - s);
+}
+
+inline Unsigned rotate_right(const Unsigned& a, const Unsigned::size_type n)
+{
+    if (a.width() == 0) {
+        return a;
+    }
+    return rotate_left(a, a.width() - n % a.width());
+}
+
+inline Signed shift_left(const Signed& a, const Signed::size_type n)
+{
+    return detail::shift_left(a, n);
+}
+
+inline Signed shift_right(const Signed& a, const Signed::size_type n)
+{
+    return detail::shift_right(a, n);
+}
+
+inline Signed rotate_left(const Signed& a, const Signed::size_type n)
+{
+    return to_signed(rotate_left(to_unsigned(a), n));
+}
+
+inline Signed rotate_right(const Signed& a, const Signed::size_type n)
+{
+    return to_signed(rotate_right(to_unsigned(a), n));
+}
+
+inline Unsigned operator<<(const Unsigned& a, const Unsigned::size_type n)
+{
+    return shift_left(a, n);
+}
+
+inline Unsigned operator>>(const Unsigned& a, const Unsigned::size_type n)
+{
+    return shift_right(a, n);
+}
+
+inline Signed operator<<(const Signed& a, const Signed::size_type n)
+{
+    return shift_left(a, n);
+}
+
+inline Signed operator>>(const Signed& a, const Signed::size_type n)
+{
+    return shift_right(a, n);
+}
+
+inline Montgomery::Montgomery(const Unsigned& modulus)
+    : modulus_(modulus)
+{
+    if ((modulus.limbs() == 0) || ((modulus.limb(0) & 1) == 0)) {
+        HDLTYPES_THROW(std::invalid_argument("Modulus must be odd"));
+    }
+    inverse_ = limbs::montgomery_inverse(modulus.limb(0));
+    // R^2 mod m, where R = 2^(64*limbs)
+    Unsigned r2(2 * limbs::limb_bits * modulus.limbs() + 1);
+    r2.set_limb(r2.limbs() - 1, 1);
+    r2_ = r2 % modulus;
+}
+
+inline const Unsigned& Montgomery::modulus() const noexcept
+{
+    return modulus_;
+}
+
+inline Unsigned Montgomery::to_montgomery(const Unsigned& a) const
+{
+    return multiply(a % modulus_, r2_);
+}
+
+inline Unsigned Montgomery::from_montgomery(const Unsigned& a) const
+{
+    return multiply(a, detail::wrap_integer(modulus_, 1));
+}
+
+inline Unsigned Montgomery::multiply(const Unsigned& a, const Unsigned& b) const
+{
+    detail::check_widths(a.width(), modulus_.width());
+    detail::check_widths(b.width(), modulus_.width());
+    Unsigned r(modulus_.width());
+    limbs::limb_buffer scratch(limbs::montgomery_scratch(modulus_.limbs()));
+    limbs::montgomery_multiply(r.data(), a.data(), b.data(), modulus_.data(), modulus_.limbs(), inverse_, scratch.data());
+    return r;
+}
+
+inline Unsigned Montgomery::mod_multiply(const Unsigned& a, const Unsigned& b) const
+{
+    // the factor of R in b cancels the factor of 1/R of the Montgomery product
+    return multiply(a % modulus_, to_montgomery(b));
+}
+
+inline Unsigned Montgomery::mod_pow(const Unsigned& base, const Unsigned& exponent) const
+{
+    const std::size_t n = modulus_.limbs();
+    Unsigned x = to_montgomery(Unsigned(1, 1));
+    const Unsigned b = to_montgomery(base);
+    limbs::limb_buffer scratch(limbs::montgomery_scratch(n));
+    // left-to-right binary exponentiation
+    for (std::size_t i = exponent.width(); i-- > 0;) {
+        limbs::montgomery_multiply(x.data(), x.data(), x.data(), modulus_.data(), n, inverse_, scratch.data());
+        if ((exponent.limb(i / limbs::limb_bits) >> (i % limbs::limb_bits)) & 1) {
+            limbs::montgomery_multiply(x.data(), x.data(), b.data(), modulus_.data(), n, inverse_, scratch.data());
+        }
+    }
+    return from_montgomery(x);
+}
+
+}
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef HDLTYPES_IMPL_PACKED_HPP
+#define HDLTYPES_IMPL_PACKED_HPP
+#include "hdltypes/packed.hpp"
+
+#include <cassert>
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint64_t
+
+#include "hdltypes/logic.hpp" // Logic
+
+namespace hdltypes {
+namespace packed {
+
+constexpr std::size_t word_count(const std::size_t length) noexcept
+{
+    return (length + word_bits - 1) / word_bits;
+}
+
+constexpr word_type tail_mask(const std::size_t length) noexcept
+{
+    return (length % word_bits == 0) ? ~word_type(0) : ((word_type(1) << (length % word_bits)) - 1);
+}
+
+constexpr uint8_t encode(const Logic a) noexcept
+{
+    constexpr uint8_t table[9] = {
+        0b1001, 0b0001, 0b0000, 0b0010, 0b0011, 0b0101, 0b0100, 0b0110, 0b0111
+    };
+    //  U       X       0       1       Z       W       L       H       -
+    return table[int(a.value())];
+}
+
+constexpr Logic decode(const uint8_t code) noexcept
+{
+    constexpr Logic table[16] = {
+        '0'_l, 'X'_l, '1'_l, 'Z'_l, 'L'_l, 'W'_l, 'H'_l, '-'_l,
+        'X'_l, 'U'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l, 'X'_l
+    };
+    assert((code < 8) || (code == 0b1001));
+    return table[code & 0xF];
+}
+
+constexpr LogicWord broadcast(const Logic a) noexcept
+{
+    const uint8_t code = encode(a);
+    return LogicWord {
+        (code & 0b0001) ? ~word_type(0) : word_type(0),
+        (code & 0b0010) ? ~word_type(0) : word_type(0),
+        (code & 0b0100) ? ~word_type(0) : word_type(0),
+        (code & 0b1000) ? ~word_type(0) : word_type(0)
+    };
+}
+
+constexpr Logic get(const LogicWord& w, const std::size_t bit) noexcept
+{
+    assert(bit < word_bits);
+    return decode(uint8_t(
+        ((w.unknown >> bit) & 1)
+        | (((w.value >> bit) & 1) << 1)
+        | (((w.weak >> bit) & 1) << 2)
+        | (((w.unassigned >> bit) & 1) << 3)));
+}
+
+constexpr void set(LogicWord& w, const std::size_t bit, const Logic a) noexcept
+{
+    assert(bit < word_bits);
+    const uint8_t code = encode(a);
+    const word_type m = word_type(1) << bit;
+    w.unknown = (w.unknown & ~m) | (word_type(code & 1) << bit);
+    w.value = (w.value & ~m) | (word_type((code >> 1) & 1) << bit);
+    w.weak = (w.weak & ~m) | (word_type((code >> 2) & 1) << bit);
+    w.unassigned = (w.unassigned & ~m) | (word_type((code >> 3) & 1) << bit);
+}
+
+constexpr LogicWord mask(const LogicWord& w, const word_type m) noexcept
+{
+    return LogicWord { w.unknown & m, w.value & m, w.weak & m, w.unassigned & m };
+}
+
+constexpr word_type mask01(const LogicWord& w) noexcept
+{
+    return ~(w.unknown | w.weak);
+}
+
+constexpr bool operator==(const LogicWord& a, const LogicWord& b) noexcept
+{
+    return (a.unknown == b.unknown) && (a.value == b.value) && (a.weak == b.weak) && (a.unassigned == b.unassigned);
+}
+
+constexpr bool operator!=(const LogicWord& a, const LogicWord& b) noexcept
+{
+    return !(a == b);
+}
+
+/*
+  Every operation yields only `U`, `X`, `0`, or `1`, so the results never have the
+  weak plane set. The inputs are classified as "strong or weak zero", "strong or
+  weak one", `U`, or "any other unknown"; the dominance rules of the scalar tables
+  are then applied on those classes.
+*/
+
+constexpr LogicWord operator&(const LogicWord& a, const LogicWord& b) noexcept
+{
+    const word_type zero = (~a.unknown & ~a.value) | (~b.unknown & ~b.value);
+    const word_type one = (~a.unknown & a.value) & (~b.unknown & b.value);
+    const word_type unassigned = (a.unassigned | b.unassigned) & ~zero;
+    return LogicWord { ~(zero | one), one, 0, unassigned };
+}
+
+constexpr LogicWord operator|(const LogicWord& a, const LogicWord& b) noexcept
+{
+    const word_type one = (~a.unknown & a.value) | (~b.unknown & b.value);
+    const word_type zero = (~a.unknown & ~a.value) & (~b.unknown & ~b.value);
+    const word_type unassigned = (a.unassigned | b.unassigned) & ~one;
+    return LogicWord { ~(zero | one), one, 0, unassigned };
+}
+
+constexpr LogicWord operator^(const LogicWord& a, const LogicWord& b) noexcept
+{
+    const word_type known = ~a.unknown & ~b.unknown;
+    return LogicWord { ~known, (a.value ^ b.value) & known, 0, a.unassigned | b.unassigned };
+}
+
+constexpr LogicWord operator~(const LogicWord& a) noexcept
+{
+    return LogicWord { a.unknown, ~a.unknown & ~a.value, 0, a.unassigned };
+}
+
+constexpr DriveWord drive(const LogicWord& w) noexcept
+{
+    // `X` and `-` both drive strong conflicting values; `U` is only unassigned
+    const word_type conflict = w.unknown & ~w.unassigned & ~(w.value ^ w.weak);
+    const word_type strong = ~w.unknown & ~w.weak;
+    return DriveWord {
+        (strong & ~w.value) | conflict,
+        (strong & w.value) | conflict,
+        w.weak & ~w.value,
+        w.weak & (w.value ^ w.unknown),
+        w.unassigned
+    };
+}
+
+constexpr LogicWord resolve(const DriveWord& d) noexcept
+{
+    const word_type strong = d.strong0 | d.strong1;
+    const word_type weak = ~strong & (d.weak0 | d.weak1);
+    const word_type unknown = (d.strong0 & d.strong1) | (~strong & ~(d.weak0 ^ d.weak1));
+    const word_type value = (d.strong1 & ~d.strong0) | (~strong & ~d.weak0);
+    return LogicWord {
+        unknown | d.unassigned,
+        value & ~d.unassigned,
+        weak & ~d.unassigned,
+        d.unassigned
+    };
+}
+
+constexpr DriveWord operator|(const DriveWord& a, const DriveWord& b) noexcept
+{
+    return DriveWord {
+        a.strong0 | b.strong0,
+        a.strong1 | b.strong1,
+        a.weak0 | b.weak0,
+        a.weak1 | b.weak1,
+        a.unassigned | b.unassigned
+    };
+}
+
+constexpr DriveWord& operator|=(DriveWord& a, const DriveWord& b) noexcept
+{
+    return (a = a | b);
+}
+
+constexpr LogicWord resolve(const LogicWord& a, const LogicWord& b) noexcept
+{
+    return resolve(drive(a) | drive(b));
+}
+
+}
+}
+
+#endif
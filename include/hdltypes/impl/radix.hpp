@@ -0,0 +1,307 @@
+#ifndef HDLTYPES_IMPL_RADIX_HPP
+#define HDLTYPES_IMPL_RADIX_HPP
+
+#include <algorithm> // max
+#include <cassert>
+#include <cstddef> // size_t
+#include <vector>  // vector
+
+#include "hdltypes/impl/limbs.hpp"        // limb_type, limb_bits, count_leading_zeros, divide_limb, multiply_limbs
+#include "hdltypes/impl/text_kernels.hpp" // scan_hex_chars, pack_hex_chars, format_hex_chars, hex_digit_value
+#include "hdltypes/numeric.hpp"           // Unsigned, significant_limbs
+#include "hdltypes/packed.hpp"            // word_count
+
+namespace hdltypes {
+namespace detail {
+
+/*
+  Conversion of Unsigned values to and from digit strings.
+
+  Bases 2, 8, and 16 map digits directly onto bits; hexadecimal digits are converted 16
+  or 32 at a time by the SIMD text kernels.
+
+  Decimal conversion splits values in halves around powers 10^(19*2^j), so both
+  directions cost a few multiplications per level rather than a division or
+  multiplication by 10^19 per limb. Parsing joins the halves as `high * 10^(19*2^j) + low`.
+  Printing divides by the powers with Barrett's method, using reciprocals computed by
+  Newton's iteration, because Algorithm D is itself quadratic. Values of up to
+  `radix_threshold` limbs are converted a limb of 19 digits at a time.
+*/
+
+/** Limbs up to which radix conversions work a limb at a time rather than split values in halves. */
+constexpr std::size_t radix_threshold = 2 * limbs::karatsuba_threshold;
+
+/** Largest power of 10 that fits in a limb, and its number of digits. */
+constexpr limbs::limb_type decimal_limb = 10000000000000000000ULL;
+constexpr std::size_t decimal_limb_digits = 19;
+
+/** Bits per digit of base 2, 8, or 16; 0 for other bases. */
+constexpr unsigned digit_bits(const int base) noexcept
+{
+    return (base == 2) ? 1 : (base == 8) ? 3 : (base == 16) ? 4 : 0;
+}
+
+/** Number of bits up to and including the most significant set bit. */
+inline std::size_t bit_length(const Unsigned& a) noexcept
+{
+    const std::size_t n = significant_limbs(a.data(), a.limbs());
+    return (n == 0) ? 0 : n * limbs::limb_bits - limbs::count_leading_zeros(a.limb(n - 1));
+}
+
+/** `a` resized to the bits it needs, at least 1. */
+inline Unsigned trim(const Unsigned& a)
+{
+    return resize(a, std::max<std::size_t>(bit_length(a), 1));
+}
+
+/** `2^n` in an Unsigned of `width` bits. */
+inline Unsigned power_of_two(const std::size_t n, const std::size_t width)
+{
+    Unsigned r(width);
+    r.set_limb(n / limbs::limb_bits, limbs::limb_type(1) << (n % limbs::limb_bits));
+    return r;
+}
+
+/** `floor(2^(2k) / d)` for a `d` of exactly `k` bits, in `k + 2` bits.
+
+    Refines the reciprocal of the top half of `d` with one Newton step, which doubles its
+    precision, then corrects the last few units with the exact remainder.
+    */
+inline Unsigned reciprocal(const Unsigned& d)
+{
+    const std::size_t k = d.width();
+    assert(bit_length(d) == k);
+    if (k <= radix_threshold * limbs::limb_bits) {
+        return resize(power_of_two(2 * k, 2 * k + 1) / d, k + 2);
+    }
+    const std::size_t h = k / 2 + 2;
+    const Unsigned x = resize(reciprocal(resize(d >> (k - h), h)), k + 4) << (k - h);
+    // x overestimates; x * (2 - d * x / 2^(2k)) underestimates by a few units
+    const Unsigned t = resize((d * (x * x)) >> (2 * k), k + 4);
+    Unsigned y = x + x - t;
+    const Unsigned one = power_of_two(2 * k, 2 * k + 4);
+    Unsigned p = resize(d * y, 2 * k + 4);
+    while (p > one) {
+        y -= 1;
+        p -= d;
+    }
+    Unsigned r = one - p;
+    while (r >= d) {
+        y += 1;
+        r -= d;
+    }
+    return resize(y, k + 2);
+}
+
+/** Divisor with its reciprocal, dividing values below the divisor squared by multiplication. */
+struct BarrettDivisor {
+    BarrettDivisor() = default;
+
+    explicit BarrettDivisor(const Unsigned& d)
+        : divisor(trim(d))
+        , inverse(reciprocal(divisor))
+    {
+    }
+
+    Unsigned divisor;
+    Unsigned inverse;
+};
+
+/** `q = a / d` and `r = a % d` for an `a` below the divisor squared. */
+inline void barrett_divide(const BarrettDivisor& d, const Unsigned& a, Unsigned& q, Unsigned& r)
+{
+    const std::size_t k = d.divisor.width();
+    assert(bit_length(a) <= 2 * k);
+    const Unsigned x = resize(a, 2 * k);
+    q = resize((x * d.inverse) >> (2 * k), k + 1);
+    r = x - q * d.divisor;
+    while (r >= d.divisor) {
+        q += 1;
+        r -= d.divisor;
+    }
+    r = resize(r, k);
+}
+
+/** Writes `19 * chunks` decimal digits of the `n` limbs at `a`, which are overwritten. */
+inline void format_decimal_limbs(limbs::limb_type* const a, std::size_t n, const std::size_t chunks, char* const out) noexcept
+{
+    for (std::size_t c = chunks; c-- > 0;) {
+        limbs::limb_type rem = limbs::divide_limb(a, a, n, decimal_limb);
+        n = significant_limbs(a, n);
+        for (std::size_t i = decimal_limb_digits; i-- > 0;) {
+            out[c * decimal_limb_digits + i] = char('0' + rem % 10);
+            rem /= 10;
+        }
+    }
+    assert(n == 0);
+}
+
+/** Whether decimal conversions split values of `19 * 2^level` digits in halves. */
+constexpr bool split_decimal(const std::size_t level) noexcept
+{
+    return (std::size_t(1) << level) > radix_threshold;
+}
+
+/** Writes the `19 * 2^level` decimal digits of an `a` below `10^(19 * 2^level)`, with leading zeros.
+
+    `powers[j]` is `10^(19 * 2^j)`, and is only set where `split_decimal(j + 1)`.
+    */
+inline void format_decimal(const Unsigned& a, const std::vector<BarrettDivisor>& powers, const std::size_t level, char* const out)
+{
+    if (!split_decimal(level)) {
+        std::vector<limbs::limb_type> scratch(a.data(), a.data() + a.limbs());
+        format_decimal_limbs(scratch.data(), scratch.size(), std::size_t(1) << level, out);
+        return;
+    }
+    Unsigned q, r;
+    barrett_divide(powers[level - 1], a, q, r);
+    const std::size_t half = decimal_limb_digits << (level - 1);
+    format_decimal(q, powers, level - 1, out);
+    format_decimal(r, powers, level - 1, out + half);
+}
+
+/** Decimal digits of `a` without leading zeros. */
+inline std::vector<char> format_decimal(const Unsigned& a)
+{
+    const Unsigned x = trim(a);
+    // powers 10^(19*2^j) up to the first that exceeds x
+    std::vector<Unsigned> squares { Unsigned(64, decimal_limb) };
+    while (squares.back() <= x) {
+        squares.push_back(trim(squares.back() * squares.back()));
+    }
+    std::vector<BarrettDivisor> powers(squares.size() - 1);
+    for (std::size_t j = 0; j < powers.size(); ++j) {
+        if (split_decimal(j + 1)) {
+            powers[j] = BarrettDivisor(squares[j]);
+        }
+    }
+    const std::size_t level = squares.size() - 1;
+    std::vector<char> digits(decimal_limb_digits << level);
+    format_decimal(x, powers, level, digits.data());
+    std::size_t zeros = 0;
+    while ((zeros + 1 < digits.size()) && (digits[zeros] == '0')) {
+        ++zeros;
+    }
+    digits.erase(digits.begin(), digits.begin() + std::ptrdiff_t(zeros));
+    return digits;
+}
+
+/** Value of `n` valid decimal digits, a limb of 19 digits at a time. */
+template <typename CharType>
+Unsigned parse_decimal_limbs(const CharType* const str, const std::size_t n)
+{
+    std::vector<limbs::limb_type> r(n / decimal_limb_digits + 1);
+    std::size_t m = 0;
+    for (std::size_t i = 0; i < n;) {
+        const std::size_t count = (i == 0 && n % decimal_limb_digits != 0) ? n % decimal_limb_digits : decimal_limb_digits;
+        limbs::limb_type chunk = 0, scale = 1;
+        for (std::size_t j = 0; j < count; ++j) {
+            chunk = chunk * 10 + limbs::limb_type(char_index(str[i + j]) - '0');
+            scale *= 10;
+        }
+        i += count;
+        // r = r * scale + chunk
+        limbs::limb_type carry = chunk;
+        for (std::size_t j = 0; j < m; ++j) {
+            limbs::limb_type hi = 0, lo = 0;
+            limbs::multiply_limbs(r[j], scale, hi, lo);
+            lo += carry;
+            r[j] = lo;
+            carry = hi + limbs::limb_type(lo < carry);
+        }
+        if (carry != 0) {
+            r[m++] = carry;
+        }
+    }
+    Unsigned a(std::max<std::size_t>(m, 1) * limbs::limb_bits);
+    std::copy(r.begin(), r.begin() + std::ptrdiff_t(m), a.data());
+    return a;
+}
+
+/** Value of `n` valid decimal digits, joining halves of `19 * 2^j` digits with `powers[j] = 10^(19 * 2^j)`. */
+template <typename CharType>
+Unsigned parse_decimal(const CharType* const str, const std::size_t n, const std::vector<Unsigned>& powers)
+{
+    if (n <= (decimal_limb_digits * radix_threshold)) {
+        return parse_decimal_limbs(str, n);
+    }
+    std::size_t j = 0;
+    while ((decimal_limb_digits << (j + 1)) < n) {
+        ++j;
+    }
+    const std::size_t low = decimal_limb_digits << j;
+    const Unsigned high = parse_decimal(str, n - low, powers);
+    return trim(high * powers[j] + parse_decimal(str + (n - low), low, powers));
+}
+
+/** Value of `n` valid decimal digits. */
+template <typename CharType>
+Unsigned parse_decimal(const CharType* const str, const std::size_t n)
+{
+    std::vector<Unsigned> powers { Unsigned(64, decimal_limb) };
+    while ((decimal_limb_digits << powers.size()) < n) {
+        powers.push_back(trim(powers.back() * powers.back()));
+    }
+    return parse_decimal(str, n, powers);
+}
+
+/** Writes the low `n` digits of the `na` limbs at `a`, `bits` bits per digit, most significant first. */
+template <typename CharType>
+void format_binary_digits(const limbs::limb_type* const a, const std::size_t na, const std::size_t n, const unsigned bits, CharType* const out) noexcept
+{
+    if (bits == 4) {
+        format_hex_chars(a, n, out);
+        return;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t offset = (n - 1 - i) * bits;
+        const std::size_t w = offset / limbs::limb_bits;
+        const std::size_t b = offset % limbs::limb_bits;
+        limbs::limb_type v = a[w] >> b;
+        if ((b + bits > limbs::limb_bits) && (w + 1 < na)) {
+            v |= a[w + 1] << (limbs::limb_bits - b);
+        }
+        out[i] = CharType('0' + (v & ((1u << bits) - 1)));
+    }
+}
+
+/** Writes the value of `n` valid digits, `bits` bits per digit, to the `word_count(n * bits)` limbs at `a`. */
+template <typename CharType>
+void parse_binary_digits(const CharType* const str, const std::size_t n, const unsigned bits, limbs::limb_type* const a) noexcept
+{
+    if (bits == 4) {
+        pack_hex_chars(str, n, a);
+        return;
+    }
+    std::fill(a, a + packed::word_count(n * bits), limbs::limb_type(0));
+    for (std::size_t i = 0; i < n; ++i) {
+        const limbs::limb_type v = limbs::limb_type(char_index(str[i]) - '0');
+        const std::size_t offset = (n - 1 - i) * bits;
+        const std::size_t w = offset / limbs::limb_bits;
+        const std::size_t b = offset % limbs::limb_bits;
+        a[w] |= v << b;
+        if (b + bits > limbs::limb_bits) {
+            a[w + 1] |= v >> (limbs::limb_bits - b);
+        }
+    }
+}
+
+/** Length of the leading run of digits of base 2, 8, 10, or 16. */
+template <typename CharType>
+std::size_t scan_digits(const CharType* const str, const std::size_t n, const int base) noexcept
+{
+    if (base == 16) {
+        return scan_hex_chars(str, n);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        if (char_index(str[i]) - '0' >= std::size_t(base)) {
+            return i;
+        }
+    }
+    return n;
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef HDLTYPES_IMPL_RESOLUTION_HPP
+#define HDLTYPES_IMPL_RESOLUTION_HPP
+#include "hdltypes/resolution.hpp"
+
+#include <cassert>
+#include <cstddef>   // size_t
+#include <cstdint>   // uint32_t
+#include <limits>    // numeric_limits
+#include <stdexcept> // out_of_range, invalid_argument
+#include <vector>    // vector
+
+#include "hdltypes/bounds.hpp"       // Bounds
+#include "hdltypes/logic.hpp"        // Logic
+#include "hdltypes/logic_vector.hpp" // LogicVector, check_lengths
+#include "hdltypes/packed.hpp"       // DriveWord, drive, resolve
+#include "hdltypes/utils.hpp"        // HDLTYPES_THROW
+
+namespace hdltypes {
+
+namespace detail {
+
+/** Number of `0` bits below the least significant `1` bit. `a` must not be 0. */
+inline unsigned count_trailing_zeros(const packed::word_type a) noexcept
+{
+#if defined(__GNUC__)
+    return unsigned(__builtin_ctzll(a));
+#else
+    unsigned n = 0;
+    for (packed::word_type m = 1; (a & m) == 0; m <<= 1) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/** Updates the counts of drivers of one strength over a word of elements, and the mask of elements where any driver drives it. */
+inline void update_drive_counts(uint32_t* const counts, const packed::word_type before, const packed::word_type after, packed::word_type& driven) noexcept
+{
+    for (packed::word_type added = after & ~before; added != 0; added &= added - 1) {
+        const unsigned bit = count_trailing_zeros(added);
+        if (counts[bit]++ == 0) {
+            driven |= packed::word_type(1) << bit;
+        }
+    }
+    for (packed::word_type removed = before & ~after; removed != 0; removed &= removed - 1) {
+        const unsigned bit = count_trailing_zeros(removed);
+        assert(counts[bit] != 0);
+        if (--counts[bit] == 0) {
+            driven &= ~(packed::word_type(1) << bit);
+        }
+    }
+}
+
+}
+
+inline LogicBus::LogicBus(const Bounds bounds, const size_type drivers)
+    : bounds_(bounds)
+    , drivers_(drivers, LogicVector(bounds, 'Z'_l))
+    , driven_(packed::word_count(bounds.length()), packed::DriveWord {})
+    , counts_(packed::drive_planes * packed::word_bits * packed::word_count(bounds.length()), 0)
+    , value_(bounds, 'Z'_l)
+{
+    if (drivers > std::numeric_limits<uint32_t>::max()) {
+        HDLTYPES_THROW(std::invalid_argument("Too many drivers"));
+    }
+}
+
+inline LogicBus::LogicBus(const size_type length, const size_type drivers)
+    : LogicBus(downto(Bounds::index_type(length) - 1, 0), drivers)
+{
+}
+
+inline Bounds LogicBus::bounds() const noexcept
+{
+    return bounds_;
+}
+
+inline LogicBus::size_type LogicBus::length() const noexcept
+{
+    return bounds_.length();
+}
+
+inline LogicBus::size_type LogicBus::drivers() const noexcept
+{
+    return drivers_.size();
+}
+
+inline const LogicVector& LogicBus::value() const noexcept
+{
+    return value_;
+}
+
+inline const LogicVector& LogicBus::driver(const size_type n) const
+{
+    if (n >= drivers_.size()) {
+        HDLTYPES_THROW(std::out_of_range("No such driver"));
+    }
+    return drivers_[n];
+}
+
+inline void LogicBus::drive(const size_type n, const LogicVector& value)
+{
+    if (n >= drivers_.size()) {
+        HDLTYPES_THROW(std::out_of_range("No such driver"));
+    }
+    detail::check_lengths(length(), value.length());
+    LogicVector& d = drivers_[n];
+    for (size_type i = 0; i < value_.words(); ++i) {
+        const auto before = packed::drive(d.word(i));
+        const auto after = packed::drive(value.word(i));
+        // values that drive the same strengths, like `X` and `-`, are stored without touching the counts
+        d.set_word(i, value.word(i));
+        if ((before.strong0 == after.strong0) && (before.strong1 == after.strong1) && (before.weak0 == after.weak0)
+            && (before.weak1 == after.weak1) && (before.unassigned == after.unassigned)) {
+            continue;
+        }
+        uint32_t* const counts = counts_.data() + i * packed::drive_planes * packed::word_bits;
+        auto& driven = driven_[i];
+        detail::update_drive_counts(counts + 0 * packed::word_bits, before.strong0, after.strong0, driven.strong0);
+        detail::update_drive_counts(counts + 1 * packed::word_bits, before.strong1, after.strong1, driven.strong1);
+        detail::update_drive_counts(counts + 2 * packed::word_bits, before.weak0, after.weak0, driven.weak0);
+        detail::update_drive_counts(counts + 3 * packed::word_bits, before.weak1, after.weak1, driven.weak1);
+        detail::update_drive_counts(counts + 4 * packed::word_bits, before.unassigned, after.unassigned, driven.unassigned);
+        value_.set_word(i, packed::resolve(driven));
+    }
+}
+
+inline void LogicBus::release(const size_type n)
+{
+    drive(n, LogicVector(bounds_, 'Z'_l));
+}
+
+inline void resolve(LogicVector& r, const LogicVector* const drivers, const std::size_t n)
+{
+    for (std::size_t j = 0; j < n; ++j) {
+        detail::check_lengths(r.length(), drivers[j].length());
+    }
+    for (std::size_t i = 0; i < r.words(); ++i) {
+        packed::DriveWord d {};
+        for (std::size_t j = 0; j < n; ++j) {
+            d |= packed::drive(drivers[j].word(i));
+        }
+        r.set_word(i, packed::resolve(d));
+    }
+}
+
+}
+
+#endif
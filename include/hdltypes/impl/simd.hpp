@@ -0,0 +1,310 @@
+#ifndef HDLTYPES_IMPL_SIMD_HPP
+#define HDLTYPES_IMPL_SIMD_HPP
+
+#include <cstddef> // size_t
+
+#include "hdltypes/packed.hpp" // word_type
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define HDLTYPES_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define HDLTYPES_SIMD_X86 0
+#endif
+
+namespace hdltypes {
+namespace simd {
+
+using packed::word_type;
+
+/** Instruction set levels that kernels are available for. */
+enum class Isa {
+    scalar, ///< Portable C++.
+    sse2,   ///< x86 SSE2, 128-bit vectors.
+    ssse3,  ///< x86 SSSE3, adds byte shuffles.
+    avx2    ///< x86 AVX2 and POPCNT, 256-bit vectors.
+};
+
+/** Kernels over arrays of packed words
+
+    Element-wise kernels write `n` words to `r`, which may alias an operand.
+    Reduction kernels read `n` words.
+    */
+struct WordKernels {
+    void (*bit_and)(word_type* r, const word_type* a, const word_type* b, std::size_t n) noexcept;
+    void (*bit_or)(word_type* r, const word_type* a, const word_type* b, std::size_t n) noexcept;
+    void (*bit_xor)(word_type* r, const word_type* a, const word_type* b, std::size_t n) noexcept;
+    void (*bit_not)(word_type* r, const word_type* a, std::size_t n) noexcept;
+    bool (*all_ones)(const word_type* a, std::size_t n) noexcept;
+    bool (*any_ones)(const word_type* a, std::size_t n) noexcept;
+    std::size_t (*popcount)(const word_type* a, std::size_t n) noexcept;
+};
+
+namespace scalar {
+
+/** Number of set bits in a word. */
+constexpr std::size_t popcount(word_type w) noexcept
+{
+    w = w - ((w >> 1) & 0x5555555555555555);
+    w = (w & 0x3333333333333333) + ((w >> 2) & 0x3333333333333333);
+    w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0F;
+    return std::size_t((w * 0x0101010101010101) >> 56);
+}
+
+inline void bit_and(word_type* const r, const word_type* const a, const word_type* const b, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = a[i] & b[i];
+    }
+}
+
+inline void bit_or(word_type* const r, const word_type* const a, const word_type* const b, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = a[i] | b[i];
+    }
+}
+
+inline void bit_xor(word_type* const r, const word_type* const a, const word_type* const b, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = a[i] ^ b[i];
+    }
+}
+
+inline void bit_not(word_type* const r, const word_type* const a, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = ~a[i];
+    }
+}
+
+inline bool all_ones(const word_type* const a, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        if (~a[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool any_ones(const word_type* const a, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        if (a[i] != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline std::size_t popcount(const word_type* const a, const std::size_t n) noexcept
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        count += popcount(a[i]);
+    }
+    return count;
+}
+
+}
+
+#if HDLTYPES_SIMD_X86
+
+namespace sse2 {
+
+#define HDLTYPES_SSE2_BINARY(name, intrinsic)                                                           \
+    __attribute__((target("sse2"))) inline void name(                                                  \
+        word_type* const r, const word_type* const a, const word_type* const b, const std::size_t n) noexcept \
+    {                                                                                                   \
+        std::size_t i = 0;                                                                              \
+        for (; i + 2 <= n; i += 2) {                                                                    \
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));                \
+            const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));                \
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i), intrinsic(x, y));                       \
+        }                                                                                               \
+        scalar::name(r + i, a + i, b + i, n - i);                                                       \
+    }
+
+HDLTYPES_SSE2_BINARY(bit_and, _mm_and_si128)
+HDLTYPES_SSE2_BINARY(bit_or, _mm_or_si128)
+HDLTYPES_SSE2_BINARY(bit_xor, _mm_xor_si128)
+
+#undef HDLTYPES_SSE2_BINARY
+
+__attribute__((target("sse2"))) inline void bit_not(word_type* const r, const word_type* const a, const std::size_t n) noexcept
+{
+    const __m128i ones = _mm_set1_epi32(-1);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i), _mm_xor_si128(x, ones));
+    }
+    scalar::bit_not(r + i, a + i, n - i);
+}
+
+__attribute__((target("sse2"))) inline bool all_ones(const word_type* const a, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi32(-1))) != 0xFFFF) {
+            return false;
+        }
+    }
+    return scalar::all_ones(a + i, n - i);
+}
+
+__attribute__((target("sse2"))) inline bool any_ones(const word_type* const a, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_setzero_si128())) != 0xFFFF) {
+            return true;
+        }
+    }
+    return scalar::any_ones(a + i, n - i);
+}
+
+}
+
+namespace avx2 {
+
+#define HDLTYPES_AVX2_BINARY(name, intrinsic)                                                           \
+    __attribute__((target("avx2"))) inline void name(                                                  \
+        word_type* const r, const word_type* const a, const word_type* const b, const std::size_t n) noexcept \
+    {                                                                                                   \
+        std::size_t i = 0;                                                                              \
+        for (; i + 4 <= n; i += 4) {                                                                    \
+            const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));             \
+            const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));             \
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), intrinsic(x, y));                    \
+        }                                                                                               \
+        sse2::name(r + i, a + i, b + i, n - i);                                                         \
+    }
+
+HDLTYPES_AVX2_BINARY(bit_and, _mm256_and_si256)
+HDLTYPES_AVX2_BINARY(bit_or, _mm256_or_si256)
+HDLTYPES_AVX2_BINARY(bit_xor, _mm256_xor_si256)
+
+#undef HDLTYPES_AVX2_BINARY
+
+__attribute__((target("avx2"))) inline void bit_not(word_type* const r, const word_type* const a, const std::size_t n) noexcept
+{
+    const __m256i ones = _mm256_set1_epi32(-1);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_xor_si256(x, ones));
+    }
+    sse2::bit_not(r + i, a + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline bool all_ones(const word_type* const a, const std::size_t n) noexcept
+{
+    const __m256i ones = _mm256_set1_epi32(-1);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        if (!_mm256_testc_si256(x, ones)) {
+            return false;
+        }
+    }
+    return sse2::all_ones(a + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline bool any_ones(const word_type* const a, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        if (!_mm256_testz_si256(x, x)) {
+            return true;
+        }
+    }
+    return sse2::any_ones(a + i, n - i);
+}
+
+__attribute__((target("avx2,popcnt"))) inline std::size_t popcount(const word_type* const a, const std::size_t n) noexcept
+{
+    // 4 independent accumulators to hide the latency of popcnt
+    std::size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        c0 += std::size_t(__builtin_popcountll(a[i + 0]));
+        c1 += std::size_t(__builtin_popcountll(a[i + 1]));
+        c2 += std::size_t(__builtin_popcountll(a[i + 2]));
+        c3 += std::size_t(__builtin_popcountll(a[i + 3]));
+    }
+    for (; i < n; ++i) {
+        c0 += std::size_t(__builtin_popcountll(a[i]));
+    }
+    return c0 + c1 + c2 + c3;
+}
+
+}
+
+#endif
+
+/** Returns the highest instruction set level supported by the running CPU. */
+inline Isa detect_isa() noexcept
+{
+#if HDLTYPES_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return Isa::avx2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return Isa::ssse3;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return Isa::sse2;
+    }
+#endif
+    return Isa::scalar;
+}
+
+/** Returns the kernels for the given level. The running CPU must support the level. */
+inline const WordKernels& word_kernels(const Isa isa) noexcept
+{
+    static const WordKernels scalar_kernels {
+        scalar::bit_and, scalar::bit_or, scalar::bit_xor, scalar::bit_not,
+        scalar::all_ones, scalar::any_ones, scalar::popcount
+    };
+#if HDLTYPES_SIMD_X86
+    static const WordKernels sse2_kernels {
+        sse2::bit_and, sse2::bit_or, sse2::bit_xor, sse2::bit_not,
+        sse2::all_ones, sse2::any_ones, scalar::popcount
+    };
+    static const WordKernels avx2_kernels {
+        avx2::bit_and, avx2::bit_or, avx2::bit_xor, avx2::bit_not,
+        avx2::all_ones, avx2::any_ones, avx2::popcount
+    };
+    switch (isa) {
+    case Isa::avx2:
+        return avx2_kernels;
+    case Isa::ssse3:
+    case Isa::sse2:
+        return sse2_kernels;
+    case Isa::scalar:
+        break;
+    }
+#else
+    (void)isa;
+#endif
+    return scalar_kernels;
+}
+
+/** Returns the best kernels for the running CPU. The CPU is only interrogated once. */
+inline const WordKernels& word_kernels() noexcept
+{
+    static const WordKernels& kernels = word_kernels(detect_isa());
+    return kernels;
+}
+
+}
+}
+
+#endif
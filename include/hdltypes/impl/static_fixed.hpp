@@ -0,0 +1,318 @@
+#ifndef HDLTYPES_IMPL_STATIC_FIXED_HPP
+#define HDLTYPES_IMPL_STATIC_FIXED_HPP
+#include "hdltypes/static_fixed.hpp"
+
+#include <cmath>   // ldexp, floor, nearbyint, isnan
+#include <cstddef> // size_t
+
+#include "hdltypes/impl/limbs.hpp" // limb_type, limb_bits
+
+namespace hdltypes {
+
+namespace detail {
+
+/** Bits of `a` in an integer of `W` bits, shifted left so the rightmost bit has the index `right`. */
+template <std::size_t W, int right, int L, int R>
+constexpr StaticUnsigned<W> align_fixed(const StaticUfixed<L, R>& a) noexcept
+{
+    return resize<W>(a.bits()) << std::size_t(R - right);
+}
+
+template <std::size_t W, int right, int L, int R>
+constexpr StaticSigned<W> align_fixed(const StaticSfixed<L, R>& a) noexcept
+{
+    return resize<W>(a.bits()) << std::size_t(R - right);
+}
+
+/** What to add to `v` before shifting right by `n` to round to nearest, ties to even. `n` must not be 0. */
+template <typename I>
+constexpr I round_bias(const I& v, const std::size_t n) noexcept
+{
+    return ((I(1) << (n - 1)) - I(1)) + ((v >> n) & I(1));
+}
+
+/** Integer of the unsigned integer value of a double. `x` must be integral and in range. */
+template <std::size_t N>
+StaticUnsigned<N> unsigned_from_real(double x) noexcept
+{
+    StaticUnsigned<N> r;
+    for (std::size_t i = r.limbs(); i-- > 0;) {
+        const int e = int(i * limbs::limb_bits);
+        const double part = std::floor(std::ldexp(x, -e));
+        r.set_limb(i, limbs::limb_type(part));
+        x -= std::ldexp(part, e);
+    }
+    return r;
+}
+
+/** Unsigned integer value as a double. */
+template <std::size_t N>
+double unsigned_to_real(const StaticUnsigned<N>& a) noexcept
+{
+    double r = 0.0;
+    for (std::size_t i = a.limbs(); i-- > 0;) {
+        r += std::ldexp(double(a.limb(i)), int(i * limbs::limb_bits));
+    }
+    return r;
+}
+
+}
+
+template <int L, int R>
+StaticUfixed<L, R>::StaticUfixed(const double value) noexcept
+{
+    const double scaled = std::nearbyint(std::ldexp(value, -R));
+    if (!(scaled > 0.0)) {
+        // negative or NaN
+        bits_ = integer_type();
+    } else if (scaled >= std::ldexp(1.0, int(width()))) {
+        bits_ = ~integer_type();
+    } else {
+        bits_ = detail::unsigned_from_real<width()>(scaled);
+    }
+}
+
+template <int L, int R>
+constexpr StaticUfixed<L, R> StaticUfixed<L, R>::from_bits(const integer_type& bits) noexcept
+{
+    StaticUfixed r;
+    r.bits_ = bits;
+    return r;
+}
+
+template <int L, int R>
+constexpr int StaticUfixed<L, R>::left() noexcept
+{
+    return L;
+}
+
+template <int L, int R>
+constexpr int StaticUfixed<L, R>::right() noexcept
+{
+    return R;
+}
+
+template <int L, int R>
+constexpr std::size_t StaticUfixed<L, R>::width() noexcept
+{
+    return detail::fixed_width(L, R);
+}
+
+template <int L, int R>
+constexpr typename StaticUfixed<L, R>::integer_type StaticUfixed<L, R>::bits() const noexcept
+{
+    return bits_;
+}
+
+template <int L, int R>
+StaticSfixed<L, R>::StaticSfixed(const double value) noexcept
+{
+    const double scaled = std::nearbyint(std::ldexp(value, -R));
+    const double limit = std::ldexp(1.0, int(width()) - 1);
+    if (std::isnan(scaled)) {
+        bits_ = integer_type();
+    } else if (scaled >= limit) {
+        bits_ = ~(integer_type(1) << (width() - 1));
+    } else if (scaled < -limit) {
+        bits_ = integer_type(1) << (width() - 1);
+    } else if (scaled < 0.0) {
+        // the magnitude of the most negative value wraps to itself
+        bits_ = -to_signed(detail::unsigned_from_real<width()>(-scaled));
+    } else {
+        bits_ = to_signed(detail::unsigned_from_real<width()>(scaled));
+    }
+}
+
+template <int L, int R>
+constexpr StaticSfixed<L, R> StaticSfixed<L, R>::from_bits(const integer_type& bits) noexcept
+{
+    StaticSfixed r;
+    r.bits_ = bits;
+    return r;
+}
+
+template <int L, int R>
+constexpr int StaticSfixed<L, R>::left() noexcept
+{
+    return L;
+}
+
+template <int L, int R>
+constexpr int StaticSfixed<L, R>::right() noexcept
+{
+    return R;
+}
+
+template <int L, int R>
+constexpr std::size_t StaticSfixed<L, R>::width() noexcept
+{
+    return detail::fixed_width(L, R);
+}
+
+template <int L, int R>
+constexpr typename StaticSfixed<L, R>::integer_type StaticSfixed<L, R>::bits() const noexcept
+{
+    return bits_;
+}
+
+template <int L, int R>
+double to_real(const StaticUfixed<L, R>& a) noexcept
+{
+    return std::ldexp(detail::unsigned_to_real(a.bits()), R);
+}
+
+template <int L, int R>
+double to_real(const StaticSfixed<L, R>& a) noexcept
+{
+    // widened by a bit so the magnitude of the most negative value fits
+    constexpr std::size_t W = detail::fixed_width(L, R) + 1;
+    const auto v = resize<W>(a.bits());
+    const double magnitude = detail::unsigned_to_real(to_unsigned(abs(v)));
+    return std::ldexp((v < StaticSigned<W>(0)) ? -magnitude : magnitude, R);
+}
+
+template <int L, int R>
+constexpr StaticSfixed<L + 1, R> to_sfixed(const StaticUfixed<L, R>& a) noexcept
+{
+    return StaticSfixed<L + 1, R>::from_bits(to_signed(resize<detail::fixed_width(L + 1, R)>(a.bits())));
+}
+
+template <int L2, int R2, int L, int R>
+constexpr StaticUfixed<L2, R2> resize(const StaticUfixed<L, R>& a, const FixedOverflow overflow, const FixedRound round) noexcept
+{
+    using T = StaticUfixed<L2, R2>;
+    constexpr int low = detail::min_bound(R, R2);
+    // every bit of `a` aligned to the lowest bound, and a bit for the carry of rounding
+    constexpr std::size_t W = detail::fixed_width(detail::max_bound(L, L2), low) + 1;
+    constexpr std::size_t dropped = std::size_t(R2 - low);
+    auto v = detail::align_fixed<W, low>(a);
+    if ((round == FixedRound::round) && (dropped != 0)) {
+        v += detail::round_bias(v, dropped);
+    }
+    v = v >> dropped;
+    if ((overflow == FixedOverflow::saturate) && ((v >> T::width()) != StaticUnsigned<W>())) {
+        return T::from_bits(~typename T::integer_type());
+    }
+    return T::from_bits(resize<T::width()>(v));
+}
+
+template <int L2, int R2, int L, int R>
+constexpr StaticSfixed<L2, R2> resize(const StaticSfixed<L, R>& a, const FixedOverflow overflow, const FixedRound round) noexcept
+{
+    using T = StaticSfixed<L2, R2>;
+    constexpr int low = detail::min_bound(R, R2);
+    constexpr std::size_t W = detail::fixed_width(detail::max_bound(L, L2), low) + 1;
+    constexpr std::size_t dropped = std::size_t(R2 - low);
+    auto v = detail::align_fixed<W, low>(a);
+    if ((round == FixedRound::round) && (dropped != 0)) {
+        v += detail::round_bias(v, dropped);
+    }
+    // arithmetic shift, so truncation rounds towards negative infinity
+    v = v >> dropped;
+    if (overflow == FixedOverflow::saturate) {
+        // in range when the bits from the sign bit of the result up are all equal
+        const auto high = v >> (T::width() - 1);
+        if ((high != StaticSigned<W>(0)) && (high != StaticSigned<W>(-1))) {
+            const auto min = typename T::integer_type(1) << (T::width() - 1);
+            return T::from_bits((high < StaticSigned<W>(0)) ? min : ~min);
+        }
+    }
+    // resize of a StaticSigned keeps the sign bit, so wrap through StaticUnsigned
+    return T::from_bits(to_signed(resize<T::width()>(to_unsigned(v))));
+}
+
+template <int L1, int R1, int L2, int R2>
+constexpr StaticUfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)> operator+(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept
+{
+    using T = StaticUfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)>;
+    return T::from_bits(detail::align_fixed<T::width(), T::right()>(a) + detail::align_fixed<T::width(), T::right()>(b));
+}
+
+template <int L1, int R1, int L2, int R2>
+constexpr StaticUfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)> operator-(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept
+{
+    using T = StaticUfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)>;
+    return T::from_bits(detail::align_fixed<T::width(), T::right()>(a) - detail::align_fixed<T::width(), T::right()>(b));
+}
+
+template <int L1, int R1, int L2, int R2>
+constexpr StaticUfixed<L1 + L2 + 1, R1 + R2> operator*(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept
+{
+    return StaticUfixed<L1 + L2 + 1, R1 + R2>::from_bits(a.bits() * b.bits());
+}
+
+template <int L1, int R1, int L2, int R2>
+constexpr StaticSfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)> operator+(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept
+{
+    using T = StaticSfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)>;
+    return T::from_bits(detail::align_fixed<T::width(), T::right()>(a) + detail::align_fixed<T::width(), T::right()>(b));
+}
+
+template <int L1, int R1, int L2, int R2>
+constexpr StaticSfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)> operator-(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept
+{
+    using T = StaticSfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)>;
+    return T::from_bits(detail::align_fixed<T::width(), T::right()>(a) - detail::align_fixed<T::width(), T::right()>(b));
+}
+
+template <int L1, int R1, int L2, int R2>
+constexpr StaticSfixed<L1 + L2 + 1, R1 + R2> operator*(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept
+{
+    return StaticSfixed<L1 + L2 + 1, R1 + R2>::from_bits(a.bits() * b.bits());
+}
+
+template <int L, int R>
+constexpr StaticSfixed<L + 1, R> operator-(const StaticSfixed<L, R>& a) noexcept
+{
+    using T = StaticSfixed<L + 1, R>;
+    return T::from_bits(-detail::align_fixed<T::width(), R>(a));
+}
+
+template <int L, int R>
+constexpr StaticSfixed<L + 1, R> abs(const StaticSfixed<L, R>& a) noexcept
+{
+    using T = StaticSfixed<L + 1, R>;
+    return T::from_bits(abs(detail::align_fixed<T::width(), R>(a)));
+}
+
+template <int L1, int R1, int L2, int R2>
+constexpr int compare(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept
+{
+    constexpr int low = detail::min_bound(R1, R2);
+    constexpr std::size_t W = detail::fixed_width(detail::max_bound(L1, L2), low);
+    return compare(detail::align_fixed<W, low>(a), detail::align_fixed<W, low>(b));
+}
+
+template <int L1, int R1, int L2, int R2>
+constexpr int compare(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept
+{
+    constexpr int low = detail::min_bound(R1, R2);
+    constexpr std::size_t W = detail::fixed_width(detail::max_bound(L1, L2), low);
+    return compare(detail::align_fixed<W, low>(a), detail::align_fixed<W, low>(b));
+}
+
+#define HDLTYPES_STATIC_FIXED_COMPARISON(type, op)                                       \
+    template <int L1, int R1, int L2, int R2>                                             \
+    constexpr bool operator op(const type<L1, R1>& a, const type<L2, R2>& b) noexcept     \
+    {                                                                                     \
+        return compare(a, b) op 0;                                                        \
+    }
+
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticUfixed, ==)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticUfixed, !=)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticUfixed, <)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticUfixed, <=)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticUfixed, >)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticUfixed, >=)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticSfixed, ==)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticSfixed, !=)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticSfixed, <)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticSfixed, <=)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticSfixed, >)
+HDLTYPES_STATIC_FIXED_COMPARISON(StaticSfixed, >=)
+
+#undef HDLTYPES_STATIC_FIXED_COMPARISON
+
+}
+
+#endif
@@ -0,0 +1,673 @@
+#ifndef HDLTYPES_IMPL_STATIC_FLOAT_HPP
+#define HDLTYPES_IMPL_STATIC_FLOAT_HPP
+#include "hdltypes/static_float.hpp"
+
+#include <cstddef>     // size_t
+#include <cstdint>     // uint32_t, uint64_t
+#include <cstring>     // memcpy
+#include <type_traits> // integral_constant
+
+#include "hdltypes/impl/limbs.hpp" // count_leading_zeros, limb_bits
+
+namespace hdltypes {
+
+namespace detail {
+
+/*
+  Soft floating point.
+
+  Values are unpacked into a sign, the exponent of the least significant bit of the
+  significand, and the significand with its hidden bit, in an integer wide enough for
+  the exact product of two significands or a quotient with 3 extra bits. round_float
+  rounds such a value to a format, so every operation is exact up to a single rounding.
+*/
+
+enum class FloatClass {
+    zero,
+    finite,
+    infinite,
+    nan
+};
+
+template <std::size_t E, std::size_t M>
+struct FloatParts {
+    using sig_type = StaticUnsigned<2 * M + 6>;
+
+    FloatClass cls;
+    bool sign;
+    int exp;      ///< Exponent of the least significant bit of `sig`.
+    sig_type sig; ///< Significand, including the hidden bit of normal values.
+};
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> low_bits(const std::size_t n) noexcept
+{
+    return (StaticUnsigned<N>(1) << n) - StaticUnsigned<N>(1);
+}
+
+/** Number of bits up to and including the most significant `1` bit; 0 if `a` is 0. */
+template <std::size_t N>
+int bit_length(const StaticUnsigned<N>& a) noexcept
+{
+    for (std::size_t i = a.limbs(); i-- > 0;) {
+        if (a.limb(i) != 0) {
+            return int((i + 1) * limbs::limb_bits - limbs::count_leading_zeros(a.limb(i)));
+        }
+    }
+    return 0;
+}
+
+template <std::size_t E, std::size_t M>
+constexpr StaticUnsigned<1 + E + M> float_sign_bit() noexcept
+{
+    return StaticUnsigned<1 + E + M>(1) << (E + M);
+}
+
+template <std::size_t E, std::size_t M>
+constexpr StaticUnsigned<1 + E + M> float_infinity(const bool sign) noexcept
+{
+    return (low_bits<1 + E + M>(E) << M) | (sign ? float_sign_bit<E, M>() : StaticUnsigned<1 + E + M>());
+}
+
+template <std::size_t E, std::size_t M>
+constexpr StaticUnsigned<1 + E + M> float_nan() noexcept
+{
+    return float_infinity<E, M>(false) | (StaticUnsigned<1 + E + M>(1) << (M - 1));
+}
+
+template <std::size_t E, std::size_t M>
+constexpr StaticUnsigned<1 + E + M> float_zero(const bool sign) noexcept
+{
+    return sign ? float_sign_bit<E, M>() : StaticUnsigned<1 + E + M>();
+}
+
+template <std::size_t E, std::size_t M>
+FloatParts<E, M> unpack_float(const StaticUnsigned<1 + E + M>& bits) noexcept
+{
+    using P = FloatParts<E, M>;
+    using S = typename P::sig_type;
+    const bool sign = (bits & float_sign_bit<E, M>()) != StaticUnsigned<1 + E + M>();
+    const int biased = int(to_integer(resize<E>(bits >> M)));
+    const S fraction = resize<P::sig_type::width()>(bits & low_bits<1 + E + M>(M));
+    if (biased == (1 << E) - 1) {
+        return P { (fraction == S()) ? FloatClass::infinite : FloatClass::nan, sign, 0, S() };
+    }
+    if (biased == 0) {
+        if (fraction == S()) {
+            return P { FloatClass::zero, sign, 0, S() };
+        }
+        return P { FloatClass::finite, sign, float_emin(E) - int(M), fraction };
+    }
+    return P { FloatClass::finite, sign, biased - float_bias(E) - int(M), fraction | (S(1) << M) };
+}
+
+/** Rounds `sig * 2^exp` to the nearest value of the format, ties to even. `sig` must not be 0. */
+template <std::size_t E, std::size_t M, std::size_t N>
+StaticUnsigned<1 + E + M> round_float(const bool sign, const int exp, const StaticUnsigned<N>& sig) noexcept
+{
+    using B = StaticUnsigned<1 + E + M>;
+    // wide enough for the significand of the format, when `sig` has fewer bits
+    using S = StaticUnsigned<max_width(N, M + 2)>;
+    const S v = resize<S::width()>(sig);
+    const int n = bit_length(v);
+    const int top = exp + n - 1;
+    if (top > float_bias(E)) {
+        return float_infinity<E, M>(sign);
+    }
+    // exponent of the least significant bit of the result; fixed for subnormals
+    int q = ((top > float_emin(E)) ? top : float_emin(E)) - int(M);
+    S kept;
+    if (q <= exp) {
+        kept = v << std::size_t(exp - q);
+    } else {
+        const int s = q - exp;
+        if (s > n) {
+            // below half of the smallest subnormal
+            return float_zero<E, M>(sign);
+        }
+        kept = v >> std::size_t(s);
+        const S rem = v & low_bits<S::width()>(std::size_t(s));
+        const S half = S(1) << std::size_t(s - 1);
+        if ((rem > half) || ((rem == half) && ((kept & S(1)) != S()))) {
+            kept += S(1);
+        }
+        if ((kept >> (M + 1)) != S()) {
+            kept = kept >> 1;
+            ++q;
+            if (q + int(M) > float_bias(E)) {
+                return float_infinity<E, M>(sign);
+            }
+        }
+    }
+    const bool normal = (kept >> M) != S();
+    const B biased = normal ? B((unsigned long long)(q + int(M) + float_bias(E))) : B();
+    return float_zero<E, M>(sign) | (biased << M) | (resize<1 + E + M>(kept) & low_bits<1 + E + M>(M));
+}
+
+template <std::size_t E, std::size_t M>
+StaticUnsigned<1 + E + M> soft_add(const StaticUnsigned<1 + E + M>& x, const StaticUnsigned<1 + E + M>& y) noexcept
+{
+    using S = typename FloatParts<E, M>::sig_type;
+    auto a = unpack_float<E, M>(x);
+    auto b = unpack_float<E, M>(y);
+    if ((a.cls == FloatClass::nan) || (b.cls == FloatClass::nan)) {
+        return float_nan<E, M>();
+    }
+    if (a.cls == FloatClass::infinite) {
+        return ((b.cls == FloatClass::infinite) && (a.sign != b.sign)) ? float_nan<E, M>() : x;
+    }
+    if (b.cls == FloatClass::infinite) {
+        return y;
+    }
+    if (a.cls == FloatClass::zero) {
+        return (b.cls == FloatClass::zero) ? float_zero<E, M>(a.sign && b.sign) : y;
+    }
+    if (b.cls == FloatClass::zero) {
+        return x;
+    }
+    if ((a.exp < b.exp) || ((a.exp == b.exp) && (a.sig < b.sig))) {
+        const auto t = a;
+        a = b;
+        b = t;
+    }
+    // 3 bits below the larger operand; the bits shifted out of the smaller are only
+    // needed as a sticky bit, since it is then at least 2 positions below them
+    const std::size_t d = std::size_t(a.exp - b.exp);
+    const S sa = a.sig << 3;
+    S sb = b.sig << 3;
+    if (d != 0) {
+        const bool sticky = (d >= S::width()) ? true : ((sb & low_bits<S::width()>(d)) != S());
+        sb = (sb >> d) | (sticky ? S(1) : S());
+    }
+    if (a.sign == b.sign) {
+        return round_float<E, M>(a.sign, a.exp - 3, sa + sb);
+    }
+    if (sa == sb) {
+        return float_zero<E, M>(false);
+    }
+    return round_float<E, M>(a.sign, a.exp - 3, sa - sb);
+}
+
+template <std::size_t E, std::size_t M>
+StaticUnsigned<1 + E + M> soft_subtract(const StaticUnsigned<1 + E + M>& x, const StaticUnsigned<1 + E + M>& y) noexcept
+{
+    return soft_add<E, M>(x, y ^ float_sign_bit<E, M>());
+}
+
+template <std::size_t E, std::size_t M>
+StaticUnsigned<1 + E + M> soft_multiply(const StaticUnsigned<1 + E + M>& x, const StaticUnsigned<1 + E + M>& y) noexcept
+{
+    const auto a = unpack_float<E, M>(x);
+    const auto b = unpack_float<E, M>(y);
+    const bool sign = a.sign != b.sign;
+    if ((a.cls == FloatClass::nan) || (b.cls == FloatClass::nan)) {
+        return float_nan<E, M>();
+    }
+    if ((a.cls == FloatClass::infinite) || (b.cls == FloatClass::infinite)) {
+        return ((a.cls == FloatClass::zero) || (b.cls == FloatClass::zero)) ? float_nan<E, M>() : float_infinity<E, M>(sign);
+    }
+    if ((a.cls == FloatClass::zero) || (b.cls == FloatClass::zero)) {
+        return float_zero<E, M>(sign);
+    }
+    return round_float<E, M>(sign, a.exp + b.exp, resize<2 * M + 6>(a.sig * b.sig));
+}
+
+/** Shifts the significand of a finite value so its most significant bit is the hidden bit. */
+template <std::size_t E, std::size_t M>
+void normalize_float(FloatParts<E, M>& a) noexcept
+{
+    const int shift = int(M) + 1 - bit_length(a.sig);
+    a.sig = a.sig << std::size_t(shift);
+    a.exp -= shift;
+}
+
+template <std::size_t E, std::size_t M>
+StaticUnsigned<1 + E + M> soft_divide(const StaticUnsigned<1 + E + M>& x, const StaticUnsigned<1 + E + M>& y) noexcept
+{
+    using S = typename FloatParts<E, M>::sig_type;
+    auto a = unpack_float<E, M>(x);
+    auto b = unpack_float<E, M>(y);
+    const bool sign = a.sign != b.sign;
+    if ((a.cls == FloatClass::nan) || (b.cls == FloatClass::nan)) {
+        return float_nan<E, M>();
+    }
+    if (a.cls == FloatClass::infinite) {
+        return (b.cls == FloatClass::infinite) ? float_nan<E, M>() : float_infinity<E, M>(sign);
+    }
+    if (b.cls == FloatClass::infinite) {
+        return float_zero<E, M>(sign);
+    }
+    if (b.cls == FloatClass::zero) {
+        return (a.cls == FloatClass::zero) ? float_nan<E, M>() : float_infinity<E, M>(sign);
+    }
+    if (a.cls == FloatClass::zero) {
+        return float_zero<E, M>(sign);
+    }
+    // normalize subnormals, so the quotient has at least M + 4 bits
+    normalize_float(a);
+    normalize_float(b);
+    const S num = a.sig << (M + 4);
+    const S q = num / b.sig;
+    const bool sticky = (num % b.sig) != S();
+    return round_float<E, M>(sign, a.exp - b.exp - int(M + 4), q | (sticky ? S(1) : S()));
+}
+
+/*
+  Native floating point.
+*/
+
+inline uint64_t double_bits(const double a) noexcept
+{
+    uint64_t r;
+    std::memcpy(&r, &a, sizeof(r));
+    return r;
+}
+
+inline double bits_double(const uint64_t a) noexcept
+{
+    double r;
+    std::memcpy(&r, &a, sizeof(r));
+    return r;
+}
+
+inline uint32_t float_bits(const float a) noexcept
+{
+    uint32_t r;
+    std::memcpy(&r, &a, sizeof(r));
+    return r;
+}
+
+inline float bits_float(const uint32_t a) noexcept
+{
+    float r;
+    std::memcpy(&r, &a, sizeof(r));
+    return r;
+}
+
+/** `2^e`, for `e` in the range of doubles. */
+constexpr double power_of_two(int e) noexcept
+{
+    double r = 1.0;
+    for (; e > 0; --e) {
+        r *= 2.0;
+    }
+    for (; e < 0; ++e) {
+        r *= 0.5;
+    }
+    return r;
+}
+
+/** Rounds a double to the format, via its parts. */
+template <std::size_t E, std::size_t M>
+StaticUnsigned<1 + E + M> round_double(const double a, std::false_type) noexcept
+{
+    const uint64_t d = double_bits(a);
+    const bool sign = (d >> 63) != 0;
+    const int biased = int((d >> 52) & 0x7FF);
+    const uint64_t fraction = d & ((uint64_t(1) << 52) - 1);
+    if (biased == 0x7FF) {
+        return (fraction == 0) ? float_infinity<E, M>(sign) : float_nan<E, M>();
+    }
+    if ((biased == 0) && (fraction == 0)) {
+        return float_zero<E, M>(sign);
+    }
+    const uint64_t sig = fraction | ((biased != 0) ? (uint64_t(1) << 52) : 0);
+    return round_float<E, M>(sign, ((biased != 0) ? biased : 1) - 1075, StaticUnsigned<64>(sig));
+}
+
+/** Rounds a double to a format with fewer exponent and fraction bits, on the bits of the double. */
+template <std::size_t E, std::size_t M>
+inline StaticUnsigned<1 + E + M> round_double(const double a, std::true_type) noexcept
+{
+    constexpr std::size_t shift = 52 - M;
+    constexpr uint64_t infinity = ((uint64_t(1) << E) - 1) << M;
+    constexpr uint64_t rebias = uint64_t(1023 - float_bias(E)) << 52;
+    const uint64_t d = double_bits(a);
+    const uint64_t sign = (d >> 63) << (E + M);
+    const uint64_t magnitude = d & ~(uint64_t(1) << 63);
+    if (magnitude > (uint64_t(0x7FF) << 52)) {
+        return float_nan<E, M>();
+    }
+    if (magnitude >= uint64_t(float_emin(E) + 1023) << 52) {
+        // a carry out of the fraction increments the exponent, up to infinity
+        const uint64_t v = magnitude - rebias;
+        const uint64_t r = (v + ((uint64_t(1) << (shift - 1)) - 1) + ((v >> shift) & 1)) >> shift;
+        return StaticUnsigned<1 + E + M>(sign | ((r < infinity) ? r : infinity));
+    }
+    // adding a constant whose last bit weighs as much as the smallest subnormal rounds
+    // to a subnormal in the FPU; a carry into the hidden bit gives the smallest normal
+    constexpr double scale = power_of_two(float_emin(E) - int(M) + 52);
+    return StaticUnsigned<1 + E + M>(sign | (double_bits(bits_double(magnitude) + scale) - double_bits(scale)));
+}
+
+template <std::size_t E, std::size_t M>
+StaticUnsigned<1 + E + M> round_double(const double a) noexcept
+{
+    return round_double<E, M>(a, std::integral_constant<bool, (E <= 11) && (M < 52)>());
+}
+
+/** The value of a format that fits in a double, as a double. Exact. */
+template <std::size_t E, std::size_t M>
+inline double exact_double(const StaticUnsigned<1 + E + M>& bits) noexcept
+{
+    static_assert(E <= 11 && M <= 52, "Format must fit in a double");
+    const uint64_t v = to_integer(bits);
+    const uint64_t sign = (v >> (E + M)) << 63;
+    const uint64_t biased = (v >> M) & ((uint64_t(1) << E) - 1);
+    const uint64_t fraction = v & ((uint64_t(1) << M) - 1);
+    if (biased == (uint64_t(1) << E) - 1) {
+        return bits_double(sign | (uint64_t(0x7FF) << 52) | (fraction << (52 - M)));
+    }
+    if (biased == 0) {
+        // a multiple of the smallest subnormal double at worst, so the product is exact
+        constexpr double scale = power_of_two(float_emin(E) - int(M));
+        return bits_double(sign | double_bits(double(fraction) * scale));
+    }
+    return bits_double(sign | ((biased - uint64_t(float_bias(E)) + 1023) << 52) | (fraction << (52 - M)));
+}
+
+template <FloatPath P>
+using FloatPathTag = std::integral_constant<FloatPath, P>;
+
+template <std::size_t E, std::size_t M>
+using float_path_tag = FloatPathTag<float_path(E, M)>;
+
+template <std::size_t E, std::size_t M>
+StaticUnsigned<1 + E + M> float_from_double(const double a, FloatPathTag<FloatPath::binary32>) noexcept
+{
+    // the conversion rounds to nearest like the other paths, with subnormals and infinities
+    const float f = float(a);
+    return StaticUnsigned<1 + E + M>((f != f) ? to_integer(float_nan<E, M>()) : float_bits(f));
+}
+
+template <std::size_t E, std::size_t M>
+StaticUnsigned<1 + E + M> float_from_double(const double a, FloatPathTag<FloatPath::binary64>) noexcept
+{
+    return StaticUnsigned<1 + E + M>((a != a) ? to_integer(float_nan<E, M>()) : double_bits(a));
+}
+
+template <std::size_t E, std::size_t M, FloatPath P>
+StaticUnsigned<1 + E + M> float_from_double(const double a, FloatPathTag<P>) noexcept
+{
+    return round_double<E, M>(a);
+}
+
+template <std::size_t E, std::size_t M>
+float native_float(const StaticFloat<E, M>& a) noexcept
+{
+    return bits_float(uint32_t(to_integer(a.bits())));
+}
+
+template <std::size_t E, std::size_t M, typename Op>
+StaticFloat<E, M> float_operation(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b, Op, FloatPathTag<FloatPath::binary32>) noexcept
+{
+    const float r = Op::native(native_float(a), native_float(b));
+    return StaticFloat<E, M>::from_bits(StaticUnsigned<1 + E + M>((r != r) ? to_integer(float_nan<E, M>()) : float_bits(r)));
+}
+
+template <std::size_t E, std::size_t M, typename Op>
+StaticFloat<E, M> float_operation(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b, Op, FloatPathTag<FloatPath::binary64>) noexcept
+{
+    const double r = Op::native(bits_double(to_integer(a.bits())), bits_double(to_integer(b.bits())));
+    return StaticFloat<E, M>::from_bits(StaticUnsigned<1 + E + M>((r != r) ? to_integer(float_nan<E, M>()) : double_bits(r)));
+}
+
+template <std::size_t E, std::size_t M, typename Op>
+StaticFloat<E, M> float_operation(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b, Op, FloatPathTag<FloatPath::via_double>) noexcept
+{
+    return StaticFloat<E, M>::from_bits(round_double<E, M>(Op::native(exact_double<E, M>(a.bits()), exact_double<E, M>(b.bits()))));
+}
+
+template <std::size_t E, std::size_t M, typename Op>
+StaticFloat<E, M> float_operation(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b, Op, FloatPathTag<FloatPath::soft>) noexcept
+{
+    return StaticFloat<E, M>::from_bits(Op::template soft<E, M>(a.bits(), b.bits()));
+}
+
+#define HDLTYPES_FLOAT_OPERATION(name, op, soft_function)                                                         \
+    struct name {                                                                                                  \
+        template <typename T>                                                                                      \
+        static T native(const T a, const T b) noexcept                                                             \
+        {                                                                                                          \
+            return a op b;                                                                                         \
+        }                                                                                                          \
+        template <std::size_t E, std::size_t M>                                                                    \
+        static StaticUnsigned<1 + E + M> soft(const StaticUnsigned<1 + E + M>& a, const StaticUnsigned<1 + E + M>& b) noexcept \
+        {                                                                                                          \
+            return soft_function<E, M>(a, b);                                                                      \
+        }                                                                                                          \
+    };
+
+HDLTYPES_FLOAT_OPERATION(FloatAdd, +, soft_add)
+HDLTYPES_FLOAT_OPERATION(FloatSubtract, -, soft_subtract)
+HDLTYPES_FLOAT_OPERATION(FloatMultiply, *, soft_multiply)
+HDLTYPES_FLOAT_OPERATION(FloatDivide, /, soft_divide)
+
+#undef HDLTYPES_FLOAT_OPERATION
+
+/** Whether every value of the format is exactly a double. */
+template <std::size_t E, std::size_t M>
+using FloatFitsDouble = std::integral_constant<bool, (E <= 11) && (M <= 52)>;
+
+template <std::size_t E, std::size_t M>
+double float_to_real(const StaticFloat<E, M>& a, std::true_type) noexcept
+{
+    return exact_double<E, M>(a.bits());
+}
+
+template <std::size_t E, std::size_t M>
+double float_to_real(const StaticFloat<E, M>& a, std::false_type) noexcept
+{
+    return bits_double(to_integer(resize<11, 52>(a).bits()));
+}
+
+template <std::size_t E2, std::size_t M2, std::size_t E, std::size_t M>
+StaticFloat<E2, M2> resize_float(const StaticFloat<E, M>& a, std::true_type) noexcept
+{
+    // exact, so rounding the double rounds the value once
+    return StaticFloat<E2, M2>(exact_double<E, M>(a.bits()));
+}
+
+template <std::size_t E2, std::size_t M2, std::size_t E, std::size_t M>
+StaticFloat<E2, M2> resize_float(const StaticFloat<E, M>& a, std::false_type) noexcept
+{
+    const auto p = unpack_float<E, M>(a.bits());
+    switch (p.cls) {
+    case FloatClass::zero:
+        return StaticFloat<E2, M2>::from_bits(float_zero<E2, M2>(p.sign));
+    case FloatClass::infinite:
+        return StaticFloat<E2, M2>::from_bits(float_infinity<E2, M2>(p.sign));
+    case FloatClass::nan:
+        return StaticFloat<E2, M2>::nan();
+    case FloatClass::finite:
+        break;
+    }
+    return StaticFloat<E2, M2>::from_bits(round_float<E2, M2>(p.sign, p.exp, p.sig));
+}
+
+/** The bits with the sign bit cleared. */
+template <std::size_t E, std::size_t M>
+constexpr StaticUnsigned<1 + E + M> float_magnitude(const StaticFloat<E, M>& a) noexcept
+{
+    return a.bits() & ~float_sign_bit<E, M>();
+}
+
+/** Three-way comparison of values that are not NaN. */
+template <std::size_t E, std::size_t M>
+constexpr int compare_float(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return ((float_magnitude(a) == StaticUnsigned<1 + E + M>()) && (float_magnitude(b) == StaticUnsigned<1 + E + M>())) ? 0
+        : (signbit(a) != signbit(b))                                                                           ? (signbit(a) ? -1 : 1)
+        : signbit(a)                                                                                           ? compare(float_magnitude(b), float_magnitude(a))
+                                                                                                               : compare(float_magnitude(a), float_magnitude(b));
+}
+
+}
+
+template <std::size_t E, std::size_t M>
+StaticFloat<E, M>::StaticFloat(const double value) noexcept
+    : bits_(detail::float_from_double<E, M>(value, detail::float_path_tag<E, M>()))
+{
+}
+
+template <std::size_t E, std::size_t M>
+constexpr StaticFloat<E, M> StaticFloat<E, M>::from_bits(const bits_type& bits) noexcept
+{
+    StaticFloat r;
+    r.bits_ = bits;
+    return r;
+}
+
+template <std::size_t E, std::size_t M>
+constexpr StaticFloat<E, M> StaticFloat<E, M>::infinity() noexcept
+{
+    return from_bits(detail::float_infinity<E, M>(false));
+}
+
+template <std::size_t E, std::size_t M>
+constexpr StaticFloat<E, M> StaticFloat<E, M>::nan() noexcept
+{
+    return from_bits(detail::float_nan<E, M>());
+}
+
+template <std::size_t E, std::size_t M>
+constexpr std::size_t StaticFloat<E, M>::exponent_width() noexcept
+{
+    return E;
+}
+
+template <std::size_t E, std::size_t M>
+constexpr std::size_t StaticFloat<E, M>::fraction_width() noexcept
+{
+    return M;
+}
+
+template <std::size_t E, std::size_t M>
+constexpr std::size_t StaticFloat<E, M>::width() noexcept
+{
+    return 1 + E + M;
+}
+
+template <std::size_t E, std::size_t M>
+constexpr int StaticFloat<E, M>::bias() noexcept
+{
+    return detail::float_bias(E);
+}
+
+template <std::size_t E, std::size_t M>
+constexpr bool StaticFloat<E, M>::is_native() noexcept
+{
+    return detail::float_path(E, M) != detail::FloatPath::soft;
+}
+
+template <std::size_t E, std::size_t M>
+constexpr typename StaticFloat<E, M>::bits_type StaticFloat<E, M>::bits() const noexcept
+{
+    return bits_;
+}
+
+template <std::size_t E, std::size_t M>
+double to_real(const StaticFloat<E, M>& a) noexcept
+{
+    return detail::float_to_real(a, detail::FloatFitsDouble<E, M>());
+}
+
+template <std::size_t E2, std::size_t M2, std::size_t E, std::size_t M>
+StaticFloat<E2, M2> resize(const StaticFloat<E, M>& a) noexcept
+{
+    return detail::resize_float<E2, M2>(a, detail::FloatFitsDouble<E, M>());
+}
+
+template <std::size_t E, std::size_t M>
+constexpr bool isnan(const StaticFloat<E, M>& a) noexcept
+{
+    return detail::float_magnitude(a) > detail::float_infinity<E, M>(false);
+}
+
+template <std::size_t E, std::size_t M>
+constexpr bool isinf(const StaticFloat<E, M>& a) noexcept
+{
+    return detail::float_magnitude(a) == detail::float_infinity<E, M>(false);
+}
+
+template <std::size_t E, std::size_t M>
+constexpr bool signbit(const StaticFloat<E, M>& a) noexcept
+{
+    return (a.bits() & detail::float_sign_bit<E, M>()) != StaticUnsigned<1 + E + M>();
+}
+
+template <std::size_t E, std::size_t M>
+StaticFloat<E, M> operator+(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return detail::float_operation(a, b, detail::FloatAdd(), detail::float_path_tag<E, M>());
+}
+
+template <std::size_t E, std::size_t M>
+StaticFloat<E, M> operator-(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return detail::float_operation(a, b, detail::FloatSubtract(), detail::float_path_tag<E, M>());
+}
+
+template <std::size_t E, std::size_t M>
+StaticFloat<E, M> operator*(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return detail::float_operation(a, b, detail::FloatMultiply(), detail::float_path_tag<E, M>());
+}
+
+template <std::size_t E, std::size_t M>
+StaticFloat<E, M> operator/(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return detail::float_operation(a, b, detail::FloatDivide(), detail::float_path_tag<E, M>());
+}
+
+template <std::size_t E, std::size_t M>
+constexpr StaticFloat<E, M> operator-(const StaticFloat<E, M>& a) noexcept
+{
+    return StaticFloat<E, M>::from_bits(a.bits() ^ detail::float_sign_bit<E, M>());
+}
+
+template <std::size_t E, std::size_t M>
+constexpr StaticFloat<E, M> abs(const StaticFloat<E, M>& a) noexcept
+{
+    return StaticFloat<E, M>::from_bits(detail::float_magnitude(a));
+}
+
+template <std::size_t E, std::size_t M>
+constexpr bool operator==(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return !isnan(a) && !isnan(b) && (detail::compare_float(a, b) == 0);
+}
+
+template <std::size_t E, std::size_t M>
+constexpr bool operator!=(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return !(a == b);
+}
+
+template <std::size_t E, std::size_t M>
+constexpr bool operator<(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return !isnan(a) && !isnan(b) && (detail::compare_float(a, b) < 0);
+}
+
+template <std::size_t E, std::size_t M>
+constexpr bool operator<=(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return !isnan(a) && !isnan(b) && (detail::compare_float(a, b) <= 0);
+}
+
+template <std::size_t E, std::size_t M>
+constexpr bool operator>(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return b < a;
+}
+
+template <std::size_t E, std::size_t M>
+constexpr bool operator>=(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept
+{
+    return b <= a;
+}
+
+}
+
+#endif
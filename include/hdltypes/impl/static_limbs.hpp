@@ -0,0 +1,328 @@
+#ifndef HDLTYPES_IMPL_STATIC_LIMBS_HPP
+#define HDLTYPES_IMPL_STATIC_LIMBS_HPP
+
+#include <cstddef> // size_t
+
+#include "hdltypes/impl/limbs.hpp" // limb_type, limb_bits, wide_limb_type, multiply_limbs
+
+namespace hdltypes {
+namespace limbs {
+
+/*
+  Storage of the compile-time width integer types.
+
+  Widths of up to 64 bits are held in a native 64-bit integer and widths of up to 128
+  bits in a native 128-bit integer where the compiler has one. Wider values are held in
+  a LimbArray, a fixed array of limbs with the same constexpr operators as the native
+  types. All operations work modulo the number of bits of the storage type; the integer
+  types mask or sign-extend the result to their width.
+*/
+
+/** Fixed array of `K` limbs, least significant first, with the arithmetic of a `64*K` bit unsigned integer. */
+template <std::size_t K>
+struct LimbArray {
+    limb_type limb[K];
+};
+
+template <std::size_t K>
+constexpr LimbArray<K> operator+(const LimbArray<K>& a, const LimbArray<K>& b) noexcept
+{
+    LimbArray<K> r {};
+    limb_type carry = 0;
+    for (std::size_t i = 0; i < K; ++i) {
+        const limb_type s = a.limb[i] + b.limb[i];
+        r.limb[i] = s + carry;
+        carry = limb_type((s < a.limb[i]) || (r.limb[i] < s));
+    }
+    return r;
+}
+
+template <std::size_t K>
+constexpr LimbArray<K> operator-(const LimbArray<K>& a, const LimbArray<K>& b) noexcept
+{
+    LimbArray<K> r {};
+    limb_type borrow = 0;
+    for (std::size_t i = 0; i < K; ++i) {
+        const limb_type d = a.limb[i] - b.limb[i];
+        r.limb[i] = d - borrow;
+        borrow = limb_type((a.limb[i] < b.limb[i]) || (d < borrow));
+    }
+    return r;
+}
+
+template <std::size_t K>
+constexpr LimbArray<K> operator-(const LimbArray<K>& a) noexcept
+{
+    return LimbArray<K> {} - a;
+}
+
+/** Product truncated to `K` limbs. */
+template <std::size_t K>
+constexpr LimbArray<K> operator*(const LimbArray<K>& a, const LimbArray<K>& b) noexcept
+{
+    LimbArray<K> r {};
+    for (std::size_t i = 0; i < K; ++i) {
+        limb_type carry = 0;
+        for (std::size_t j = 0; i + j < K; ++j) {
+            limb_type hi = 0, lo = 0;
+            multiply_limbs(a.limb[i], b.limb[j], hi, lo);
+            lo += carry;
+            hi += limb_type(lo < carry);
+            r.limb[i + j] += lo;
+            hi += limb_type(r.limb[i + j] < lo);
+            carry = hi;
+        }
+    }
+    return r;
+}
+
+template <std::size_t K>
+constexpr LimbArray<K> operator&(const LimbArray<K>& a, const LimbArray<K>& b) noexcept
+{
+    LimbArray<K> r {};
+    for (std::size_t i = 0; i < K; ++i) {
+        r.limb[i] = a.limb[i] & b.limb[i];
+    }
+    return r;
+}
+
+template <std::size_t K>
+constexpr LimbArray<K> operator|(const LimbArray<K>& a, const LimbArray<K>& b) noexcept
+{
+    LimbArray<K> r {};
+    for (std::size_t i = 0; i < K; ++i) {
+        r.limb[i] = a.limb[i] | b.limb[i];
+    }
+    return r;
+}
+
+template <std::size_t K>
+constexpr LimbArray<K> operator^(const LimbArray<K>& a, const LimbArray<K>& b) noexcept
+{
+    LimbArray<K> r {};
+    for (std::size_t i = 0; i < K; ++i) {
+        r.limb[i] = a.limb[i] ^ b.limb[i];
+    }
+    return r;
+}
+
+template <std::size_t K>
+constexpr LimbArray<K> operator~(const LimbArray<K>& a) noexcept
+{
+    LimbArray<K> r {};
+    for (std::size_t i = 0; i < K; ++i) {
+        r.limb[i] = ~a.limb[i];
+    }
+    return r;
+}
+
+template <std::size_t K>
+constexpr bool operator==(const LimbArray<K>& a, const LimbArray<K>& b) noexcept
+{
+    for (std::size_t i = 0; i < K; ++i) {
+        if (a.limb[i] != b.limb[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t K>
+constexpr bool operator!=(const LimbArray<K>& a, const LimbArray<K>& b) noexcept
+{
+    return !(a == b);
+}
+
+/** Unsigned less than. */
+template <std::size_t K>
+constexpr bool operator<(const LimbArray<K>& a, const LimbArray<K>& b) noexcept
+{
+    for (std::size_t i = K; i-- > 0;) {
+        if (a.limb[i] != b.limb[i]) {
+            return a.limb[i] < b.limb[i];
+        }
+    }
+    return false;
+}
+
+/** Bits of a storage type. */
+template <typename T>
+struct storage_bits;
+
+template <>
+struct storage_bits<limb_type> {
+    static constexpr std::size_t value = limb_bits;
+};
+
+#if HDLTYPES_HAS_INT128
+template <>
+struct storage_bits<wide_limb_type> {
+    static constexpr std::size_t value = 2 * limb_bits;
+};
+#endif
+
+template <std::size_t K>
+struct storage_bits<LimbArray<K>> {
+    static constexpr std::size_t value = K * limb_bits;
+};
+
+/** Storage type for integers of `N` bits. */
+template <std::size_t N, bool = (N <= limb_bits), bool = (HDLTYPES_HAS_INT128 && N <= 2 * limb_bits)>
+struct static_storage {
+    using type = LimbArray<(N + limb_bits - 1) / limb_bits>;
+};
+
+template <std::size_t N, bool B>
+struct static_storage<N, true, B> {
+    using type = limb_type;
+};
+
+#if HDLTYPES_HAS_INT128
+template <std::size_t N>
+struct static_storage<N, false, true> {
+    using type = wide_limb_type;
+};
+#endif
+
+/** Returns the nth limb of a storage value. */
+constexpr limb_type get_limb(const limb_type a, const std::size_t) noexcept
+{
+    return a;
+}
+
+#if HDLTYPES_HAS_INT128
+constexpr limb_type get_limb(const wide_limb_type a, const std::size_t n) noexcept
+{
+    return limb_type(a >> (n * limb_bits));
+}
+#endif
+
+template <std::size_t K>
+constexpr limb_type get_limb(const LimbArray<K>& a, const std::size_t n) noexcept
+{
+    return a.limb[n];
+}
+
+/** Sets the nth limb of a storage value. */
+constexpr void set_limb(limb_type& a, const std::size_t, const limb_type value) noexcept
+{
+    a = value;
+}
+
+#if HDLTYPES_HAS_INT128
+constexpr void set_limb(wide_limb_type& a, const std::size_t n, const limb_type value) noexcept
+{
+    const std::size_t s = n * limb_bits;
+    a = (a & ~(wide_limb_type(~limb_type(0)) << s)) | (wide_limb_type(value) << s);
+}
+#endif
+
+template <std::size_t K>
+constexpr void set_limb(LimbArray<K>& a, const std::size_t n, const limb_type value) noexcept
+{
+    a.limb[n] = value;
+}
+
+/** Storage value with every limb set to `fill` except limb 0, which is set to `low`. */
+template <typename T>
+constexpr T make_storage(const limb_type low, const limb_type fill) noexcept
+{
+    T r {};
+    for (std::size_t i = 0; i < storage_bits<T>::value / limb_bits; ++i) {
+        set_limb(r, i, (i == 0) ? low : fill);
+    }
+    return r;
+}
+
+/** `a << n` for any `n`; 0 once every bit is shifted out. */
+template <typename T>
+constexpr T shift_left(const T& a, const std::size_t n) noexcept
+{
+    constexpr std::size_t k = storage_bits<T>::value / limb_bits;
+    T r {};
+    const std::size_t ls = n / limb_bits;
+    const std::size_t bs = n % limb_bits;
+    for (std::size_t i = ls; i < k; ++i) {
+        limb_type v = get_limb(a, i - ls) << bs;
+        if ((bs != 0) && (i > ls)) {
+            v |= get_limb(a, i - ls - 1) >> (limb_bits - bs);
+        }
+        set_limb(r, i, v);
+    }
+    return r;
+}
+
+/** `a >> n` for any `n`, shifting in `fill` bits. */
+template <typename T>
+constexpr T shift_right(const T& a, const std::size_t n, const limb_type fill) noexcept
+{
+    constexpr std::size_t k = storage_bits<T>::value / limb_bits;
+    T r {};
+    const std::size_t ls = (n / limb_bits < k) ? n / limb_bits : k;
+    const std::size_t bs = (n / limb_bits < k) ? n % limb_bits : 0;
+    for (std::size_t i = 0; i < k; ++i) {
+        const limb_type lo = (i + ls < k) ? get_limb(a, i + ls) : fill;
+        const limb_type hi = (i + ls + 1 < k) ? get_limb(a, i + ls + 1) : fill;
+        set_limb(r, i, (bs == 0) ? lo : ((lo >> bs) | (hi << (limb_bits - bs))));
+    }
+    return r;
+}
+
+constexpr limb_type shift_left(const limb_type a, const std::size_t n) noexcept
+{
+    return (n < limb_bits) ? (a << n) : 0;
+}
+
+constexpr limb_type shift_right(const limb_type a, const std::size_t n, const limb_type fill) noexcept
+{
+    return (n == 0) ? a : (n < limb_bits) ? ((a >> n) | (fill << (limb_bits - n))) : fill;
+}
+
+#if HDLTYPES_HAS_INT128
+constexpr wide_limb_type shift_left(const wide_limb_type a, const std::size_t n) noexcept
+{
+    return (n < 2 * limb_bits) ? (a << n) : 0;
+}
+
+constexpr wide_limb_type shift_right(const wide_limb_type a, const std::size_t n, const limb_type fill) noexcept
+{
+    const wide_limb_type f = (wide_limb_type(fill) << limb_bits) | fill;
+    return (n == 0) ? a : (n < 2 * limb_bits) ? ((a >> n) | (f << (2 * limb_bits - n))) : f;
+}
+#endif
+
+/** Mask of the low `n` bits. */
+template <typename T>
+constexpr T low_mask(const std::size_t n) noexcept
+{
+    return ~shift_left(~T {}, n);
+}
+
+/** Unsigned quotient and remainder. `b` must not be zero. */
+template <typename T>
+constexpr void divide(const T& a, const T& b, T& quotient, T& remainder) noexcept
+{
+    quotient = a / b;
+    remainder = a % b;
+}
+
+template <std::size_t K>
+constexpr void divide(const LimbArray<K>& a, const LimbArray<K>& b, LimbArray<K>& quotient, LimbArray<K>& remainder) noexcept
+{
+    // restoring division, one bit at a time from the top
+    quotient = LimbArray<K> {};
+    remainder = LimbArray<K> {};
+    for (std::size_t i = K * limb_bits; i-- > 0;) {
+        remainder = shift_left(remainder, 1);
+        remainder.limb[0] |= (a.limb[i / limb_bits] >> (i % limb_bits)) & 1;
+        if (!(remainder < b)) {
+            remainder = remainder - b;
+            quotient.limb[i / limb_bits] |= limb_type(1) << (i % limb_bits);
+        }
+    }
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,584 @@
+#ifndef HDLTYPES_IMPL_STATIC_NUMERIC_HPP
+#define HDLTYPES_IMPL_STATIC_NUMERIC_HPP
+#include "hdltypes/static_numeric.hpp"
+
+#include <cstddef>   // size_t
+#include <stdexcept> // domain_error
+
+#include "hdltypes/impl/limbs.hpp"        // limb_type, sign_fill
+#include "hdltypes/impl/static_limbs.hpp" // storage_bits, get_limb, set_limb, shift_left, shift_right, low_mask, divide
+#include "hdltypes/numeric.hpp"           // Unsigned, Signed, check_widths
+#include "hdltypes/packed.hpp"            // word_count
+#include "hdltypes/utils.hpp"             // HDLTYPES_THROW
+
+namespace hdltypes {
+
+namespace detail {
+
+/** Number of limbs of a storage type. */
+template <typename T>
+constexpr std::size_t storage_limbs() noexcept
+{
+    return limbs::storage_bits<T>::value / limbs::limb_bits;
+}
+
+/** Storage value with only bit `n` set. */
+template <typename T>
+constexpr T storage_bit(const std::size_t n) noexcept
+{
+    return limbs::shift_left(limbs::make_storage<T>(1, 0), n);
+}
+
+/** Whether the top bit of the storage is set. */
+template <typename T>
+constexpr bool storage_negative(const T& v) noexcept
+{
+    return limbs::sign_fill(limbs::get_limb(v, storage_limbs<T>() - 1)) != 0;
+}
+
+/** Copies a storage value into another storage type, extending with the fill limb or dropping high limbs. */
+template <typename To, typename From>
+constexpr To convert_storage(const From& v, const limbs::limb_type fill) noexcept
+{
+    To r {};
+    for (std::size_t i = 0; i < storage_limbs<To>(); ++i) {
+        limbs::set_limb(r, i, (i < storage_limbs<From>()) ? limbs::get_limb(v, i) : fill);
+    }
+    return r;
+}
+
+/** Clears the bits of the storage above the width. */
+template <std::size_t N, typename T>
+constexpr T wrap_unsigned(const T& v) noexcept
+{
+    return v & limbs::low_mask<T>(N);
+}
+
+/** Sets the bits of the storage above the width to copies of the sign bit. */
+template <std::size_t N, typename T>
+constexpr T wrap_signed(const T& v) noexcept
+{
+    return (wrap_unsigned<N>(v) ^ storage_bit<T>(N - 1)) - storage_bit<T>(N - 1);
+}
+
+/** The value of `a` in the storage type `T`. */
+template <typename T, std::size_t N>
+constexpr T extend(const StaticUnsigned<N>& a) noexcept
+{
+    return convert_storage<T>(a.value(), 0);
+}
+
+/** \copydoc extend(const StaticUnsigned<N>&) */
+template <typename T, std::size_t N>
+constexpr T extend(const StaticSigned<N>& a) noexcept
+{
+    return convert_storage<T>(a.value(), storage_negative(a.value()) ? ~limbs::limb_type(0) : 0);
+}
+
+/** Magnitude of a storage value holding a signed value. */
+template <typename T>
+constexpr T magnitude(const T& v) noexcept
+{
+    return storage_negative(v) ? (T {} - v) : v;
+}
+
+/** Unsigned quotient and remainder of storage values. Fails if `b` is zero. */
+template <typename T>
+constexpr void checked_divide(const T& a, const T& b, T& quotient, T& remainder)
+{
+    if (b == T {}) {
+        HDLTYPES_THROW(std::domain_error("Division by zero"));
+    }
+    limbs::divide(a, b, quotient, remainder);
+}
+
+/** Signed quotient and remainder of storage values, rounding towards zero. Fails if `b` is zero. */
+template <typename T>
+constexpr void divide_signed(const T& a, const T& b, T& quotient, T& remainder)
+{
+    checked_divide(magnitude(a), magnitude(b), quotient, remainder);
+    if (storage_negative(a) != storage_negative(b)) {
+        quotient = T {} - quotient;
+    }
+    if (storage_negative(a)) {
+        remainder = T {} - remainder;
+    }
+}
+
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N>::StaticUnsigned(const unsigned long long value) noexcept
+    : value_(detail::wrap_unsigned<N>(limbs::make_storage<storage_type>(value, 0)))
+{
+}
+
+template <std::size_t N>
+StaticUnsigned<N>::StaticUnsigned(const Unsigned& a)
+{
+    detail::check_widths(width(), a.width());
+    for (size_type i = 0; i < limbs(); ++i) {
+        limbs::set_limb(value_, i, a.limb(i));
+    }
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> StaticUnsigned<N>::from_value(const storage_type& value) noexcept
+{
+    StaticUnsigned r;
+    r.value_ = detail::wrap_unsigned<N>(value);
+    return r;
+}
+
+template <std::size_t N>
+constexpr typename StaticUnsigned<N>::size_type StaticUnsigned<N>::width() noexcept
+{
+    return N;
+}
+
+template <std::size_t N>
+constexpr typename StaticUnsigned<N>::size_type StaticUnsigned<N>::limbs() noexcept
+{
+    return packed::word_count(N);
+}
+
+template <std::size_t N>
+constexpr typename StaticUnsigned<N>::limb_type StaticUnsigned<N>::limb(const size_type n) const noexcept
+{
+    return limbs::get_limb(value_, n);
+}
+
+template <std::size_t N>
+constexpr void StaticUnsigned<N>::set_limb(const size_type n, const limb_type value) noexcept
+{
+    limbs::set_limb(value_, n, value);
+    value_ = detail::wrap_unsigned<N>(value_);
+}
+
+template <std::size_t N>
+constexpr typename StaticUnsigned<N>::storage_type StaticUnsigned<N>::value() const noexcept
+{
+    return value_;
+}
+
+template <std::size_t N>
+StaticUnsigned<N>::operator Unsigned() const
+{
+    Unsigned r(N);
+    for (size_type i = 0; i < limbs(); ++i) {
+        r.set_limb(i, limb(i));
+    }
+    return r;
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N>::StaticSigned(const long long value) noexcept
+    : value_(detail::wrap_signed<N>(limbs::make_storage<storage_type>(limbs::limb_type(value), (value < 0) ? ~limbs::limb_type(0) : 0)))
+{
+}
+
+template <std::size_t N>
+StaticSigned<N>::StaticSigned(const Signed& a)
+{
+    detail::check_widths(width(), a.width());
+    for (size_type i = 0; i < limbs(); ++i) {
+        limbs::set_limb(value_, i, a.limb(i));
+    }
+    value_ = detail::wrap_signed<N>(value_);
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> StaticSigned<N>::from_value(const storage_type& value) noexcept
+{
+    StaticSigned r;
+    r.value_ = detail::wrap_signed<N>(value);
+    return r;
+}
+
+template <std::size_t N>
+constexpr typename StaticSigned<N>::size_type StaticSigned<N>::width() noexcept
+{
+    return N;
+}
+
+template <std::size_t N>
+constexpr typename StaticSigned<N>::size_type StaticSigned<N>::limbs() noexcept
+{
+    return packed::word_count(N);
+}
+
+template <std::size_t N>
+constexpr typename StaticSigned<N>::limb_type StaticSigned<N>::limb(const size_type n) const noexcept
+{
+    return limbs::get_limb(value_, n);
+}
+
+template <std::size_t N>
+constexpr void StaticSigned<N>::set_limb(const size_type n, const limb_type value) noexcept
+{
+    limbs::set_limb(value_, n, value);
+    value_ = detail::wrap_signed<N>(value_);
+}
+
+template <std::size_t N>
+constexpr typename StaticSigned<N>::storage_type StaticSigned<N>::value() const noexcept
+{
+    return value_;
+}
+
+template <std::size_t N>
+StaticSigned<N>::operator Signed() const
+{
+    Signed r(N);
+    for (size_type i = 0; i < limbs(); ++i) {
+        r.set_limb(i, limb(i));
+    }
+    return r;
+}
+
+template <std::size_t N>
+constexpr unsigned long long to_integer(const StaticUnsigned<N>& a) noexcept
+{
+    return a.limb(0);
+}
+
+template <std::size_t N>
+constexpr long long to_integer(const StaticSigned<N>& a) noexcept
+{
+    return static_cast<long long>(a.limb(0));
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> to_unsigned(const StaticSigned<N>& a) noexcept
+{
+    return StaticUnsigned<N>::from_value(a.value());
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> to_signed(const StaticUnsigned<N>& a) noexcept
+{
+    return StaticSigned<N>::from_value(a.value());
+}
+
+template <std::size_t M, std::size_t N, typename>
+constexpr StaticUnsigned<M> resize(const StaticUnsigned<N>& a) noexcept
+{
+    return StaticUnsigned<M>::from_value(detail::extend<typename StaticUnsigned<M>::storage_type>(a));
+}
+
+template <std::size_t M, std::size_t N, typename>
+constexpr StaticSigned<M> resize(const StaticSigned<N>& a) noexcept
+{
+    using T = typename StaticSigned<M>::storage_type;
+    T v = detail::extend<T>(a);
+    if (M < N) {
+        // numeric_std keeps the sign bit when narrowing
+        const T low = limbs::low_mask<T>(M - 1);
+        v = (v & low) | (detail::storage_negative(a.value()) ? ~low : T {});
+    }
+    return StaticSigned<M>::from_value(v);
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<detail::max_width(N, M)> operator+(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept
+{
+    using R = StaticUnsigned<detail::max_width(N, M)>;
+    using T = typename R::storage_type;
+    return R::from_value(detail::extend<T>(a) + detail::extend<T>(b));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<N>& operator+=(StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept
+{
+    return (a = resize<N>(a + b));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<detail::max_width(N, M)> operator-(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept
+{
+    using R = StaticUnsigned<detail::max_width(N, M)>;
+    using T = typename R::storage_type;
+    return R::from_value(detail::extend<T>(a) - detail::extend<T>(b));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<N>& operator-=(StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept
+{
+    return (a = resize<N>(a - b));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<N + M> operator*(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept
+{
+    using R = StaticUnsigned<N + M>;
+    using T = typename R::storage_type;
+    return R::from_value(detail::extend<T>(a) * detail::extend<T>(b));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<N> operator/(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b)
+{
+    using T = typename StaticUnsigned<detail::max_width(N, M)>::storage_type;
+    T q {}, r {};
+    detail::checked_divide(detail::extend<T>(a), detail::extend<T>(b), q, r);
+    return StaticUnsigned<N>::from_value(detail::convert_storage<typename StaticUnsigned<N>::storage_type>(q, 0));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<M> operator%(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b)
+{
+    using T = typename StaticUnsigned<detail::max_width(N, M)>::storage_type;
+    T q {}, r {};
+    detail::checked_divide(detail::extend<T>(a), detail::extend<T>(b), q, r);
+    return StaticUnsigned<M>::from_value(detail::convert_storage<typename StaticUnsigned<M>::storage_type>(r, 0));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<M> mod(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b)
+{
+    return a % b;
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<detail::max_width(N, M)> operator+(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept
+{
+    using R = StaticSigned<detail::max_width(N, M)>;
+    using T = typename R::storage_type;
+    return R::from_value(detail::extend<T>(a) + detail::extend<T>(b));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<N>& operator+=(StaticSigned<N>& a, const StaticSigned<M>& b) noexcept
+{
+    // wrap to the width of a rather than keep its sign bit
+    return (a = to_signed(resize<N>(to_unsigned(a + b))));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<detail::max_width(N, M)> operator-(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept
+{
+    using R = StaticSigned<detail::max_width(N, M)>;
+    using T = typename R::storage_type;
+    return R::from_value(detail::extend<T>(a) - detail::extend<T>(b));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<N>& operator-=(StaticSigned<N>& a, const StaticSigned<M>& b) noexcept
+{
+    return (a = to_signed(resize<N>(to_unsigned(a - b))));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<N + M> operator*(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept
+{
+    using R = StaticSigned<N + M>;
+    using T = typename R::storage_type;
+    return R::from_value(detail::extend<T>(a) * detail::extend<T>(b));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<N> operator/(const StaticSigned<N>& a, const StaticSigned<M>& b)
+{
+    using T = typename StaticSigned<detail::max_width(N, M)>::storage_type;
+    T q {}, r {};
+    detail::divide_signed(detail::extend<T>(a), detail::extend<T>(b), q, r);
+    return StaticSigned<N>::from_value(detail::convert_storage<typename StaticSigned<N>::storage_type>(q, 0));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<M> operator%(const StaticSigned<N>& a, const StaticSigned<M>& b)
+{
+    using T = typename StaticSigned<detail::max_width(N, M)>::storage_type;
+    T q {}, r {};
+    detail::divide_signed(detail::extend<T>(a), detail::extend<T>(b), q, r);
+    return StaticSigned<M>::from_value(detail::convert_storage<typename StaticSigned<M>::storage_type>(r, 0));
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<M> mod(const StaticSigned<N>& a, const StaticSigned<M>& b)
+{
+    const StaticSigned<M> r = a % b;
+    if ((r != StaticSigned<M>()) && (detail::storage_negative(a.value()) != detail::storage_negative(b.value()))) {
+        return r + b;
+    }
+    return r;
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> operator-(const StaticSigned<N>& a) noexcept
+{
+    return StaticSigned<N>::from_value(typename StaticSigned<N>::storage_type {} - a.value());
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> abs(const StaticSigned<N>& a) noexcept
+{
+    return detail::storage_negative(a.value()) ? -a : a;
+}
+
+template <std::size_t N, std::size_t M>
+constexpr int compare(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept
+{
+    using T = typename StaticUnsigned<detail::max_width(N, M)>::storage_type;
+    const T x = detail::extend<T>(a);
+    const T y = detail::extend<T>(b);
+    return (x < y) ? -1 : (y < x);
+}
+
+template <std::size_t N, std::size_t M>
+constexpr int compare(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept
+{
+    using T = typename StaticSigned<detail::max_width(N, M)>::storage_type;
+    // flipping the sign bit maps two's complement order onto unsigned order
+    const T sign = detail::storage_bit<T>(limbs::storage_bits<T>::value - 1);
+    const T x = detail::extend<T>(a) ^ sign;
+    const T y = detail::extend<T>(b) ^ sign;
+    return (x < y) ? -1 : (y < x);
+}
+
+#define HDLTYPES_STATIC_NUMERIC_COMPARISON(type, op)                                      \
+    template <std::size_t N, std::size_t M>                                               \
+    constexpr bool operator op(const type<N>& a, const type<M>& b) noexcept               \
+    {                                                                                     \
+        return compare(a, b) op 0;                                                        \
+    }
+
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticUnsigned, ==)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticUnsigned, !=)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticUnsigned, <)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticUnsigned, <=)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticUnsigned, >)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticUnsigned, >=)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticSigned, ==)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticSigned, !=)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticSigned, <)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticSigned, <=)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticSigned, >)
+HDLTYPES_STATIC_NUMERIC_COMPARISON(StaticSigned, >=)
+
+#undef HDLTYPES_STATIC_NUMERIC_COMPARISON
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator&(const StaticUnsigned<N>& a, const StaticUnsigned<N>& b) noexcept
+{
+    return StaticUnsigned<N>::from_value(a.value() & b.value());
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator|(const StaticUnsigned<N>& a, const StaticUnsigned<N>& b) noexcept
+{
+    return StaticUnsigned<N>::from_value(a.value() | b.value());
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator^(const StaticUnsigned<N>& a, const StaticUnsigned<N>& b) noexcept
+{
+    return StaticUnsigned<N>::from_value(a.value() ^ b.value());
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator~(const StaticUnsigned<N>& a) noexcept
+{
+    return StaticUnsigned<N>::from_value(~a.value());
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> operator&(const StaticSigned<N>& a, const StaticSigned<N>& b) noexcept
+{
+    return StaticSigned<N>::from_value(a.value() & b.value());
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> operator|(const StaticSigned<N>& a, const StaticSigned<N>& b) noexcept
+{
+    return StaticSigned<N>::from_value(a.value() | b.value());
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> operator^(const StaticSigned<N>& a, const StaticSigned<N>& b) noexcept
+{
+    return StaticSigned<N>::from_value(a.value() ^ b.value());
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> operator~(const StaticSigned<N>& a) noexcept
+{
+    return StaticSigned<N>::from_value(~a.value());
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> shift_left(const StaticUnsigned<N>& a, const std::size_t n) noexcept
+{
+    return StaticUnsigned<N>::from_value(limbs::shift_left(a.value(), n));
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> shift_right(const StaticUnsigned<N>& a, const std::size_t n) noexcept
+{
+    return StaticUnsigned<N>::from_value(limbs::shift_right(a.value(), n, 0));
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> rotate_left(const StaticUnsigned<N>& a, const std::size_t n) noexcept
+{
+    const std::size_t s = n % N;
+    return (s == 0) ? a : (shift_left(a, s) | shift_right(a, N - s));
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> rotate_right(const StaticUnsigned<N>& a, const std::size_t n) noexcept
+{
+    return rotate_left(a, N - n % N);
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> shift_left(const StaticSigned<N>& a, const std::size_t n) noexcept
+{
+    return StaticSigned<N>::from_value(limbs::shift_left(a.value(), n));
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> shift_right(const StaticSigned<N>& a, const std::size_t n) noexcept
+{
+    return StaticSigned<N>::from_value(limbs::shift_right(a.value(), n, detail::storage_negative(a.value()) ? ~limbs::limb_type(0) : 0));
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> rotate_left(const StaticSigned<N>& a, const std::size_t n) noexcept
+{
+    return to_signed(rotate_left(to_unsigned(a), n));
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> rotate_right(const StaticSigned<N>& a, const std::size_t n) noexcept
+{
+    return to_signed(rotate_right(to_unsigned(a), n));
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator<<(const StaticUnsigned<N>& a, const std::size_t n) noexcept
+{
+    return shift_left(a, n);
+}
+
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator>>(const StaticUnsigned<N>& a, const std::size_t n) noexcept
+{
+    return shift_right(a, n);
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> operator<<(const StaticSigned<N>& a, const std::size_t n) noexcept
+{
+    return shift_left(a, n);
+}
+
+template <std::size_t N>
+constexpr StaticSigned<N> operator>>(const StaticSigned<N>& a, const std::size_t n) noexcept
+{
+    return shift_right(a, n);
+}
+
+}
+
+#endif
@@ -0,0 +1,553 @@
+#ifndef HDLTYPES_IMPL_STATIC_VECTOR_HPP
+#define HDLTYPES_IMPL_STATIC_VECTOR_HPP
+#include "hdltypes/static_vector.hpp"
+
+#include <cassert>
+#include <cstddef>   // size_t
+#include <stdexcept> // invalid_argument, out_of_range
+#include <string>    // basic_string
+
+#include "hdltypes/bit_vector.hpp"   // BitVector
+#include "hdltypes/bounds.hpp"       // Bounds, Direction
+#include "hdltypes/impl/simd.hpp"    // popcount
+#include "hdltypes/logic.hpp"        // Logic, Bit
+#include "hdltypes/logic_vector.hpp" // LogicVector, check_lengths
+#include "hdltypes/packed.hpp"       // LogicWord, word_type
+#include "hdltypes/utils.hpp"        // HDLTYPES_THROW
+
+namespace hdltypes {
+
+constexpr Direction default_direction(const Bounds::index_type left, const Bounds::index_type right) noexcept
+{
+    return (left < right) ? Direction::ascending : Direction::descending;
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr StaticLogicVector<Left, Right, Dir>::StaticLogicVector() noexcept
+{
+    fill(Logic());
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr StaticLogicVector<Left, Right, Dir>::StaticLogicVector(const Logic init) noexcept
+{
+    fill(init);
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+template <typename CharType, std::size_t N>
+constexpr StaticLogicVector<Left, Right, Dir>::StaticLogicVector(const CharType (&str)[N])
+{
+    static_assert(N - 1 == length(), "String literal length does not match the array length");
+    for (size_type i = 0; i < length(); ++i) {
+        packed::LogicWord w = word(i / packed::word_bits);
+        packed::set(w, i % packed::word_bits, to_logic(str[i]));
+        set_word(i / packed::word_bits, w);
+    }
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+StaticLogicVector<Left, Right, Dir>::StaticLogicVector(const LogicVector& a)
+{
+    detail::check_lengths(length(), a.length());
+    for (size_type i = 0; i < words(); ++i) {
+        set_word(i, a.word(i));
+    }
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr Bounds StaticLogicVector<Left, Right, Dir>::bounds() noexcept
+{
+    return Bounds(Left, Dir, Right);
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr Bounds::size_type StaticLogicVector<Left, Right, Dir>::length() noexcept
+{
+    return bounds().length();
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr Bounds::size_type StaticLogicVector<Left, Right, Dir>::words() noexcept
+{
+    return packed::word_count(length());
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr Logic StaticLogicVector<Left, Right, Dir>::operator[](const index_type index) const noexcept
+{
+    const size_type offset = bounds().offset(index);
+    return packed::get(word(offset / packed::word_bits), offset % packed::word_bits);
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr Logic StaticLogicVector<Left, Right, Dir>::at(const index_type index) const
+{
+    if (!bounds().contains(index)) {
+        HDLTYPES_THROW(std::out_of_range("Index is not in the bounds of the array"));
+    }
+    return (*this)[index];
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr void StaticLogicVector<Left, Right, Dir>::set(const index_type index, const Logic value)
+{
+    if (!bounds().contains(index)) {
+        HDLTYPES_THROW(std::out_of_range("Index is not in the bounds of the array"));
+    }
+    const size_type offset = bounds().offset(index);
+    packed::LogicWord w = word(offset / packed::word_bits);
+    packed::set(w, offset % packed::word_bits, value);
+    set_word(offset / packed::word_bits, w);
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr void StaticLogicVector<Left, Right, Dir>::fill(const Logic value) noexcept
+{
+    const packed::LogicWord w = packed::broadcast(value);
+    for (size_type i = 0; i < words(); ++i) {
+        set_word(i, w);
+    }
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr packed::LogicWord StaticLogicVector<Left, Right, Dir>::word(const size_type n) const noexcept
+{
+    assert(n < words());
+    return packed::LogicWord { planes_[0][n], planes_[1][n], planes_[2][n], planes_[3][n] };
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr void StaticLogicVector<Left, Right, Dir>::set_word(const size_type n, const packed::LogicWord& w) noexcept
+{
+    assert(n < words());
+    const word_type m = (n + 1 == words()) ? packed::tail_mask(length()) : ~word_type(0);
+    planes_[0][n] = w.unknown & m;
+    planes_[1][n] = w.value & m;
+    planes_[2][n] = w.weak & m;
+    planes_[3][n] = w.unassigned & m;
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+StaticLogicVector<Left, Right, Dir>::operator LogicVector() const
+{
+    LogicVector r(bounds());
+    for (size_type i = 0; i < words(); ++i) {
+        r.set_word(i, word(i));
+    }
+    return r;
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr StaticBitVector<Left, Right, Dir>::StaticBitVector(const Bit init) noexcept
+{
+    fill(init);
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+template <typename CharType, std::size_t N>
+constexpr StaticBitVector<Left, Right, Dir>::StaticBitVector(const CharType (&str)[N])
+{
+    static_assert(N - 1 == length(), "String literal length does not match the array length");
+    for (size_type i = 0; i < length(); ++i) {
+        if (to_bit(str[i]) == '1'_b) {
+            words_[i / packed::word_bits] |= word_type(1) << (i % packed::word_bits);
+        }
+    }
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+StaticBitVector<Left, Right, Dir>::StaticBitVector(const BitVector& a)
+{
+    detail::check_lengths(length(), a.length());
+    for (size_type i = 0; i < words(); ++i) {
+        words_[i] = a.word(i);
+    }
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr Bounds StaticBitVector<Left, Right, Dir>::bounds() noexcept
+{
+    return Bounds(Left, Dir, Right);
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr Bounds::size_type StaticBitVector<Left, Right, Dir>::length() noexcept
+{
+    return bounds().length();
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr Bounds::size_type StaticBitVector<Left, Right, Dir>::words() noexcept
+{
+    return packed::word_count(length());
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr Bit StaticBitVector<Left, Right, Dir>::operator[](const index_type index) const noexcept
+{
+    const size_type offset = bounds().offset(index);
+    return to_bit(bool((words_[offset / packed::word_bits] >> (offset % packed::word_bits)) & 1));
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr Bit StaticBitVector<Left, Right, Dir>::at(const index_type index) const
+{
+    if (!bounds().contains(index)) {
+        HDLTYPES_THROW(std::out_of_range("Index is not in the bounds of the array"));
+    }
+    return (*this)[index];
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr void StaticBitVector<Left, Right, Dir>::set(const index_type index, const Bit value)
+{
+    if (!bounds().contains(index)) {
+        HDLTYPES_THROW(std::out_of_range("Index is not in the bounds of the array"));
+    }
+    const size_type offset = bounds().offset(index);
+    const word_type m = word_type(1) << (offset % packed::word_bits);
+    word_type& w = words_[offset / packed::word_bits];
+    w = (value == '1'_b) ? (w | m) : (w & ~m);
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr void StaticBitVector<Left, Right, Dir>::fill(const Bit value) noexcept
+{
+    for (size_type i = 0; i < words(); ++i) {
+        set_word(i, (value == '1'_b) ? ~word_type(0) : word_type(0));
+    }
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr packed::word_type StaticBitVector<Left, Right, Dir>::word(const size_type n) const noexcept
+{
+    assert(n < words());
+    return words_[n];
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr void StaticBitVector<Left, Right, Dir>::set_word(const size_type n, const word_type w) noexcept
+{
+    assert(n < words());
+    words_[n] = (n + 1 == words()) ? (w & packed::tail_mask(length())) : w;
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr StaticBitVector<Left, Right, Dir>::StaticBitVector(const StaticLogicVector<Left, Right, Dir>& a)
+{
+    for (size_type i = 0; i < words(); ++i) {
+        const packed::LogicWord w = a.word(i);
+        if ((w.unknown | w.weak) != 0) {
+            HDLTYPES_THROW(std::invalid_argument("StaticLogicVector value cannot be converted to StaticBitVector"));
+        }
+        words_[i] = w.value;
+    }
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+constexpr StaticBitVector<Left, Right, Dir>::operator StaticLogicVector<Left, Right, Dir>() const noexcept
+{
+    StaticLogicVector<Left, Right, Dir> r('0'_l);
+    for (size_type i = 0; i < words(); ++i) {
+        r.set_word(i, packed::LogicWord { 0, words_[i], 0, 0 });
+    }
+    return r;
+}
+
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir>
+StaticBitVector<Left, Right, Dir>::operator BitVector() const
+{
+    BitVector r(bounds());
+    for (size_type i = 0; i < words(); ++i) {
+        r.set_word(i, words_[i]);
+    }
+    return r;
+}
+
+template <typename CharType, Bounds::index_type L, Bounds::index_type R, Direction D>
+std::basic_string<CharType> to_string(const StaticLogicVector<L, R, D>& a)
+{
+    std::basic_string<CharType> r(a.length(), CharType());
+    for (std::size_t i = 0; i < a.length(); ++i) {
+        r[i] = to_char<CharType>(a[a.bounds().index(i)]);
+    }
+    return r;
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr bool operator==(const StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept
+{
+    if (a.length() != b.length()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        if (a.word(i) != b.word(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr bool operator!=(const StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept
+{
+    return !(a == b);
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1> operator&(const StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept
+{
+    StaticLogicVector<L1, R1, D1> r(a);
+    return (r &= b);
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1>& operator&=(StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept
+{
+    static_assert(StaticLogicVector<L1, R1, D1>::length() == StaticLogicVector<L2, R2, D2>::length(), "Array lengths do not match");
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        a.set_word(i, a.word(i) & b.word(i));
+    }
+    return a;
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1> operator|(const StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept
+{
+    StaticLogicVector<L1, R1, D1> r(a);
+    return (r |= b);
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1>& operator|=(StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept
+{
+    static_assert(StaticLogicVector<L1, R1, D1>::length() == StaticLogicVector<L2, R2, D2>::length(), "Array lengths do not match");
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        a.set_word(i, a.word(i) | b.word(i));
+    }
+    return a;
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1> operator^(const StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept
+{
+    StaticLogicVector<L1, R1, D1> r(a);
+    return (r ^= b);
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1>& operator^=(StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept
+{
+    static_assert(StaticLogicVector<L1, R1, D1>::length() == StaticLogicVector<L2, R2, D2>::length(), "Array lengths do not match");
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        a.set_word(i, a.word(i) ^ b.word(i));
+    }
+    return a;
+}
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr StaticLogicVector<L, R, D> operator~(const StaticLogicVector<L, R, D>& a) noexcept
+{
+    StaticLogicVector<L, R, D> r(a);
+    return inplace_invert(r);
+}
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr StaticLogicVector<L, R, D>& inplace_invert(StaticLogicVector<L, R, D>& a) noexcept
+{
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        a.set_word(i, ~a.word(i));
+    }
+    return a;
+}
+
+namespace detail {
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Logic reduce_unknowns(const StaticLogicVector<L, R, D>& a, const Logic otherwise) noexcept
+{
+    packed::word_type unknown = 0;
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        const packed::LogicWord w = a.word(i);
+        if (w.unassigned != 0) {
+            return 'U'_l;
+        }
+        unknown |= w.unknown;
+    }
+    return (unknown != 0) ? 'X'_l : otherwise;
+}
+
+}
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Logic and_reduce(const StaticLogicVector<L, R, D>& a) noexcept
+{
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        const packed::LogicWord w = a.word(i);
+        const packed::word_type m = (i + 1 == a.words()) ? packed::tail_mask(a.length()) : ~packed::word_type(0);
+        if ((~(w.unknown | w.value) & m) != 0) {
+            return '0'_l;
+        }
+    }
+    return detail::reduce_unknowns(a, '1'_l);
+}
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Logic or_reduce(const StaticLogicVector<L, R, D>& a) noexcept
+{
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        const packed::LogicWord w = a.word(i);
+        if ((w.value & ~w.unknown) != 0) {
+            return '1'_l;
+        }
+    }
+    return detail::reduce_unknowns(a, '0'_l);
+}
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Logic xor_reduce(const StaticLogicVector<L, R, D>& a) noexcept
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        count += simd::scalar::popcount(a.word(i).value);
+    }
+    return detail::reduce_unknowns(a, (count & 1) ? '1'_l : '0'_l);
+}
+
+template <typename CharType, Bounds::index_type L, Bounds::index_type R, Direction D>
+std::basic_string<CharType> to_string(const StaticBitVector<L, R, D>& a)
+{
+    std::basic_string<CharType> r(a.length(), CharType());
+    for (std::size_t i = 0; i < a.length(); ++i) {
+        r[i] = to_char<CharType>(a[a.bounds().index(i)]);
+    }
+    return r;
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr bool operator==(const StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept
+{
+    if (a.length() != b.length()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        if (a.word(i) != b.word(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr bool operator!=(const StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept
+{
+    return !(a == b);
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1> operator&(const StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept
+{
+    StaticBitVector<L1, R1, D1> r(a);
+    return (r &= b);
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1>& operator&=(StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept
+{
+    static_assert(StaticBitVector<L1, R1, D1>::length() == StaticBitVector<L2, R2, D2>::length(), "Array lengths do not match");
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        a.set_word(i, a.word(i) & b.word(i));
+    }
+    return a;
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1> operator|(const StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept
+{
+    StaticBitVector<L1, R1, D1> r(a);
+    return (r |= b);
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1>& operator|=(StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept
+{
+    static_assert(StaticBitVector<L1, R1, D1>::length() == StaticBitVector<L2, R2, D2>::length(), "Array lengths do not match");
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        a.set_word(i, a.word(i) | b.word(i));
+    }
+    return a;
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1> operator^(const StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept
+{
+    StaticBitVector<L1, R1, D1> r(a);
+    return (r ^= b);
+}
+
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1>& operator^=(StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept
+{
+    static_assert(StaticBitVector<L1, R1, D1>::length() == StaticBitVector<L2, R2, D2>::length(), "Array lengths do not match");
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        a.set_word(i, a.word(i) ^ b.word(i));
+    }
+    return a;
+}
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr StaticBitVector<L, R, D> operator~(const StaticBitVector<L, R, D>& a) noexcept
+{
+    StaticBitVector<L, R, D> r(a);
+    return inplace_invert(r);
+}
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr StaticBitVector<L, R, D>& inplace_invert(StaticBitVector<L, R, D>& a) noexcept
+{
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        a.set_word(i, ~a.word(i));
+    }
+    return a;
+}
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Bit and_reduce(const StaticBitVector<L, R, D>& a) noexcept
+{
+    for (std::size_t i = 0; i + 1 < a.words(); ++i) {
+        if (~a.word(i) != 0) {
+            return '0'_b;
+        }
+    }
+    return to_bit((a.words() == 0) || (a.word(a.words() - 1) == packed::tail_mask(a.length())));
+}
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Bit or_reduce(const StaticBitVector<L, R, D>& a) noexcept
+{
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        if (a.word(i) != 0) {
+            return '1'_b;
+        }
+    }
+    return '0'_b;
+}
+
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Bit xor_reduce(const StaticBitVector<L, R, D>& a) noexcept
+{
+    packed::word_type parity = 0;
+    for (std::size_t i = 0; i < a.words(); ++i) {
+        parity ^= a.word(i);
+    }
+    // fold the word onto itself until the parity of all bits is in bit 0
+    for (std::size_t shift = packed::word_bits / 2; shift != 0; shift /= 2) {
+        parity ^= parity >> shift;
+    }
+    return to_bit(bool(parity & 1));
+}
+
+}
+
+#endif
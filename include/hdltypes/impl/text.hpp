@@ -0,0 +1,302 @@
+#ifndef HDLTYPES_IMPL_TEXT_HPP
+#define HDLTYPES_IMPL_TEXT_HPP
+#include "hdltypes/text.hpp"
+
+#include <cassert>
+#include <cstddef>      // size_t
+#include <new>          // bad_alloc
+#include <system_error> // errc
+#include <type_traits>  // enable_if
+#include <vector>       // vector
+
+#include "hdltypes/bit_vector.hpp"        // BitVector
+#include "hdltypes/impl/radix.hpp"        // format_decimal, parse_decimal, format_binary_digits, parse_binary_digits
+#include "hdltypes/impl/text_kernels.hpp" // parse_logic_chars, pack_logic_chars, unpack_logic_chars
+#include "hdltypes/logic.hpp"             // Logic, Bit
+#include "hdltypes/logic_vector.hpp"      // LogicVector
+#include "hdltypes/numeric.hpp"           // Unsigned, Signed
+#include "hdltypes/utils.hpp"             // HDLTYPES_TRY, HDLTYPES_CATCH
+
+namespace hdltypes {
+
+namespace detail {
+
+/** Extracts `count` bits, at most 8, starting at element offset `offset` of a packed plane. */
+inline unsigned extract_bits(const packed::word_type* const plane, const std::size_t offset, const std::size_t count) noexcept
+{
+    const std::size_t w = offset / packed::word_bits;
+    const std::size_t b = offset % packed::word_bits;
+    packed::word_type bits = plane[w] >> b;
+    if (b + count > packed::word_bits) {
+        bits |= plane[w + 1] << (packed::word_bits - b);
+    }
+    return unsigned(bits & ((packed::word_type(1) << count) - 1));
+}
+
+/** Reverses the low `count` bits, turning element order into digit order (leftmost element is the MSB). */
+inline unsigned reverse_bits(unsigned bits, const std::size_t count) noexcept
+{
+    unsigned r = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        r = (r << 1) | (bits & 1);
+        bits >>= 1;
+    }
+    return r;
+}
+
+/** Writes the digits of `n` elements, `bits` elements per digit, padding the first digit on the left.
+
+    `digit(offset, count)` returns the character for the `count` elements at `offset`,
+    which are the low bits of the digit.
+    */
+template <typename CharType, typename DigitFunc>
+CharType* format_digits(CharType* out, const std::size_t n, const std::size_t bits, const DigitFunc& digit) noexcept
+{
+    const std::size_t digits = (n + bits - 1) / bits;
+    const std::size_t pad = digits * bits - n;
+    for (std::size_t d = 0; d < digits; ++d) {
+        const std::size_t count = (d == 0) ? bits - pad : bits;
+        const std::size_t offset = (d == 0) ? 0 : d * bits - pad;
+        *out++ = digit(offset, count);
+    }
+    return out;
+}
+
+template <typename CharType>
+CharType digit_char(const unsigned value) noexcept
+{
+    return CharType("0123456789ABCDEF"[value]);
+}
+
+template <typename CharType>
+ToCharsResult<CharType> unsigned_to_chars(CharType* const first, CharType* const last, const Unsigned& a, const int base)
+{
+    const std::size_t room = std::size_t(last - first);
+    const unsigned bits = digit_bits(base);
+    if (bits != 0) {
+        const std::size_t n = std::max<std::size_t>((bit_length(a) + bits - 1) / bits, 1);
+        if (n > room) {
+            return { last, std::errc::value_too_large };
+        }
+        format_binary_digits(a.data(), a.limbs(), n, bits, first);
+        return { first + n, std::errc() };
+    }
+    const std::vector<char> digits = format_decimal(a);
+    if (digits.size() > room) {
+        return { last, std::errc::value_too_large };
+    }
+    for (std::size_t i = 0; i < digits.size(); ++i) {
+        first[i] = CharType(digits[i]);
+    }
+    return { first + digits.size(), std::errc() };
+}
+
+/** Reads the magnitude in the leading digits of [first, last) into `m`. */
+template <typename CharType>
+FromCharsResult<CharType> magnitude_from_chars(const CharType* const first, const CharType* const last, Unsigned& m, const int base)
+{
+    const std::size_t n = scan_digits(first, std::size_t(last - first), base);
+    if (n == 0) {
+        return { first, std::errc::invalid_argument };
+    }
+    const unsigned bits = digit_bits(base);
+    if (bits != 0) {
+        m = Unsigned(n * bits);
+        parse_binary_digits(first, n, bits, m.data());
+    } else {
+        m = parse_decimal(first, n);
+    }
+    return { first + n, std::errc() };
+}
+
+constexpr bool supported_base(const int base) noexcept
+{
+    return (base == 2) || (base == 8) || (base == 10) || (base == 16);
+}
+
+}
+
+constexpr std::size_t to_chars_max_length(const std::size_t width, const int base) noexcept
+{
+    // log10(2) < 0.30103
+    return (base == 10) ? width * 30103 / 100000 + 2
+        : (detail::digit_bits(base) != 0) ? (width + detail::digit_bits(base) - 1) / detail::digit_bits(base) + 1
+                                          : 0;
+}
+
+constexpr std::size_t to_chars_length(const std::size_t length, const Radix radix) noexcept
+{
+    return (length + unsigned(radix) - 1) / unsigned(radix);
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+std::size_t parse_logic(const CharType* const str, const std::size_t length, Logic* const out) noexcept
+{
+    return detail::parse_logic_chars(str, length, out);
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+std::size_t parse_bit(const CharType* const str, const std::size_t length, Bit* const out) noexcept
+{
+    return detail::parse_bit_chars(str, length, out);
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+std::size_t parse_logic_vector(const CharType* const str, const std::size_t length, LogicVector& out) noexcept
+{
+    assert(out.length() == length);
+    return detail::pack_logic_chars(str, length, out.write_planes().plane(0), out.words());
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+std::size_t parse_bit_vector(const CharType* const str, const std::size_t length, BitVector& out) noexcept
+{
+    assert(out.length() == length);
+    return detail::pack_bit_chars(str, length, out.data());
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+CharType* to_chars(CharType* const out, const Logic* const values, const std::size_t length) noexcept
+{
+    detail::format_logic_chars(values, length, out);
+    return out + length;
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+CharType* to_chars(CharType* const out, const Bit* const values, const std::size_t length) noexcept
+{
+    detail::format_bit_chars(values, length, out);
+    return out + length;
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+CharType* to_chars(CharType* const out, const LogicVector& a, const Radix radix) noexcept
+{
+    const std::size_t n = a.length();
+    if (radix == Radix::binary) {
+        detail::unpack_logic_chars(a.plane(0), a.words(), n, out);
+        return out + n;
+    }
+    const std::size_t bits = unsigned(radix);
+    const unsigned all = (1u << bits) - 1;
+    const bool z_pad = (n != 0) && (a[a.left()] == 'Z'_l);
+    return detail::format_digits(out, n, bits, [&](const std::size_t offset, const std::size_t count) {
+        const unsigned unknown = detail::extract_bits(a.plane(0), offset, count);
+        const unsigned value = detail::extract_bits(a.plane(1), offset, count);
+        const unsigned weak = detail::extract_bits(a.plane(2), offset, count);
+        const unsigned unassigned = detail::extract_bits(a.plane(3), offset, count);
+        // To_X01Z: L and H are known, Z is the only unknown value kept
+        const unsigned z_raw = unknown & value & ~weak & ~unassigned;
+        const unsigned x = unknown & ~z_raw;
+        const unsigned pad = all & ~((1u << count) - 1);
+        const unsigned z = detail::reverse_bits(z_raw, count) | (z_pad ? pad : 0u);
+        if (x == 0 && z == 0) {
+            return detail::digit_char<CharType>(detail::reverse_bits(value, count));
+        } else if (x == 0 && z == all) {
+            return CharType('Z');
+        }
+        return CharType('X');
+    });
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+CharType* to_chars(CharType* const out, const BitVector& a, const Radix radix) noexcept
+{
+    const std::size_t n = a.length();
+    if (radix == Radix::binary) {
+        detail::unpack_bit_chars(a.data(), n, out);
+        return out + n;
+    }
+    return detail::format_digits(out, n, unsigned(radix), [&](const std::size_t offset, const std::size_t count) {
+        return detail::digit_char<CharType>(detail::reverse_bits(detail::extract_bits(a.data(), offset, count), count));
+    });
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+ToCharsResult<CharType> to_chars(CharType* const first, CharType* const last, const Unsigned& a, const int base) noexcept
+{
+    if (!detail::supported_base(base)) {
+        return { first, std::errc::invalid_argument };
+    }
+    HDLTYPES_TRY {
+        return detail::unsigned_to_chars(first, last, a, base);
+    } HDLTYPES_CATCH(const std::bad_alloc&) {
+        return { last, std::errc::not_enough_memory };
+    }
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+ToCharsResult<CharType> to_chars(CharType* const first, CharType* const last, const Signed& a, const int base) noexcept
+{
+    if (!detail::supported_base(base)) {
+        return { first, std::errc::invalid_argument };
+    }
+    HDLTYPES_TRY {
+        if (!detail::is_negative(a)) {
+            return detail::unsigned_to_chars(first, last, to_unsigned(a), base);
+        }
+        if (first == last) {
+            return { last, std::errc::value_too_large };
+        }
+        *first = CharType('-');
+        // the magnitude of the most negative value is its own bit pattern read as unsigned
+        return detail::unsigned_to_chars(first + 1, last, to_unsigned(abs(a)), base);
+    } HDLTYPES_CATCH(const std::bad_alloc&) {
+        return { last, std::errc::not_enough_memory };
+    }
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+FromCharsResult<CharType> from_chars(const CharType* const first, const CharType* const last, Unsigned& value, const int base) noexcept
+{
+    if (!detail::supported_base(base)) {
+        return { first, std::errc::invalid_argument };
+    }
+    HDLTYPES_TRY {
+        Unsigned m;
+        const FromCharsResult<CharType> result = detail::magnitude_from_chars(first, last, m, base);
+        if (result.ec != std::errc()) {
+            return result;
+        }
+        if (detail::bit_length(m) > value.width()) {
+            return { result.ptr, std::errc::result_out_of_range };
+        }
+        value = resize(m, value.width());
+        return result;
+    } HDLTYPES_CATCH(const std::bad_alloc&) {
+        return { first, std::errc::not_enough_memory };
+    }
+}
+
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type>
+FromCharsResult<CharType> from_chars(const CharType* const first, const CharType* const last, Signed& value, const int base) noexcept
+{
+    if (!detail::supported_base(base)) {
+        return { first, std::errc::invalid_argument };
+    }
+    HDLTYPES_TRY {
+        const bool negative = (first != last) && (*first == CharType('-'));
+        Unsigned m;
+        FromCharsResult<CharType> result = detail::magnitude_from_chars(first + negative, last, m, base);
+        if (result.ec != std::errc()) {
+            return { first, result.ec };
+        }
+        if (detail::bit_length(m) > value.width()) {
+            return { result.ptr, std::errc::result_out_of_range };
+        }
+        // a magnitude that fits as a negative value only fits as a positive one if below 2^(width-1)
+        const Signed s = to_signed(resize(m, value.width()));
+        const Signed r = negative ? -s : s;
+        if ((detail::bit_length(m) != 0) && (detail::is_negative(r) != negative)) {
+            return { result.ptr, std::errc::result_out_of_range };
+        }
+        value = r;
+        return result;
+    } HDLTYPES_CATCH(const std::bad_alloc&) {
+        return { first, std::errc::not_enough_memory };
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,966 @@
+#ifndef HDLTYPES_IMPL_TEXT_KERNELS_HPP
+#define HDLTYPES_IMPL_TEXT_KERNELS_HPP
+
+#include <cstddef>     // size_t
+#include <cstdint>     // uint8_t, uint32_t
+#include <type_traits> // make_unsigned, is_trivially_copyable
+
+#include "hdltypes/impl/simd.hpp" // Isa, detect_isa
+#include "hdltypes/logic.hpp"     // Logic, Bit
+#include "hdltypes/packed.hpp"    // encode, word_type
+
+namespace hdltypes {
+
+static_assert(sizeof(Logic) == 1 && std::is_trivially_copyable<Logic>::value, "Bulk conversions store Logic values as bytes");
+static_assert(sizeof(Bit) == 1 && std::is_trivially_copyable<Bit>::value, "Bulk conversions store Bit values as bytes");
+
+namespace detail {
+
+/** Marks a character that is not a Logic or Bit in the character tables. */
+constexpr uint8_t invalid_char = 0xFF;
+
+constexpr uint8_t logic_char_value(const unsigned c) noexcept
+{
+    switch (c) {
+    case 'U':
+    case 'u':
+        return Logic::U;
+    case 'X':
+    case 'x':
+        return Logic::X;
+    case '0':
+        return Logic::_0;
+    case '1':
+        return Logic::_1;
+    case 'Z':
+    case 'z':
+        return Logic::Z;
+    case 'W':
+    case 'w':
+        return Logic::W;
+    case 'L':
+    case 'l':
+        return Logic::L;
+    case 'H':
+    case 'h':
+        return Logic::H;
+    case '-':
+        return Logic::DC;
+    default:
+        return invalid_char;
+    }
+}
+
+/** Lookups from a character to its Logic value and to the packed::encode code of that value. */
+struct LogicCharTable {
+    uint8_t value[256];
+    uint8_t code[256];
+
+    constexpr LogicCharTable() noexcept
+        : value {}
+        , code {}
+    {
+        for (unsigned c = 0; c < 256; ++c) {
+            value[c] = logic_char_value(c);
+            code[c] = (value[c] == invalid_char) ? invalid_char : packed::encode(Logic(Logic::value_type(value[c])));
+        }
+    }
+};
+
+inline const LogicCharTable& logic_char_table() noexcept
+{
+    static constexpr LogicCharTable table {};
+    return table;
+}
+
+/** Characters of Logic values, indexed by Logic::value_type. */
+inline const char* logic_chars() noexcept
+{
+    return "UX01ZWLH-";
+}
+
+/** Characters of Logic values, indexed by packed::encode code. */
+inline const char* logic_code_chars() noexcept
+{
+    return "0X1ZLWH-?U??????";
+}
+
+/** Index of a character in the character tables; non-ASCII characters map to an invalid entry. */
+template <typename CharType>
+constexpr std::size_t char_index(const CharType c) noexcept
+{
+    using unsigned_type = typename std::make_unsigned<CharType>::type;
+    return (static_cast<unsigned_type>(c) < 0x80) ? std::size_t(static_cast<unsigned_type>(c)) : 0xFF;
+}
+
+/** Value of a hexadecimal digit character of either case, or invalid_char. */
+template <typename CharType>
+constexpr unsigned hex_digit_value(const CharType c) noexcept
+{
+    return (char_index(c) - '0' < 10) ? unsigned(char_index(c) - '0')
+        : ((char_index(c) | 0x20) - 'a' < 6) ? unsigned((char_index(c) | 0x20) - 'a' + 10)
+                                             : invalid_char;
+}
+
+}
+
+namespace simd {
+
+/** Kernels converting between `char` strings and Logic or Bit values
+
+    Parsing kernels return the position of the first character that could not be converted,
+    or `n` if all were converted. `parse_*` kernels write one byte per character.
+    `pack_logic` writes the 4 bit-planes of packed::LogicWord into `planes`, each plane
+    `stride` words apart. `pack_bit` writes one bit per character into `words`.
+
+    Formatting kernels write `n` characters to `out`. `format_*` kernels read one value per
+    byte, `unpack_*` kernels read the packed layouts written by the `pack_*` kernels.
+
+    The hexadecimal kernels convert between the digits of an integer, most significant digit
+    first, and its words, least significant word first. `scan_hex` returns the length of the
+    leading run of digits. `pack_hex` writes the value of `n` valid digits to `(n + 15) / 16`
+    words and `format_hex` writes the low `n` digits of `words` in uppercase.
+    */
+struct TextKernels {
+    std::size_t (*parse_logic)(const char* str, std::size_t n, uint8_t* out) noexcept;
+    std::size_t (*parse_bit)(const char* str, std::size_t n, uint8_t* out) noexcept;
+    std::size_t (*pack_logic)(const char* str, std::size_t n, word_type* planes, std::size_t stride) noexcept;
+    std::size_t (*pack_bit)(const char* str, std::size_t n, word_type* words) noexcept;
+    void (*format_logic)(const uint8_t* values, std::size_t n, char* out) noexcept;
+    void (*format_bit)(const uint8_t* values, std::size_t n, char* out) noexcept;
+    void (*unpack_logic)(const word_type* planes, std::size_t stride, std::size_t n, char* out) noexcept;
+    void (*unpack_bit)(const word_type* words, std::size_t n, char* out) noexcept;
+    std::size_t (*scan_hex)(const char* str, std::size_t n) noexcept;
+    void (*pack_hex)(const char* str, std::size_t n, word_type* words) noexcept;
+    void (*format_hex)(const word_type* words, std::size_t n, char* out) noexcept;
+};
+
+namespace scalar {
+
+template <typename CharType>
+std::size_t parse_logic(const CharType* const str, const std::size_t n, uint8_t* const out) noexcept
+{
+    const auto& table = detail::logic_char_table();
+    for (std::size_t i = 0; i < n; ++i) {
+        const uint8_t v = table.value[detail::char_index(str[i])];
+        if (v == detail::invalid_char) {
+            return i;
+        }
+        out[i] = v;
+    }
+    return n;
+}
+
+template <typename CharType>
+std::size_t parse_bit(const CharType* const str, const std::size_t n, uint8_t* const out) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t v = detail::char_index(str[i]) - std::size_t('0');
+        if (v > 1) {
+            return i;
+        }
+        out[i] = uint8_t(v);
+    }
+    return n;
+}
+
+template <typename CharType>
+std::size_t pack_logic(const CharType* const str, const std::size_t n, word_type* const planes, const std::size_t stride) noexcept
+{
+    const auto& table = detail::logic_char_table();
+    for (std::size_t base = 0; base < n; base += packed::word_bits) {
+        word_type p[packed::logic_planes] = {};
+        const std::size_t m = (n - base < packed::word_bits) ? n - base : packed::word_bits;
+        for (std::size_t b = 0; b < m; ++b) {
+            const uint8_t code = table.code[detail::char_index(str[base + b])];
+            if (code == detail::invalid_char) {
+                return base + b;
+            }
+            for (std::size_t k = 0; k < packed::logic_planes; ++k) {
+                p[k] |= word_type((code >> k) & 1) << b;
+            }
+        }
+        for (std::size_t k = 0; k < packed::logic_planes; ++k) {
+            planes[k * stride + base / packed::word_bits] = p[k];
+        }
+    }
+    return n;
+}
+
+template <typename CharType>
+std::size_t pack_bit(const CharType* const str, const std::size_t n, word_type* const words) noexcept
+{
+    for (std::size_t base = 0; base < n; base += packed::word_bits) {
+        word_type p = 0;
+        const std::size_t m = (n - base < packed::word_bits) ? n - base : packed::word_bits;
+        for (std::size_t b = 0; b < m; ++b) {
+            const std::size_t v = detail::char_index(str[base + b]) - std::size_t('0');
+            if (v > 1) {
+                return base + b;
+            }
+            p |= word_type(v) << b;
+        }
+        words[base / packed::word_bits] = p;
+    }
+    return n;
+}
+
+template <typename CharType>
+void format_logic(const uint8_t* const values, const std::size_t n, CharType* const out) noexcept
+{
+    const char* const chars = detail::logic_chars();
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = CharType(chars[values[i]]);
+    }
+}
+
+template <typename CharType>
+void format_bit(const uint8_t* const values, const std::size_t n, CharType* const out) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = CharType('0' + values[i]);
+    }
+}
+
+/** Writes the characters of elements [first, last) of packed planes to the same positions of `out`. */
+template <typename CharType>
+void unpack_logic_range(const word_type* const planes, const std::size_t stride, const std::size_t first, const std::size_t last, CharType* const out) noexcept
+{
+    const char* const chars = detail::logic_code_chars();
+    for (std::size_t i = first; i < last; ++i) {
+        const std::size_t w = i / packed::word_bits;
+        const std::size_t b = i % packed::word_bits;
+        std::size_t code = 0;
+        for (std::size_t k = 0; k < packed::logic_planes; ++k) {
+            code |= std::size_t((planes[k * stride + w] >> b) & 1) << k;
+        }
+        out[i] = CharType(chars[code]);
+    }
+}
+
+template <typename CharType>
+void unpack_logic(const word_type* const planes, const std::size_t stride, const std::size_t n, CharType* const out) noexcept
+{
+    unpack_logic_range(planes, stride, 0, n, out);
+}
+
+/** Writes the characters of elements [first, last) of packed words to the same positions of `out`. */
+template <typename CharType>
+void unpack_bit_range(const word_type* const words, const std::size_t first, const std::size_t last, CharType* const out) noexcept
+{
+    for (std::size_t i = first; i < last; ++i) {
+        out[i] = CharType('0' + ((words[i / packed::word_bits] >> (i % packed::word_bits)) & 1));
+    }
+}
+
+template <typename CharType>
+void unpack_bit(const word_type* const words, const std::size_t n, CharType* const out) noexcept
+{
+    unpack_bit_range(words, 0, n, out);
+}
+
+template <typename CharType>
+std::size_t scan_hex(const CharType* const str, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        if (detail::hex_digit_value(str[i]) == detail::invalid_char) {
+            return i;
+        }
+    }
+    return n;
+}
+
+/** Value of at most 16 valid hexadecimal digits. */
+template <typename CharType>
+word_type pack_hex_word(const CharType* const str, const std::size_t n) noexcept
+{
+    word_type w = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        w = (w << 4) | detail::hex_digit_value(str[i]);
+    }
+    return w;
+}
+
+template <typename CharType>
+void pack_hex(const CharType* const str, const std::size_t n, word_type* const words) noexcept
+{
+    for (std::size_t end = n, w = 0; end > 0; ++w) {
+        const std::size_t count = (end < 16) ? end : 16;
+        end -= count;
+        words[w] = pack_hex_word(str + end, count);
+    }
+}
+
+/** Writes digits [first, last) of the `n` digit hexadecimal string of `words` to the same positions of `out`. */
+template <typename CharType>
+void format_hex_range(const word_type* const words, const std::size_t n, const std::size_t first, const std::size_t last, CharType* const out) noexcept
+{
+    for (std::size_t i = first; i < last; ++i) {
+        const std::size_t d = n - 1 - i;
+        out[i] = CharType("0123456789ABCDEF"[(words[d / 16] >> (4 * (d % 16))) & 0xF]);
+    }
+}
+
+template <typename CharType>
+void format_hex(const word_type* const words, const std::size_t n, CharType* const out) noexcept
+{
+    format_hex_range(words, n, 0, n, out);
+}
+
+}
+
+#if HDLTYPES_SIMD_X86
+
+/*
+  Classification of Logic characters with byte shuffles.
+
+  Valid characters are identified by looking up a class mask by the high nibble and
+  by the low nibble of the character, a character is valid if the masks share a bit:
+
+    class   high nibbles    low nibbles
+    0x01    2               D               '-'
+    0x02    3               0 1             '0' '1'
+    0x04    4 6             8 C             'H' 'L' 'h' 'l'
+    0x08    5 7             5 7 8 A         'U' 'W' 'X' 'Z' 'u' 'w' 'x' 'z'
+
+  The value is then looked up by the low nibble, in one of two tables depending on
+  whether the character is in class 0x08 (the only collision is 'H' with 'X').
+*/
+
+namespace ssse3 {
+
+__attribute__((target("ssse3"))) inline __m128i classify_logic(const __m128i c, uint32_t& invalid) noexcept
+{
+    const __m128i hi_table = _mm_setr_epi8(0, 0, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i lo_table = _mm_setr_epi8(0x02, 0x02, 0, 0, 0, 0x08, 0, 0x08, 0x0C, 0, 0x08, 0, 0x04, 0x01, 0, 0);
+    const __m128i unknown_table = _mm_setr_epi8(0, 0, 0, 0, 0, Logic::U, 0, Logic::W, Logic::X, 0, Logic::Z, 0, 0, 0, 0, 0);
+    const __m128i other_table = _mm_setr_epi8(Logic::_0, Logic::_1, 0, 0, 0, 0, 0, 0, Logic::H, 0, 0, 0, Logic::L, Logic::DC, 0, 0);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i lo = _mm_and_si128(c, nibble);
+    const __m128i hi = _mm_and_si128(_mm_srli_epi16(c, 4), nibble);
+    const __m128i hi_class = _mm_shuffle_epi8(hi_table, hi);
+    const __m128i lo_class = _mm_shuffle_epi8(lo_table, lo);
+    invalid = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(hi_class, lo_class), _mm_setzero_si128())));
+    const __m128i is_unknown = _mm_cmpeq_epi8(_mm_and_si128(hi_class, _mm_set1_epi8(0x08)), _mm_set1_epi8(0x08));
+    return _mm_or_si128(
+        _mm_and_si128(is_unknown, _mm_shuffle_epi8(unknown_table, lo)),
+        _mm_andnot_si128(is_unknown, _mm_shuffle_epi8(other_table, lo)));
+}
+
+__attribute__((target("ssse3"))) inline __m128i classify_bit(const __m128i c, uint32_t& invalid) noexcept
+{
+    const __m128i v = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    const __m128i valid = _mm_cmpeq_epi8(_mm_and_si128(v, _mm_set1_epi8(~1)), _mm_setzero_si128());
+    invalid = uint32_t(_mm_movemask_epi8(valid)) ^ 0xFFFF;
+    return v;
+}
+
+__attribute__((target("ssse3"))) inline std::size_t parse_logic(const char* const str, const std::size_t n, uint8_t* const out) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        uint32_t invalid = 0;
+        const __m128i v = classify_logic(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i)), invalid);
+        if (invalid != 0) {
+            return i + std::size_t(__builtin_ctz(invalid));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), v);
+    }
+    return i + scalar::parse_logic(str + i, n - i, out + i);
+}
+
+__attribute__((target("ssse3"))) inline std::size_t parse_bit(const char* const str, const std::size_t n, uint8_t* const out) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        uint32_t invalid = 0;
+        const __m128i v = classify_bit(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i)), invalid);
+        if (invalid != 0) {
+            return i + std::size_t(__builtin_ctz(invalid));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), v);
+    }
+    return i + scalar::parse_bit(str + i, n - i, out + i);
+}
+
+__attribute__((target("ssse3"))) inline std::size_t pack_logic(const char* const str, const std::size_t n, word_type* const planes, const std::size_t stride) noexcept
+{
+    const __m128i code_table = _mm_setr_epi8(0b1001, 0b0001, 0b0000, 0b0010, 0b0011, 0b0101, 0b0100, 0b0110, 0b0111, 0, 0, 0, 0, 0, 0, 0);
+    std::size_t i = 0;
+    for (; i + packed::word_bits <= n; i += packed::word_bits) {
+        word_type p0 = 0, p1 = 0, p2 = 0, p3 = 0;
+        for (std::size_t j = 0; j < packed::word_bits; j += 16) {
+            uint32_t invalid = 0;
+            const __m128i v = classify_logic(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i + j)), invalid);
+            if (invalid != 0) {
+                return i + j + std::size_t(__builtin_ctz(invalid));
+            }
+            const __m128i code = _mm_shuffle_epi8(code_table, v);
+            p0 |= word_type(uint32_t(_mm_movemask_epi8(_mm_slli_epi16(code, 7)))) << j;
+            p1 |= word_type(uint32_t(_mm_movemask_epi8(_mm_slli_epi16(code, 6)))) << j;
+            p2 |= word_type(uint32_t(_mm_movemask_epi8(_mm_slli_epi16(code, 5)))) << j;
+            p3 |= word_type(uint32_t(_mm_movemask_epi8(_mm_slli_epi16(code, 4)))) << j;
+        }
+        const std::size_t w = i / packed::word_bits;
+        planes[0 * stride + w] = p0;
+        planes[1 * stride + w] = p1;
+        planes[2 * stride + w] = p2;
+        planes[3 * stride + w] = p3;
+    }
+    return i + scalar::pack_logic(str + i, n - i, planes + i / packed::word_bits, stride);
+}
+
+__attribute__((target("ssse3"))) inline std::size_t pack_bit(const char* const str, const std::size_t n, word_type* const words) noexcept
+{
+    std::size_t i = 0;
+    for (; i + packed::word_bits <= n; i += packed::word_bits) {
+        word_type p = 0;
+        for (std::size_t j = 0; j < packed::word_bits; j += 16) {
+            uint32_t invalid = 0;
+            const __m128i v = classify_bit(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i + j)), invalid);
+            if (invalid != 0) {
+                return i + j + std::size_t(__builtin_ctz(invalid));
+            }
+            p |= word_type(uint32_t(_mm_movemask_epi8(_mm_slli_epi16(v, 7)))) << j;
+        }
+        words[i / packed::word_bits] = p;
+    }
+    return i + scalar::pack_bit(str + i, n - i, words + i / packed::word_bits);
+}
+
+/** Byte i of the result is all ones if bit i of `bits` is set. */
+__attribute__((target("ssse3"))) inline __m128i expand_bits(const uint32_t bits) noexcept
+{
+    const __m128i spread = _mm_shuffle_epi8(_mm_cvtsi32_si128(int(bits)), _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1));
+    const __m128i select = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    return _mm_cmpeq_epi8(_mm_and_si128(spread, select), select);
+}
+
+__attribute__((target("ssse3"))) inline void format_logic(const uint8_t* const values, const std::size_t n, char* const out) noexcept
+{
+    const __m128i chars = _mm_setr_epi8('U', 'X', '0', '1', 'Z', 'W', 'L', 'H', '-', '?', '?', '?', '?', '?', '?', '?');
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_shuffle_epi8(chars, v));
+    }
+    scalar::format_logic(values + i, n - i, out + i);
+}
+
+__attribute__((target("ssse3"))) inline void format_bit(const uint8_t* const values, const std::size_t n, char* const out) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi8(v, _mm_set1_epi8('0')));
+    }
+    scalar::format_bit(values + i, n - i, out + i);
+}
+
+__attribute__((target("ssse3"))) inline void unpack_logic(const word_type* const planes, const std::size_t stride, const std::size_t n, char* const out) noexcept
+{
+    const __m128i chars = _mm_setr_epi8('0', 'X', '1', 'Z', 'L', 'W', 'H', '-', '?', 'U', '?', '?', '?', '?', '?', '?');
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const std::size_t w = i / packed::word_bits;
+        const std::size_t b = i % packed::word_bits;
+        __m128i code = _mm_setzero_si128();
+        for (std::size_t k = 0; k < packed::logic_planes; ++k) {
+            const uint32_t bits = uint32_t((planes[k * stride + w] >> b) & 0xFFFF);
+            code = _mm_or_si128(code, _mm_and_si128(expand_bits(bits), _mm_set1_epi8(char(1 << k))));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_shuffle_epi8(chars, code));
+    }
+    scalar::unpack_logic_range(planes, stride, i, n, out);
+}
+
+__attribute__((target("ssse3"))) inline void unpack_bit(const word_type* const words, const std::size_t n, char* const out) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const uint32_t bits = uint32_t((words[i / packed::word_bits] >> (i % packed::word_bits)) & 0xFFFF);
+        const __m128i v = _mm_sub_epi8(_mm_set1_epi8('0'), expand_bits(bits));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), v);
+    }
+    scalar::unpack_bit_range(words, i, n, out);
+}
+
+/** Mask of the bytes that are not hexadecimal digits. */
+__attribute__((target("ssse3"))) inline uint32_t invalid_hex(const __m128i c) noexcept
+{
+    const __m128i digit = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    const __m128i letter = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+    return uint32_t(_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter))) ^ 0xFFFF;
+}
+
+/** Values of 16 valid hexadecimal digits, one per byte. */
+__attribute__((target("ssse3"))) inline __m128i hex_values(const __m128i c) noexcept
+{
+    // '0'-'9' are unchanged by setting bit 5, which lowercases the letters
+    const __m128i v = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('0'));
+    const __m128i letter = _mm_cmpgt_epi8(v, _mm_set1_epi8(9));
+    return _mm_sub_epi8(v, _mm_and_si128(letter, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+/** Joins the 16 digit values of each 128-bit lane into a word in the low 8 bytes of the lane. */
+__attribute__((target("ssse3"))) inline __m128i hex_word(const __m128i values) noexcept
+{
+    // pairs of digits into bytes, then the bytes into little-endian order
+    const __m128i bytes = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+    return _mm_shuffle_epi8(bytes, _mm_setr_epi8(14, 12, 10, 8, 6, 4, 2, 0, -1, -1, -1, -1, -1, -1, -1, -1));
+}
+
+/** Digits of the words in the low 8 bytes of each lane as characters, most significant first. */
+__attribute__((target("ssse3"))) inline __m128i hex_chars(const __m128i words) noexcept
+{
+    const __m128i chars = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i hi = _mm_and_si128(_mm_srli_epi16(words, 4), nibble);
+    const __m128i lo = _mm_and_si128(words, nibble);
+    const __m128i digits = _mm_shuffle_epi8(_mm_unpacklo_epi8(hi, lo), _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1));
+    return _mm_shuffle_epi8(chars, digits);
+}
+
+__attribute__((target("ssse3"))) inline std::size_t scan_hex(const char* const str, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const uint32_t invalid = invalid_hex(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i)));
+        if (invalid != 0) {
+            return i + std::size_t(__builtin_ctz(invalid));
+        }
+    }
+    return i + scalar::scan_hex(str + i, n - i);
+}
+
+__attribute__((target("ssse3"))) inline void pack_hex(const char* const str, const std::size_t n, word_type* const words) noexcept
+{
+    std::size_t w = 0;
+    for (; 16 * (w + 1) <= n; ++w) {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + n - 16 * (w + 1)));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(words + w), hex_word(hex_values(c)));
+    }
+    if (16 * w < n) {
+        words[w] = scalar::pack_hex_word(str, n - 16 * w);
+    }
+}
+
+__attribute__((target("ssse3"))) inline void format_hex(const word_type* const words, const std::size_t n, char* const out) noexcept
+{
+    const std::size_t head = n % 16;
+    scalar::format_hex_range(words, n, 0, head, out);
+    for (std::size_t w = n / 16; w-- > 0;) {
+        const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(words + w));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + n - 16 * (w + 1)), hex_chars(v));
+    }
+}
+
+}
+
+namespace avx2 {
+
+__attribute__((target("avx2"))) inline __m256i classify_logic(const __m256i c, uint32_t& invalid) noexcept
+{
+    const __m256i hi_table = _mm256_setr_epi8(
+        0, 0, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i lo_table = _mm256_setr_epi8(
+        0x02, 0x02, 0, 0, 0, 0x08, 0, 0x08, 0x0C, 0, 0x08, 0, 0x04, 0x01, 0, 0,
+        0x02, 0x02, 0, 0, 0, 0x08, 0, 0x08, 0x0C, 0, 0x08, 0, 0x04, 0x01, 0, 0);
+    const __m256i unknown_table = _mm256_setr_epi8(
+        0, 0, 0, 0, 0, Logic::U, 0, Logic::W, Logic::X, 0, Logic::Z, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, Logic::U, 0, Logic::W, Logic::X, 0, Logic::Z, 0, 0, 0, 0, 0);
+    const __m256i other_table = _mm256_setr_epi8(
+        Logic::_0, Logic::_1, 0, 0, 0, 0, 0, 0, Logic::H, 0, 0, 0, Logic::L, Logic::DC, 0, 0,
+        Logic::_0, Logic::_1, 0, 0, 0, 0, 0, 0, Logic::H, 0, 0, 0, Logic::L, Logic::DC, 0, 0);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i lo = _mm256_and_si256(c, nibble);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(c, 4), nibble);
+    const __m256i hi_class = _mm256_shuffle_epi8(hi_table, hi);
+    const __m256i lo_class = _mm256_shuffle_epi8(lo_table, lo);
+    invalid = uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(hi_class, lo_class), _mm256_setzero_si256())));
+    const __m256i is_unknown = _mm256_cmpeq_epi8(_mm256_and_si256(hi_class, _mm256_set1_epi8(0x08)), _mm256_set1_epi8(0x08));
+    return _mm256_blendv_epi8(_mm256_shuffle_epi8(other_table, lo), _mm256_shuffle_epi8(unknown_table, lo), is_unknown);
+}
+
+__attribute__((target("avx2"))) inline __m256i classify_bit(const __m256i c, uint32_t& invalid) noexcept
+{
+    const __m256i v = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+    const __m256i valid = _mm256_cmpeq_epi8(_mm256_and_si256(v, _mm256_set1_epi8(~1)), _mm256_setzero_si256());
+    invalid = ~uint32_t(_mm256_movemask_epi8(valid));
+    return v;
+}
+
+__attribute__((target("avx2"))) inline std::size_t parse_logic(const char* const str, const std::size_t n, uint8_t* const out) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        uint32_t invalid = 0;
+        const __m256i v = classify_logic(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i)), invalid);
+        if (invalid != 0) {
+            return i + std::size_t(__builtin_ctz(invalid));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+    }
+    return i + ssse3::parse_logic(str + i, n - i, out + i);
+}
+
+__attribute__((target("avx2"))) inline std::size_t parse_bit(const char* const str, const std::size_t n, uint8_t* const out) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        uint32_t invalid = 0;
+        const __m256i v = classify_bit(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i)), invalid);
+        if (invalid != 0) {
+            return i + std::size_t(__builtin_ctz(invalid));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+    }
+    return i + ssse3::parse_bit(str + i, n - i, out + i);
+}
+
+__attribute__((target("avx2"))) inline std::size_t pack_logic(const char* const str, const std::size_t n, word_type* const planes, const std::size_t stride) noexcept
+{
+    const __m256i code_table = _mm256_setr_epi8(
+        0b1001, 0b0001, 0b0000, 0b0010, 0b0011, 0b0101, 0b0100, 0b0110, 0b0111, 0, 0, 0, 0, 0, 0, 0,
+        0b1001, 0b0001, 0b0000, 0b0010, 0b0011, 0b0101, 0b0100, 0b0110, 0b0111, 0, 0, 0, 0, 0, 0, 0);
+    std::size_t i = 0;
+    for (; i + packed::word_bits <= n; i += packed::word_bits) {
+        word_type p0 = 0, p1 = 0, p2 = 0, p3 = 0;
+        for (std::size_t j = 0; j < packed::word_bits; j += 32) {
+            uint32_t invalid = 0;
+            const __m256i v = classify_logic(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i + j)), invalid);
+            if (invalid != 0) {
+                return i + j + std::size_t(__builtin_ctz(invalid));
+            }
+            const __m256i code = _mm256_shuffle_epi8(code_table, v);
+            p0 |= word_type(uint32_t(_mm256_movemask_epi8(_mm256_slli_epi16(code, 7)))) << j;
+            p1 |= word_type(uint32_t(_mm256_movemask_epi8(_mm256_slli_epi16(code, 6)))) << j;
+            p2 |= word_type(uint32_t(_mm256_movemask_epi8(_mm256_slli_epi16(code, 5)))) << j;
+            p3 |= word_type(uint32_t(_mm256_movemask_epi8(_mm256_slli_epi16(code, 4)))) << j;
+        }
+        const std::size_t w = i / packed::word_bits;
+        planes[0 * stride + w] = p0;
+        planes[1 * stride + w] = p1;
+        planes[2 * stride + w] = p2;
+        planes[3 * stride + w] = p3;
+    }
+    return i + scalar::pack_logic(str + i, n - i, planes + i / packed::word_bits, stride);
+}
+
+__attribute__((target("avx2"))) inline std::size_t pack_bit(const char* const str, const std::size_t n, word_type* const words) noexcept
+{
+    std::size_t i = 0;
+    for (; i + packed::word_bits <= n; i += packed::word_bits) {
+        word_type p = 0;
+        for (std::size_t j = 0; j < packed::word_bits; j += 32) {
+            uint32_t invalid = 0;
+            const __m256i v = classify_bit(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i + j)), invalid);
+            if (invalid != 0) {
+                return i + j + std::size_t(__builtin_ctz(invalid));
+            }
+            p |= word_type(uint32_t(_mm256_movemask_epi8(_mm256_slli_epi16(v, 7)))) << j;
+        }
+        words[i / packed::word_bits] = p;
+    }
+    return i + scalar::pack_bit(str + i, n - i, words + i / packed::word_bits);
+}
+
+/** Byte i of the result is all ones if bit i of `bits` is set. */
+__attribute__((target("avx2"))) inline __m256i expand_bits(const uint32_t bits) noexcept
+{
+    const __m256i spread = _mm256_shuffle_epi8(_mm256_set1_epi32(int(bits)), _mm256_setr_epi8(
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3));
+    const __m256i select = _mm256_set1_epi64x(static_cast<long long>(0x8040201008040201ULL));
+    return _mm256_cmpeq_epi8(_mm256_and_si256(spread, select), select);
+}
+
+__attribute__((target("avx2"))) inline void format_logic(const uint8_t* const values, const std::size_t n, char* const out) noexcept
+{
+    const __m256i chars = _mm256_setr_epi8(
+        'U', 'X', '0', '1', 'Z', 'W', 'L', 'H', '-', '?', '?', '?', '?', '?', '?', '?',
+        'U', 'X', '0', '1', 'Z', 'W', 'L', 'H', '-', '?', '?', '?', '?', '?', '?', '?');
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_shuffle_epi8(chars, v));
+    }
+    ssse3::format_logic(values + i, n - i, out + i);
+}
+
+__attribute__((target("avx2"))) inline void format_bit(const uint8_t* const values, const std::size_t n, char* const out) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi8(v, _mm256_set1_epi8('0')));
+    }
+    ssse3::format_bit(values + i, n - i, out + i);
+}
+
+__attribute__((target("avx2"))) inline void unpack_logic(const word_type* const planes, const std::size_t stride, const std::size_t n, char* const out) noexcept
+{
+    const __m256i chars = _mm256_setr_epi8(
+        '0', 'X', '1', 'Z', 'L', 'W', 'H', '-', '?', 'U', '?', '?', '?', '?', '?', '?',
+        '0', 'X', '1', 'Z', 'L', 'W', 'H', '-', '?', 'U', '?', '?', '?', '?', '?', '?');
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const std::size_t w = i / packed::word_bits;
+        const std::size_t b = i % packed::word_bits;
+        __m256i code = _mm256_setzero_si256();
+        for (std::size_t k = 0; k < packed::logic_planes; ++k) {
+            const uint32_t bits = uint32_t(planes[k * stride + w] >> b);
+            code = _mm256_or_si256(code, _mm256_and_si256(expand_bits(bits), _mm256_set1_epi8(char(1 << k))));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_shuffle_epi8(chars, code));
+    }
+    scalar::unpack_logic_range(planes, stride, i, n, out);
+}
+
+__attribute__((target("avx2"))) inline void unpack_bit(const word_type* const words, const std::size_t n, char* const out) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const uint32_t bits = uint32_t(words[i / packed::word_bits] >> (i % packed::word_bits));
+        const __m256i v = _mm256_sub_epi8(_mm256_set1_epi8('0'), expand_bits(bits));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+    }
+    scalar::unpack_bit_range(words, i, n, out);
+}
+
+__attribute__((target("avx2"))) inline std::size_t scan_hex(const char* const str, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i));
+        const __m256i digit = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+        const __m256i letter = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+        const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+        const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+        const uint32_t invalid = ~uint32_t(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)));
+        if (invalid != 0) {
+            return i + std::size_t(__builtin_ctz(invalid));
+        }
+    }
+    return i + ssse3::scan_hex(str + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline void pack_hex(const char* const str, const std::size_t n, word_type* const words) noexcept
+{
+    std::size_t w = 0;
+    for (; 16 * (w + 2) <= n; w += 2) {
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + n - 16 * (w + 2)));
+        const __m256i v = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+        const __m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+        const __m256i values = _mm256_sub_epi8(d, _mm256_and_si256(_mm256_cmpgt_epi8(d, _mm256_set1_epi8(9)), _mm256_set1_epi8('a' - '0' - 10)));
+        const __m256i bytes = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110));
+        const __m256i packed = _mm256_shuffle_epi8(bytes, _mm256_setr_epi8(
+            14, 12, 10, 8, 6, 4, 2, 0, -1, -1, -1, -1, -1, -1, -1, -1,
+            14, 12, 10, 8, 6, 4, 2, 0, -1, -1, -1, -1, -1, -1, -1, -1));
+        // the upper lane holds the less significant digits
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(words + w), _mm256_extracti128_si256(packed, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(words + w + 1), _mm256_castsi256_si128(packed));
+    }
+    ssse3::pack_hex(str, n - 16 * w, words + w);
+}
+
+__attribute__((target("avx2"))) inline void format_hex(const word_type* const words, const std::size_t n, char* const out) noexcept
+{
+    const __m256i chars = _mm256_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const std::size_t head = n % 32;
+    ssse3::format_hex(words + n / 32 * 2, head, out);
+    for (std::size_t w = n / 32 * 2; w > 0; w -= 2) {
+        // the more significant word goes in the lower lane, which is written first
+        const __m256i v = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(words + w - 1))),
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(words + w - 2)), 1);
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+        const __m256i lo = _mm256_and_si256(v, nibble);
+        const __m256i digits = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(hi, lo), _mm256_setr_epi8(
+            14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+            14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + n - 16 * w), _mm256_shuffle_epi8(chars, digits));
+    }
+}
+
+}
+
+#endif
+
+/** Returns the text kernels for the given level. The running CPU must support the level. */
+inline const TextKernels& text_kernels(const Isa isa) noexcept
+{
+    static const TextKernels scalar_kernels {
+        scalar::parse_logic<char>, scalar::parse_bit<char>, scalar::pack_logic<char>, scalar::pack_bit<char>,
+        scalar::format_logic<char>, scalar::format_bit<char>, scalar::unpack_logic<char>, scalar::unpack_bit<char>,
+        scalar::scan_hex<char>, scalar::pack_hex<char>, scalar::format_hex<char>
+    };
+#if HDLTYPES_SIMD_X86
+    static const TextKernels ssse3_kernels {
+        ssse3::parse_logic, ssse3::parse_bit, ssse3::pack_logic, ssse3::pack_bit,
+        ssse3::format_logic, ssse3::format_bit, ssse3::unpack_logic, ssse3::unpack_bit,
+        ssse3::scan_hex, ssse3::pack_hex, ssse3::format_hex
+    };
+    static const TextKernels avx2_kernels {
+        avx2::parse_logic, avx2::parse_bit, avx2::pack_logic, avx2::pack_bit,
+        avx2::format_logic, avx2::format_bit, avx2::unpack_logic, avx2::unpack_bit,
+        avx2::scan_hex, avx2::pack_hex, avx2::format_hex
+    };
+    switch (isa) {
+    case Isa::avx2:
+        return avx2_kernels;
+    case Isa::ssse3:
+        return ssse3_kernels;
+    case Isa::sse2:
+    case Isa::scalar:
+        break;
+    }
+#else
+    (void)isa;
+#endif
+    return scalar_kernels;
+}
+
+/** Returns the best text kernels for the running CPU. */
+inline const TextKernels& text_kernels() noexcept
+{
+    static const TextKernels& kernels = text_kernels(detect_isa());
+    return kernels;
+}
+
+}
+
+namespace detail {
+
+inline std::size_t parse_logic_chars(const char* const str, const std::size_t n, Logic* const out) noexcept
+{
+    return simd::text_kernels().parse_logic(str, n, reinterpret_cast<uint8_t*>(out));
+}
+
+template <typename CharType>
+std::size_t parse_logic_chars(const CharType* const str, const std::size_t n, Logic* const out) noexcept
+{
+    return simd::scalar::parse_logic(str, n, reinterpret_cast<uint8_t*>(out));
+}
+
+inline std::size_t parse_bit_chars(const char* const str, const std::size_t n, Bit* const out) noexcept
+{
+    return simd::text_kernels().parse_bit(str, n, reinterpret_cast<uint8_t*>(out));
+}
+
+template <typename CharType>
+std::size_t parse_bit_chars(const CharType* const str, const std::size_t n, Bit* const out) noexcept
+{
+    return simd::scalar::parse_bit(str, n, reinterpret_cast<uint8_t*>(out));
+}
+
+inline std::size_t pack_logic_chars(const char* const str, const std::size_t n, packed::word_type* const planes, const std::size_t stride) noexcept
+{
+    return simd::text_kernels().pack_logic(str, n, planes, stride);
+}
+
+template <typename CharType>
+std::size_t pack_logic_chars(const CharType* const str, const std::size_t n, packed::word_type* const planes, const std::size_t stride) noexcept
+{
+    return simd::scalar::pack_logic(str, n, planes, stride);
+}
+
+inline std::size_t pack_bit_chars(const char* const str, const std::size_t n, packed::word_type* const words) noexcept
+{
+    return simd::text_kernels().pack_bit(str, n, words);
+}
+
+template <typename CharType>
+std::size_t pack_bit_chars(const CharType* const str, const std::size_t n, packed::word_type* const words) noexcept
+{
+    return simd::scalar::pack_bit(str, n, words);
+}
+
+inline void format_logic_chars(const Logic* const values, const std::size_t n, char* const out) noexcept
+{
+    simd::text_kernels().format_logic(reinterpret_cast<const uint8_t*>(values), n, out);
+}
+
+template <typename CharType>
+void format_logic_chars(const Logic* const values, const std::size_t n, CharType* const out) noexcept
+{
+    simd::scalar::format_logic(reinterpret_cast<const uint8_t*>(values), n, out);
+}
+
+inline void format_bit_chars(const Bit* const values, const std::size_t n, char* const out) noexcept
+{
+    simd::text_kernels().format_bit(reinterpret_cast<const uint8_t*>(values), n, out);
+}
+
+template <typename CharType>
+void format_bit_chars(const Bit* const values, const std::size_t n, CharType* const out) noexcept
+{
+    simd::scalar::format_bit(reinterpret_cast<const uint8_t*>(values), n, out);
+}
+
+inline void unpack_logic_chars(const packed::word_type* const planes, const std::size_t stride, const std::size_t n, char* const out) noexcept
+{
+    simd::text_kernels().unpack_logic(planes, stride, n, out);
+}
+
+template <typename CharType>
+void unpack_logic_chars(const packed::word_type* const planes, const std::size_t stride, const std::size_t n, CharType* const out) noexcept
+{
+    simd::scalar::unpack_logic(planes, stride, n, out);
+}
+
+inline void unpack_bit_chars(const packed::word_type* const words, const std::size_t n, char* const out) noexcept
+{
+    simd::text_kernels().unpack_bit(words, n, out);
+}
+
+template <typename CharType>
+void unpack_bit_chars(const packed::word_type* const words, const std::size_t n, CharType* const out) noexcept
+{
+    simd::scalar::unpack_bit(words, n, out);
+}
+
+inline std::size_t scan_hex_chars(const char* const str, const std::size_t n) noexcept
+{
+    return simd::text_kernels().scan_hex(str, n);
+}
+
+template <typename CharType>
+std::size_t scan_hex_chars(const CharType* const str, const std::size_t n) noexcept
+{
+    return simd::scalar::scan_hex(str, n);
+}
+
+inline void pack_hex_chars(const char* const str, const std::size_t n, packed::word_type* const words) noexcept
+{
+    simd::text_kernels().pack_hex(str, n, words);
+}
+
+template <typename CharType>
+void pack_hex_chars(const CharType* const str, const std::size_t n, packed::word_type* const words) noexcept
+{
+    simd::scalar::pack_hex(str, n, words);
+}
+
+inline void format_hex_chars(const packed::word_type* const words, const std::size_t n, char* const out) noexcept
+{
+    simd::text_kernels().format_hex(words, n, out);
+}
+
+template <typename CharType>
+void format_hex_chars(const packed::word_type* const words, const std::size_t n, CharType* const out) noexcept
+{
+    simd::scalar::format_hex(words, n, out);
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,543 @@
+#ifndef HDLTYPES_IMPL_VECTOR_EXPRESSION_HPP
+#define HDLTYPES_IMPL_VECTOR_EXPRESSION_HPP
+#include "hdltypes/vector_expression.hpp"
+
+#include <cstddef>     // size_t, ptrdiff_t
+#include <type_traits> // integral_constant, is_same, decay
+#include <utility>     // forward
+
+#include "hdltypes/bit_vector.hpp"    // BitVector
+#include "hdltypes/bounds.hpp"        // Bounds
+#include "hdltypes/impl/simd.hpp"     // word_kernels
+#include "hdltypes/logic.hpp"         // Logic, Bit
+#include "hdltypes/logic_vector.hpp"  // LogicVector, check_lengths
+#include "hdltypes/packed.hpp"        // LogicWord, broadcast, mask01, word_count
+#include "hdltypes/vector_view.hpp"   // ConstLogicVectorView, ConstBitVectorView
+
+namespace hdltypes {
+
+namespace detail {
+
+inline LogicScalar::LogicScalar(const Logic a) noexcept
+    : word(packed::broadcast(a))
+{
+}
+
+inline BitScalar::BitScalar(const Bit a) noexcept
+    : word((a == '1'_b) ? ~packed::word_type(0) : packed::word_type(0))
+{
+}
+
+struct AndWords {
+    template <typename W>
+    static W apply(const W& a, const W& b) noexcept
+    {
+        return a & b;
+    }
+
+    static void kernel(packed::word_type* const r, const packed::word_type* const a, const packed::word_type* const b, const std::size_t n) noexcept
+    {
+        simd::word_kernels().bit_and(r, a, b, n);
+    }
+};
+
+struct OrWords {
+    template <typename W>
+    static W apply(const W& a, const W& b) noexcept
+    {
+        return a | b;
+    }
+
+    static void kernel(packed::word_type* const r, const packed::word_type* const a, const packed::word_type* const b, const std::size_t n) noexcept
+    {
+        simd::word_kernels().bit_or(r, a, b, n);
+    }
+};
+
+struct XorWords {
+    template <typename W>
+    static W apply(const W& a, const W& b) noexcept
+    {
+        return a ^ b;
+    }
+
+    static void kernel(packed::word_type* const r, const packed::word_type* const a, const packed::word_type* const b, const std::size_t n) noexcept
+    {
+        simd::word_kernels().bit_xor(r, a, b, n);
+    }
+};
+
+struct InvertWords {
+    template <typename W>
+    static W apply(const W& a, NoOperand) noexcept
+    {
+        return ~a;
+    }
+
+    static void kernel(packed::word_type* const r, const packed::word_type* const a, NoOperand, const std::size_t n) noexcept
+    {
+        simd::word_kernels().bit_not(r, a, n);
+    }
+};
+
+/** Whether an operand is an array with a plane of values. */
+template <typename T, typename D = typename std::decay<T>::type>
+struct has_value_plane : std::integral_constant<bool, std::is_same<D, LogicVector>::value || std::is_same<D, BitVector>::value> {
+};
+
+/** Whether an expression is a single operation on arrays, so its values can be evaluated with an Operation's kernel. */
+template <typename A, typename B>
+struct has_word_kernel : std::integral_constant<bool,
+                             has_value_plane<A>::value
+                                 && (has_value_plane<B>::value || std::is_same<typename std::decay<B>::type, NoOperand>::value)> {
+};
+
+inline const packed::word_type* value_plane(const LogicVector& a) noexcept
+{
+    return a.plane(1);
+}
+
+inline const packed::word_type* value_plane(const BitVector& a) noexcept
+{
+    return a.data();
+}
+
+inline NoOperand value_plane(NoOperand) noexcept
+{
+    return NoOperand {};
+}
+
+// whether operands hold only `0` and `1`
+
+inline bool all01(const LogicVector& a) noexcept
+{
+    return a.is01();
+}
+
+inline bool all01(const BitVector&) noexcept
+{
+    return true;
+}
+
+inline bool all01(const ConstLogicVectorView& a) noexcept
+{
+    return a.is01();
+}
+
+inline bool all01(const ConstBitVectorView&) noexcept
+{
+    return true;
+}
+
+inline bool all01(const LogicScalar& a) noexcept
+{
+    return packed::mask01(a.word) == ~packed::word_type(0);
+}
+
+inline bool all01(const BitScalar&) noexcept
+{
+    return true;
+}
+
+inline bool all01(NoOperand) noexcept
+{
+    return true;
+}
+
+template <typename Operation, typename A, typename B>
+bool all01(const LogicVectorExpression<Operation, A, B>& a) noexcept
+{
+    return a.is01();
+}
+
+template <typename Operation, typename A, typename B>
+bool all01(const BitVectorExpression<Operation, A, B>&) noexcept
+{
+    return true;
+}
+
+// operands as words of Logic elements
+
+inline packed::LogicWord logic_word(const LogicVector& a, const std::size_t n) noexcept
+{
+    return a.word(n);
+}
+
+inline packed::LogicWord logic_word(const BitVector& a, const std::size_t n) noexcept
+{
+    return packed::LogicWord { 0, a.word(n), 0, 0 };
+}
+
+inline packed::LogicWord logic_word(const ConstLogicVectorView& a, const std::size_t n) noexcept
+{
+    return a.word(n);
+}
+
+inline packed::LogicWord logic_word(const ConstBitVectorView& a, const std::size_t n) noexcept
+{
+    return packed::LogicWord { 0, a.word(n), 0, 0 };
+}
+
+inline packed::LogicWord logic_word(const LogicScalar& a, std::size_t) noexcept
+{
+    return a.word;
+}
+
+inline packed::LogicWord logic_word(const BitScalar& a, std::size_t) noexcept
+{
+    return packed::LogicWord { 0, a.word, 0, 0 };
+}
+
+inline NoOperand logic_word(NoOperand, std::size_t) noexcept
+{
+    return NoOperand {};
+}
+
+// scalars read no array
+
+inline bool aliases(const LogicScalar&, const void*, std::ptrdiff_t, std::ptrdiff_t) noexcept
+{
+    return false;
+}
+
+inline bool aliases(const BitScalar&, const void*, std::ptrdiff_t, std::ptrdiff_t) noexcept
+{
+    return false;
+}
+
+inline bool aliases(NoOperand, const void*, std::ptrdiff_t, std::ptrdiff_t) noexcept
+{
+    return false;
+}
+
+template <typename Operation, typename A, typename B>
+packed::LogicWord logic_word(const LogicVectorExpression<Operation, A, B>& a, const std::size_t n) noexcept
+{
+    return a.word(n);
+}
+
+template <typename Operation, typename A, typename B>
+packed::LogicWord logic_word(const BitVectorExpression<Operation, A, B>& a, const std::size_t n) noexcept
+{
+    return packed::LogicWord { 0, a.word(n), 0, 0 };
+}
+
+// operands as the value planes of words, which are the whole value of operands of `0` and `1`
+
+inline packed::word_type value_word(const LogicVector& a, const std::size_t n) noexcept
+{
+    return a.plane(1)[n];
+}
+
+inline packed::word_type value_word(const BitVector& a, const std::size_t n) noexcept
+{
+    return a.word(n);
+}
+
+inline packed::word_type value_word(const ConstLogicVectorView& a, const std::size_t n) noexcept
+{
+    return a.word(n).value;
+}
+
+inline packed::word_type value_word(const ConstBitVectorView& a, const std::size_t n) noexcept
+{
+    return a.word(n);
+}
+
+inline packed::word_type value_word(const LogicScalar& a, std::size_t) noexcept
+{
+    return a.word.value;
+}
+
+inline packed::word_type value_word(const BitScalar& a, std::size_t) noexcept
+{
+    return a.word;
+}
+
+inline NoOperand value_word(NoOperand, std::size_t) noexcept
+{
+    return NoOperand {};
+}
+
+template <typename Operation, typename A, typename B>
+packed::word_type value_word(const LogicVectorExpression<Operation, A, B>& a, const std::size_t n) noexcept
+{
+    return a.value_word(n);
+}
+
+template <typename Operation, typename A, typename B>
+packed::word_type value_word(const BitVectorExpression<Operation, A, B>& a, const std::size_t n) noexcept
+{
+    return a.word(n);
+}
+
+// bounds of the result of an expression
+
+template <typename A, typename B>
+Bounds expression_bounds(const A& a, const B& b, std::true_type, std::true_type)
+{
+    check_lengths(a.length(), b.length());
+    return a.bounds();
+}
+
+template <typename A, typename B>
+Bounds expression_bounds(const A& a, const B&, std::true_type, std::false_type) noexcept
+{
+    return a.bounds();
+}
+
+template <typename A, typename B>
+Bounds expression_bounds(const A&, const B& b, std::false_type, std::true_type) noexcept
+{
+    return b.bounds();
+}
+
+template <typename A, typename B>
+Bounds expression_bounds(const A& a, const B& b)
+{
+    return expression_bounds(a, b,
+        is_vector_operand<typename std::decay<A>::type> {},
+        is_vector_operand<typename std::decay<B>::type> {});
+}
+
+/** Evaluates the values of an expression with the Operation's kernel. */
+template <typename Operation, typename A, typename B>
+void evaluate_values(packed::word_type* const r, const A& a, const B& b, const std::size_t n, std::true_type) noexcept
+{
+    Operation::kernel(r, value_plane(a), value_plane(b), n);
+}
+
+/** Evaluates the values of an expression one word at a time. */
+template <typename Operation, typename A, typename B>
+void evaluate_values(packed::word_type* const r, const A& a, const B& b, const std::size_t n, std::false_type) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = Operation::apply(value_word(a, i), value_word(b, i));
+    }
+}
+
+}
+
+template <typename Operation, typename A, typename B>
+LogicVectorExpression<Operation, A, B>::LogicVectorExpression(A a, B b)
+    : a_(std::forward<A>(a))
+    , b_(std::forward<B>(b))
+    , bounds_(detail::expression_bounds(a_, b_))
+{
+}
+
+template <typename Operation, typename A, typename B>
+Bounds LogicVectorExpression<Operation, A, B>::bounds() const noexcept
+{
+    return bounds_;
+}
+
+template <typename Operation, typename A, typename B>
+typename LogicVectorExpression<Operation, A, B>::size_type LogicVectorExpression<Operation, A, B>::length() const noexcept
+{
+    return bounds_.length();
+}
+
+template <typename Operation, typename A, typename B>
+bool LogicVectorExpression<Operation, A, B>::aliases(const void* const array, const Bounds::index_type start, const Bounds::index_type step) const noexcept
+{
+    return detail::aliases(a_, array, start, step) || detail::aliases(b_, array, start, step);
+}
+
+template <typename Operation, typename A, typename B>
+typename LogicVectorExpression<Operation, A, B>::size_type LogicVectorExpression<Operation, A, B>::words() const noexcept
+{
+    return packed::word_count(bounds_.length());
+}
+
+template <typename Operation, typename A, typename B>
+bool LogicVectorExpression<Operation, A, B>::is01() const noexcept
+{
+    return detail::all01(a_) && detail::all01(b_);
+}
+
+template <typename Operation, typename A, typename B>
+packed::LogicWord LogicVectorExpression<Operation, A, B>::word(const size_type n) const noexcept
+{
+    return Operation::apply(detail::logic_word(a_, n), detail::logic_word(b_, n));
+}
+
+template <typename Operation, typename A, typename B>
+packed::word_type LogicVectorExpression<Operation, A, B>::value_word(const size_type n) const noexcept
+{
+    return Operation::apply(detail::value_word(a_, n), detail::value_word(b_, n));
+}
+
+template <typename Operation, typename A, typename B>
+void LogicVectorExpression<Operation, A, B>::evaluate_values(packed::word_type* const r) const noexcept
+{
+    detail::evaluate_values<Operation>(r, a_, b_, words(), detail::has_word_kernel<A, B> {});
+}
+
+template <typename Operation, typename A, typename B>
+BitVectorExpression<Operation, A, B>::BitVectorExpression(A a, B b)
+    : a_(std::forward<A>(a))
+    , b_(std::forward<B>(b))
+    , bounds_(detail::expression_bounds(a_, b_))
+{
+}
+
+template <typename Operation, typename A, typename B>
+Bounds BitVectorExpression<Operation, A, B>::bounds() const noexcept
+{
+    return bounds_;
+}
+
+template <typename Operation, typename A, typename B>
+typename BitVectorExpression<Operation, A, B>::size_type BitVectorExpression<Operation, A, B>::length() const noexcept
+{
+    return bounds_.length();
+}
+
+template <typename Operation, typename A, typename B>
+bool BitVectorExpression<Operation, A, B>::aliases(const void* const array, const Bounds::index_type start, const Bounds::index_type step) const noexcept
+{
+    return detail::aliases(a_, array, start, step) || detail::aliases(b_, array, start, step);
+}
+
+template <typename Operation, typename A, typename B>
+typename BitVectorExpression<Operation, A, B>::size_type BitVectorExpression<Operation, A, B>::words() const noexcept
+{
+    return packed::word_count(bounds_.length());
+}
+
+template <typename Operation, typename A, typename B>
+packed::word_type BitVectorExpression<Operation, A, B>::word(const size_type n) const noexcept
+{
+    return Operation::apply(detail::value_word(a_, n), detail::value_word(b_, n));
+}
+
+template <typename Operation, typename A, typename B>
+void BitVectorExpression<Operation, A, B>::evaluate(packed::word_type* const r) const noexcept
+{
+    detail::evaluate_values<Operation>(r, a_, b_, words(), detail::has_word_kernel<A, B> {});
+}
+
+template <typename A, typename B, typename std::enable_if<detail::is_logic_operation<A, B>::value, int>::type>
+LogicVectorExpression<detail::AndWords, detail::operand_t<A>, detail::operand_t<B>> operator&(A&& a, B&& b)
+{
+    return { std::forward<A>(a), std::forward<B>(b) };
+}
+
+template <typename A, typename B, typename std::enable_if<detail::is_logic_operation<A, B>::value, int>::type>
+LogicVectorExpression<detail::OrWords, detail::operand_t<A>, detail::operand_t<B>> operator|(A&& a, B&& b)
+{
+    return { std::forward<A>(a), std::forward<B>(b) };
+}
+
+template <typename A, typename B, typename std::enable_if<detail::is_logic_operation<A, B>::value, int>::type>
+LogicVectorExpression<detail::XorWords, detail::operand_t<A>, detail::operand_t<B>> operator^(A&& a, B&& b)
+{
+    return { std::forward<A>(a), std::forward<B>(b) };
+}
+
+template <typename A, typename std::enable_if<detail::is_logic_operation<A, detail::NoOperand>::value, int>::type>
+LogicVectorExpression<detail::InvertWords, detail::operand_t<A>, detail::NoOperand> operator~(A&& a)
+{
+    return { std::forward<A>(a), detail::NoOperand {} };
+}
+
+template <typename A, typename B, typename std::enable_if<detail::is_bit_operation<A, B>::value, int>::type>
+BitVectorExpression<detail::AndWords, detail::operand_t<A>, detail::operand_t<B>> operator&(A&& a, B&& b)
+{
+    return { std::forward<A>(a), std::forward<B>(b) };
+}
+
+template <typename A, typename B, typename std::enable_if<detail::is_bit_operation<A, B>::value, int>::type>
+BitVectorExpression<detail::OrWords, detail::operand_t<A>, detail::operand_t<B>> operator|(A&& a, B&& b)
+{
+    return { std::forward<A>(a), std::forward<B>(b) };
+}
+
+template <typename A, typename B, typename std::enable_if<detail::is_bit_operation<A, B>::value, int>::type>
+BitVectorExpression<detail::XorWords, detail::operand_t<A>, detail::operand_t<B>> operator^(A&& a, B&& b)
+{
+    return { std::forward<A>(a), std::forward<B>(b) };
+}
+
+template <typename A, typename std::enable_if<detail::is_bit_operation<A, detail::NoOperand>::value, int>::type>
+BitVectorExpression<detail::InvertWords, detail::operand_t<A>, detail::NoOperand> operator~(A&& a)
+{
+    return { std::forward<A>(a), detail::NoOperand {} };
+}
+
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVector&, B>::value, int>::type>
+LogicVector& operator&=(LogicVector& a, B&& b)
+{
+    return (a = a & std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVector&, B>::value, int>::type>
+LogicVector& operator|=(LogicVector& a, B&& b)
+{
+    return (a = a | std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVector&, B>::value, int>::type>
+LogicVector& operator^=(LogicVector& a, B&& b)
+{
+    return (a = a ^ std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVector&, B>::value, int>::type>
+BitVector& operator&=(BitVector& a, B&& b)
+{
+    return (a = a & std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVector&, B>::value, int>::type>
+BitVector& operator|=(BitVector& a, B&& b)
+{
+    return (a = a | std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVector&, B>::value, int>::type>
+BitVector& operator^=(BitVector& a, B&& b)
+{
+    return (a = a ^ std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVectorView&, B>::value, int>::type>
+LogicVectorView operator&=(LogicVectorView a, B&& b)
+{
+    return (a = a & std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVectorView&, B>::value, int>::type>
+LogicVectorView operator|=(LogicVectorView a, B&& b)
+{
+    return (a = a | std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVectorView&, B>::value, int>::type>
+LogicVectorView operator^=(LogicVectorView a, B&& b)
+{
+    return (a = a ^ std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVectorView&, B>::value, int>::type>
+BitVectorView operator&=(BitVectorView a, B&& b)
+{
+    return (a = a & std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVectorView&, B>::value, int>::type>
+BitVectorView operator|=(BitVectorView a, B&& b)
+{
+    return (a = a | std::forward<B>(b));
+}
+
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVectorView&, B>::value, int>::type>
+BitVectorView operator^=(BitVectorView a, B&& b)
+{
+    return (a = a ^ std::forward<B>(b));
+}
+
+}
+
+#endif
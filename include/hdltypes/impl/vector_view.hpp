@@ -0,0 +1,534 @@
+#ifndef HDLTYPES_IMPL_VECTOR_VIEW_HPP
+#define HDLTYPES_IMPL_VECTOR_VIEW_HPP
+#include "hdltypes/vector_view.hpp"
+
+#include <algorithm>   // min
+#include <cstddef>     // size_t, ptrdiff_t
+#include <stdexcept>   // invalid_argument, out_of_range
+#include <string>      // basic_string
+#include <type_traits> // true_type, false_type, is_const, is_same
+#include <vector>      // vector
+
+#include "hdltypes/bit_vector.hpp"   // BitVector
+#include "hdltypes/bounds.hpp"       // Bounds, Direction
+#include "hdltypes/logic.hpp"        // Logic, Bit, to_char
+#include "hdltypes/logic_vector.hpp" // LogicVector, check_lengths
+#include "hdltypes/memory.hpp"       // ResourceAllocator
+#include "hdltypes/packed.hpp"       // LogicWord, word_type, word_bits, word_count, tail_mask, broadcast, get, set, mask, mask01
+#include "hdltypes/utils.hpp"        // HDLTYPES_THROW
+
+namespace hdltypes {
+
+namespace detail {
+
+template <>
+struct view_traits<LogicVector> {
+    using value_type = Logic;
+    using word_type = packed::LogicWord;
+
+    static Logic get(const word_type& w, const std::size_t bit) noexcept
+    {
+        return packed::get(w, bit);
+    }
+
+    static void set(word_type& w, const std::size_t bit, const Logic a) noexcept
+    {
+        packed::set(w, bit, a);
+    }
+
+    static word_type broadcast(const Logic a) noexcept
+    {
+        return packed::broadcast(a);
+    }
+
+    static word_type mask(const word_type& w, const packed::word_type m) noexcept
+    {
+        return packed::mask(w, m);
+    }
+
+    /** Takes the bits of `b` under `m`, and of `a` elsewhere. */
+    static word_type merge(const word_type& a, const word_type& b, const packed::word_type m) noexcept
+    {
+        return word_type {
+            (a.unknown & ~m) | (b.unknown & m),
+            (a.value & ~m) | (b.value & m),
+            (a.weak & ~m) | (b.weak & m),
+            (a.unassigned & ~m) | (b.unassigned & m)
+        };
+    }
+
+    static word_type shift_down(const word_type& w, const std::size_t s) noexcept
+    {
+        return word_type { w.unknown >> s, w.value >> s, w.weak >> s, w.unassigned >> s };
+    }
+
+    static word_type shift_up(const word_type& w, const std::size_t s) noexcept
+    {
+        return word_type { w.unknown << s, w.value << s, w.weak << s, w.unassigned << s };
+    }
+
+    static bool all01(const word_type& w) noexcept
+    {
+        return packed::mask01(w) == ~packed::word_type(0);
+    }
+
+    static bool all01(const LogicVector& a) noexcept
+    {
+        return a.is01();
+    }
+
+    /** Words of the sources a view can be assigned from. */
+    static word_type to_word(const packed::LogicWord& w) noexcept
+    {
+        return w;
+    }
+
+    static word_type to_word(const packed::word_type w) noexcept
+    {
+        return word_type { 0, w, 0, 0 };
+    }
+};
+
+template <>
+struct view_traits<BitVector> {
+    using value_type = Bit;
+    using word_type = packed::word_type;
+
+    static Bit get(const word_type w, const std::size_t bit) noexcept
+    {
+        return to_bit(bool((w >> bit) & 1));
+    }
+
+    static void set(word_type& w, const std::size_t bit, const Bit a) noexcept
+    {
+        const word_type m = word_type(1) << bit;
+        w = (a == '1'_b) ? (w | m) : (w & ~m);
+    }
+
+    static word_type broadcast(const Bit a) noexcept
+    {
+        return (a == '1'_b) ? ~word_type(0) : word_type(0);
+    }
+
+    static word_type mask(const word_type w, const word_type m) noexcept
+    {
+        return w & m;
+    }
+
+    static word_type merge(const word_type a, const word_type b, const word_type m) noexcept
+    {
+        return (a & ~m) | (b & m);
+    }
+
+    static word_type shift_down(const word_type w, const std::size_t s) noexcept
+    {
+        return w >> s;
+    }
+
+    static word_type shift_up(const word_type w, const std::size_t s) noexcept
+    {
+        return w << s;
+    }
+
+    static bool all01(word_type) noexcept
+    {
+        return true;
+    }
+
+    static bool all01(const BitVector&) noexcept
+    {
+        return true;
+    }
+
+    static word_type to_word(const word_type w) noexcept
+    {
+        return w;
+    }
+};
+
+inline bool aliases(const LogicVector& a, const void* const array, const std::ptrdiff_t start, const std::ptrdiff_t step) noexcept
+{
+    return (&a == array) && ((start != 0) || (step != 1));
+}
+
+inline bool aliases(const BitVector& a, const void* const array, const std::ptrdiff_t start, const std::ptrdiff_t step) noexcept
+{
+    return (&a == array) && ((start != 0) || (step != 1));
+}
+
+template <typename Source>
+bool aliases(const Source& a, const void* const array, const std::ptrdiff_t start, const std::ptrdiff_t step) noexcept
+{
+    return a.aliases(array, start, step);
+}
+
+}
+
+template <typename Vector>
+BasicVectorView<Vector>::BasicVectorView(Vector& a) noexcept
+    : vector_(&a)
+    , bounds_(a.bounds())
+{
+}
+
+template <typename Vector>
+template <typename Other, typename std::enable_if<std::is_same<const Other, Vector>::value && !std::is_same<Other, Vector>::value, int>::type>
+BasicVectorView<Vector>::BasicVectorView(const BasicVectorView<Other>& a) noexcept
+    : BasicVectorView(a.vector_, a.bounds_, a.start_, a.step_)
+{
+}
+
+template <typename Vector>
+BasicVectorView<Vector>::BasicVectorView(Vector* const vector, const Bounds bounds, const index_type start, const index_type step) noexcept
+    : vector_(vector)
+    , bounds_(bounds)
+    , start_(start)
+    , step_(step)
+{
+}
+
+template <typename Vector>
+BasicVectorView<Vector>& BasicVectorView<Vector>::operator=(const BasicVectorView& a)
+{
+    copy(a, std::is_const<Vector> {});
+    return *this;
+}
+
+template <typename Vector>
+template <typename Source>
+BasicVectorView<Vector>& BasicVectorView<Vector>::operator=(const Source& a)
+{
+    static_assert(!std::is_const<Vector>::value, "Elements of a read-only view cannot be assigned");
+    assign(a);
+    return *this;
+}
+
+template <typename Vector>
+Bounds BasicVectorView<Vector>::bounds() const noexcept
+{
+    return bounds_;
+}
+
+template <typename Vector>
+typename BasicVectorView<Vector>::index_type BasicVectorView<Vector>::left() const noexcept
+{
+    return bounds_.left();
+}
+
+template <typename Vector>
+typename BasicVectorView<Vector>::index_type BasicVectorView<Vector>::right() const noexcept
+{
+    return bounds_.right();
+}
+
+template <typename Vector>
+Direction BasicVectorView<Vector>::direction() const noexcept
+{
+    return bounds_.direction();
+}
+
+template <typename Vector>
+typename BasicVectorView<Vector>::index_type BasicVectorView<Vector>::low() const noexcept
+{
+    return bounds_.low();
+}
+
+template <typename Vector>
+typename BasicVectorView<Vector>::index_type BasicVectorView<Vector>::high() const noexcept
+{
+    return bounds_.high();
+}
+
+template <typename Vector>
+typename BasicVectorView<Vector>::size_type BasicVectorView<Vector>::length() const noexcept
+{
+    return bounds_.length();
+}
+
+template <typename Vector>
+bool BasicVectorView<Vector>::is01() const noexcept
+{
+    if (aligned() && (start_ == 0) && (length() == vector_->length())) {
+        return traits::all01(*vector_);
+    }
+    // words are `0` past the end of the view
+    for (size_type n = 0; n < words(); ++n) {
+        if (!traits::all01(word(n))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Vector>
+bool BasicVectorView<Vector>::aligned() const noexcept
+{
+    return (step_ == 1) && (start_ % index_type(packed::word_bits) == 0);
+}
+
+template <typename Vector>
+bool BasicVectorView<Vector>::aliases(const void* const array, const index_type start, const index_type step) const noexcept
+{
+    return (length() != 0) && (vector_ == array) && ((start_ != start) || (step_ != step));
+}
+
+template <typename Vector>
+typename BasicVectorView<Vector>::value_type BasicVectorView<Vector>::operator[](const index_type index) const noexcept
+{
+    const auto p = size_type(position(bounds_.offset(index)));
+    return traits::get(vector_->word(p / packed::word_bits), p % packed::word_bits);
+}
+
+template <typename Vector>
+typename BasicVectorView<Vector>::value_type BasicVectorView<Vector>::at(const index_type index) const
+{
+    if (!bounds_.contains(index)) {
+        HDLTYPES_THROW(std::out_of_range("Index is not in the bounds of the array"));
+    }
+    return (*this)[index];
+}
+
+template <typename Vector>
+void BasicVectorView<Vector>::set(const index_type index, const value_type value) const
+{
+    static_assert(!std::is_const<Vector>::value, "Elements of a read-only view cannot be set");
+    if (!bounds_.contains(index)) {
+        HDLTYPES_THROW(std::out_of_range("Index is not in the bounds of the array"));
+    }
+    const auto p = size_type(position(bounds_.offset(index)));
+    auto w = vector_->word(p / packed::word_bits);
+    traits::set(w, p % packed::word_bits, value);
+    vector_->set_word(p / packed::word_bits, w);
+}
+
+template <typename Vector>
+void BasicVectorView<Vector>::fill(const value_type value) const noexcept
+{
+    const word_type w = traits::broadcast(value);
+    for (size_type n = 0; n < words(); ++n) {
+        set_word(n, w);
+    }
+}
+
+template <typename Vector>
+typename BasicVectorView<Vector>::size_type BasicVectorView<Vector>::words() const noexcept
+{
+    return packed::word_count(length());
+}
+
+template <typename Vector>
+typename BasicVectorView<Vector>::word_type BasicVectorView<Vector>::word(const size_type n) const noexcept
+{
+    const size_type first = n * packed::word_bits;
+    const size_type count = std::min(packed::word_bits, length() - first);
+    const auto p = size_type(position(first));
+    if (step_ == 1) {
+        // consecutive elements are in at most two words of the array
+        const size_type k = p / packed::word_bits;
+        const size_type s = p % packed::word_bits;
+        word_type r = vector_->word(k);
+        if (s != 0) {
+            r = traits::shift_down(r, s);
+            if (s + count > packed::word_bits) {
+                r = traits::merge(r, traits::shift_up(vector_->word(k + 1), packed::word_bits - s), ~packed::word_type(0) << (packed::word_bits - s));
+            }
+        }
+        return traits::mask(r, packed::tail_mask(count));
+    }
+    word_type r {};
+    for (size_type b = 0; b < count; ++b) {
+        const auto q = size_type(position(first + b));
+        traits::set(r, b, traits::get(vector_->word(q / packed::word_bits), q % packed::word_bits));
+    }
+    return r;
+}
+
+template <typename Vector>
+void BasicVectorView<Vector>::set_word(const size_type n, const word_type& w) const noexcept
+{
+    static_assert(!std::is_const<Vector>::value, "Elements of a read-only view cannot be set");
+    const size_type first = n * packed::word_bits;
+    const size_type count = std::min(packed::word_bits, length() - first);
+    const packed::word_type m = packed::tail_mask(count);
+    const auto p = size_type(position(first));
+    if (step_ == 1) {
+        const size_type k = p / packed::word_bits;
+        const size_type s = p % packed::word_bits;
+        vector_->set_word(k, traits::merge(vector_->word(k), traits::shift_up(w, s), m << s));
+        if (s + count > packed::word_bits) {
+            const size_type t = packed::word_bits - s;
+            vector_->set_word(k + 1, traits::merge(vector_->word(k + 1), traits::shift_down(w, t), m >> t));
+        }
+        return;
+    }
+    for (size_type b = 0; b < count; ++b) {
+        const auto q = size_type(position(first + b));
+        auto x = vector_->word(q / packed::word_bits);
+        traits::set(x, q % packed::word_bits, traits::get(w, b));
+        vector_->set_word(q / packed::word_bits, x);
+    }
+}
+
+template <typename Vector>
+BasicVectorView<Vector> BasicVectorView<Vector>::slice(const Bounds bounds) const
+{
+    if (bounds.length() == 0) {
+        return BasicVectorView(vector_, bounds, start_, step_);
+    }
+    if (bounds.direction() != direction()) {
+        HDLTYPES_THROW(std::invalid_argument("Slice direction does not match the direction of the array"));
+    }
+    if (!bounds_.contains(bounds.left()) || !bounds_.contains(bounds.right())) {
+        HDLTYPES_THROW(std::out_of_range("Slice is not in the bounds of the array"));
+    }
+    return BasicVectorView(vector_, bounds, position(bounds_.offset(bounds.left())), step_);
+}
+
+template <typename Vector>
+BasicVectorView<Vector> BasicVectorView<Vector>::alias(const Bounds bounds) const
+{
+    detail::check_lengths(length(), bounds.length());
+    return BasicVectorView(vector_, bounds, start_, step_);
+}
+
+template <typename Vector>
+BasicVectorView<Vector> BasicVectorView<Vector>::reversed() const noexcept
+{
+    const Direction opposite = (direction() == Direction::ascending) ? Direction::descending : Direction::ascending;
+    const Bounds bounds(right(), opposite, left());
+    if (length() == 0) {
+        return BasicVectorView(vector_, bounds, start_, step_);
+    }
+    return BasicVectorView(vector_, bounds, position(length() - 1), -step_);
+}
+
+template <typename Vector>
+BasicVectorView<Vector> BasicVectorView<Vector>::stride(const size_type step) const
+{
+    if (step == 0) {
+        HDLTYPES_THROW(std::invalid_argument("Stride must not be 0"));
+    }
+    const auto last = index_type((length() + step - 1) / step) - 1;
+    const index_type right = (direction() == Direction::ascending) ? left() + last : left() - last;
+    return BasicVectorView(vector_, Bounds(left(), direction(), right), start_, step_ * index_type(step));
+}
+
+template <typename Vector>
+typename BasicVectorView<Vector>::index_type BasicVectorView<Vector>::position(const size_type offset) const noexcept
+{
+    return start_ + index_type(offset) * step_;
+}
+
+template <typename Vector>
+void BasicVectorView<Vector>::copy(const BasicVectorView& a, std::true_type) noexcept
+{
+    vector_ = a.vector_;
+    bounds_ = a.bounds_;
+    start_ = a.start_;
+    step_ = a.step_;
+}
+
+template <typename Vector>
+void BasicVectorView<Vector>::copy(const BasicVectorView& a, std::false_type)
+{
+    assign(a);
+}
+
+template <typename Vector>
+template <typename Source>
+void BasicVectorView<Vector>::assign(const Source& a)
+{
+    detail::check_lengths(length(), a.length());
+    if (detail::aliases(a, vector_, start_, step_)) {
+        // the source reads elements that an earlier word would overwrite
+        std::vector<word_type, ResourceAllocator<word_type>> values(words());
+        for (size_type n = 0; n < values.size(); ++n) {
+            values[n] = traits::to_word(a.word(n));
+        }
+        for (size_type n = 0; n < values.size(); ++n) {
+            set_word(n, values[n]);
+        }
+        return;
+    }
+    for (size_type n = 0; n < words(); ++n) {
+        set_word(n, traits::to_word(a.word(n)));
+    }
+}
+
+inline LogicVector to_logic_vector(const ConstLogicVectorView& a)
+{
+    LogicVector r(a.bounds());
+    for (std::size_t n = 0; n < a.words(); ++n) {
+        r.set_word(n, a.word(n));
+    }
+    return r;
+}
+
+inline BitVector to_bit_vector(const ConstBitVectorView& a)
+{
+    BitVector r(a.bounds());
+    for (std::size_t n = 0; n < a.words(); ++n) {
+        r.set_word(n, a.word(n));
+    }
+    return r;
+}
+
+template <typename CharType>
+std::basic_string<CharType> to_string(const ConstLogicVectorView& a)
+{
+    std::basic_string<CharType> r(a.length(), CharType());
+    for (std::size_t i = 0; i < a.length(); ++i) {
+        r[i] = to_char<CharType>(a[a.bounds().index(i)]);
+    }
+    return r;
+}
+
+template <typename CharType>
+std::basic_string<CharType> to_string(const ConstBitVectorView& a)
+{
+    std::basic_string<CharType> r(a.length(), CharType());
+    for (std::size_t i = 0; i < a.length(); ++i) {
+        r[i] = to_char<CharType>(a[a.bounds().index(i)]);
+    }
+    return r;
+}
+
+inline bool operator==(const ConstLogicVectorView& a, const ConstLogicVectorView& b) noexcept
+{
+    if (a.length() != b.length()) {
+        return false;
+    }
+    for (std::size_t n = 0; n < a.words(); ++n) {
+        if (!(a.word(n) == b.word(n))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool operator!=(const ConstLogicVectorView& a, const ConstLogicVectorView& b) noexcept
+{
+    return !(a == b);
+}
+
+inline bool operator==(const ConstBitVectorView& a, const ConstBitVectorView& b) noexcept
+{
+    if (a.length() != b.length()) {
+        return false;
+    }
+    for (std::size_t n = 0; n < a.words(); ++n) {
+        if (a.word(n) != b.word(n)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool operator!=(const ConstBitVectorView& a, const ConstBitVectorView& b) noexcept
+{
+    return !(a == b);
+}
+
+}
+
+#endif
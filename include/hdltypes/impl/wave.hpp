@@ -0,0 +1,703 @@
+#ifndef HDLTYPES_IMPL_WAVE_HPP
+#define HDLTYPES_IMPL_WAVE_HPP
+#include "hdltypes/wave.hpp"
+
+#include <algorithm> // copy, equal, fill
+#include <cstddef>   // size_t
+#include <cstdint>   // uint8_t, uint64_t, int64_t
+#include <cstdio>    // FILE, fwrite
+#include <cstring>   // memcpy
+#include <stdexcept> // invalid_argument, logic_error, out_of_range, runtime_error
+#include <string>    // string, to_string
+#include <utility>   // move
+#include <vector>    // vector
+
+#include "hdltypes/impl/text_kernels.hpp" // unpack_logic_chars, unpack_bit_chars
+#include "hdltypes/packed.hpp"            // word_count, logic_planes
+#include "hdltypes/utils.hpp"             // HDLTYPES_THROW
+
+namespace hdltypes {
+
+inline WaveSink file_sink(std::FILE* const file)
+{
+    return [file](const char* const data, const std::size_t size) {
+        if (std::fwrite(data, 1, size, file) != size) {
+            HDLTYPES_THROW(std::runtime_error("Failed to write the waveform"));
+        }
+    };
+}
+
+namespace detail {
+
+/** The VCD character of each Logic::value_type, with all 9 values or with `0`, `1`, `x`, and `z` only. */
+inline char wave_char(const unsigned value, const bool four_state) noexcept
+{
+    static const char nine[9] = { 'U', 'X', '0', '1', 'Z', 'W', 'L', 'H', '-' };
+    static const char four[9] = { 'x', 'x', '0', '1', 'z', 'x', '0', '1', 'x' };
+    return four_state ? four[value] : nine[value];
+}
+
+/** Maps the characters of Logic values to `0`, `1`, `x`, and `z`. */
+inline void wave_four_state(char* const chars, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        switch (chars[i]) {
+        case 'L':
+            chars[i] = '0';
+            break;
+        case 'H':
+            chars[i] = '1';
+            break;
+        case 'Z':
+            chars[i] = 'z';
+            break;
+        case '0':
+        case '1':
+            break;
+        default:
+            chars[i] = 'x';
+        }
+    }
+}
+
+/** Writes the decimal digits of an integer; at most 20 bytes. */
+inline char* put_decimal(char* out, std::uint64_t v) noexcept
+{
+    char digits[20];
+    char* d = digits + 20;
+    do {
+        *--d = char('0' + v % 10);
+        v /= 10;
+    } while (v != 0);
+    return std::copy(d, digits + 20, out);
+}
+
+/** Writes an unsigned LEB128 varint; at most 10 bytes. */
+inline char* put_varint(char* out, std::uint64_t v) noexcept
+{
+    while (v >= 0x80) {
+        *out++ = char((v & 0x7F) | 0x80);
+        v >>= 7;
+    }
+    *out++ = char(v);
+    return out;
+}
+
+/** Writes the elements of packed words, 8 to a byte from bit 0. */
+inline char* put_bits(char* out, const packed::word_type* const words, const std::size_t length) noexcept
+{
+    const std::size_t bytes = (length + 7) / 8;
+    for (std::size_t k = 0; k < bytes; ++k) {
+        *out++ = char(std::uint8_t(words[k / 8] >> (8 * (k % 8))));
+    }
+    return out;
+}
+
+/** Reader of the bytes of a waveform in the `delta` format. */
+class WaveReader {
+
+public: // constructors
+    WaveReader(const char* const data, const std::size_t size) noexcept
+        : p_(data)
+        , end_(data + size)
+    {
+    }
+
+public: // reading
+    bool done() const noexcept
+    {
+        return p_ == end_;
+    }
+
+    std::uint8_t byte()
+    {
+        if (p_ == end_) {
+            HDLTYPES_THROW(std::invalid_argument("Waveform is truncated"));
+        }
+        return std::uint8_t(*p_++);
+    }
+
+    std::uint64_t varint()
+    {
+        std::uint64_t v = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            const std::uint8_t b = byte();
+            v |= std::uint64_t(b & 0x7F) << shift;
+            if ((b & 0x80) == 0) {
+                return v;
+            }
+        }
+        HDLTYPES_THROW(std::invalid_argument("Waveform has an invalid integer"));
+    }
+
+    std::int64_t zigzag()
+    {
+        const std::uint64_t v = varint();
+        return std::int64_t(v >> 1) ^ -std::int64_t(v & 1);
+    }
+
+    std::string string()
+    {
+        const std::uint64_t n = varint();
+        if (n > std::uint64_t(end_ - p_)) {
+            HDLTYPES_THROW(std::invalid_argument("Waveform is truncated"));
+        }
+        const char* const first = p_;
+        p_ += n;
+        return std::string(first, p_);
+    }
+
+    /** Reads `length` elements packed 8 to a byte into words. */
+    void bits(packed::word_type* const words, const std::size_t length)
+    {
+        const std::size_t bytes = (length + 7) / 8;
+        std::fill(words, words + packed::word_count(length), packed::word_type(0));
+        for (std::size_t k = 0; k < bytes; ++k) {
+            words[k / 8] |= packed::word_type(byte()) << (8 * (k % 8));
+        }
+        if (length != 0) {
+            words[packed::word_count(length) - 1] &= packed::tail_mask(length);
+        }
+    }
+
+private: // members
+    const char* p_;
+    const char* end_;
+};
+
+}
+
+inline WaveWriter::WaveWriter(WaveSink sink, const WaveOptions& options)
+    : sink_(std::move(sink))
+    , options_(options)
+{
+    records_.reserve(options_.buffer_size / sizeof(word_type) + 1);
+    if (options_.background) {
+        worker_ = std::thread([this] { work(); });
+    }
+}
+
+inline WaveWriter::~WaveWriter()
+{
+    try {
+        flush();
+    } catch (...) {
+        // errors can only be reported by flush()
+    }
+    if (worker_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        worker_.join();
+    }
+}
+
+inline WaveWriter::signal_type WaveWriter::add_logic(const std::string& name)
+{
+    return add(name, Bounds(), false, false);
+}
+
+inline WaveWriter::signal_type WaveWriter::add_logic(const std::string& name, const Bounds bounds)
+{
+    return add(name, bounds, false, true);
+}
+
+inline WaveWriter::signal_type WaveWriter::add_bit(const std::string& name)
+{
+    return add(name, Bounds(), true, false);
+}
+
+inline WaveWriter::signal_type WaveWriter::add_bit(const std::string& name, const Bounds bounds)
+{
+    return add(name, bounds, true, true);
+}
+
+inline void WaveWriter::time(const time_type t)
+{
+    if (t < time_) {
+        HDLTYPES_THROW(std::invalid_argument("Time of a waveform can not go backwards"));
+    }
+    if (t != time_) {
+        time_ = t;
+        time_recorded_ = false;
+    }
+    if (!started_) {
+        start();
+    }
+}
+
+inline WaveWriter::time_type WaveWriter::time() const noexcept
+{
+    return time_;
+}
+
+inline void WaveWriter::change(const signal_type signal, const Logic value)
+{
+    const word_type v = value.value();
+    record(signal, checked(signal, false, false, 1), &v);
+}
+
+inline void WaveWriter::change(const signal_type signal, const Bit value)
+{
+    const word_type v = (value == '1'_b) ? Logic::_1 : Logic::_0;
+    record(signal, checked(signal, true, false, 1), &v);
+}
+
+inline void WaveWriter::change(const signal_type signal, const LogicVector& value)
+{
+    // the planes of a LogicVector are contiguous
+    record(signal, checked(signal, false, true, value.length()), value.plane(0));
+}
+
+inline void WaveWriter::change(const signal_type signal, const BitVector& value)
+{
+    record(signal, checked(signal, true, true, value.length()), value.data());
+}
+
+inline void WaveWriter::flush()
+{
+    if (!started_) {
+        start();
+    }
+    if (!options_.background) {
+        submit();
+        encode(nullptr, 0);
+        write_output();
+        return;
+    }
+    submit();
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return queue_.empty() && !busy_; });
+    rethrow();
+    // the background thread is idle until the next submit()
+    encode(nullptr, 0);
+    write_output();
+}
+
+inline std::uint64_t WaveWriter::changes() const noexcept
+{
+    return changes_;
+}
+
+inline WaveWriter::signal_type WaveWriter::add(const std::string& name, const Bounds bounds, const bool bit, const bool vector)
+{
+    if (started_) {
+        HDLTYPES_THROW(std::logic_error("Signals of a waveform must be declared before it is started"));
+    }
+    const size_type length = vector ? bounds.length() : 1;
+    const size_type words = !vector ? 1 : bit ? packed::word_count(length) : packed::logic_planes * packed::word_count(length);
+    const signal_type signal = signals_.size();
+
+    std::string code;
+    for (size_type n = signal;; n /= 94) {
+        code += char(33 + n % 94);
+        if (n < 94) {
+            break;
+        }
+    }
+
+    signals_.push_back(Signal { name, bounds, bit, vector, length, words, values_.size(), false, std::move(code) });
+    values_.resize(values_.size() + words);
+    return signal;
+}
+
+inline WaveWriter::Signal& WaveWriter::checked(const signal_type signal, const bool bit, const bool vector, const size_type length)
+{
+    if (signal >= signals_.size()) {
+        HDLTYPES_THROW(std::out_of_range("Signal is not declared"));
+    }
+    Signal& s = signals_[signal];
+    if ((s.bit != bit) || (s.vector != vector)) {
+        HDLTYPES_THROW(std::invalid_argument("Value does not match the type of the signal"));
+    }
+    if (s.length != length) {
+        HDLTYPES_THROW(std::invalid_argument("Value does not match the length of the signal"));
+    }
+    return s;
+}
+
+inline void WaveWriter::record(const signal_type signal, Signal& s, const word_type* const value)
+{
+    word_type* const last = values_.data() + s.offset;
+    if (s.recorded && std::equal(value, value + s.words, last)) {
+        return;
+    }
+    std::copy(value, value + s.words, last);
+    s.recorded = true;
+
+    if (!started_) {
+        start();
+    }
+    if (!time_recorded_) {
+        records_.push_back(1);
+        records_.push_back(time_);
+        time_recorded_ = true;
+    }
+    records_.push_back(word_type(signal) << 1);
+    records_.insert(records_.end(), value, value + s.words);
+    ++changes_;
+    if (records_.size() * sizeof(word_type) >= options_.buffer_size) {
+        submit();
+    }
+}
+
+inline void WaveWriter::start()
+{
+    started_ = true;
+}
+
+inline void WaveWriter::submit()
+{
+    if (!options_.background) {
+        encode(records_.data(), records_.size());
+        records_.clear();
+        return;
+    }
+    if (records_.empty()) {
+        return;
+    }
+    {
+        // at most 2 buffers wait, so a slow sink holds back the simulation rather than filling memory
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return queue_.size() < 2; });
+        rethrow();
+        queue_.push_back(std::move(records_));
+        if (!spare_.empty()) {
+            records_ = std::move(spare_.back());
+            spare_.pop_back();
+        } else {
+            records_ = std::vector<word_type>();
+            records_.reserve(options_.buffer_size / sizeof(word_type) + 1);
+        }
+    }
+    cv_.notify_all();
+}
+
+inline void WaveWriter::rethrow()
+{
+    if (error_) {
+        const std::exception_ptr e = error_;
+        error_ = nullptr;
+        std::rethrow_exception(e);
+    }
+}
+
+inline void WaveWriter::work()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            return;
+        }
+        std::vector<word_type> records = std::move(queue_.front());
+        queue_.pop_front();
+        busy_ = true;
+        const bool failed = bool(error_);
+        lock.unlock();
+
+        // after an error the remaining changes are dropped until it is reported
+        std::exception_ptr error;
+        try {
+            if (!failed) {
+                encode(records.data(), records.size());
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+        records.clear();
+
+        lock.lock();
+        if (error) {
+            error_ = error;
+        }
+        spare_.push_back(std::move(records));
+        busy_ = false;
+        cv_.notify_all();
+    }
+}
+
+inline void WaveWriter::encode(const word_type* const records, const size_type n)
+{
+    if (!header_encoded_) {
+        encode_header();
+        header_encoded_ = true;
+    }
+    const bool vcd = (options_.format == WaveFormat::vcd);
+    for (size_type i = 0; i < n;) {
+        if ((records[i] & 1) != 0) {
+            const time_type t = records[i + 1];
+            char* p = output(24);
+            if (vcd) {
+                *p++ = '#';
+                p = detail::put_decimal(p, t);
+                *p++ = '\n';
+            } else {
+                *p++ = 0;
+                p = detail::put_varint(p, t - encoded_time_);
+            }
+            output_size_ = size_type(p - output_.data());
+            encoded_time_ = t;
+            i += 2;
+        } else {
+            const signal_type signal = signal_type(records[i] >> 1);
+            const Signal& s = signals_[signal];
+            if (vcd) {
+                encode_vcd(s, records + i + 1);
+            } else {
+                encode_delta(signal, records + i + 1);
+            }
+            i += 1 + s.words;
+        }
+        if (output_size_ >= options_.buffer_size) {
+            write_output();
+        }
+    }
+}
+
+inline void WaveWriter::encode_header()
+{
+    std::string h;
+    if (options_.format == WaveFormat::vcd) {
+        h += "$timescale " + options_.timescale + " $end\n";
+        std::vector<std::string> scopes;
+        for (const Signal& s : signals_) {
+            // split the name into its scopes and the name in the innermost scope
+            std::vector<std::string> path;
+            size_type first = 0;
+            for (size_type dot = s.name.find('.'); dot != std::string::npos; dot = s.name.find('.', first)) {
+                path.push_back(s.name.substr(first, dot - first));
+                first = dot + 1;
+            }
+            size_type common = 0;
+            while ((common < scopes.size()) && (common < path.size()) && (scopes[common] == path[common])) {
+                ++common;
+            }
+            for (size_type k = scopes.size(); k > common; --k) {
+                h += "$upscope $end\n";
+            }
+            for (size_type k = common; k < path.size(); ++k) {
+                h += "$scope module " + path[k] + " $end\n";
+            }
+            scopes = std::move(path);
+
+            h += "$var wire " + std::to_string(s.length) + " " + s.code + " " + s.name.substr(first);
+            if (s.vector) {
+                h += " [" + std::to_string(s.bounds.left()) + ":" + std::to_string(s.bounds.right()) + "]";
+            }
+            h += " $end\n";
+        }
+        for (size_type k = scopes.size(); k > 0; --k) {
+            h += "$upscope $end\n";
+        }
+        h += "$enddefinitions $end\n";
+    } else {
+        char buffer[24];
+        const auto varint = [&](const std::uint64_t v) {
+            h.append(buffer, detail::put_varint(buffer, v));
+        };
+        const auto zigzag = [&](const std::int64_t v) {
+            varint((std::uint64_t(v) << 1) ^ std::uint64_t(v >> 63));
+        };
+        h += "HDLWAVE1";
+        varint(options_.timescale.size());
+        h += options_.timescale;
+        varint(signals_.size());
+        for (const Signal& s : signals_) {
+            const bool descending = s.vector && (s.bounds.direction() == Direction::descending);
+            h += char((s.bit ? 1 : 0) | (s.vector ? 2 : 0) | (descending ? 4 : 0));
+            varint(s.name.size());
+            h += s.name;
+            if (s.vector) {
+                zigzag(s.bounds.left());
+                zigzag(s.bounds.right());
+            }
+        }
+    }
+    char* const p = output(h.size());
+    std::memcpy(p, h.data(), h.size());
+    output_size_ += h.size();
+}
+
+inline void WaveWriter::encode_vcd(const Signal& s, const word_type* const value)
+{
+    const size_type code = s.code.size();
+    char* p = output(s.length + code + 3);
+    if (!s.vector) {
+        *p++ = detail::wave_char(unsigned(value[0]), options_.four_state);
+    } else {
+        *p++ = 'b';
+        if (s.bit) {
+            detail::unpack_bit_chars(value, s.length, p);
+        } else {
+            detail::unpack_logic_chars(value, packed::word_count(s.length), s.length, p);
+            if (options_.four_state) {
+                detail::wave_four_state(p, s.length);
+            }
+        }
+        p += s.length;
+        *p++ = ' ';
+    }
+    std::memcpy(p, s.code.data(), code);
+    p += code;
+    *p++ = '\n';
+    output_size_ = size_type(p - output_.data());
+}
+
+inline void WaveWriter::encode_delta(const signal_type signal, const word_type* const value)
+{
+    const Signal& s = signals_[signal];
+    char* p = output(11 + s.words * sizeof(word_type) + 1);
+    p = detail::put_varint(p, std::uint64_t(signal) + 1);
+    if (!s.vector) {
+        *p++ = char(value[0]);
+    } else if (s.bit) {
+        p = detail::put_bits(p, value, s.length);
+    } else {
+        // planes: unknown, value, weak, unassigned
+        const size_type words = packed::word_count(s.length);
+        bool is01 = true;
+        for (size_type n = 0; n < words; ++n) {
+            is01 = is01 && ((value[n] | value[2 * words + n] | value[3 * words + n]) == 0);
+        }
+        if (is01) {
+            *p++ = 0;
+            p = detail::put_bits(p, value + words, s.length);
+        } else {
+            *p++ = 1;
+            for (size_type plane = 0; plane < packed::logic_planes; ++plane) {
+                p = detail::put_bits(p, value + plane * words, s.length);
+            }
+        }
+    }
+    output_size_ = size_type(p - output_.data());
+}
+
+inline char* WaveWriter::output(const size_type n)
+{
+    if (output_.size() < output_size_ + n) {
+        output_.resize(std::max(output_size_ + n, options_.buffer_size + options_.buffer_size / 4));
+    }
+    return output_.data() + output_size_;
+}
+
+inline void WaveWriter::write_output()
+{
+    if (output_size_ != 0) {
+        const size_type n = output_size_;
+        output_size_ = 0;
+        sink_(output_.data(), n);
+    }
+}
+
+inline void delta_to_vcd(const char* const data, const std::size_t size, WaveSink sink, const bool four_state)
+{
+    detail::WaveReader r(data, size);
+    for (const char c : std::string("HDLWAVE1")) {
+        if (char(r.byte()) != c) {
+            HDLTYPES_THROW(std::invalid_argument("Data is not a waveform"));
+        }
+    }
+    WaveOptions options;
+    options.timescale = r.string();
+    options.four_state = four_state;
+    WaveWriter w(std::move(sink), options);
+
+    const std::uint64_t count = r.varint();
+    std::vector<std::uint8_t> flags;
+    std::vector<LogicVector> logic;
+    std::vector<BitVector> bits;
+    for (std::uint64_t i = 0; i < count; ++i) {
+        const std::uint8_t f = r.byte();
+        const std::string name = r.string();
+        if ((f > 7) || (f == 4) || (f == 5)) {
+            HDLTYPES_THROW(std::invalid_argument("Waveform has an invalid signal"));
+        }
+        flags.push_back(f);
+        logic.emplace_back();
+        bits.emplace_back();
+        if ((f & 2) == 0) {
+            if ((f & 1) != 0) {
+                w.add_bit(name);
+            } else {
+                w.add_logic(name);
+            }
+            continue;
+        }
+        const Bounds::index_type left = Bounds::index_type(r.zigzag());
+        const Bounds::index_type right = Bounds::index_type(r.zigzag());
+        const Bounds bounds(left, ((f & 4) != 0) ? Direction::descending : Direction::ascending, right);
+        if ((f & 1) != 0) {
+            w.add_bit(name, bounds);
+            bits.back() = BitVector(bounds);
+        } else {
+            w.add_logic(name, bounds);
+            logic.back() = LogicVector(bounds);
+        }
+    }
+
+    WaveWriter::time_type t = 0;
+    std::vector<packed::word_type> planes;
+    while (!r.done()) {
+        const std::uint64_t id = r.varint();
+        if (id == 0) {
+            t += r.varint();
+            w.time(t);
+            continue;
+        }
+        if (id > count) {
+            HDLTYPES_THROW(std::invalid_argument("Waveform has an undeclared signal"));
+        }
+        const std::size_t signal = std::size_t(id - 1);
+        const std::uint8_t f = flags[signal];
+        if ((f & 2) == 0) {
+            const std::uint8_t v = r.byte();
+            if (((f & 1) != 0) ? ((v != Logic::_0) && (v != Logic::_1)) : (v > Logic::DC)) {
+                HDLTYPES_THROW(std::invalid_argument("Waveform has an invalid value"));
+            }
+            if ((f & 1) != 0) {
+                w.change(signal, (v == Logic::_1) ? '1'_b : '0'_b);
+            } else {
+                w.change(signal, Logic(Logic::value_type(v)));
+            }
+        } else if ((f & 1) != 0) {
+            BitVector& a = bits[signal];
+            planes.resize(a.words());
+            r.bits(planes.data(), a.length());
+            for (std::size_t n = 0; n < a.words(); ++n) {
+                a.set_word(n, planes[n]);
+            }
+            w.change(signal, a);
+        } else {
+            LogicVector& a = logic[signal];
+            const std::size_t words = a.words();
+            planes.assign(packed::logic_planes * words, 0);
+            const std::uint8_t all = r.byte();
+            if (all == 0) {
+                r.bits(planes.data() + words, a.length());
+            } else if (all == 1) {
+                for (std::size_t plane = 0; plane < packed::logic_planes; ++plane) {
+                    r.bits(planes.data() + plane * words, a.length());
+                }
+            } else {
+                HDLTYPES_THROW(std::invalid_argument("Waveform has an invalid value"));
+            }
+            for (std::size_t n = 0; n < words; ++n) {
+                const packed::LogicWord word { planes[n], planes[words + n], planes[2 * words + n], planes[3 * words + n] };
+                // `U` is the only value of the unassigned plane
+                if ((word.unassigned & ~(word.unknown & ~word.value & ~word.weak)) != 0) {
+                    HDLTYPES_THROW(std::invalid_argument("Waveform has an invalid value"));
+                }
+                a.set_word(n, word);
+            }
+            w.change(signal, a);
+        }
+    }
+    w.flush();
+}
+
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef HDLTYPES_INSTRUMENT_HPP
+#define HDLTYPES_INSTRUMENT_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint64_t
+#include <string>  // string
+
+#ifndef HDLTYPES_INSTRUMENT
+/** Set to 1 to count the calls of the Logic and Bit operators, and the values of their results, in InstrumentCounters.
+
+    When 0 the operators are unchanged and the counters stay zero. When 1 the operators
+    can still be used in constant expressions if the compiler provides
+    `__builtin_is_constant_evaluated` (GCC 9, Clang 9, MSVC 19.25, and later); constant
+    evaluations are not counted. Must be the same in every translation unit.
+    */
+#define HDLTYPES_INSTRUMENT 0
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define HDLTYPES_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif defined(__GNUC__) && (__GNUC__ >= 9)
+#define HDLTYPES_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#elif defined(_MSC_VER) && (_MSC_VER >= 1925)
+#define HDLTYPES_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#ifndef HDLTYPES_CONSTANT_EVALUATED
+#define HDLTYPES_CONSTANT_EVALUATED() false
+#endif
+
+namespace hdltypes {
+
+/** Operations counted by the instrumentation. */
+enum class InstrumentedOperation : uint8_t {
+    logic_and,     ///< Logic `&` and `&=`.
+    logic_or,      ///< Logic `|` and `|=`.
+    logic_xor,     ///< Logic `^` and `^=`.
+    logic_not,     ///< Logic `~` and inplace_invert().
+    logic_resolve, ///< resolve() of two Logic values, including each driver of resolve() of an array.
+    bit_and,       ///< Bit `&` and `&=`.
+    bit_or,        ///< Bit `|` and `|=`.
+    bit_xor,       ///< Bit `^` and `^=`.
+    bit_not,       ///< Bit `~` and inplace_invert().
+    logic_vector,  ///< Evaluations of LogicVector expressions; the results are the elements of the array.
+    bit_vector     ///< Evaluations of BitVector expressions; the results are the elements of the array.
+};
+
+/** Number of values of InstrumentedOperation. */
+constexpr std::size_t instrumented_operations = 11;
+
+/** Number of result values counted: one for each value of Logic::value_type. */
+constexpr std::size_t instrumented_values = 9;
+
+/** Counts of operations and of the values of their results
+
+    Each thread counts into its own counters, instrument_counters(), while HDLTYPES_INSTRUMENT
+    is 1. Results are counted by Logic::value_type, so Bit results count as `0` and `1`.
+    Counters of several threads can be summed into one before the threads end.
+
+    ~~~{.cpp}
+    reset_instrument_counters();
+    evaluate(block);
+    const InstrumentCounters& c = instrument_counters();
+    std::cout << c.results(InstrumentedOperation::logic_and, Logic::X) << " of " << c.calls(InstrumentedOperation::logic_and) << " & gave X\n";
+    std::cout << to_string(c);
+    ~~~
+    */
+class InstrumentCounters {
+
+public: // attributes
+    /** The number of calls of the operation. */
+    std::uint64_t calls(InstrumentedOperation op) const noexcept;
+
+    /** The number of results of the operation with the given Logic::value_type value. */
+    std::uint64_t results(InstrumentedOperation op, unsigned value) const noexcept;
+
+    /** The number of results of the operation with any value. */
+    std::uint64_t results(InstrumentedOperation op) const noexcept;
+
+public: // modifiers
+    /** Counts a call of the operation. */
+    void add_call(InstrumentedOperation op) noexcept;
+
+    /** Counts `n` results of the operation with the given Logic::value_type value. */
+    void add_results(InstrumentedOperation op, unsigned value, std::uint64_t n = 1) noexcept;
+
+    /** Sets all counts to zero. */
+    void reset() noexcept;
+
+    /** Adds the counts of another set of counters. */
+    InstrumentCounters& operator+=(const InstrumentCounters& a) noexcept;
+
+private: // members
+    std::uint64_t calls_[instrumented_operations] {};
+    std::uint64_t results_[instrumented_operations][instrumented_values] {};
+};
+
+/** The counters of the calling thread. */
+InstrumentCounters& instrument_counters() noexcept;
+
+/** Sets the counters of the calling thread to zero. */
+void reset_instrument_counters() noexcept;
+
+/** \relates InstrumentedOperation The name of the operation, like `logic_and`. */
+const char* to_string(InstrumentedOperation op) noexcept;
+
+/** \relates InstrumentCounters CSV table of the counters, with a header row `operation,calls,U,X,0,1,Z,W,L,H,-` and a row for each operation. */
+std::string to_string(const InstrumentCounters& a);
+
+}
+
+#include "hdltypes/impl/instrument.hpp"
+
+#endif
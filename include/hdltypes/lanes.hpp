@@ -0,0 +1,277 @@
+#ifndef HDLTYPES_LANES_HPP
+#define HDLTYPES_LANES_HPP
+
+#include "hdltypes/logic.hpp"  // Logic, Bit
+#include "hdltypes/packed.hpp" // LogicWord, word_type, word_bits
+#include <cstddef>             // size_t
+
+namespace hdltypes {
+
+namespace detail {
+
+/** Makes a function parameter not take part in template argument deduction, so it accepts conversions. */
+template <typename T>
+struct identity {
+    using type = T;
+};
+
+template <typename T>
+using identity_t = typename identity<T>::type;
+
+}
+
+template <std::size_t N>
+class BitLanes;
+
+/** One Logic value for each of `N` independent instances of a model
+
+    Holds the lanes bit-sliced in a single packed::LogicWord, one bit of each plane
+    per lane, so the Logic operators evaluate all lanes with a few word instructions.
+    Code written for Logic works on LogicLanes unchanged, running `N` instances at
+    once; Logic values used with LogicLanes apply to every lane. Lanes are numbered
+    from `0`, and at most packed::word_bits lanes are supported.
+
+    Comparisons compare all lanes, and is01 and to_bool yield a BitLanes with a
+    result for each lane.
+    */
+template <std::size_t N>
+class LogicLanes {
+
+    static_assert((N >= 1) && (N <= packed::word_bits), "LogicLanes supports 1 to 64 lanes");
+
+public: // types
+    /** Type of the value of each lane. */
+    using value_type = Logic;
+
+    /** Type of lane numbers. */
+    using size_type = std::size_t;
+
+public: // constructors
+    /** Default all lanes to `U`. */
+    constexpr LogicLanes() noexcept;
+
+    /** Allows a Logic to be converted *implicitly* to a LogicLanes with all lanes set to it. */
+    constexpr LogicLanes(Logic a) noexcept;
+
+    /** Create a LogicLanes from a word of packed lanes. Bits past the last lane are ignored. */
+    explicit constexpr LogicLanes(const packed::LogicWord& w) noexcept;
+
+public: // attributes
+    /** The number of lanes. */
+    static constexpr size_type lanes() noexcept;
+
+public: // lane access
+    /** Returns the value of a lane. There is *no* bounds checking. */
+    constexpr Logic operator[](size_type lane) const noexcept;
+
+    /** Returns the value of a lane. Fails if there is no such lane. */
+    constexpr Logic at(size_type lane) const;
+
+    /** Sets the value of a lane. Fails if there is no such lane. */
+    constexpr void set(size_type lane, Logic value);
+
+public: // packed access
+    /** Returns the packed lanes. Bits past the last lane are `0`. */
+    constexpr packed::LogicWord word() const noexcept;
+
+private: // members
+    packed::LogicWord word_ {};
+};
+
+/** One Bit value for each of `N` independent instances of a model
+
+    The Bit counterpart of LogicLanes, holding each lane as one bit of a word. Like
+    Bit, a BitLanes can be used where a LogicLanes is expected.
+    */
+template <std::size_t N>
+class BitLanes {
+
+    static_assert((N >= 1) && (N <= packed::word_bits), "BitLanes supports 1 to 64 lanes");
+
+public: // types
+    /** Type of the value of each lane. */
+    using value_type = Bit;
+
+    /** Type of lane numbers. */
+    using size_type = std::size_t;
+
+public: // constructors
+    /** Default all lanes to `0`. */
+    constexpr BitLanes() noexcept = default;
+
+    /** Allows a Bit to be converted *implicitly* to a BitLanes with all lanes set to it. */
+    constexpr BitLanes(Bit a) noexcept;
+
+    /** Create a BitLanes from a word with a bit for each lane. Bits past the last lane are ignored. */
+    explicit constexpr BitLanes(packed::word_type w) noexcept;
+
+public: // attributes
+    /** The number of lanes. */
+    static constexpr size_type lanes() noexcept;
+
+public: // lane access
+    /** Returns the value of a lane. There is *no* bounds checking. */
+    constexpr Bit operator[](size_type lane) const noexcept;
+
+    /** Returns the value of a lane. Fails if there is no such lane. */
+    constexpr Bit at(size_type lane) const;
+
+    /** Sets the value of a lane. Fails if there is no such lane. */
+    constexpr void set(size_type lane, Bit value);
+
+public: // packed access
+    /** Returns the lanes, lane `n` in bit `n`. Bits past the last lane are `0`. */
+    constexpr packed::word_type word() const noexcept;
+
+public: // LogicLanes conversion
+    /** Allows a LogicLanes to be converted to a BitLanes. Fails if any lane is not `0` or `1`. */
+    explicit constexpr BitLanes(const LogicLanes<N>& a);
+
+    /** Allows a BitLanes to be converted *implicitly* to a LogicLanes. */
+    constexpr operator LogicLanes<N>() const noexcept;
+
+private: // members
+    packed::word_type word_ { 0 };
+};
+
+/** \relates LogicLanes Value equality of all lanes. */
+template <std::size_t N>
+constexpr bool operator==(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept;
+
+/** \relates LogicLanes Value inequality. */
+template <std::size_t N>
+constexpr bool operator!=(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept;
+
+/** \relates LogicLanes Lane-wise logical "and" operation. */
+template <std::size_t N>
+constexpr LogicLanes<N> operator&(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept;
+
+/** \relates LogicLanes Lane-wise logical "and" operation of a Logic and every lane. */
+template <std::size_t N>
+constexpr LogicLanes<N> operator&(Logic a, const LogicLanes<N>& b) noexcept;
+
+/** \relates LogicLanes Lane-wise logical "and" operation. */
+template <std::size_t N>
+constexpr LogicLanes<N> operator&(const BitLanes<N>& a, const LogicLanes<N>& b) noexcept;
+
+/** \relates LogicLanes Inplace version of the lane-wise logical "and" operation. */
+template <std::size_t N>
+constexpr LogicLanes<N>& operator&=(LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept;
+
+/** \relates LogicLanes Lane-wise logical "or" operation. */
+template <std::size_t N>
+constexpr LogicLanes<N> operator|(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept;
+
+/** \relates LogicLanes Lane-wise logical "or" operation of a Logic and every lane. */
+template <std::size_t N>
+constexpr LogicLanes<N> operator|(Logic a, const LogicLanes<N>& b) noexcept;
+
+/** \relates LogicLanes Lane-wise logical "or" operation. */
+template <std::size_t N>
+constexpr LogicLanes<N> operator|(const BitLanes<N>& a, const LogicLanes<N>& b) noexcept;
+
+/** \relates LogicLanes Inplace version of the lane-wise logical "or" operation. */
+template <std::size_t N>
+constexpr LogicLanes<N>& operator|=(LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept;
+
+/** \relates LogicLanes Lane-wise logical "xor" operation. */
+template <std::size_t N>
+constexpr LogicLanes<N> operator^(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept;
+
+/** \relates LogicLanes Lane-wise logical "xor" operation of a Logic and every lane. */
+template <std::size_t N>
+constexpr LogicLanes<N> operator^(Logic a, const LogicLanes<N>& b) noexcept;
+
+/** \relates LogicLanes Lane-wise logical "xor" operation. */
+template <std::size_t N>
+constexpr LogicLanes<N> operator^(const BitLanes<N>& a, const LogicLanes<N>& b) noexcept;
+
+/** \relates LogicLanes Inplace version of the lane-wise logical "xor" operation. */
+template <std::size_t N>
+constexpr LogicLanes<N>& operator^=(LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept;
+
+/** \relates LogicLanes Lane-wise logical inversion operation. */
+template <std::size_t N>
+constexpr LogicLanes<N> operator~(const LogicLanes<N>& a) noexcept;
+
+/** \relates LogicLanes Inplace version of the lane-wise logical inversion operation. */
+template <std::size_t N>
+constexpr LogicLanes<N>& inplace_invert(LogicLanes<N>& a) noexcept;
+
+/** \relates LogicLanes Lane-wise resolution of two drivers. See resolve(Logic, Logic). */
+template <std::size_t N>
+constexpr LogicLanes<N> resolve(const LogicLanes<N>& a, const detail::identity_t<LogicLanes<N>>& b) noexcept;
+
+/** \relates LogicLanes Returns `1` in each lane whose value is `0` or `1`. */
+template <std::size_t N>
+constexpr BitLanes<N> is01(const LogicLanes<N>& a) noexcept;
+
+/** \relates LogicLanes Converts the lanes of `0` and `1` to `false` and `true`, respectively. Fails if any lane is not `0` or `1`. */
+template <std::size_t N>
+constexpr BitLanes<N> to_bool(const LogicLanes<N>& a);
+
+/** \relates BitLanes Value equality of all lanes. */
+template <std::size_t N>
+constexpr bool operator==(const BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept;
+
+/** \relates BitLanes Value inequality. */
+template <std::size_t N>
+constexpr bool operator!=(const BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept;
+
+/** \relates BitLanes Lane-wise logical "and" operation. */
+template <std::size_t N>
+constexpr BitLanes<N> operator&(const BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept;
+
+/** \relates BitLanes Lane-wise logical "and" operation of a Bit and every lane. */
+template <std::size_t N>
+constexpr BitLanes<N> operator&(Bit a, const BitLanes<N>& b) noexcept;
+
+/** \relates BitLanes Inplace version of the lane-wise logical "and" operation. */
+template <std::size_t N>
+constexpr BitLanes<N>& operator&=(BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept;
+
+/** \relates BitLanes Lane-wise logical "or" operation. */
+template <std::size_t N>
+constexpr BitLanes<N> operator|(const BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept;
+
+/** \relates BitLanes Lane-wise logical "or" operation of a Bit and every lane. */
+template <std::size_t N>
+constexpr BitLanes<N> operator|(Bit a, const BitLanes<N>& b) noexcept;
+
+/** \relates BitLanes Inplace version of the lane-wise logical "or" operation. */
+template <std::size_t N>
+constexpr BitLanes<N>& operator|=(BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept;
+
+/** \relates BitLanes Lane-wise logical "xor" operation. */
+template <std::size_t N>
+constexpr BitLanes<N> operator^(const BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept;
+
+/** \relates BitLanes Lane-wise logical "xor" operation of a Bit and every lane. */
+template <std::size_t N>
+constexpr BitLanes<N> operator^(Bit a, const BitLanes<N>& b) noexcept;
+
+/** \relates BitLanes Inplace version of the lane-wise logical "xor" operation. */
+template <std::size_t N>
+constexpr BitLanes<N>& operator^=(BitLanes<N>& a, const detail::identity_t<BitLanes<N>>& b) noexcept;
+
+/** \relates BitLanes Lane-wise logical inversion operation. */
+template <std::size_t N>
+constexpr BitLanes<N> operator~(const BitLanes<N>& a) noexcept;
+
+/** \relates BitLanes Inplace version of the lane-wise logical inversion operation. */
+template <std::size_t N>
+constexpr BitLanes<N>& inplace_invert(BitLanes<N>& a) noexcept;
+
+/** \relates BitLanes Returns `1` in every lane. */
+template <std::size_t N>
+constexpr BitLanes<N> is01(const BitLanes<N>& a) noexcept;
+
+/** \relates BitLanes Returns the lanes, as `false` for `0` and `true` for `1`. */
+template <std::size_t N>
+constexpr BitLanes<N> to_bool(const BitLanes<N>& a) noexcept;
+
+}
+
+#include "hdltypes/impl/lanes.hpp"
+
+#endif
@@ -2,9 +2,20 @@
 #define HDLTYPES_LOGIC_HPP
 
 #include "hdltypes/utils.hpp" // is_char_type, is_integer_type
+#include <cstddef>            // size_t
 #include <cstdint>            // uint8_t
 #include <type_traits>        // enable_if, is_same
 
+#ifndef HDLTYPES_LOGIC_TABLES
+/** Set to 1 to compute the Logic operators by indexing lookup tables rather than with bit operations.
+
+    Both give the same results. The bit operations let compilers vectorize loops over
+    arrays of Logic; the tables may be faster for scattered scalar operations on some
+    targets. Must be the same in every translation unit.
+    */
+#define HDLTYPES_LOGIC_TABLES 0
+#endif
+
 namespace hdltypes {
 
 using namespace util;
@@ -92,6 +103,14 @@ constexpr Logic to_logic(const CharType& c);
 /** \relates Logic Returns the given Logic. */
 constexpr Logic to_logic(Logic a) noexcept;
 
+/** \relates Logic Non-throwing version of to_logic(const IntType&). Returns `false`, leaving `r` unchanged, if the value is not `0` or `1`. */
+template <typename IntType, typename std::enable_if<is_integer_type<IntType>::value, int>::type = 0>
+constexpr bool try_to_logic(const IntType& i, Logic& r) noexcept;
+
+/** \relates Logic Non-throwing version of to_logic(const CharType&). Returns `false`, leaving `r` unchanged, if the character is not a Logic. */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+constexpr bool try_to_logic(const CharType& c, Logic& r) noexcept;
+
 /** \relates Logic Value equality. */
 constexpr bool operator==(Logic a, Logic b) noexcept;
 
@@ -122,6 +141,16 @@ constexpr Logic operator~(Logic a) noexcept;
 /** \relates Logic Inplace version of the logical "invert" operation. */
 constexpr Logic& inplace_invert(Logic& a) noexcept;
 
+/** \relates Logic Resolves the values of two drivers of a signal. See implementation for details.
+
+    Equivalent to VHDL's std_logic resolution function: strong values override weak
+    values, which override `Z`; conflicting values of the same strength yield `X` or `W`.
+    */
+constexpr Logic resolve(Logic a, Logic b) noexcept;
+
+/** \relates Logic Resolves the values of any number of drivers of a signal. Returns `Z` if there are no drivers. */
+constexpr Logic resolve(const Logic* drivers, std::size_t n) noexcept;
+
 /** \relates Logic Returns `true` if the value is `0` or `1`. */
 constexpr bool is01(Logic a) noexcept;
 
@@ -132,6 +161,19 @@ constexpr IntType to_int(Logic a);
 /** \relates Logic Converts a Logic `0`/`L` or `1`/`H` to the integer `false` or `true`, respectively. */
 constexpr bool to_bool(Logic a);
 
+/** \relates Logic Non-throwing version of to_int(Logic). Returns `false`, leaving `r` unchanged, if the value is not `0` or `1`. */
+template <typename IntType>
+constexpr bool try_to_int(Logic a, IntType& r) noexcept;
+
+/** \relates Logic Non-throwing version of to_bool(Logic). Returns `false`, leaving `r` unchanged, if the value is not `0` or `1`. */
+constexpr bool try_to_bool(Logic a, bool& r) noexcept;
+
+/** \relates Logic Returns the position of the first of `n` values that is not `0` or `1`, or `n` if all are.
+
+    Checks 8 values at a time with word instructions.
+    */
+std::size_t validate01(const Logic* a, std::size_t n) noexcept;
+
 /** \relates Logic Converts a Logic into a character. See the below details for the mapping.
 
 \verbatim
@@ -220,6 +262,26 @@ constexpr Bit to_bit(Logic a);
 /** \relates Bit Returns the given Bit. */
 constexpr Bit to_bit(Bit a) noexcept;
 
+/** \relates Bit Non-throwing version of to_bit(const IntType&). Returns `false`, leaving `r` unchanged, if the value is not `0` or `1`. */
+template <typename IntType, typename std::enable_if<is_integer_type<IntType>::value, int>::type = 0>
+constexpr bool try_to_bit(const IntType& i, Bit& r) noexcept;
+
+/** \relates Bit Non-throwing version of to_bit(const CharType&). Returns `false`, leaving `r` unchanged, if the character is not a Bit. */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+constexpr bool try_to_bit(const CharType& c, Bit& r) noexcept;
+
+/** \relates Bit Non-throwing version of to_bit(Logic) and Bit(Logic). Returns `false`, leaving `r` unchanged, if the value is not `0` or `1`. */
+constexpr bool try_to_bit(Logic a, Bit& r) noexcept;
+
+/** \relates Bit Converts Logic values to Bit in bulk. See to_bit(Logic).
+
+    Conversion stops at the first value that is not `0` or `1`. Returns the position of
+    that value, or `n` if all values were converted. Elements of `out` at and after the
+    returned position have unspecified values. Converts 8 values at a time with word
+    instructions.
+    */
+std::size_t convert01(const Logic* a, std::size_t n, Bit* out) noexcept;
+
 /** \relates Logic converts the Bit values `0` and `1` to Logic `0` and `1`, respectively. */
 constexpr Logic to_logic(Bit a) noexcept;
 
@@ -0,0 +1,124 @@
+#ifndef HDLTYPES_LOGIC_LUT_HPP
+#define HDLTYPES_LOGIC_LUT_HPP
+
+#include "hdltypes/logic.hpp"        // Logic
+#include "hdltypes/logic_vector.hpp" // LogicVector
+#include "hdltypes/packed.hpp"       // word_type, logic_planes
+#include <cstddef>                   // size_t
+#include <type_traits>               // enable_if, is_convertible, is_same
+#include <utility>                   // index_sequence
+
+namespace hdltypes {
+
+namespace detail {
+
+/** True if all of the given values are true. */
+template <bool... Values>
+struct all_of;
+
+template <>
+struct all_of<> : std::true_type {
+};
+
+template <bool Value, bool... Values>
+struct all_of<Value, Values...> : std::integral_constant<bool, Value && all_of<Values...>::value> {
+};
+
+/** Enables a LogicLut member for `Arity` arguments of the given types that satisfy `Trait`. */
+template <template <typename> class Trait, std::size_t Arity, typename... Args>
+using enable_if_arguments_t = typename std::enable_if<(sizeof...(Args) == Arity) && all_of<Trait<Args>::value...>::value, int>::type;
+
+template <typename T>
+using is_logic_convertible = std::is_convertible<T, Logic>;
+
+template <typename T>
+using is_logic_vector = std::is_same<T, LogicVector>;
+
+template <typename T>
+using is_logic = std::is_same<T, Logic>;
+
+/** Number of entries in the truth table of a function of `arity` Logic arguments. */
+constexpr std::size_t lut_entries(std::size_t arity) noexcept;
+
+}
+
+/** Truth table of a user-defined Logic function of `Arity` arguments
+
+    Tabulates a function once, at construction, for every combination of Logic
+    arguments in a single flat table of `9^Arity` entries, so that evaluating it is
+    one table load. The function is called with Logic arguments and may return a Logic
+    or a Bit. When constructed from a literal function object with a `constexpr` call
+    operator, the table is built at compile time and may be evaluated in constant
+    expressions.
+
+    \code
+    struct Mux2 {
+        constexpr Logic operator()(Logic a, Logic b, Logic sel) const noexcept
+        {
+            return (a & ~sel) | (b & sel);
+        }
+    };
+
+    constexpr LogicLut<3> mux2 { Mux2 {} };
+    static_assert(mux2('0'_l, '1'_l, '1'_b) == '1'_l, "");
+    \endcode
+
+    Arrays of arguments are evaluated with apply(), and LogicVector arguments with the
+    call operator. While all vector arguments hold only `0` and `1`, the vector form
+    evaluates 64 elements at a time from the sum-of-products of the table's `0`/`1`
+    entries, rather than looking up every element.
+    */
+template <std::size_t Arity>
+class LogicLut {
+
+    static_assert((Arity >= 1) && (Arity <= 4), "LogicLut supports functions of 1 to 4 arguments");
+
+public: // types
+    /** Type of table sizes and array lengths. */
+    using size_type = std::size_t;
+
+public: // constructors
+    /** Tabulates `f` for every combination of arguments. */
+    template <typename Function>
+    explicit constexpr LogicLut(Function f);
+
+public: // attributes
+    /** The number of arguments of the function. */
+    static constexpr size_type arity() noexcept;
+
+    /** The number of entries in the table. */
+    static constexpr size_type size() noexcept;
+
+public: // evaluation
+    /** Returns the value of the function for the given arguments. */
+    template <typename... Args, detail::enable_if_arguments_t<detail::is_logic_convertible, Arity, Args...> = 0>
+    constexpr Logic operator()(Args... args) const noexcept;
+
+    /** Element-wise evaluation of LogicVectors. Yields a value with the bounds of the first argument. Fails if the lengths differ. */
+    template <typename... Args, detail::enable_if_arguments_t<detail::is_logic_vector, Arity, Args...> = 0>
+    LogicVector operator()(const Args&... args) const;
+
+    /** Evaluates the function for `n` elements of the argument arrays, storing the results in `r`. */
+    template <typename... Args, detail::enable_if_arguments_t<detail::is_logic, Arity, Args...> = 0>
+    void apply(Logic* r, size_type n, const Args*... args) const noexcept;
+
+private: // helpers
+    template <typename Function, std::size_t... I>
+    static constexpr Logic call(Function& f, size_type index, std::index_sequence<I...>);
+
+    static constexpr Logic argument(size_type index, size_type n) noexcept;
+
+private: // members
+    Logic table_[detail::lut_entries(Arity)] {};
+    packed::word_type minterms_[packed::logic_planes] {}; ///< For each plane, bit `c` is the plane's bit of the result for the `0`/`1` arguments of the bits of `c`.
+};
+
+/** Creates the LogicLut of a function of `Arity` arguments. */
+template <std::size_t Arity, typename Function>
+constexpr LogicLut<Arity> make_logic_lut(Function f);
+
+}
+
+#include "hdltypes/impl/logic_lut.hpp"
+
+#endif
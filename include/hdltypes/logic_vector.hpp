@@ -0,0 +1,247 @@
+#ifndef HDLTYPES_LOGIC_VECTOR_HPP
+#define HDLTYPES_LOGIC_VECTOR_HPP
+
+#include "hdltypes/bounds.hpp" // Bounds
+#include "hdltypes/logic.hpp"  // Logic
+#include "hdltypes/memory.hpp" // ResourceAllocator
+#include "hdltypes/packed.hpp" // LogicWord, word_type
+#include "hdltypes/utils.hpp"  // is_char_type
+#include <cstddef>             // size_t
+#include <string>              // basic_string
+#include <type_traits>         // enable_if
+#include <vector>              // vector
+
+namespace hdltypes {
+
+template <typename Operation, typename A, typename B>
+class LogicVectorExpression;
+
+/** Array of Logic values
+
+    Roughly equivalent to VHDL's std_logic_vector. Elements are indexed using the
+    Bounds given at construction; the length of a LogicVector is fixed.
+
+    Elements are stored packed in bit-planes of 64 elements (see packed::LogicWord),
+    so element-wise logic operations process 64 elements with a few word instructions.
+    Because of this, elements can not be accessed by reference.
+
+    Element-wise operations require the operands to be the same length, and yield a
+    value with the bounds of the left operand. They yield a LogicVectorExpression that
+    is evaluated in one pass when converted to or assigned to a LogicVector.
+
+    A LogicVector keeps count of its elements that are not `0` or `1`, updated as
+    elements are set, so is01() is constant time. While all operands hold only `0`
+    and `1`, element-wise operations and reductions work on the value plane alone
+    with the same kernels as BitVector. The planes are written directly only through
+    a PlaneWriter, which recounts when destroyed, so the count is always exact and
+    is01() on a const array only reads it.
+
+    The words are allocated from a MemoryResource, by default that of the calling
+    thread (see ResourceScope), so temporaries can be allocated from an ArenaResource.
+    */
+class LogicVector {
+
+public: // types
+    /** Type of the elements. */
+    using value_type = Logic;
+
+    /** Type of index values. */
+    using index_type = Bounds::index_type;
+
+    /** Type of lengths and offsets. */
+    using size_type = Bounds::size_type;
+
+    /** Type of the words that hold the packed elements. */
+    using word_type = packed::word_type;
+
+    /** Type of the allocator of the words. */
+    using allocator_type = ResourceAllocator<word_type>;
+
+public: // constructors
+    /** Default to a null array. */
+    LogicVector() = default;
+
+    /** Create a LogicVector with the given bounds, with all elements set to `init`. */
+    explicit LogicVector(Bounds bounds, Logic init = Logic(), const allocator_type& alloc = allocator_type());
+
+    /** Create a LogicVector with the bounds `length-1 downto 0`, with all elements set to `init`. */
+    explicit LogicVector(size_type length, Logic init = Logic(), const allocator_type& alloc = allocator_type());
+
+    /** Evaluates an expression of element-wise operations, with the bounds of the expression. */
+    template <typename Operation, typename A, typename B>
+    LogicVector(const LogicVectorExpression<Operation, A, B>& e, const allocator_type& alloc = allocator_type());
+
+    /** Copies an array, allocating from the given allocator. Copies made without one allocate from the default resource of the calling thread. */
+    LogicVector(const LogicVector& a, const allocator_type& alloc);
+
+    /** Moves an array, allocating from the given allocator if it is not equal to that of `a`. */
+    LogicVector(LogicVector&& a, const allocator_type& alloc);
+
+    LogicVector(const LogicVector& a) = default;
+    LogicVector(LogicVector&& a) = default;
+    LogicVector& operator=(const LogicVector& a) = default;
+    LogicVector& operator=(LogicVector&& a) = default;
+
+    /** Evaluates an expression of element-wise operations, taking its bounds. The expression may refer to this array, also through views of it. */
+    template <typename Operation, typename A, typename B>
+    LogicVector& operator=(const LogicVectorExpression<Operation, A, B>& e);
+
+public: // attributes
+    /** The allocator of the words. Copying or moving an array into this one keeps the allocator. */
+    allocator_type get_allocator() const noexcept;
+
+    /** The bounds of the array. */
+    Bounds bounds() const noexcept;
+
+    /** The leftmost index. */
+    index_type left() const noexcept;
+
+    /** The rightmost index. */
+    index_type right() const noexcept;
+
+    /** The direction of the bounds. */
+    Direction direction() const noexcept;
+
+    /** The lowest index. */
+    index_type low() const noexcept;
+
+    /** The highest index. */
+    index_type high() const noexcept;
+
+    /** The number of elements. */
+    size_type length() const noexcept;
+
+    /** Whether all elements are `0` or `1`. Constant time. */
+    bool is01() const noexcept;
+
+public: // element access
+    /** Returns the element at the index. There is *no* bounds checking. */
+    Logic operator[](index_type index) const noexcept;
+
+    /** Returns the element at the index. Fails if the index is not in the bounds. */
+    Logic at(index_type index) const;
+
+    /** Sets the element at the index. Fails if the index is not in the bounds. */
+    void set(index_type index, Logic value);
+
+    /** Sets all elements to the given value. */
+    void fill(Logic value) noexcept;
+
+public: // packed access
+    /** The number of words in each bit-plane. */
+    size_type words() const noexcept;
+
+    /** Returns the `n`th word of packed elements. Elements are packed from the left. */
+    packed::LogicWord word(size_type n) const noexcept;
+
+    /** Sets the `n`th word of packed elements. Bits past the end of the array are ignored. */
+    void set_word(size_type n, const packed::LogicWord& w) noexcept;
+
+    /** Returns a pointer to the words of the given bit-plane; the planes are in the order of the members of packed::LogicWord. */
+    const word_type* plane(size_type p) const noexcept;
+
+    /** Writable access to the bit-planes, which recounts the elements that are not `0` or `1` when destroyed. */
+    class PlaneWriter;
+
+    /** Returns writable access to the bit-planes. The array must not be used otherwise until the writer is destroyed. */
+    PlaneWriter write_planes() noexcept;
+
+private: // helpers
+    /** Stores the `n`th word, clearing bits past the end of the array; returns the mask of stored elements that are not `0` or `1`. */
+    word_type store_word(size_type n, const packed::LogicWord& w) noexcept;
+
+    /** Evaluates an expression of the same length into the array. */
+    template <typename Expression>
+    void assign(const Expression& e) noexcept;
+
+    /** Counts the elements that are not `0` or `1` again, after the planes were written. */
+    void recount() noexcept;
+
+private: // members
+    Bounds bounds_ {};
+    size_type words_per_plane_ { 0 };
+    std::vector<word_type, allocator_type> words_ {};
+    size_type non01_ { 0 };
+};
+
+/** Writable access to the bit-planes of a LogicVector
+
+    Bits past the end of the array must be kept `0`. The count of elements that are not
+    `0` or `1` is only updated when the writer is destroyed, so the array must not be
+    read or written otherwise while the writer exists.
+    */
+class LogicVector::PlaneWriter {
+
+public: // constructors
+    explicit PlaneWriter(LogicVector& a) noexcept;
+
+    PlaneWriter(PlaneWriter&& a) noexcept;
+
+    /** Recounts the elements of the array that are not `0` or `1`. */
+    ~PlaneWriter();
+
+    PlaneWriter(const PlaneWriter&) = delete;
+    PlaneWriter& operator=(const PlaneWriter&) = delete;
+    PlaneWriter& operator=(PlaneWriter&&) = delete;
+
+public: // packed access
+    /** Returns a pointer to the words of the given bit-plane. */
+    word_type* plane(size_type p) const noexcept;
+
+private: // members
+    LogicVector* a_;
+};
+
+/** \relates LogicVector Converts a string of characters into a LogicVector with the bounds `length-1 downto 0`. See to_logic for details. */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+LogicVector to_logic_vector(const CharType* str, std::size_t length);
+
+/** \relates LogicVector Converts a string into a LogicVector with the bounds `length-1 downto 0`. See to_logic for details. */
+template <typename CharType>
+LogicVector to_logic_vector(const std::basic_string<CharType>& str);
+
+/** \relates LogicVector UDL convenience syntax for to_logic_vector. */
+LogicVector operator""_lv(const char* str, std::size_t length);
+
+/** \relates LogicVector Converts a LogicVector into a string, from left to right. See to_char for details. */
+template <typename CharType = char>
+std::basic_string<CharType> to_string(const LogicVector& a);
+
+/** \relates LogicVector Returns `true` if all elements are `0` or `1`. See LogicVector::is01. */
+bool is01(const LogicVector& a) noexcept;
+
+/** \relates LogicVector Value equality. Arrays of different lengths are never equal; bounds are not compared. */
+bool operator==(const LogicVector& a, const LogicVector& b) noexcept;
+
+/** \relates LogicVector Value inequality. */
+bool operator!=(const LogicVector& a, const LogicVector& b) noexcept;
+
+/** \relates LogicVector Inplace version of the element-wise logical inversion operation. */
+LogicVector& inplace_invert(LogicVector& a) noexcept;
+
+/** \relates LogicVector Logical "and" of all elements, as if folded with the Logic operator. Returns `1` for a null array.
+
+    Stops at the first word containing a `0` or `L`.
+    */
+Logic and_reduce(const LogicVector& a) noexcept;
+
+/** \relates LogicVector Logical "or" of all elements, as if folded with the Logic operator. Returns `0` for a null array.
+
+    Stops at the first word containing a `1` or `H`.
+    */
+Logic or_reduce(const LogicVector& a) noexcept;
+
+/** \relates LogicVector Logical "xor" of all elements, as if folded with the Logic operator. Returns `0` for a null array.
+
+    The parity of known elements is found with a population count of the value plane.
+    */
+Logic xor_reduce(const LogicVector& a) noexcept;
+
+}
+
+#include "hdltypes/impl/logic_vector.hpp"
+
+// element-wise operations, which also work on BitVectors
+#include "hdltypes/bit_vector.hpp"
+
+#endif
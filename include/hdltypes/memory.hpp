@@ -0,0 +1,235 @@
+#ifndef HDLTYPES_MEMORY_HPP
+#define HDLTYPES_MEMORY_HPP
+
+#include <cstddef> // size_t, max_align_t
+
+#ifndef HDLTYPES_STD_MEMORY_RESOURCE
+/** Set to 1 to make MemoryResource an alias of `std::pmr::memory_resource`, or 0 to use the library's own class with the same interface.
+
+    Defaults to 1 when `<memory_resource>` is available (C++17), so resources written
+    for `std::pmr`, like `std::pmr::monotonic_buffer_resource`, can be used directly.
+    Must be the same in every translation unit.
+    */
+#if (__cplusplus >= 201703L) && defined(__has_include)
+#if __has_include(<memory_resource>)
+#define HDLTYPES_STD_MEMORY_RESOURCE 1
+#endif
+#endif
+#ifndef HDLTYPES_STD_MEMORY_RESOURCE
+#define HDLTYPES_STD_MEMORY_RESOURCE 0
+#endif
+#endif
+
+#if HDLTYPES_STD_MEMORY_RESOURCE
+#include <memory_resource> // memory_resource
+#endif
+
+namespace hdltypes {
+
+#if HDLTYPES_STD_MEMORY_RESOURCE
+
+/** Source of memory for the arrays and integers of the library; see `std::pmr::memory_resource`. */
+using MemoryResource = std::pmr::memory_resource;
+
+#else
+
+/** Source of memory for the arrays and integers of the library
+
+    Has the interface of C++17's `std::pmr::memory_resource`: derived classes override
+    do_allocate(), do_deallocate(), and do_is_equal().
+    */
+class MemoryResource {
+
+public: // constructors
+    MemoryResource() = default;
+    MemoryResource(const MemoryResource&) = default;
+    MemoryResource& operator=(const MemoryResource&) = default;
+    virtual ~MemoryResource() = default;
+
+public: // allocation
+    /** Allocates `bytes` bytes aligned to `alignment`, a power of 2. Fails with `std::bad_alloc` if the memory can not be allocated. */
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+    /** Frees memory from allocate() with the same size and alignment. */
+    void deallocate(void* p, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+    /** Whether memory allocated from either resource can be freed by the other. */
+    bool is_equal(const MemoryResource& other) const noexcept;
+
+private: // overrides
+    virtual void* do_allocate(std::size_t bytes, std::size_t alignment) = 0;
+    virtual void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) = 0;
+    virtual bool do_is_equal(const MemoryResource& other) const noexcept = 0;
+};
+
+/** \relates MemoryResource Whether memory allocated from either resource can be freed by the other. */
+bool operator==(const MemoryResource& a, const MemoryResource& b) noexcept;
+
+/** \relates MemoryResource Whether memory allocated from one resource can not be freed by the other. */
+bool operator!=(const MemoryResource& a, const MemoryResource& b) noexcept;
+
+#endif
+
+/** \relates MemoryResource The resource that allocates with the global `operator new` and frees with `operator delete`. */
+MemoryResource* new_delete_resource() noexcept;
+
+/** \relates MemoryResource The resource used by arrays and integers created without one on the calling thread. Initially new_delete_resource(). */
+MemoryResource* thread_resource() noexcept;
+
+/** \relates MemoryResource Sets the default resource of the calling thread, or resets it to new_delete_resource() if `r` is null. Returns the previous default. */
+MemoryResource* set_thread_resource(MemoryResource* r) noexcept;
+
+/** Makes a resource the default resource of the calling thread for its lifetime
+
+    Arrays and integers created in the scope without a resource, including temporaries
+    and the results of operators, allocate from the resource. Values that must outlive
+    the resource must be created with another resource, or copied after the scope ends.
+    */
+class ResourceScope {
+
+public: // constructors
+    /** Makes `r` the default resource of the calling thread. */
+    explicit ResourceScope(MemoryResource& r) noexcept;
+
+    /** Restores the previous default resource. */
+    ~ResourceScope();
+
+    ResourceScope(const ResourceScope&) = delete;
+    ResourceScope& operator=(const ResourceScope&) = delete;
+
+private: // members
+    MemoryResource* previous_;
+};
+
+/** Allocator of objects of type `T` from a MemoryResource
+
+    Like `std::pmr::polymorphic_allocator`, but default-constructed allocators use the
+    default resource of the calling thread (see thread_resource()). Allocators compare
+    equal if their resources do, are not propagated by assignment or swap, and containers
+    copied with `select_on_container_copy_construction` use the default resource.
+    */
+template <typename T>
+class ResourceAllocator {
+
+public: // types
+    /** Type of the allocated objects. */
+    using value_type = T;
+
+public: // constructors
+    /** Allocates from the default resource of the calling thread. */
+    ResourceAllocator() noexcept;
+
+    /** Allows a resource to be converted *implicitly* to an allocator from it. */
+    ResourceAllocator(MemoryResource* r) noexcept;
+
+    /** Allows an allocator of another type to be converted *implicitly*, with the same resource. */
+    template <typename U>
+    ResourceAllocator(const ResourceAllocator<U>& a) noexcept;
+
+public: // allocation
+    /** Allocates uninitialized memory for `n` objects. Fails with `std::bad_alloc` if the memory can not be allocated. */
+    T* allocate(std::size_t n);
+
+    /** Frees memory from allocate() for `n` objects. */
+    void deallocate(T* p, std::size_t n) noexcept;
+
+    /** The allocator used for copies of containers: one from the default resource of the calling thread. */
+    ResourceAllocator select_on_container_copy_construction() const noexcept;
+
+    /** The resource memory is allocated from. */
+    MemoryResource* resource() const noexcept;
+
+private: // members
+    MemoryResource* resource_;
+};
+
+/** \relates ResourceAllocator Whether memory allocated by either allocator can be freed by the other. */
+template <typename T, typename U>
+bool operator==(const ResourceAllocator<T>& a, const ResourceAllocator<U>& b) noexcept;
+
+/** \relates ResourceAllocator Whether memory allocated by one allocator can not be freed by the other. */
+template <typename T, typename U>
+bool operator!=(const ResourceAllocator<T>& a, const ResourceAllocator<U>& b) noexcept;
+
+/** Bump allocator for values that are freed all at once, like the temporaries of a simulation delta
+
+    Memory is carved out of large blocks from an upstream resource by advancing a pointer,
+    and freeing single allocations does nothing. reset() frees everything at once but
+    keeps the blocks, so after the first few deltas allocation never reaches the upstream
+    resource; release() returns the blocks to it. Blocks grow geometrically from
+    `block_size` bytes.
+
+    An arena is not synchronized: use one arena per thread, made the default resource of
+    its thread with a ResourceScope.
+
+    ~~~{.cpp}
+    ArenaResource arena;
+    for (auto& delta : deltas) {
+        {
+            ResourceScope scope(arena);
+            evaluate(delta); // LogicVector, BitVector, Unsigned, and Signed temporaries allocate from the arena
+        }
+        arena.reset();
+    }
+    ~~~
+    */
+class ArenaResource : public MemoryResource {
+
+public: // types
+    /** Type of sizes in bytes. */
+    using size_type = std::size_t;
+
+    /** Size of the first block if none is given. */
+    static constexpr size_type default_block_size = 64 * 1024;
+
+public: // constructors
+    /** Create an arena that allocates blocks of at least `block_size` bytes from `upstream`. No memory is allocated until needed. */
+    explicit ArenaResource(size_type block_size = default_block_size, MemoryResource* upstream = thread_resource()) noexcept;
+
+    ArenaResource(const ArenaResource&) = delete;
+    ArenaResource& operator=(const ArenaResource&) = delete;
+
+    /** Returns all blocks to the upstream resource. */
+    ~ArenaResource() override;
+
+public: // attributes
+    /** The resource blocks are allocated from. */
+    MemoryResource* upstream_resource() const noexcept;
+
+    /** The number of bytes of the blocks held from the upstream resource. */
+    size_type capacity() const noexcept;
+
+public: // modifiers
+    /** Frees all memory allocated from the arena, keeping the blocks for reuse. */
+    void reset() noexcept;
+
+    /** Frees all memory allocated from the arena, returning the blocks to the upstream resource. */
+    void release() noexcept;
+
+private: // overrides
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const MemoryResource& other) const noexcept override;
+
+private: // helpers
+    struct Block;
+
+    /** Makes the given block the one allocated from. */
+    void use(Block* block) noexcept;
+
+private: // members
+    MemoryResource* upstream_;
+    size_type block_size_;
+    size_type next_size_;
+    size_type capacity_ { 0 };
+    Block* first_ { nullptr };
+    Block* current_ { nullptr };
+    char* cursor_ { nullptr };
+    char* end_ { nullptr };
+};
+
+}
+
+#include "hdltypes/impl/memory.hpp"
+
+#endif
@@ -0,0 +1,514 @@
+#ifndef HDLTYPES_NUMERIC_HPP
+#define HDLTYPES_NUMERIC_HPP
+
+#include "hdltypes/memory.hpp" // ResourceAllocator
+#include "hdltypes/packed.hpp" // word_type
+#include <cstddef>             // size_t
+
+namespace hdltypes {
+
+namespace detail {
+
+/** Storage of the limbs of Unsigned and Signed
+
+    Values of up to `inline_limbs` limbs are held inline; wider values are held in an
+    array from the allocator. Like the standard containers, copies allocate from the
+    default resource, and the allocator is kept by assignment.
+    */
+class LimbStorage {
+
+public: // types
+    using size_type = std::size_t;
+    using limb_type = packed::word_type;
+    using allocator_type = ResourceAllocator<limb_type>;
+
+    /** Number of limbs held without allocating. */
+    static constexpr size_type inline_limbs = 2;
+
+public: // constructors
+    LimbStorage() noexcept;
+    LimbStorage(size_type width, const allocator_type& alloc);
+    LimbStorage(const LimbStorage& other);
+    LimbStorage(const LimbStorage& other, const allocator_type& alloc);
+    LimbStorage(LimbStorage&& other) noexcept;
+    LimbStorage(LimbStorage&& other, const allocator_type& alloc);
+    LimbStorage& operator=(const LimbStorage& other);
+    LimbStorage& operator=(LimbStorage&& other);
+    ~LimbStorage();
+
+public: // access
+    allocator_type get_allocator() const noexcept;
+    size_type width() const noexcept;
+    size_type size() const noexcept;
+    bool is_inline() const noexcept;
+    const limb_type* data() const noexcept;
+    limb_type* data() noexcept;
+
+private:
+    void release() noexcept;
+
+    size_type width_ { 0 };
+    allocator_type alloc_ {};
+    union {
+        limb_type inline_[inline_limbs];
+        limb_type* heap_;
+    };
+};
+
+}
+
+/** Unsigned integer of a fixed number of bits
+
+    Roughly equivalent to VHDL's numeric_std unsigned. The width is fixed at construction.
+    Arithmetic follows numeric_std: results of binary operations are as wide as the wider
+    operand, and results that do not fit wrap.
+
+    The value is held in 64-bit limbs, least significant first. Values of up to 128 bits
+    are held inline without allocating; wider values allocate from a MemoryResource, by
+    default that of the calling thread (see ResourceScope). Bits above the width in the
+    top limb are always `0`.
+    */
+class Unsigned {
+
+public: // types
+    /** Type of widths and bit positions. */
+    using size_type = std::size_t;
+
+    /** Type of the limbs holding the value. */
+    using limb_type = packed::word_type;
+
+    /** Type of the allocator of limbs of values wider than 128 bits. */
+    using allocator_type = ResourceAllocator<limb_type>;
+
+public: // constructors
+    /** Default to a null value of width 0. */
+    Unsigned() = default;
+
+    /** Create an Unsigned of the given width with the value 0. */
+    explicit Unsigned(size_type width, const allocator_type& alloc = allocator_type());
+
+    /** Create an Unsigned of the given width with the given value. Fails if the value does not fit. */
+    Unsigned(size_type width, unsigned long long value, const allocator_type& alloc = allocator_type());
+
+    /** Copies a value, allocating from the given allocator. Copies made without one allocate from the default resource of the calling thread. */
+    Unsigned(const Unsigned& a, const allocator_type& alloc);
+
+    /** Moves a value, allocating from the given allocator if it is not equal to that of `a`. */
+    Unsigned(Unsigned&& a, const allocator_type& alloc);
+
+    Unsigned(const Unsigned& a) = default;
+    Unsigned(Unsigned&& a) = default;
+    Unsigned& operator=(const Unsigned& a) = default;
+    Unsigned& operator=(Unsigned&& a) = default;
+
+public: // attributes
+    /** The allocator of the limbs. Copying or moving a value into this one keeps the allocator. */
+    allocator_type get_allocator() const noexcept;
+
+    /** The number of bits. */
+    size_type width() const noexcept;
+
+public: // limb access
+    /** The number of limbs holding the value. */
+    size_type limbs() const noexcept;
+
+    /** Returns the nth limb, least significant first. There is *no* bounds checking. */
+    limb_type limb(size_type n) const noexcept;
+
+    /** Sets the nth limb. Bits of the top limb above the width are ignored. There is *no* bounds checking. */
+    void set_limb(size_type n, limb_type value) noexcept;
+
+    /** Pointer to the limbs. Bits of the top limb above the width must be kept `0`. */
+    const limb_type* data() const noexcept;
+
+    /** \copydoc data() const */
+    limb_type* data() noexcept;
+
+private:
+    detail::LimbStorage limbs_;
+};
+
+/** Two's complement signed integer of a fixed number of bits
+
+    Roughly equivalent to VHDL's numeric_std signed. The width is fixed at construction.
+    Arithmetic follows numeric_std: results of binary operations are as wide as the wider
+    operand, narrower operands are sign-extended, and results that do not fit wrap.
+
+    The value is held in 64-bit limbs, least significant first. Values of up to 128 bits
+    are held inline without allocating; wider values allocate from a MemoryResource like
+    Unsigned. Bits above the width in the top limb are always copies of the sign bit.
+    */
+class Signed {
+
+public: // types
+    /** Type of widths and bit positions. */
+    using size_type = std::size_t;
+
+    /** Type of the limbs holding the value. */
+    using limb_type = packed::word_type;
+
+    /** Type of the allocator of limbs of values wider than 128 bits. */
+    using allocator_type = ResourceAllocator<limb_type>;
+
+public: // constructors
+    /** Default to a null value of width 0. */
+    Signed() = default;
+
+    /** Create a Signed of the given width with the value 0. */
+    explicit Signed(size_type width, const allocator_type& alloc = allocator_type());
+
+    /** Create a Signed of the given width with the given value. Fails if the value does not fit. */
+    Signed(size_type width, long long value, const allocator_type& alloc = allocator_type());
+
+    /** Copies a value, allocating from the given allocator. Copies made without one allocate from the default resource of the calling thread. */
+    Signed(const Signed& a, const allocator_type& alloc);
+
+    /** Moves a value, allocating from the given allocator if it is not equal to that of `a`. */
+    Signed(Signed&& a, const allocator_type& alloc);
+
+    Signed(const Signed& a) = default;
+    Signed(Signed&& a) = default;
+    Signed& operator=(const Signed& a) = default;
+    Signed& operator=(Signed&& a) = default;
+
+public: // attributes
+    /** The allocator of the limbs. Copying or moving a value into this one keeps the allocator. */
+    allocator_type get_allocator() const noexcept;
+
+    /** The number of bits. */
+    size_type width() const noexcept;
+
+public: // limb access
+    /** The number of limbs holding the value. */
+    size_type limbs() const noexcept;
+
+    /** Returns the nth limb, least significant first. There is *no* bounds checking. */
+    limb_type limb(size_type n) const noexcept;
+
+    /** Sets the nth limb. Bits of the top limb above the width are replaced by copies of the sign bit. There is *no* bounds checking. */
+    void set_limb(size_type n, limb_type value) noexcept;
+
+    /** Pointer to the limbs. Bits of the top limb above the width must be kept copies of the sign bit. */
+    const limb_type* data() const noexcept;
+
+    /** \copydoc data() const */
+    limb_type* data() noexcept;
+
+private:
+    detail::LimbStorage limbs_;
+};
+
+/** \relates Unsigned Returns the value as an integer. Fails if the value does not fit. */
+unsigned long long to_integer(const Unsigned& a);
+
+/** \relates Signed Returns the value as an integer. Fails if the value does not fit. */
+long long to_integer(const Signed& a);
+
+/** \relates Unsigned Reinterprets the bits of a Signed as an Unsigned of the same width. */
+Unsigned to_unsigned(const Signed& a);
+
+/** \relates Signed Reinterprets the bits of an Unsigned as a Signed of the same width. */
+Signed to_signed(const Unsigned& a);
+
+/** \relates Unsigned Changes the width, adding `0` bits on the left or dropping bits from the left. */
+Unsigned resize(const Unsigned& a, Unsigned::size_type width);
+
+/** \relates Signed Changes the width. Widening sign-extends; narrowing keeps the sign bit and the rightmost `width-1` bits. */
+Signed resize(const Signed& a, Signed::size_type width);
+
+/** \relates Unsigned Addition. Yields the width of the wider operand. */
+Unsigned operator+(const Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Addition of an integer. Yields the width of `a`; the integer wraps to that width. */
+Unsigned operator+(const Unsigned& a, unsigned long long b);
+
+/** \relates Unsigned Inplace addition. Yields the width of `a`. */
+Unsigned& operator+=(Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Inplace addition of an integer. */
+Unsigned& operator+=(Unsigned& a, unsigned long long b);
+
+/** \relates Unsigned Subtraction. Yields the width of the wider operand. */
+Unsigned operator-(const Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Subtraction of an integer. Yields the width of `a`; the integer wraps to that width. */
+Unsigned operator-(const Unsigned& a, unsigned long long b);
+
+/** \relates Unsigned Inplace subtraction. Yields the width of `a`. */
+Unsigned& operator-=(Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Inplace subtraction of an integer. */
+Unsigned& operator-=(Unsigned& a, unsigned long long b);
+
+/** \relates Signed Addition. Yields the width of the wider operand. */
+Signed operator+(const Signed& a, const Signed& b);
+
+/** \relates Signed Addition of an integer. Yields the width of `a`; the integer wraps to that width. */
+Signed operator+(const Signed& a, long long b);
+
+/** \relates Signed Inplace addition. Yields the width of `a`. */
+Signed& operator+=(Signed& a, const Signed& b);
+
+/** \relates Signed Inplace addition of an integer. */
+Signed& operator+=(Signed& a, long long b);
+
+/** \relates Signed Subtraction. Yields the width of the wider operand. */
+Signed operator-(const Signed& a, const Signed& b);
+
+/** \relates Signed Subtraction of an integer. Yields the width of `a`; the integer wraps to that width. */
+Signed operator-(const Signed& a, long long b);
+
+/** \relates Signed Inplace subtraction. Yields the width of `a`. */
+Signed& operator-=(Signed& a, const Signed& b);
+
+/** \relates Signed Inplace subtraction of an integer. */
+Signed& operator-=(Signed& a, long long b);
+
+/** \relates Signed Negation. The most negative value wraps to itself. */
+Signed operator-(const Signed& a);
+
+/** \relates Signed Absolute value. The most negative value wraps to itself. */
+Signed abs(const Signed& a);
+
+/** \relates Unsigned Multiplication. Yields the sum of the widths, so the product never wraps. */
+Unsigned operator*(const Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Multiplication by an integer. Yields twice the width of `a`; the integer wraps to the width of `a`. */
+Unsigned operator*(const Unsigned& a, unsigned long long b);
+
+/** \relates Unsigned Division, rounding towards zero. Yields the width of `a`. Fails if `b` is zero. */
+Unsigned operator/(const Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Division by an integer, like numeric_std: the integer is converted at the width of `a`, and the quotient is 0 if the integer needs more bits. Yields the width of `a`. Fails if `b` is zero. */
+Unsigned operator/(const Unsigned& a, unsigned long long b);
+
+/** \relates Unsigned Remainder of division, like numeric_std "rem". Yields the width of `b`. Fails if `b` is zero. */
+Unsigned operator%(const Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Remainder of division by an integer converted like the divisor of operator/(). Yields the width of `a`. Fails if `b` is zero. */
+Unsigned operator%(const Unsigned& a, unsigned long long b);
+
+/** \relates Unsigned Modulus, like numeric_std "mod"; the same as the remainder for unsigned values. Yields the width of `b`. */
+Unsigned mod(const Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Modulus of division by an integer converted like the divisor of operator/(). Yields the width of `a`. Fails if `b` is zero. */
+Unsigned mod(const Unsigned& a, unsigned long long b);
+
+/** \relates Signed Multiplication. Yields the sum of the widths, so the product never wraps. */
+Signed operator*(const Signed& a, const Signed& b);
+
+/** \relates Signed Multiplication by an integer. Yields twice the width of `a`; the integer wraps to the width of `a`. */
+Signed operator*(const Signed& a, long long b);
+
+/** \relates Signed Division, rounding towards zero. Yields the width of `a`; the most negative value divided by -1 wraps. Fails if `b` is zero. */
+Signed operator/(const Signed& a, const Signed& b);
+
+/** \relates Signed Division by an integer, like numeric_std: the integer is converted at the width of `a`, and the quotient is 0 if the integer needs more bits, so `Signed(4, -8) / 8` is 0. Yields the width of `a`. Fails if `b` is zero. */
+Signed operator/(const Signed& a, long long b);
+
+/** \relates Signed Remainder of division, with the sign of `a` like numeric_std "rem". Yields the width of `b`. Fails if `b` is zero. */
+Signed operator%(const Signed& a, const Signed& b);
+
+/** \relates Signed Remainder of division by an integer converted like the divisor of operator/(). Yields the width of `a`. Fails if `b` is zero. */
+Signed operator%(const Signed& a, long long b);
+
+/** \relates Signed Modulus, with the sign of `b` like numeric_std "mod". Yields the width of `b`. Fails if `b` is zero. */
+Signed mod(const Signed& a, const Signed& b);
+
+/** \relates Signed Modulus of division by an integer converted like the divisor of operator/(), resized to the width of `a` by resize(). Fails if `b` is zero. */
+Signed mod(const Signed& a, long long b);
+
+/** \relates Unsigned Three-way comparison of values; the widths may differ. Returns a negative number, 0, or a positive number. */
+int compare(const Unsigned& a, const Unsigned& b) noexcept;
+
+/** \relates Unsigned Three-way comparison with an integer. */
+int compare(const Unsigned& a, unsigned long long b) noexcept;
+
+/** \relates Signed Three-way comparison of values; the widths may differ. Returns a negative number, 0, or a positive number. */
+int compare(const Signed& a, const Signed& b) noexcept;
+
+/** \relates Signed Three-way comparison with an integer. */
+int compare(const Signed& a, long long b) noexcept;
+
+/** \relates Unsigned Value equality; the widths may differ. */
+bool operator==(const Unsigned& a, const Unsigned& b) noexcept;
+
+/** \relates Unsigned Value inequality. */
+bool operator!=(const Unsigned& a, const Unsigned& b) noexcept;
+
+/** \relates Unsigned Less than. */
+bool operator<(const Unsigned& a, const Unsigned& b) noexcept;
+
+/** \relates Unsigned Less than or equal. */
+bool operator<=(const Unsigned& a, const Unsigned& b) noexcept;
+
+/** \relates Unsigned Greater than. */
+bool operator>(const Unsigned& a, const Unsigned& b) noexcept;
+
+/** \relates Unsigned Greater than or equal. */
+bool operator>=(const Unsigned& a, const Unsigned& b) noexcept;
+
+/** \relates Unsigned Comparisons with an integer. */
+bool operator==(const Unsigned& a, unsigned long long b) noexcept;
+
+/** \relates Unsigned \copydoc operator==(const Unsigned&, unsigned long long) */
+bool operator!=(const Unsigned& a, unsigned long long b) noexcept;
+
+/** \relates Unsigned \copydoc operator==(const Unsigned&, unsigned long long) */
+bool operator<(const Unsigned& a, unsigned long long b) noexcept;
+
+/** \relates Unsigned \copydoc operator==(const Unsigned&, unsigned long long) */
+bool operator<=(const Unsigned& a, unsigned long long b) noexcept;
+
+/** \relates Unsigned \copydoc operator==(const Unsigned&, unsigned long long) */
+bool operator>(const Unsigned& a, unsigned long long b) noexcept;
+
+/** \relates Unsigned \copydoc operator==(const Unsigned&, unsigned long long) */
+bool operator>=(const Unsigned& a, unsigned long long b) noexcept;
+
+/** \relates Signed Value equality; the widths may differ. */
+bool operator==(const Signed& a, const Signed& b) noexcept;
+
+/** \relates Signed Value inequality. */
+bool operator!=(const Signed& a, const Signed& b) noexcept;
+
+/** \relates Signed Less than. */
+bool operator<(const Signed& a, const Signed& b) noexcept;
+
+/** \relates Signed Less than or equal. */
+bool operator<=(const Signed& a, const Signed& b) noexcept;
+
+/** \relates Signed Greater than. */
+bool operator>(const Signed& a, const Signed& b) noexcept;
+
+/** \relates Signed Greater than or equal. */
+bool operator>=(const Signed& a, const Signed& b) noexcept;
+
+/** \relates Signed Comparisons with an integer. */
+bool operator==(const Signed& a, long long b) noexcept;
+
+/** \relates Signed \copydoc operator==(const Signed&, long long) */
+bool operator!=(const Signed& a, long long b) noexcept;
+
+/** \relates Signed \copydoc operator==(const Signed&, long long) */
+bool operator<(const Signed& a, long long b) noexcept;
+
+/** \relates Signed \copydoc operator==(const Signed&, long long) */
+bool operator<=(const Signed& a, long long b) noexcept;
+
+/** \relates Signed \copydoc operator==(const Signed&, long long) */
+bool operator>(const Signed& a, long long b) noexcept;
+
+/** \relates Signed \copydoc operator==(const Signed&, long long) */
+bool operator>=(const Signed& a, long long b) noexcept;
+
+/** \relates Unsigned Bitwise "and". Fails if the widths do not match. */
+Unsigned operator&(const Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Bitwise "or". Fails if the widths do not match. */
+Unsigned operator|(const Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Bitwise "xor". Fails if the widths do not match. */
+Unsigned operator^(const Unsigned& a, const Unsigned& b);
+
+/** \relates Unsigned Bitwise inversion. */
+Unsigned operator~(const Unsigned& a);
+
+/** \relates Signed Bitwise "and". Fails if the widths do not match. */
+Signed operator&(const Signed& a, const Signed& b);
+
+/** \relates Signed Bitwise "or". Fails if the widths do not match. */
+Signed operator|(const Signed& a, const Signed& b);
+
+/** \relates Signed Bitwise "xor". Fails if the widths do not match. */
+Signed operator^(const Signed& a, const Signed& b);
+
+/** \relates Signed Bitwise inversion. */
+Signed operator~(const Signed& a);
+
+/** \relates Unsigned Shifts towards the most significant bit, shifting in `0` bits. */
+Unsigned shift_left(const Unsigned& a, Unsigned::size_type n);
+
+/** \relates Unsigned Shifts towards the least significant bit, shifting in `0` bits. */
+Unsigned shift_right(const Unsigned& a, Unsigned::size_type n);
+
+/** \relates Unsigned Rotates towards the most significant bit. */
+Unsigned rotate_left(const Unsigned& a, Unsigned::size_type n);
+
+/** \relates Unsigned Rotates towards the least significant bit. */
+Unsigned rotate_right(const Unsigned& a, Unsigned::size_type n);
+
+/** \relates Signed Shifts towards the most significant bit, shifting in `0` bits. */
+Signed shift_left(const Signed& a, Signed::size_type n);
+
+/** \relates Signed Shifts towards the least significant bit, shifting in copies of the sign bit. */
+Signed shift_right(const Signed& a, Signed::size_type n);
+
+/** \relates Signed Rotates towards the most significant bit. */
+Signed rotate_left(const Signed& a, Signed::size_type n);
+
+/** \relates Signed Rotates towards the least significant bit. */
+Signed rotate_right(const Signed& a, Signed::size_type n);
+
+/** \relates Unsigned Same as shift_left. */
+Unsigned operator<<(const Unsigned& a, Unsigned::size_type n);
+
+/** \relates Unsigned Same as shift_right. */
+Unsigned operator>>(const Unsigned& a, Unsigned::size_type n);
+
+/** \relates Signed Same as shift_left. */
+Signed operator<<(const Signed& a, Signed::size_type n);
+
+/** \relates Signed Same as shift_right. */
+Signed operator>>(const Signed& a, Signed::size_type n);
+
+/** Context for repeated multiplication modulo a fixed odd modulus
+
+    Holds the constants of Montgomery reduction, which replaces the division of each
+    modular multiplication with multiplications and shifts. Values in Montgomery form are
+    `a * R mod m`, where `R` is `2^(64*limbs)` of the modulus; products of values in that
+    form stay in that form. Useful for modular exponentiation in cryptographic reference
+    models. All results are as wide as the modulus.
+    */
+class Montgomery {
+
+public: // types
+    /** Type of the limbs holding values. */
+    using limb_type = packed::word_type;
+
+public: // constructors
+    /** Create a context for the given modulus. Fails if the modulus is even, which includes zero. */
+    explicit Montgomery(const Unsigned& modulus);
+
+public: // attributes
+    /** The modulus. */
+    const Unsigned& modulus() const noexcept;
+
+public: // conversions
+    /** Converts a value of any width into Montgomery form, reducing it first. */
+    Unsigned to_montgomery(const Unsigned& a) const;
+
+    /** Converts a value in Montgomery form back into an ordinary value. */
+    Unsigned from_montgomery(const Unsigned& a) const;
+
+public: // operations
+    /** Product of two values in Montgomery form, in Montgomery form. The operands must be results of this context. */
+    Unsigned multiply(const Unsigned& a, const Unsigned& b) const;
+
+    /** `a * b mod m` for ordinary values of any width. */
+    Unsigned mod_multiply(const Unsigned& a, const Unsigned& b) const;
+
+    /** `base^exponent mod m` for ordinary values of any width. */
+    Unsigned mod_pow(const Unsigned& base, const Unsigned& exponent) const;
+
+private:
+    Unsigned modulus_;
+    Unsigned r2_;
+    limb_type inverse_ { 0 };
+};
+
+}
+
+#include "hdltypes/impl/numeric.hpp"
+
+#endif
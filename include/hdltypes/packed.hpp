@@ -0,0 +1,147 @@
+#ifndef HDLTYPES_PACKED_HPP
+#define HDLTYPES_PACKED_HPP
+
+#include "hdltypes/logic.hpp" // Logic
+#include <cstddef>            // size_t
+#include <cstdint>            // uint8_t, uint64_t
+
+namespace hdltypes {
+namespace packed {
+
+/** Type of the machine words that hold packed elements. */
+using word_type = uint64_t;
+
+/** Number of elements held in each word (or plane) of a packed array. */
+constexpr std::size_t word_bits = 64;
+
+/** Number of words needed to hold the given number of packed elements. */
+constexpr std::size_t word_count(std::size_t length) noexcept;
+
+/** Mask of the bits used in the last word of a packed array of the given length. */
+constexpr word_type tail_mask(std::size_t length) noexcept;
+
+/** 64 Logic values encoded in bit-planes
+
+    Each Logic value is encoded as 4 bits, one bit in each plane. The encoding is chosen
+    so that the "and", "or", "xor", and inversion operations can be computed with a
+    handful of word-wide boolean operations that give the same results as the tables
+    used for the scalar Logic operations.
+
+\verbatim
+        unknown value weak unassigned
+U       1       0     0    1
+X       1       0     0    0
+_0      0       0     0    0
+_1      0       1     0    0
+Z       1       1     0    0
+W       1       0     1    0
+L       0       0     1    0
+H       0       1     1    0
+DC      1       1     1    0
+\endverbatim
+
+    A zeroed word is 64 `0` values.
+    */
+struct LogicWord {
+    word_type unknown;    ///< Set if the value is not `0`, `1`, `L`, or `H`.
+    word_type value;      ///< The logical value of `0`, `1`, `L`, and `H` values.
+    word_type weak;       ///< Set for weak values.
+    word_type unassigned; ///< Set only for `U` values.
+};
+
+/** Number of bit-planes in a LogicWord. */
+constexpr std::size_t logic_planes = 4;
+
+/** \relates LogicWord Returns the 4-bit code of a Logic value. Bit `n` of the code is the bit in plane `n`. */
+constexpr uint8_t encode(Logic a) noexcept;
+
+/** \relates LogicWord Returns the Logic value of a 4-bit code. */
+constexpr Logic decode(uint8_t code) noexcept;
+
+/** \relates LogicWord Returns a LogicWord with all 64 elements set to the given value. */
+constexpr LogicWord broadcast(Logic a) noexcept;
+
+/** \relates LogicWord Returns the element at the given bit. */
+constexpr Logic get(const LogicWord& w, std::size_t bit) noexcept;
+
+/** \relates LogicWord Sets the element at the given bit. */
+constexpr void set(LogicWord& w, std::size_t bit, Logic a) noexcept;
+
+/** \relates LogicWord Clears all elements not selected by the mask to `0`. */
+constexpr LogicWord mask(const LogicWord& w, word_type m) noexcept;
+
+/** \relates LogicWord Returns the mask of elements that are `0` or `1`. */
+constexpr word_type mask01(const LogicWord& w) noexcept;
+
+/** \relates LogicWord Element-wise equality of all 4 planes. */
+constexpr bool operator==(const LogicWord& a, const LogicWord& b) noexcept;
+
+/** \relates LogicWord Element-wise inequality of any of the 4 planes. */
+constexpr bool operator!=(const LogicWord& a, const LogicWord& b) noexcept;
+
+/** \relates LogicWord Element-wise logical "and". Equivalent to the Logic operation. */
+constexpr LogicWord operator&(const LogicWord& a, const LogicWord& b) noexcept;
+
+/** \relates LogicWord Element-wise logical "or". Equivalent to the Logic operation. */
+constexpr LogicWord operator|(const LogicWord& a, const LogicWord& b) noexcept;
+
+/** \relates LogicWord Element-wise logical "xor". Equivalent to the Logic operation. */
+constexpr LogicWord operator^(const LogicWord& a, const LogicWord& b) noexcept;
+
+/** \relates LogicWord Element-wise logical inversion. Equivalent to the Logic operation. */
+constexpr LogicWord operator~(const LogicWord& a) noexcept;
+
+/** \relates LogicWord Element-wise resolution of two drivers. Equivalent to the Logic operation. */
+constexpr LogicWord resolve(const LogicWord& a, const LogicWord& b) noexcept;
+
+/** The strengths driven onto 64 resolved signals
+
+    Resolution (see resolve(Logic, Logic)) is a join: it only ever moves up from `Z`,
+    through the weak values, to the strong values and then `U`. Each level is a set of
+    the strengths seen, so any number of drivers are resolved by "or"ing their
+    DriveWords together and decoding the result once.
+
+\verbatim
+        strong0 strong1 weak0 weak1 unassigned
+U       0       0       0     0     1
+X       1       1       0     0     0
+_0      1       0       0     0     0
+_1      0       1       0     0     0
+Z       0       0       0     0     0
+W       0       0       1     1     0
+L       0       0       1     0     0
+H       0       0       0     1     0
+DC      1       1       0     0     0
+\endverbatim
+
+    A zeroed word is 64 undriven (`Z`) signals.
+    */
+struct DriveWord {
+    word_type strong0;    ///< Set if a `0`, `X`, or `-` is driven.
+    word_type strong1;    ///< Set if a `1`, `X`, or `-` is driven.
+    word_type weak0;      ///< Set if an `L` or `W` is driven.
+    word_type weak1;      ///< Set if an `H` or `W` is driven.
+    word_type unassigned; ///< Set if a `U` is driven.
+};
+
+/** Number of bit-planes in a DriveWord. */
+constexpr std::size_t drive_planes = 5;
+
+/** \relates DriveWord Returns the strengths driven by a word of values. */
+constexpr DriveWord drive(const LogicWord& w) noexcept;
+
+/** \relates DriveWord Returns the resolved values of a word of driven strengths. */
+constexpr LogicWord resolve(const DriveWord& d) noexcept;
+
+/** \relates DriveWord Union of the strengths driven. */
+constexpr DriveWord operator|(const DriveWord& a, const DriveWord& b) noexcept;
+
+/** \relates DriveWord Inplace version of the union of the strengths driven. */
+constexpr DriveWord& operator|=(DriveWord& a, const DriveWord& b) noexcept;
+
+}
+}
+
+#include "hdltypes/impl/packed.hpp"
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef HDLTYPES_RESOLUTION_HPP
+#define HDLTYPES_RESOLUTION_HPP
+
+#include "hdltypes/bounds.hpp"       // Bounds
+#include "hdltypes/logic_vector.hpp" // LogicVector
+#include "hdltypes/packed.hpp"       // DriveWord
+#include <cstddef>                   // size_t
+#include <cstdint>                   // uint32_t
+#include <vector>                    // vector
+
+namespace hdltypes {
+
+/** Resolved LogicVector signal with a fixed number of drivers
+
+    Models a bus, like a VHDL std_logic_vector signal driven from several processes:
+    every driver holds a LogicVector, and the value of the bus is the element-wise
+    resolution (see resolve(Logic, Logic)) of all drivers. Drivers start undriven (`Z`).
+
+    The resolved value is kept up to date as drivers change. For every element, the bus
+    counts the drivers driving each strength (see packed::DriveWord), so changing one
+    driver only touches the elements whose driven strengths changed, independent of the
+    number of drivers.
+    */
+class LogicBus {
+
+public: // types
+    /** Type of index values. */
+    using index_type = Bounds::index_type;
+
+    /** Type of lengths and driver numbers. */
+    using size_type = Bounds::size_type;
+
+public: // constructors
+    /** Default to a null bus with no drivers. */
+    LogicBus() = default;
+
+    /** Create a LogicBus with the given bounds and number of drivers, all undriven. */
+    LogicBus(Bounds bounds, size_type drivers);
+
+    /** Create a LogicBus with the bounds `length-1 downto 0` and the given number of drivers, all undriven. */
+    LogicBus(size_type length, size_type drivers);
+
+public: // attributes
+    /** The bounds of the bus. */
+    Bounds bounds() const noexcept;
+
+    /** The number of elements. */
+    size_type length() const noexcept;
+
+    /** The number of drivers. */
+    size_type drivers() const noexcept;
+
+    /** The resolved value. */
+    const LogicVector& value() const noexcept;
+
+public: // drivers
+    /** Returns the value of the `n`th driver. Fails if there is no such driver. */
+    const LogicVector& driver(size_type n) const;
+
+    /** Sets the value of the `n`th driver and re-resolves the elements it changes. Fails if there is no such driver or the lengths differ. */
+    void drive(size_type n, const LogicVector& value);
+
+    /** Sets the `n`th driver to `Z`. Fails if there is no such driver. */
+    void release(size_type n);
+
+private: // members
+    Bounds bounds_ {};
+    std::vector<LogicVector> drivers_ {};
+    std::vector<packed::DriveWord> driven_ {};
+    std::vector<uint32_t> counts_ {};
+    LogicVector value_ {};
+};
+
+/** \relates LogicBus Resolves the values of `n` drivers element-wise into `r`. Fails if the lengths differ.
+
+    Every word of `r` is resolved in one pass over the drivers, 64 elements at a time.
+    All elements are `Z` if there are no drivers.
+    */
+void resolve(LogicVector& r, const LogicVector* drivers, std::size_t n);
+
+}
+
+#include "hdltypes/impl/resolution.hpp"
+
+#endif
@@ -0,0 +1,251 @@
+#ifndef HDLTYPES_STATIC_FIXED_HPP
+#define HDLTYPES_STATIC_FIXED_HPP
+
+#include "hdltypes/static_numeric.hpp" // StaticUnsigned, StaticSigned
+#include <cstddef>                     // size_t
+
+namespace hdltypes {
+
+namespace detail {
+
+/** Number of bits of a fixed point type with the bounds (left downto right). */
+constexpr std::size_t fixed_width(const int left, const int right) noexcept
+{
+    return std::size_t(left - right + 1);
+}
+
+/** Left bound of the result of fixed_pkg addition and subtraction, before the carry bit. */
+constexpr int max_bound(const int a, const int b) noexcept
+{
+    return (a > b) ? a : b;
+}
+
+/** Right bound of the result of fixed_pkg addition and subtraction. */
+constexpr int min_bound(const int a, const int b) noexcept
+{
+    return (a < b) ? a : b;
+}
+
+}
+
+/** What resize does with values outside the range of the result, like fixed_pkg's fixed_overflow_style_type. */
+enum class FixedOverflow {
+    saturate, ///< Clamp to the largest or smallest value of the result.
+    wrap      ///< Drop the bits on the left.
+};
+
+/** How resize drops bits on the right, like fixed_pkg's fixed_round_style_type. */
+enum class FixedRound {
+    round,   ///< Round to the nearest value, ties to even.
+    truncate ///< Round towards negative infinity.
+};
+
+/** Unsigned fixed point number with compile-time bounds
+
+    The value has the bits (L downto R) of fixed_pkg's `ufixed`: bit `i` has the weight
+    `2^i`, so `R` is negative for fractional bits. The bits are held as a StaticUnsigned,
+    so values of up to 64 bits are a single native integer and operations never allocate
+    or check bounds at runtime.
+
+    Every arithmetic operation yields bounds that hold the exact result, computed at
+    compile time like fixed_pkg. Precision is only lost by calling resize.
+    */
+template <int L, int R>
+class StaticUfixed {
+    static_assert(L >= R, "Left bound must not be below the right bound");
+
+public: // types
+    /** Type of widths. */
+    using size_type = std::size_t;
+
+    /** Type of the bits as an integer, the value scaled by `2^-R`. */
+    using integer_type = StaticUnsigned<detail::fixed_width(L, R)>;
+
+public: // constructors
+    /** Default to the value 0. */
+    constexpr StaticUfixed() noexcept = default;
+
+    /** Create a StaticUfixed nearest to a real value, rounding ties to even and saturating. NaN converts to 0. */
+    explicit StaticUfixed(double value) noexcept;
+
+    /** Create a StaticUfixed from its bits; the value is `bits * 2^R`. */
+    static constexpr StaticUfixed from_bits(const integer_type& bits) noexcept;
+
+public: // attributes
+    /** The index of the leftmost bit. */
+    static constexpr int left() noexcept;
+
+    /** The index of the rightmost bit. */
+    static constexpr int right() noexcept;
+
+    /** The number of bits. */
+    static constexpr size_type width() noexcept;
+
+    /** Returns the bits as an integer, the value scaled by `2^-R`. */
+    constexpr integer_type bits() const noexcept;
+
+private: // members
+    integer_type bits_ {};
+};
+
+/** Two's complement fixed point number with compile-time bounds
+
+    The compile-time bound version of fixed_pkg's `sfixed`, held like StaticUfixed in a
+    StaticSigned. Bit `L` is the sign bit.
+    */
+template <int L, int R>
+class StaticSfixed {
+    static_assert(L >= R, "Left bound must not be below the right bound");
+
+public: // types
+    /** Type of widths. */
+    using size_type = std::size_t;
+
+    /** Type of the bits as an integer, the value scaled by `2^-R`. */
+    using integer_type = StaticSigned<detail::fixed_width(L, R)>;
+
+public: // constructors
+    /** Default to the value 0. */
+    constexpr StaticSfixed() noexcept = default;
+
+    /** Create a StaticSfixed nearest to a real value, rounding ties to even and saturating. NaN converts to 0. */
+    explicit StaticSfixed(double value) noexcept;
+
+    /** Create a StaticSfixed from its bits; the value is `bits * 2^R`. */
+    static constexpr StaticSfixed from_bits(const integer_type& bits) noexcept;
+
+public: // attributes
+    /** The index of the leftmost bit, the sign bit. */
+    static constexpr int left() noexcept;
+
+    /** The index of the rightmost bit. */
+    static constexpr int right() noexcept;
+
+    /** The number of bits. */
+    static constexpr size_type width() noexcept;
+
+    /** Returns the bits as an integer, the value scaled by `2^-R`. */
+    constexpr integer_type bits() const noexcept;
+
+private: // members
+    integer_type bits_ {};
+};
+
+/** \relates StaticUfixed Returns the value as a double, rounded if it has more than 53 significant bits. */
+template <int L, int R>
+double to_real(const StaticUfixed<L, R>& a) noexcept;
+
+/** \relates StaticSfixed Returns the value as a double, rounded if it has more than 53 significant bits. */
+template <int L, int R>
+double to_real(const StaticSfixed<L, R>& a) noexcept;
+
+/** \relates StaticSfixed Converts a StaticUfixed to a StaticSfixed with a sign bit added on the left. */
+template <int L, int R>
+constexpr StaticSfixed<L + 1, R> to_sfixed(const StaticUfixed<L, R>& a) noexcept;
+
+/** \relates StaticUfixed Changes the bounds, dropping bits on the right by `round` and handling values out of range by `overflow`.
+
+    Rounding adds half of the weight of the dropped bits, less one unit unless the kept
+    bits are odd, then shifts; saturation compares the bits above the result with zero.
+    Both work on whole integers, so a resize of up to 64 bits is a handful of instructions.
+    */
+template <int L2, int R2, int L, int R>
+constexpr StaticUfixed<L2, R2> resize(const StaticUfixed<L, R>& a, FixedOverflow overflow = FixedOverflow::saturate, FixedRound round = FixedRound::round) noexcept;
+
+/** \relates StaticSfixed Changes the bounds. See resize(const StaticUfixed<L, R>&, FixedOverflow, FixedRound). */
+template <int L2, int R2, int L, int R>
+constexpr StaticSfixed<L2, R2> resize(const StaticSfixed<L, R>& a, FixedOverflow overflow = FixedOverflow::saturate, FixedRound round = FixedRound::round) noexcept;
+
+/** \relates StaticUfixed Addition. Yields (max(L1, L2) + 1 downto min(R1, R2)), which holds every sum. */
+template <int L1, int R1, int L2, int R2>
+constexpr StaticUfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)> operator+(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticUfixed Subtraction. Yields the bounds of addition; negative differences wrap like fixed_pkg. */
+template <int L1, int R1, int L2, int R2>
+constexpr StaticUfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)> operator-(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticUfixed Multiplication. Yields (L1 + L2 + 1 downto R1 + R2), which holds every product. */
+template <int L1, int R1, int L2, int R2>
+constexpr StaticUfixed<L1 + L2 + 1, R1 + R2> operator*(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Addition. Yields (max(L1, L2) + 1 downto min(R1, R2)), which holds every sum. */
+template <int L1, int R1, int L2, int R2>
+constexpr StaticSfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)> operator+(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Subtraction. Yields (max(L1, L2) + 1 downto min(R1, R2)), which holds every difference. */
+template <int L1, int R1, int L2, int R2>
+constexpr StaticSfixed<detail::max_bound(L1, L2) + 1, detail::min_bound(R1, R2)> operator-(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Multiplication. Yields (L1 + L2 + 1 downto R1 + R2), which holds every product. */
+template <int L1, int R1, int L2, int R2>
+constexpr StaticSfixed<L1 + L2 + 1, R1 + R2> operator*(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Negation. Yields (L + 1 downto R), which holds the negation of the most negative value. */
+template <int L, int R>
+constexpr StaticSfixed<L + 1, R> operator-(const StaticSfixed<L, R>& a) noexcept;
+
+/** \relates StaticSfixed Absolute value. Yields (L + 1 downto R). */
+template <int L, int R>
+constexpr StaticSfixed<L + 1, R> abs(const StaticSfixed<L, R>& a) noexcept;
+
+/** \relates StaticUfixed Three-way comparison of the values. Operands of different bounds are compared by value. */
+template <int L1, int R1, int L2, int R2>
+constexpr int compare(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Three-way comparison of the values. Operands of different bounds are compared by value. */
+template <int L1, int R1, int L2, int R2>
+constexpr int compare(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticUfixed Value equality; the bounds may differ. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator==(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticUfixed Value inequality. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator!=(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticUfixed Less than. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator<(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticUfixed Less than or equal. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator<=(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticUfixed Greater than. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator>(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticUfixed Greater than or equal. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator>=(const StaticUfixed<L1, R1>& a, const StaticUfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Value equality; the bounds may differ. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator==(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Value inequality. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator!=(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Less than. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator<(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Less than or equal. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator<=(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Greater than. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator>(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept;
+
+/** \relates StaticSfixed Greater than or equal. */
+template <int L1, int R1, int L2, int R2>
+constexpr bool operator>=(const StaticSfixed<L1, R1>& a, const StaticSfixed<L2, R2>& b) noexcept;
+
+}
+
+#include "hdltypes/impl/static_fixed.hpp"
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef HDLTYPES_STATIC_FLOAT_HPP
+#define HDLTYPES_STATIC_FLOAT_HPP
+
+#include "hdltypes/static_numeric.hpp" // StaticUnsigned
+#include <cstddef>                     // size_t
+
+namespace hdltypes {
+
+namespace detail {
+
+/** How arithmetic on a floating point format is computed. */
+enum class FloatPath {
+    binary32,   ///< The format is IEEE754 binary32; computed in `float`.
+    binary64,   ///< The format is IEEE754 binary64; computed in `double`.
+    via_double, ///< Computed in `double` and rounded to the format, which gives the same result.
+    soft        ///< Computed on the bits with integer arithmetic.
+};
+
+/** Bias of the exponent of a floating point format with `E` exponent bits. */
+constexpr int float_bias(const std::size_t E) noexcept
+{
+    return (1 << (E - 1)) - 1;
+}
+
+/** Exponent of the smallest normal value of a floating point format with `E` exponent bits. */
+constexpr int float_emin(const std::size_t E) noexcept
+{
+    return 1 - float_bias(E);
+}
+
+/** Path of a floating point format with `E` exponent and `M` fraction bits.
+
+    Rounding the `double` result of an addition, subtraction, multiplication or division
+    to a format of `p` bits of precision gives the correctly rounded result when
+    `2p + 2 <= 53`, as long as the exact result cannot overflow or underflow `double`.
+    Every product and quotient of the format must then be a normal `double`.
+    */
+constexpr FloatPath float_path(const std::size_t E, const std::size_t M) noexcept
+{
+    return ((E == 8) && (M == 23)) ? FloatPath::binary32
+        : ((E == 11) && (M == 52)) ? FloatPath::binary64
+        : ((E <= 11) && (2 * (M + 1) + 2 <= 53)
+              && (2 * (float_emin(E) - int(M)) >= -1022)
+              && (float_bias(E) + 1 - float_emin(E) + int(M) <= 1023))
+        ? FloatPath::via_double
+        : FloatPath::soft;
+}
+
+}
+
+/** Binary floating point number with a compile-time format
+
+    A generalization of IEEE754 binary interchange formats after float_pkg's `float`, with
+    a sign bit, `E` exponent bits and `M` fraction bits, so `StaticFloat<8, 23>` is
+    binary32 and `StaticFloat<8, 7>` is bfloat16. Subnormals, infinities and NaN work as in
+    IEEE754, and every operation rounds to nearest, ties to even.
+
+    Arithmetic on binary32 and binary64 is native arithmetic. Narrower formats like
+    binary16, bfloat16 and the 8-bit formats are computed in `double` and rounded once
+    to the format, which gives the correctly rounded result. Other formats are computed
+    on the bits with integer arithmetic, which is much slower.
+
+    The result of an operation that is NaN is always the quiet NaN with a clear sign bit
+    and only the leftmost fraction bit set, so results do not depend on the path.
+    */
+template <std::size_t E, std::size_t M>
+class StaticFloat {
+    static_assert(E >= 2 && E <= 30, "Exponent width must be between 2 and 30 bits");
+    static_assert(M >= 1, "Fraction width must be at least 1 bit");
+
+public: // types
+    /** Type of widths. */
+    using size_type = std::size_t;
+
+    /** Type of the bits: the sign bit, then the biased exponent, then the fraction. */
+    using bits_type = StaticUnsigned<1 + E + M>;
+
+public: // constructors
+    /** Default to the value +0. */
+    constexpr StaticFloat() noexcept = default;
+
+    /** Create a StaticFloat nearest to a real value, rounding ties to even. */
+    explicit StaticFloat(double value) noexcept;
+
+    /** Create a StaticFloat from its bits. */
+    static constexpr StaticFloat from_bits(const bits_type& bits) noexcept;
+
+    /** Positive infinity. */
+    static constexpr StaticFloat infinity() noexcept;
+
+    /** The quiet NaN that operations yield. */
+    static constexpr StaticFloat nan() noexcept;
+
+public: // attributes
+    /** The number of exponent bits. */
+    static constexpr size_type exponent_width() noexcept;
+
+    /** The number of fraction bits, not counting the hidden bit. */
+    static constexpr size_type fraction_width() noexcept;
+
+    /** The number of bits. */
+    static constexpr size_type width() noexcept;
+
+    /** The bias of the exponent. */
+    static constexpr int bias() noexcept;
+
+    /** Whether arithmetic uses the native floating point unit rather than integer arithmetic. */
+    static constexpr bool is_native() noexcept;
+
+    /** Returns the bits. */
+    constexpr bits_type bits() const noexcept;
+
+private: // members
+    bits_type bits_ {};
+};
+
+/** \relates StaticFloat Returns the value as a double, rounded to nearest, ties to even, for formats wider than binary64. */
+template <std::size_t E, std::size_t M>
+double to_real(const StaticFloat<E, M>& a) noexcept;
+
+/** \relates StaticFloat Converts to another format, rounding to nearest, ties to even. */
+template <std::size_t E2, std::size_t M2, std::size_t E, std::size_t M>
+StaticFloat<E2, M2> resize(const StaticFloat<E, M>& a) noexcept;
+
+/** \relates StaticFloat Whether the value is NaN. */
+template <std::size_t E, std::size_t M>
+constexpr bool isnan(const StaticFloat<E, M>& a) noexcept;
+
+/** \relates StaticFloat Whether the value is an infinity. */
+template <std::size_t E, std::size_t M>
+constexpr bool isinf(const StaticFloat<E, M>& a) noexcept;
+
+/** \relates StaticFloat Whether the sign bit is set. */
+template <std::size_t E, std::size_t M>
+constexpr bool signbit(const StaticFloat<E, M>& a) noexcept;
+
+/** \relates StaticFloat Addition. */
+template <std::size_t E, std::size_t M>
+StaticFloat<E, M> operator+(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept;
+
+/** \relates StaticFloat Subtraction. */
+template <std::size_t E, std::size_t M>
+StaticFloat<E, M> operator-(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept;
+
+/** \relates StaticFloat Multiplication. */
+template <std::size_t E, std::size_t M>
+StaticFloat<E, M> operator*(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept;
+
+/** \relates StaticFloat Division. */
+template <std::size_t E, std::size_t M>
+StaticFloat<E, M> operator/(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept;
+
+/** \relates StaticFloat Negation; flips the sign bit, even of NaN. */
+template <std::size_t E, std::size_t M>
+constexpr StaticFloat<E, M> operator-(const StaticFloat<E, M>& a) noexcept;
+
+/** \relates StaticFloat Absolute value; clears the sign bit, even of NaN. */
+template <std::size_t E, std::size_t M>
+constexpr StaticFloat<E, M> abs(const StaticFloat<E, M>& a) noexcept;
+
+/** \relates StaticFloat Equality. NaN is not equal to anything, and +0 is equal to -0. */
+template <std::size_t E, std::size_t M>
+constexpr bool operator==(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept;
+
+/** \relates StaticFloat Inequality. NaN is not equal to anything, including itself. */
+template <std::size_t E, std::size_t M>
+constexpr bool operator!=(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept;
+
+/** \relates StaticFloat Less than. False if either operand is NaN. */
+template <std::size_t E, std::size_t M>
+constexpr bool operator<(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept;
+
+/** \relates StaticFloat Less than or equal. False if either operand is NaN. */
+template <std::size_t E, std::size_t M>
+constexpr bool operator<=(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept;
+
+/** \relates StaticFloat Greater than. False if either operand is NaN. */
+template <std::size_t E, std::size_t M>
+constexpr bool operator>(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept;
+
+/** \relates StaticFloat Greater than or equal. False if either operand is NaN. */
+template <std::size_t E, std::size_t M>
+constexpr bool operator>=(const StaticFloat<E, M>& a, const StaticFloat<E, M>& b) noexcept;
+
+}
+
+#include "hdltypes/impl/static_float.hpp"
+
+#endif
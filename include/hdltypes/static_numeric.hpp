@@ -0,0 +1,383 @@
+#ifndef HDLTYPES_STATIC_NUMERIC_HPP
+#define HDLTYPES_STATIC_NUMERIC_HPP
+
+#include "hdltypes/impl/static_limbs.hpp" // static_storage
+#include "hdltypes/numeric.hpp"           // Unsigned, Signed
+#include "hdltypes/packed.hpp"            // word_type, word_count
+#include <cstddef>                        // size_t
+#include <type_traits>                    // enable_if
+
+namespace hdltypes {
+
+namespace detail {
+
+/** Width of the result of numeric_std addition and subtraction. */
+constexpr std::size_t max_width(const std::size_t a, const std::size_t b) noexcept
+{
+    return (a > b) ? a : b;
+}
+
+}
+
+/** Unsigned integer with a compile-time number of bits
+
+    The compile-time width version of Unsigned. Widths of up to 64 bits are held in a
+    single native integer and widths of up to 128 bits in a native 128-bit integer where
+    the compiler has one, so arithmetic lowers to the native operation and a constant
+    mask. Wider values are held in an inline array of limbs. Values of this type never
+    allocate, and all operations are `constexpr`.
+
+    Arithmetic follows numeric_std like Unsigned, with the widths of results computed at
+    compile time. Bits of the storage above the width are always `0`.
+    */
+template <std::size_t N>
+class StaticUnsigned {
+    static_assert(N > 0, "Width must be at least 1");
+
+public: // types
+    /** Type of widths and bit positions. */
+    using size_type = std::size_t;
+
+    /** Type of the limbs holding the value. */
+    using limb_type = packed::word_type;
+
+    /** Type holding the value: a native integer, or a limbs::LimbArray above 128 bits. */
+    using storage_type = typename limbs::static_storage<N>::type;
+
+public: // constructors
+    /** Default to the value 0. */
+    constexpr StaticUnsigned() noexcept = default;
+
+    /** Create a StaticUnsigned with the given value. The value wraps to the width. */
+    explicit constexpr StaticUnsigned(unsigned long long value) noexcept;
+
+    /** Allows an Unsigned of the same width to be converted to a StaticUnsigned. */
+    explicit StaticUnsigned(const Unsigned& a);
+
+    /** Create a StaticUnsigned from a value of the storage type. The value wraps to the width. */
+    static constexpr StaticUnsigned from_value(const storage_type& value) noexcept;
+
+public: // attributes
+    /** The number of bits. */
+    static constexpr size_type width() noexcept;
+
+public: // limb access
+    /** The number of limbs holding the value. */
+    static constexpr size_type limbs() noexcept;
+
+    /** Returns the nth limb, least significant first. There is *no* bounds checking. */
+    constexpr limb_type limb(size_type n) const noexcept;
+
+    /** Sets the nth limb. Bits of the top limb above the width are ignored. There is *no* bounds checking. */
+    constexpr void set_limb(size_type n, limb_type value) noexcept;
+
+    /** Returns the value as the storage type. */
+    constexpr storage_type value() const noexcept;
+
+public: // Unsigned conversion
+    /** Allows a StaticUnsigned to be converted *implicitly* to an Unsigned. */
+    operator Unsigned() const;
+
+private: // members
+    storage_type value_ {};
+};
+
+/** Two's complement signed integer with a compile-time number of bits
+
+    The compile-time width version of Signed. Held like StaticUnsigned; bits of the
+    storage above the width are always copies of the sign bit, so comparisons and right
+    shifts work on the storage directly.
+    */
+template <std::size_t N>
+class StaticSigned {
+    static_assert(N > 0, "Width must be at least 1");
+
+public: // types
+    /** Type of widths and bit positions. */
+    using size_type = std::size_t;
+
+    /** Type of the limbs holding the value. */
+    using limb_type = packed::word_type;
+
+    /** Type holding the value: a native integer, or a limbs::LimbArray above 128 bits. */
+    using storage_type = typename limbs::static_storage<N>::type;
+
+public: // constructors
+    /** Default to the value 0. */
+    constexpr StaticSigned() noexcept = default;
+
+    /** Create a StaticSigned with the given value. The value wraps to the width. */
+    explicit constexpr StaticSigned(long long value) noexcept;
+
+    /** Allows a Signed of the same width to be converted to a StaticSigned. */
+    explicit StaticSigned(const Signed& a);
+
+    /** Create a StaticSigned from a value of the storage type. The value wraps to the width. */
+    static constexpr StaticSigned from_value(const storage_type& value) noexcept;
+
+public: // attributes
+    /** The number of bits. */
+    static constexpr size_type width() noexcept;
+
+public: // limb access
+    /** The number of limbs holding the value. */
+    static constexpr size_type limbs() noexcept;
+
+    /** Returns the nth limb, least significant first. There is *no* bounds checking. */
+    constexpr limb_type limb(size_type n) const noexcept;
+
+    /** Sets the nth limb. Bits of the top limb above the width are replaced by copies of the sign bit. There is *no* bounds checking. */
+    constexpr void set_limb(size_type n, limb_type value) noexcept;
+
+    /** Returns the value as the storage type, sign-extended to all of its bits. */
+    constexpr storage_type value() const noexcept;
+
+public: // Signed conversion
+    /** Allows a StaticSigned to be converted *implicitly* to a Signed. */
+    operator Signed() const;
+
+private: // members
+    storage_type value_ {};
+};
+
+/** \relates StaticUnsigned Returns the least significant 64 bits as an integer. */
+template <std::size_t N>
+constexpr unsigned long long to_integer(const StaticUnsigned<N>& a) noexcept;
+
+/** \relates StaticSigned Returns the least significant 64 bits as an integer. Exact for widths of up to 64 bits. */
+template <std::size_t N>
+constexpr long long to_integer(const StaticSigned<N>& a) noexcept;
+
+/** \relates StaticUnsigned Reinterprets the bits of a StaticSigned as a StaticUnsigned of the same width. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> to_unsigned(const StaticSigned<N>& a) noexcept;
+
+/** \relates StaticSigned Reinterprets the bits of a StaticUnsigned as a StaticSigned of the same width. */
+template <std::size_t N>
+constexpr StaticSigned<N> to_signed(const StaticUnsigned<N>& a) noexcept;
+
+/** \relates StaticUnsigned Changes the width, adding `0` bits on the left or dropping bits from the left.
+
+    `N` is checked in the template parameters so `resize<L, 0>` of the fixed point types
+    does not instantiate a StaticUnsigned of width 0.
+    */
+template <std::size_t M, std::size_t N, typename = typename std::enable_if<(N > 0)>::type>
+constexpr StaticUnsigned<M> resize(const StaticUnsigned<N>& a) noexcept;
+
+/** \relates StaticSigned Changes the width. Widening sign-extends; narrowing keeps the sign bit and the rightmost `M-1` bits. */
+template <std::size_t M, std::size_t N, typename = typename std::enable_if<(N > 0)>::type>
+constexpr StaticSigned<M> resize(const StaticSigned<N>& a) noexcept;
+
+/** \relates StaticUnsigned Addition. Yields the width of the wider operand. */
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<detail::max_width(N, M)> operator+(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Inplace addition. Yields the width of `a`. */
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<N>& operator+=(StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Subtraction. Yields the width of the wider operand. */
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<detail::max_width(N, M)> operator-(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Inplace subtraction. Yields the width of `a`. */
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<N>& operator-=(StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Multiplication. Yields the sum of the widths, so the product never wraps. */
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<N + M> operator*(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Division, rounding towards zero. Yields the width of `a`. Fails if `b` is zero. */
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<N> operator/(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b);
+
+/** \relates StaticUnsigned Remainder of division. Yields the width of `b`. Fails if `b` is zero. */
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<M> operator%(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b);
+
+/** \relates StaticUnsigned Equivalent to the remainder for unsigned values. Yields the width of `b`. Fails if `b` is zero. */
+template <std::size_t N, std::size_t M>
+constexpr StaticUnsigned<M> mod(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b);
+
+/** \relates StaticSigned Addition. Yields the width of the wider operand. */
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<detail::max_width(N, M)> operator+(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticSigned Inplace addition. Yields the width of `a`. */
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<N>& operator+=(StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticSigned Subtraction. Yields the width of the wider operand. */
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<detail::max_width(N, M)> operator-(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticSigned Inplace subtraction. Yields the width of `a`. */
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<N>& operator-=(StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticSigned Multiplication. Yields the sum of the widths, so the product never wraps. */
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<N + M> operator*(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticSigned Division, rounding towards zero. Yields the width of `a`; the most negative value divided by -1 wraps. Fails if `b` is zero. */
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<N> operator/(const StaticSigned<N>& a, const StaticSigned<M>& b);
+
+/** \relates StaticSigned Remainder of division, with the sign of `a` like numeric_std "rem". Yields the width of `b`. Fails if `b` is zero. */
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<M> operator%(const StaticSigned<N>& a, const StaticSigned<M>& b);
+
+/** \relates StaticSigned Modulus, with the sign of `b` like numeric_std "mod". Yields the width of `b`. Fails if `b` is zero. */
+template <std::size_t N, std::size_t M>
+constexpr StaticSigned<M> mod(const StaticSigned<N>& a, const StaticSigned<M>& b);
+
+/** \relates StaticSigned Negation. The most negative value wraps to itself. */
+template <std::size_t N>
+constexpr StaticSigned<N> operator-(const StaticSigned<N>& a) noexcept;
+
+/** \relates StaticSigned Absolute value. The most negative value wraps to itself. */
+template <std::size_t N>
+constexpr StaticSigned<N> abs(const StaticSigned<N>& a) noexcept;
+
+/** \relates StaticUnsigned Three-way comparison of the values. Operands of different widths are compared by value. */
+template <std::size_t N, std::size_t M>
+constexpr int compare(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticSigned Three-way comparison of the values. Operands of different widths are compared by value. */
+template <std::size_t N, std::size_t M>
+constexpr int compare(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Value equality; the widths may differ. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator==(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Value inequality. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator!=(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Less than. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator<(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Less than or equal. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator<=(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Greater than. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator>(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Greater than or equal. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator>=(const StaticUnsigned<N>& a, const StaticUnsigned<M>& b) noexcept;
+
+/** \relates StaticSigned Value equality; the widths may differ. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator==(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticSigned Value inequality. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator!=(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticSigned Less than. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator<(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticSigned Less than or equal. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator<=(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticSigned Greater than. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator>(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticSigned Greater than or equal. */
+template <std::size_t N, std::size_t M>
+constexpr bool operator>=(const StaticSigned<N>& a, const StaticSigned<M>& b) noexcept;
+
+/** \relates StaticUnsigned Bitwise "and". The widths are checked at compile time. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator&(const StaticUnsigned<N>& a, const StaticUnsigned<N>& b) noexcept;
+
+/** \relates StaticUnsigned Bitwise "or". The widths are checked at compile time. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator|(const StaticUnsigned<N>& a, const StaticUnsigned<N>& b) noexcept;
+
+/** \relates StaticUnsigned Bitwise "xor". The widths are checked at compile time. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator^(const StaticUnsigned<N>& a, const StaticUnsigned<N>& b) noexcept;
+
+/** \relates StaticUnsigned Bitwise inversion. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator~(const StaticUnsigned<N>& a) noexcept;
+
+/** \relates StaticSigned Bitwise "and". The widths are checked at compile time. */
+template <std::size_t N>
+constexpr StaticSigned<N> operator&(const StaticSigned<N>& a, const StaticSigned<N>& b) noexcept;
+
+/** \relates StaticSigned Bitwise "or". The widths are checked at compile time. */
+template <std::size_t N>
+constexpr StaticSigned<N> operator|(const StaticSigned<N>& a, const StaticSigned<N>& b) noexcept;
+
+/** \relates StaticSigned Bitwise "xor". The widths are checked at compile time. */
+template <std::size_t N>
+constexpr StaticSigned<N> operator^(const StaticSigned<N>& a, const StaticSigned<N>& b) noexcept;
+
+/** \relates StaticSigned Bitwise inversion. */
+template <std::size_t N>
+constexpr StaticSigned<N> operator~(const StaticSigned<N>& a) noexcept;
+
+/** \relates StaticUnsigned Logical shift towards the left, filling with `0`. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> shift_left(const StaticUnsigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticUnsigned Logical shift towards the right, filling with `0`. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> shift_right(const StaticUnsigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticUnsigned Rotation towards the left. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> rotate_left(const StaticUnsigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticUnsigned Rotation towards the right. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> rotate_right(const StaticUnsigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticSigned Shift towards the left, filling with `0`. */
+template <std::size_t N>
+constexpr StaticSigned<N> shift_left(const StaticSigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticSigned Arithmetic shift towards the right, filling with copies of the sign bit. */
+template <std::size_t N>
+constexpr StaticSigned<N> shift_right(const StaticSigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticSigned Rotation towards the left. */
+template <std::size_t N>
+constexpr StaticSigned<N> rotate_left(const StaticSigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticSigned Rotation towards the right. */
+template <std::size_t N>
+constexpr StaticSigned<N> rotate_right(const StaticSigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticUnsigned Same as shift_left. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator<<(const StaticUnsigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticUnsigned Same as shift_right. */
+template <std::size_t N>
+constexpr StaticUnsigned<N> operator>>(const StaticUnsigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticSigned Same as shift_left. */
+template <std::size_t N>
+constexpr StaticSigned<N> operator<<(const StaticSigned<N>& a, std::size_t n) noexcept;
+
+/** \relates StaticSigned Same as shift_right. */
+template <std::size_t N>
+constexpr StaticSigned<N> operator>>(const StaticSigned<N>& a, std::size_t n) noexcept;
+
+}
+
+#include "hdltypes/impl/static_numeric.hpp"
+
+#endif
@@ -0,0 +1,294 @@
+#ifndef HDLTYPES_STATIC_VECTOR_HPP
+#define HDLTYPES_STATIC_VECTOR_HPP
+
+#include "hdltypes/bit_vector.hpp"   // BitVector
+#include "hdltypes/bounds.hpp"       // Bounds, Direction
+#include "hdltypes/logic.hpp"        // Logic, Bit
+#include "hdltypes/logic_vector.hpp" // LogicVector
+#include "hdltypes/packed.hpp"       // LogicWord, word_type
+#include <cstddef>                   // size_t
+#include <string>                    // basic_string
+
+namespace hdltypes {
+
+/** The default Direction of compile-time bounds. Descending unless `left < right`. */
+constexpr Direction default_direction(Bounds::index_type left, Bounds::index_type right) noexcept;
+
+/** Array of Logic values with compile-time bounds
+
+    The compile-time bound version of LogicVector. The packed words are held inline,
+    so values of this type never allocate, and all operations are `constexpr`. The
+    lengths of operands of element-wise operations are checked at compile time.
+
+    The direction is inferred from the bounds, e.g. `StaticLogicVector<7, 0>` is
+    `7 downto 0` and `StaticLogicVector<0, 7>` is `0 to 7`.
+    */
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir = default_direction(Left, Right)>
+class StaticLogicVector {
+
+public: // types
+    /** Type of the elements. */
+    using value_type = Logic;
+
+    /** Type of index values. */
+    using index_type = Bounds::index_type;
+
+    /** Type of lengths and offsets. */
+    using size_type = Bounds::size_type;
+
+    /** Type of the words that hold the packed elements. */
+    using word_type = packed::word_type;
+
+public: // constructors
+    /** Default all elements to `U`. */
+    constexpr StaticLogicVector() noexcept;
+
+    /** Create a StaticLogicVector with all elements set to `init`. */
+    explicit constexpr StaticLogicVector(Logic init) noexcept;
+
+    /** Create a StaticLogicVector from a string literal of the same length. See to_logic for details. */
+    template <typename CharType, std::size_t N>
+    explicit constexpr StaticLogicVector(const CharType (&str)[N]);
+
+    /** Allows a LogicVector of the same length to be converted to a StaticLogicVector. */
+    explicit StaticLogicVector(const LogicVector& a);
+
+public: // attributes
+    /** The bounds of the array. */
+    static constexpr Bounds bounds() noexcept;
+
+    /** The number of elements. */
+    static constexpr size_type length() noexcept;
+
+    /** The number of words in each bit-plane. */
+    static constexpr size_type words() noexcept;
+
+public: // element access
+    /** Returns the element at the index. There is *no* bounds checking. */
+    constexpr Logic operator[](index_type index) const noexcept;
+
+    /** Returns the element at the index. Fails if the index is not in the bounds. */
+    constexpr Logic at(index_type index) const;
+
+    /** Sets the element at the index. Fails if the index is not in the bounds. */
+    constexpr void set(index_type index, Logic value);
+
+    /** Sets all elements to the given value. */
+    constexpr void fill(Logic value) noexcept;
+
+public: // packed access
+    /** Returns the `n`th word of packed elements. Elements are packed from the left. */
+    constexpr packed::LogicWord word(size_type n) const noexcept;
+
+    /** Sets the `n`th word of packed elements. Bits past the end of the array are ignored. */
+    constexpr void set_word(size_type n, const packed::LogicWord& w) noexcept;
+
+public: // LogicVector conversion
+    /** Allows a StaticLogicVector to be converted *implicitly* to a LogicVector. */
+    operator LogicVector() const;
+
+private: // members
+    static constexpr size_type storage_words = (packed::word_count(Bounds(Left, Dir, Right).length()) == 0) ? 1 : packed::word_count(Bounds(Left, Dir, Right).length());
+    word_type planes_[packed::logic_planes][storage_words] {};
+};
+
+/** Array of Bit values with compile-time bounds
+
+    The compile-time bound version of BitVector. The packed words are held inline,
+    so values of this type never allocate, and all operations are `constexpr`. The
+    lengths of operands of element-wise operations are checked at compile time.
+
+    Like Bit, a StaticBitVector can be used where a StaticLogicVector is expected.
+    */
+template <Bounds::index_type Left, Bounds::index_type Right, Direction Dir = default_direction(Left, Right)>
+class StaticBitVector {
+
+public: // types
+    /** Type of the elements. */
+    using value_type = Bit;
+
+    /** Type of index values. */
+    using index_type = Bounds::index_type;
+
+    /** Type of lengths and offsets. */
+    using size_type = Bounds::size_type;
+
+    /** Type of the words that hold the packed elements. */
+    using word_type = packed::word_type;
+
+public: // constructors
+    /** Default all elements to `0`. */
+    constexpr StaticBitVector() noexcept = default;
+
+    /** Create a StaticBitVector with all elements set to `init`. */
+    explicit constexpr StaticBitVector(Bit init) noexcept;
+
+    /** Create a StaticBitVector from a string literal of the same length. See to_bit for details. */
+    template <typename CharType, std::size_t N>
+    explicit constexpr StaticBitVector(const CharType (&str)[N]);
+
+    /** Allows a BitVector of the same length to be converted to a StaticBitVector. */
+    explicit StaticBitVector(const BitVector& a);
+
+public: // attributes
+    /** The bounds of the array. */
+    static constexpr Bounds bounds() noexcept;
+
+    /** The number of elements. */
+    static constexpr size_type length() noexcept;
+
+    /** The number of words. */
+    static constexpr size_type words() noexcept;
+
+public: // element access
+    /** Returns the element at the index. There is *no* bounds checking. */
+    constexpr Bit operator[](index_type index) const noexcept;
+
+    /** Returns the element at the index. Fails if the index is not in the bounds. */
+    constexpr Bit at(index_type index) const;
+
+    /** Sets the element at the index. Fails if the index is not in the bounds. */
+    constexpr void set(index_type index, Bit value);
+
+    /** Sets all elements to the given value. */
+    constexpr void fill(Bit value) noexcept;
+
+public: // packed access
+    /** Returns the `n`th word of packed elements. Elements are packed from the left. */
+    constexpr word_type word(size_type n) const noexcept;
+
+    /** Sets the `n`th word of packed elements. Bits past the end of the array are ignored. */
+    constexpr void set_word(size_type n, word_type w) noexcept;
+
+public: // conversions
+    /** Allows a StaticLogicVector to be converted to a StaticBitVector. Fails if any element is not `0` or `1`. */
+    explicit constexpr StaticBitVector(const StaticLogicVector<Left, Right, Dir>& a);
+
+    /** Allows a StaticBitVector to be converted *implicitly* to a StaticLogicVector. */
+    constexpr operator StaticLogicVector<Left, Right, Dir>() const noexcept;
+
+    /** Allows a StaticBitVector to be converted *implicitly* to a BitVector. */
+    operator BitVector() const;
+
+private: // members
+    static constexpr size_type storage_words = (packed::word_count(Bounds(Left, Dir, Right).length()) == 0) ? 1 : packed::word_count(Bounds(Left, Dir, Right).length());
+    word_type words_[storage_words] {};
+};
+
+/** \relates StaticLogicVector Converts a StaticLogicVector into a string, from left to right. */
+template <typename CharType = char, Bounds::index_type L, Bounds::index_type R, Direction D>
+std::basic_string<CharType> to_string(const StaticLogicVector<L, R, D>& a);
+
+/** \relates StaticLogicVector Value equality. Arrays of different lengths are never equal; bounds are not compared. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr bool operator==(const StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticLogicVector Value inequality. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr bool operator!=(const StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticLogicVector Element-wise logical "and" operation. Yields the bounds of the left operand. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1> operator&(const StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticLogicVector Inplace version of the element-wise logical "and" operation. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1>& operator&=(StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticLogicVector Element-wise logical "or" operation. Yields the bounds of the left operand. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1> operator|(const StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticLogicVector Inplace version of the element-wise logical "or" operation. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1>& operator|=(StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticLogicVector Element-wise logical "xor" operation. Yields the bounds of the left operand. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1> operator^(const StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticLogicVector Inplace version of the element-wise logical "xor" operation. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticLogicVector<L1, R1, D1>& operator^=(StaticLogicVector<L1, R1, D1>& a, const StaticLogicVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticLogicVector Element-wise logical inversion operation. */
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr StaticLogicVector<L, R, D> operator~(const StaticLogicVector<L, R, D>& a) noexcept;
+
+/** \relates StaticLogicVector Inplace version of the element-wise logical inversion operation. */
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr StaticLogicVector<L, R, D>& inplace_invert(StaticLogicVector<L, R, D>& a) noexcept;
+
+/** \relates StaticLogicVector Logical "and" of all elements, as if folded with the Logic operator. Returns `1` for a null array. */
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Logic and_reduce(const StaticLogicVector<L, R, D>& a) noexcept;
+
+/** \relates StaticLogicVector Logical "or" of all elements, as if folded with the Logic operator. Returns `0` for a null array. */
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Logic or_reduce(const StaticLogicVector<L, R, D>& a) noexcept;
+
+/** \relates StaticLogicVector Logical "xor" of all elements, as if folded with the Logic operator. Returns `0` for a null array. */
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Logic xor_reduce(const StaticLogicVector<L, R, D>& a) noexcept;
+
+/** \relates StaticBitVector Converts a StaticBitVector into a string, from left to right. */
+template <typename CharType = char, Bounds::index_type L, Bounds::index_type R, Direction D>
+std::basic_string<CharType> to_string(const StaticBitVector<L, R, D>& a);
+
+/** \relates StaticBitVector Value equality. Arrays of different lengths are never equal; bounds are not compared. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr bool operator==(const StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticBitVector Value inequality. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr bool operator!=(const StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticBitVector Element-wise logical "and" operation. Yields the bounds of the left operand. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1> operator&(const StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticBitVector Inplace version of the element-wise logical "and" operation. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1>& operator&=(StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticBitVector Element-wise logical "or" operation. Yields the bounds of the left operand. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1> operator|(const StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticBitVector Inplace version of the element-wise logical "or" operation. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1>& operator|=(StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticBitVector Element-wise logical "xor" operation. Yields the bounds of the left operand. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1> operator^(const StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticBitVector Inplace version of the element-wise logical "xor" operation. */
+template <Bounds::index_type L1, Bounds::index_type R1, Direction D1, Bounds::index_type L2, Bounds::index_type R2, Direction D2>
+constexpr StaticBitVector<L1, R1, D1>& operator^=(StaticBitVector<L1, R1, D1>& a, const StaticBitVector<L2, R2, D2>& b) noexcept;
+
+/** \relates StaticBitVector Element-wise logical inversion operation. */
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr StaticBitVector<L, R, D> operator~(const StaticBitVector<L, R, D>& a) noexcept;
+
+/** \relates StaticBitVector Inplace version of the element-wise logical inversion operation. */
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr StaticBitVector<L, R, D>& inplace_invert(StaticBitVector<L, R, D>& a) noexcept;
+
+/** \relates StaticBitVector Logical "and" of all elements. Returns `1` for a null array. */
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Bit and_reduce(const StaticBitVector<L, R, D>& a) noexcept;
+
+/** \relates StaticBitVector Logical "or" of all elements. Returns `0` for a null array. */
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Bit or_reduce(const StaticBitVector<L, R, D>& a) noexcept;
+
+/** \relates StaticBitVector Logical "xor" of all elements. Returns `0` for a null array. */
+template <Bounds::index_type L, Bounds::index_type R, Direction D>
+constexpr Bit xor_reduce(const StaticBitVector<L, R, D>& a) noexcept;
+
+}
+
+#include "hdltypes/impl/static_vector.hpp"
+
+#endif
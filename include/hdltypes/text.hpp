@@ -0,0 +1,172 @@
+#ifndef HDLTYPES_TEXT_HPP
+#define HDLTYPES_TEXT_HPP
+
+#include "hdltypes/bit_vector.hpp"   // BitVector
+#include "hdltypes/logic.hpp"        // Logic, Bit
+#include "hdltypes/logic_vector.hpp" // LogicVector
+#include "hdltypes/numeric.hpp"      // Unsigned, Signed
+#include "hdltypes/utils.hpp"        // is_char_type
+#include <cstddef>                   // size_t
+#include <system_error>              // errc
+#include <type_traits>               // enable_if
+
+namespace hdltypes {
+
+/** Number bases that vectors can be written in. The value is the number of elements per digit. */
+enum class Radix : unsigned {
+    binary = 1,
+    octal = 3,
+    hexadecimal = 4
+};
+
+/** \relates Logic Converts a string of characters into Logic values in bulk. See to_logic for the mapping.
+
+    Conversion stops at the first character that is not a Logic. Returns the position of
+    that character, or `length` if all characters were converted. Elements of `out` at
+    and after the returned position have unspecified values.
+
+    `char` strings are classified 16 or 32 characters at a time using SIMD byte shuffles
+    when the running CPU supports them.
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+std::size_t parse_logic(const CharType* str, std::size_t length, Logic* out) noexcept;
+
+/** \relates Bit Converts a string of characters into Bit values in bulk. See to_bit for the mapping.
+
+    Conversion stops at the first character that is not a Bit. Returns the position of
+    that character, or `length` if all characters were converted. Elements of `out` at
+    and after the returned position have unspecified values.
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+std::size_t parse_bit(const CharType* str, std::size_t length, Bit* out) noexcept;
+
+/** \relates LogicVector Converts a string of characters into the elements of a LogicVector, from left to right.
+
+    The length of `out` must be `length`. Returns the position of the first character
+    that is not a Logic, or `length` if all characters were converted. The value of `out`
+    is unspecified if not all characters were converted.
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+std::size_t parse_logic_vector(const CharType* str, std::size_t length, LogicVector& out) noexcept;
+
+/** \relates BitVector Converts a string of characters into the elements of a BitVector, from left to right.
+
+    The length of `out` must be `length`. Returns the position of the first character
+    that is not a Bit, or `length` if all characters were converted. The value of `out`
+    is unspecified if not all characters were converted.
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+std::size_t parse_bit_vector(const CharType* str, std::size_t length, BitVector& out) noexcept;
+
+/** Number of characters `to_chars` writes for a vector of `length` elements in the given radix. */
+constexpr std::size_t to_chars_length(std::size_t length, Radix radix = Radix::binary) noexcept;
+
+/** \relates Logic Writes the characters of `length` Logic values to `out`. See to_char for the mapping.
+
+    Returns the end of the characters written. No terminating null character is written.
+    `char` strings are produced 16 or 32 characters at a time using SIMD byte shuffles
+    when the running CPU supports them.
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+CharType* to_chars(CharType* out, const Logic* values, std::size_t length) noexcept;
+
+/** \relates Bit Writes the characters of `length` Bit values to `out`. See to_char for the mapping.
+
+    Returns the end of the characters written. No terminating null character is written.
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+CharType* to_chars(CharType* out, const Bit* values, std::size_t length) noexcept;
+
+/** \relates LogicVector Writes the elements of a LogicVector to `out`, from left to right.
+
+    `out` must have room for `to_chars_length(a.length(), radix)` characters. Returns the
+    end of the characters written. No terminating null character is written.
+
+    Octal and hexadecimal digits follow VHDL's `to_ostring` and `to_hstring`. The elements
+    are padded on the left to a whole number of digits, with `Z` if the leftmost element is
+    `Z` and with `0` otherwise. Each digit's elements are mapped to `X`, `0`, `1`, or `Z`
+    as by `To_X01Z`; a digit of all `Z` is written `Z`, a digit with any other non-`0`/`1`
+    element is written `X`, and other digits as uppercase hexadecimal.
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+CharType* to_chars(CharType* out, const LogicVector& a, Radix radix = Radix::binary) noexcept;
+
+/** \relates BitVector Writes the elements of a BitVector to `out`, from left to right.
+
+    `out` must have room for `to_chars_length(a.length(), radix)` characters. Returns the
+    end of the characters written. No terminating null character is written. Octal and
+    hexadecimal digits are padded on the left with `0`.
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+CharType* to_chars(CharType* out, const BitVector& a, Radix radix = Radix::binary) noexcept;
+
+/** Result of writing an Unsigned or Signed with `to_chars`, like `std::to_chars_result`.
+
+    On success `ptr` is the end of the characters written and `ec` is `std::errc()`.
+    */
+template <typename CharType>
+struct ToCharsResult {
+    CharType* ptr;
+    std::errc ec;
+};
+
+/** Result of reading an Unsigned or Signed with `from_chars`, like `std::from_chars_result`.
+
+    `ptr` is the first character not read and `ec` is `std::errc()` on success.
+    */
+template <typename CharType>
+struct FromCharsResult {
+    const CharType* ptr;
+    std::errc ec;
+};
+
+/** Upper bound on the number of characters `to_chars` writes for an Unsigned or Signed of `width` bits in `base`, including a sign. 0 for unsupported bases. */
+constexpr std::size_t to_chars_max_length(std::size_t width, int base = 10) noexcept;
+
+/** \relates Unsigned Writes the value of an Unsigned to [first, last) in base 2, 8, 10, or 16.
+
+    Digits are written most significant first without leading zeros, with uppercase
+    hexadecimal letters, and without a prefix or terminating null character. Never throws:
+    if the digits do not fit, returns `{last, std::errc::value_too_large}` and the contents
+    of the range are unspecified; an unsupported base gives `std::errc::invalid_argument`
+    and a failed allocation `std::errc::not_enough_memory`.
+
+    Hexadecimal digits of `char` strings are produced 16 or 32 at a time using SIMD byte
+    shuffles when the running CPU supports them. Decimal digits are produced by splitting
+    the value in halves around powers of 10, which is subquadratic in the width.
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+ToCharsResult<CharType> to_chars(CharType* first, CharType* last, const Unsigned& a, int base = 10) noexcept;
+
+/** \relates Signed Writes the value of a Signed to [first, last), with a leading `-` if it is negative.
+
+    See to_chars(CharType*, CharType*, const Unsigned&, int).
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+ToCharsResult<CharType> to_chars(CharType* first, CharType* last, const Signed& a, int base = 10) noexcept;
+
+/** \relates Unsigned Reads the value of an Unsigned from the leading digits of [first, last) in base 2, 8, 10, or 16.
+
+    Accepts the same digits `to_chars` writes, hexadecimal letters in either case, and no
+    sign, prefix, or whitespace. The width of `value` is kept. Never throws: on success
+    `value` is assigned and `ptr` is the first character that is not a digit. Otherwise
+    `value` is unchanged and `ec` is `std::errc::invalid_argument` with `ptr == first` if
+    there are no digits or the base is unsupported, `std::errc::result_out_of_range` with
+    `ptr` past the digits if the value does not fit in the width of `value`, or
+    `std::errc::not_enough_memory` if an allocation failed.
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+FromCharsResult<CharType> from_chars(const CharType* first, const CharType* last, Unsigned& value, int base = 10) noexcept;
+
+/** \relates Signed Reads the value of a Signed from the leading characters of [first, last), an optional `-` followed by digits.
+
+    See from_chars(const CharType*, const CharType*, Unsigned&, int).
+    */
+template <typename CharType, typename std::enable_if<is_char_type<CharType>::value, int>::type = 0>
+FromCharsResult<CharType> from_chars(const CharType* first, const CharType* last, Signed& value, int base = 10) noexcept;
+
+}
+
+#include "hdltypes/impl/text.hpp"
+
+#endif
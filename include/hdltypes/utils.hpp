@@ -1,8 +1,23 @@
 #ifndef HDLTYPES_UTIL_HPP
 #define HDLTYPES_UTIL_HPP
 
+#include <cstdlib>     // abort
 #include <type_traits> // false_type, true_type, remove_cv
 
+/**
+ * Throws the given exception, or aborts if exceptions are disabled (e.g. `-fno-exceptions`).
+ * HDLTYPES_TRY and HDLTYPES_CATCH stand for `try` and `catch`; without exceptions the handler is never run.
+ */
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define HDLTYPES_THROW(exception) throw exception
+#define HDLTYPES_TRY try
+#define HDLTYPES_CATCH(exception) catch (exception)
+#else
+#define HDLTYPES_THROW(exception) std::abort()
+#define HDLTYPES_TRY if (true)
+#define HDLTYPES_CATCH(exception) else if (false)
+#endif
+
 namespace hdltypes {
 namespace util {
 
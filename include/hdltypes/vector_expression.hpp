@@ -0,0 +1,354 @@
+#ifndef HDLTYPES_VECTOR_EXPRESSION_HPP
+#define HDLTYPES_VECTOR_EXPRESSION_HPP
+
+#include "hdltypes/bit_vector.hpp"   // BitVector
+#include "hdltypes/bounds.hpp"       // Bounds
+#include "hdltypes/logic.hpp"        // Logic, Bit
+#include "hdltypes/logic_vector.hpp" // LogicVector
+#include "hdltypes/packed.hpp"       // LogicWord, word_type
+#include "hdltypes/vector_view.hpp"  // BasicVectorView
+#include <type_traits>               // enable_if, conditional, decay
+
+namespace hdltypes {
+
+template <typename Operation, typename A, typename B>
+class LogicVectorExpression;
+
+template <typename Operation, typename A, typename B>
+class BitVectorExpression;
+
+namespace detail {
+
+/** Element-wise operations on the words of expressions; each works on both packed::LogicWord and plain words. */
+struct AndWords;
+struct OrWords;
+struct XorWords;
+struct InvertWords;
+
+/** The second operand of unary operations. */
+struct NoOperand {
+};
+
+/** A Logic operand, broadcast to every element. */
+struct LogicScalar {
+    LogicScalar(Logic a) noexcept;
+    packed::LogicWord word;
+};
+
+/** A Bit operand, broadcast to every element. */
+struct BitScalar {
+    BitScalar(Bit a) noexcept;
+    packed::word_type word;
+};
+
+/** Whether an operand is an array or an expression, rather than a scalar. */
+template <typename T>
+struct is_vector_operand : std::false_type {
+};
+
+/** Whether an operand has Logic elements. */
+template <typename T>
+struct is_logic_operand : std::false_type {
+};
+
+/** Whether an operand has Bit elements. */
+template <typename T>
+struct is_bit_operand : std::false_type {
+};
+
+template <>
+struct is_vector_operand<LogicVector> : std::true_type {
+};
+
+template <>
+struct is_vector_operand<BitVector> : std::true_type {
+};
+
+template <typename Vector>
+struct is_vector_operand<BasicVectorView<Vector>> : std::true_type {
+};
+
+template <typename Operation, typename A, typename B>
+struct is_vector_operand<LogicVectorExpression<Operation, A, B>> : std::true_type {
+};
+
+template <typename Operation, typename A, typename B>
+struct is_vector_operand<BitVectorExpression<Operation, A, B>> : std::true_type {
+};
+
+template <>
+struct is_logic_operand<LogicVector> : std::true_type {
+};
+
+template <>
+struct is_logic_operand<Logic> : std::true_type {
+};
+
+template <>
+struct is_logic_operand<LogicVectorView> : std::true_type {
+};
+
+template <>
+struct is_logic_operand<ConstLogicVectorView> : std::true_type {
+};
+
+template <typename Operation, typename A, typename B>
+struct is_logic_operand<LogicVectorExpression<Operation, A, B>> : std::true_type {
+};
+
+template <>
+struct is_bit_operand<BitVector> : std::true_type {
+};
+
+template <>
+struct is_bit_operand<Bit> : std::true_type {
+};
+
+template <>
+struct is_bit_operand<BitVectorView> : std::true_type {
+};
+
+template <>
+struct is_bit_operand<ConstBitVectorView> : std::true_type {
+};
+
+template <typename Operation, typename A, typename B>
+struct is_bit_operand<BitVectorExpression<Operation, A, B>> : std::true_type {
+};
+
+/** The missing operand of a unary operation on an array of Bit is also of Bit elements. */
+template <>
+struct is_bit_operand<NoOperand> : std::true_type {
+};
+
+/** Whether the operands yield a LogicVectorExpression: at least one is an array, and at least one has Logic elements. */
+template <typename A, typename B, typename DA = typename std::decay<A>::type, typename DB = typename std::decay<B>::type>
+struct is_logic_operation : std::integral_constant<bool,
+                                (is_vector_operand<DA>::value || is_vector_operand<DB>::value)
+                                    && (is_logic_operand<DA>::value || is_bit_operand<DA>::value)
+                                    && (is_logic_operand<DB>::value || is_bit_operand<DB>::value)
+                                    && (is_logic_operand<DA>::value || is_logic_operand<DB>::value)> {
+};
+
+/** Whether the operands yield a BitVectorExpression: at least one is an array, and both have Bit elements. */
+template <typename A, typename B, typename DA = typename std::decay<A>::type, typename DB = typename std::decay<B>::type>
+struct is_bit_operation : std::integral_constant<bool,
+                              (is_vector_operand<DA>::value || is_vector_operand<DB>::value)
+                                  && is_bit_operand<DA>::value && is_bit_operand<DB>::value> {
+};
+
+/** How an operand is held by an expression.
+
+    Arrays that are lvalues are held by reference; temporary arrays are moved into the
+    expression, so an expression of temporaries can outlive the statement. Scalars are
+    held broadcast to a whole word, and expressions are held by value.
+    */
+template <typename T, typename D = typename std::decay<T>::type>
+using operand_t = typename std::conditional<
+    std::is_same<D, LogicVector>::value || std::is_same<D, BitVector>::value,
+    typename std::conditional<std::is_lvalue_reference<T>::value, const D&, D>::type,
+    typename std::conditional<
+        std::is_same<D, Logic>::value, LogicScalar,
+        typename std::conditional<std::is_same<D, Bit>::value, BitScalar, D>::type>::type>::type;
+
+}
+
+/** Element-wise operation on arrays of Logic, evaluated when assigned
+
+    The element-wise operators on LogicVector, BitVector, and Logic and Bit values
+    broadcast to every element yield expressions rather than arrays. Expressions are
+    evaluated one word of 64 elements at a time when converted to or assigned to a
+    LogicVector, so a chain of operations like `(a & ~sel) | (b & sel)` makes one pass
+    over its operands and creates no temporary arrays. If every operand holds only `0`
+    and `1` (see LogicVector::is01), only the value planes are computed, with the
+    kernels of BitVector for a single operation.
+
+    An expression holds the arrays it is built from by reference, unless they are
+    temporaries; it must be evaluated before those arrays are changed or destroyed.
+    The bounds of an expression are those of its leftmost array operand.
+    */
+template <typename Operation, typename A, typename B>
+class LogicVectorExpression {
+
+public: // types
+    /** Type of the elements. */
+    using value_type = Logic;
+
+    /** Type of lengths and offsets. */
+    using size_type = Bounds::size_type;
+
+public: // constructors
+    /** Create an expression of the operands. Fails if array operands have different lengths. */
+    LogicVectorExpression(A a, B b);
+
+public: // attributes
+    /** The bounds of the result. */
+    Bounds bounds() const noexcept;
+
+    /** The number of elements. */
+    size_type length() const noexcept;
+
+    /** Whether all operands hold only `0` and `1`, so all elements of the result are `0` or `1`. */
+    bool is01() const noexcept;
+
+    /** Whether an operand reads elements of `array` other than those at `start`, `start + step`, and so on, so the expression can not be evaluated word by word into them. */
+    bool aliases(const void* array, Bounds::index_type start, Bounds::index_type step) const noexcept;
+
+public: // packed access
+    /** The number of words in each bit-plane. */
+    size_type words() const noexcept;
+
+    /** Computes the `n`th word of packed elements. Bits past the end of the array are unspecified. */
+    packed::LogicWord word(size_type n) const noexcept;
+
+    /** Computes the value plane of the `n`th word, which is the whole value if is01(). */
+    packed::word_type value_word(size_type n) const noexcept;
+
+    /** Computes the value planes of all words into `r`, with the kernels of BitVector where possible. Only valid if is01(). */
+    void evaluate_values(packed::word_type* r) const noexcept;
+
+private: // members
+    A a_;
+    B b_;
+    Bounds bounds_;
+};
+
+/** Element-wise operation on arrays of Bit, evaluated when assigned
+
+    Like LogicVectorExpression, for operations whose operands are all BitVectors or
+    Bit values. A single operation on BitVectors is evaluated with the SIMD kernels
+    selected for the running CPU.
+
+    An expression can be evaluated into a BitVector; to get a LogicVector, convert the
+    BitVector.
+    */
+template <typename Operation, typename A, typename B>
+class BitVectorExpression {
+
+public: // types
+    /** Type of the elements. */
+    using value_type = Bit;
+
+    /** Type of lengths and offsets. */
+    using size_type = Bounds::size_type;
+
+public: // constructors
+    /** Create an expression of the operands. Fails if array operands have different lengths. */
+    BitVectorExpression(A a, B b);
+
+public: // attributes
+    /** The bounds of the result. */
+    Bounds bounds() const noexcept;
+
+    /** The number of elements. */
+    size_type length() const noexcept;
+
+    /** Whether an operand reads elements of `array` other than those at `start`, `start + step`, and so on, so the expression can not be evaluated word by word into them. */
+    bool aliases(const void* array, Bounds::index_type start, Bounds::index_type step) const noexcept;
+
+public: // packed access
+    /** The number of words. */
+    size_type words() const noexcept;
+
+    /** Computes the `n`th word of packed elements. Bits past the end of the array are unspecified. */
+    packed::word_type word(size_type n) const noexcept;
+
+    /** Computes all words into `r`, which may be the words of an array operand. Bits past the end of the array are unspecified. */
+    void evaluate(packed::word_type* r) const noexcept;
+
+private: // members
+    A a_;
+    B b_;
+    Bounds bounds_;
+};
+
+/** \relates LogicVectorExpression Element-wise logical "and" operation. Fails if the lengths of array operands differ.
+
+    Operands are LogicVectors, BitVectors, views of them, expressions of them, or Logic or Bit values
+    broadcast to every element; at least one operand must be an array, and at least one
+    must have Logic elements.
+    */
+template <typename A, typename B, typename std::enable_if<detail::is_logic_operation<A, B>::value, int>::type = 0>
+LogicVectorExpression<detail::AndWords, detail::operand_t<A>, detail::operand_t<B>> operator&(A&& a, B&& b);
+
+/** \relates LogicVectorExpression Element-wise logical "or" operation. Fails if the lengths of array operands differ. */
+template <typename A, typename B, typename std::enable_if<detail::is_logic_operation<A, B>::value, int>::type = 0>
+LogicVectorExpression<detail::OrWords, detail::operand_t<A>, detail::operand_t<B>> operator|(A&& a, B&& b);
+
+/** \relates LogicVectorExpression Element-wise logical "xor" operation. Fails if the lengths of array operands differ. */
+template <typename A, typename B, typename std::enable_if<detail::is_logic_operation<A, B>::value, int>::type = 0>
+LogicVectorExpression<detail::XorWords, detail::operand_t<A>, detail::operand_t<B>> operator^(A&& a, B&& b);
+
+/** \relates LogicVectorExpression Element-wise logical inversion operation. */
+template <typename A, typename std::enable_if<detail::is_logic_operation<A, detail::NoOperand>::value, int>::type = 0>
+LogicVectorExpression<detail::InvertWords, detail::operand_t<A>, detail::NoOperand> operator~(A&& a);
+
+/** \relates BitVectorExpression Element-wise logical "and" operation of BitVectors, expressions of them, or Bit values. Fails if the lengths of array operands differ. */
+template <typename A, typename B, typename std::enable_if<detail::is_bit_operation<A, B>::value, int>::type = 0>
+BitVectorExpression<detail::AndWords, detail::operand_t<A>, detail::operand_t<B>> operator&(A&& a, B&& b);
+
+/** \relates BitVectorExpression Element-wise logical "or" operation. Fails if the lengths of array operands differ. */
+template <typename A, typename B, typename std::enable_if<detail::is_bit_operation<A, B>::value, int>::type = 0>
+BitVectorExpression<detail::OrWords, detail::operand_t<A>, detail::operand_t<B>> operator|(A&& a, B&& b);
+
+/** \relates BitVectorExpression Element-wise logical "xor" operation. Fails if the lengths of array operands differ. */
+template <typename A, typename B, typename std::enable_if<detail::is_bit_operation<A, B>::value, int>::type = 0>
+BitVectorExpression<detail::XorWords, detail::operand_t<A>, detail::operand_t<B>> operator^(A&& a, B&& b);
+
+/** \relates BitVectorExpression Element-wise logical inversion operation. */
+template <typename A, typename std::enable_if<detail::is_bit_operation<A, detail::NoOperand>::value, int>::type = 0>
+BitVectorExpression<detail::InvertWords, detail::operand_t<A>, detail::NoOperand> operator~(A&& a);
+
+/** \relates LogicVector Inplace version of the element-wise logical "and" operation, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVector&, B>::value, int>::type = 0>
+LogicVector& operator&=(LogicVector& a, B&& b);
+
+/** \relates LogicVector Inplace version of the element-wise logical "or" operation, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVector&, B>::value, int>::type = 0>
+LogicVector& operator|=(LogicVector& a, B&& b);
+
+/** \relates LogicVector Inplace version of the element-wise logical "xor" operation, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVector&, B>::value, int>::type = 0>
+LogicVector& operator^=(LogicVector& a, B&& b);
+
+/** \relates BitVector Inplace version of the element-wise logical "and" operation, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVector&, B>::value, int>::type = 0>
+BitVector& operator&=(BitVector& a, B&& b);
+
+/** \relates BitVector Inplace version of the element-wise logical "or" operation, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVector&, B>::value, int>::type = 0>
+BitVector& operator|=(BitVector& a, B&& b);
+
+/** \relates BitVector Inplace version of the element-wise logical "xor" operation, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVector&, B>::value, int>::type = 0>
+BitVector& operator^=(BitVector& a, B&& b);
+
+/** \relates BasicVectorView Inplace version of the element-wise logical "and" operation on the viewed elements, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVectorView&, B>::value, int>::type = 0>
+LogicVectorView operator&=(LogicVectorView a, B&& b);
+
+/** \relates BasicVectorView Inplace version of the element-wise logical "or" operation on the viewed elements, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVectorView&, B>::value, int>::type = 0>
+LogicVectorView operator|=(LogicVectorView a, B&& b);
+
+/** \relates BasicVectorView Inplace version of the element-wise logical "xor" operation on the viewed elements, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_logic_operation<LogicVectorView&, B>::value, int>::type = 0>
+LogicVectorView operator^=(LogicVectorView a, B&& b);
+
+/** \relates BasicVectorView Inplace version of the element-wise logical "and" operation on the viewed elements, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVectorView&, B>::value, int>::type = 0>
+BitVectorView operator&=(BitVectorView a, B&& b);
+
+/** \relates BasicVectorView Inplace version of the element-wise logical "or" operation on the viewed elements, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVectorView&, B>::value, int>::type = 0>
+BitVectorView operator|=(BitVectorView a, B&& b);
+
+/** \relates BasicVectorView Inplace version of the element-wise logical "xor" operation on the viewed elements, evaluated in one pass. */
+template <typename B, typename std::enable_if<detail::is_bit_operation<BitVectorView&, B>::value, int>::type = 0>
+BitVectorView operator^=(BitVectorView a, B&& b);
+
+}
+
+#include "hdltypes/impl/vector_expression.hpp"
+
+#endif
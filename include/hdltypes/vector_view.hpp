@@ -0,0 +1,232 @@
+#ifndef HDLTYPES_VECTOR_VIEW_HPP
+#define HDLTYPES_VECTOR_VIEW_HPP
+
+#include "hdltypes/bit_vector.hpp"   // BitVector
+#include "hdltypes/bounds.hpp"       // Bounds, Direction
+#include "hdltypes/logic.hpp"        // Logic, Bit
+#include "hdltypes/logic_vector.hpp" // LogicVector
+#include "hdltypes/packed.hpp"       // LogicWord, word_type
+#include <cstddef>                   // size_t, ptrdiff_t
+#include <string>                    // basic_string
+#include <type_traits>               // enable_if, is_same, remove_const, true_type, false_type
+
+namespace hdltypes {
+
+namespace detail {
+
+/** How a view reads and writes the packed words of the arrays of a type. */
+template <typename Vector>
+struct view_traits;
+
+/** Whether a source reads elements of `array` other than those at `start`, `start + step`, and so on. Arrays read all of their elements in order. */
+bool aliases(const LogicVector& a, const void* array, std::ptrdiff_t start, std::ptrdiff_t step) noexcept;
+
+/** Whether a source reads elements of `array` other than those at `start`, `start + step`, and so on. Arrays read all of their elements in order. */
+bool aliases(const BitVector& a, const void* array, std::ptrdiff_t start, std::ptrdiff_t step) noexcept;
+
+/** Whether a view or expression reads elements of `array` other than those at `start`, `start + step`, and so on. */
+template <typename Source>
+bool aliases(const Source& a, const void* array, std::ptrdiff_t start, std::ptrdiff_t step) noexcept;
+
+}
+
+/** Non-owning view of the elements of a LogicVector or BitVector
+
+    A view is a pointer to an array plus bounds: the view's own bounds, the position of
+    its leftmost element in the array, and the step between elements. Slicing, changing
+    the direction of the bounds, reversing, and taking every `n`th element yield another
+    view in constant time, without copying elements. Like VHDL, a slice must have the
+    direction of the view it is taken from.
+
+    Views of the elements of a `Vector` that are `const` are read-only (see
+    ConstLogicVectorView and ConstBitVectorView); other views also write the elements,
+    and assigning an array, view, or element-wise expression to them copies elements
+    rather than rebinding the view. Read-only views rebind on assignment.
+
+    Views are operands of the element-wise operators, and are read and written one word
+    of 64 elements at a time. Views of consecutive elements that start on a word boundary
+    of their array (see aligned()) access the words of the array directly; other views
+    of consecutive elements shift two words, and reversed or strided views gather and
+    scatter single elements.
+
+    A view must not be used after its array is destroyed or moved.
+    */
+template <typename Vector>
+class BasicVectorView {
+
+    using traits = detail::view_traits<typename std::remove_const<Vector>::type>;
+
+public: // types
+    /** Type of the elements. */
+    using value_type = typename traits::value_type;
+
+    /** Type of index values. */
+    using index_type = Bounds::index_type;
+
+    /** Type of lengths and offsets. */
+    using size_type = Bounds::size_type;
+
+    /** Type of a word of packed elements. */
+    using word_type = typename traits::word_type;
+
+public: // constructors
+    /** Default to a null view of no array. */
+    BasicVectorView() = default;
+
+    /** Allows an array to be converted *implicitly* to a view of all of its elements, with the same bounds. */
+    BasicVectorView(Vector& a) noexcept;
+
+    /** Allows a view that writes elements to be converted *implicitly* to a read-only view. */
+    template <typename Other, typename std::enable_if<std::is_same<const Other, Vector>::value && !std::is_same<Other, Vector>::value, int>::type = 0>
+    BasicVectorView(const BasicVectorView<Other>& a) noexcept;
+
+    BasicVectorView(const BasicVectorView& a) = default;
+
+    /** Copies the elements of `a` into the viewed elements, or rebinds a read-only view. Fails if the lengths differ. */
+    BasicVectorView& operator=(const BasicVectorView& a);
+
+    /** Copies the elements of an array, view, or element-wise expression into the viewed elements. Fails if the lengths differ.
+
+        The source may refer to any elements of the same array. If it reads them at other
+        positions, like a reversed or shifted view of the array, it is evaluated into a
+        temporary before any element is written.
+        */
+    template <typename Source>
+    BasicVectorView& operator=(const Source& a);
+
+public: // attributes
+    /** The bounds of the view. */
+    Bounds bounds() const noexcept;
+
+    /** The leftmost index. */
+    index_type left() const noexcept;
+
+    /** The rightmost index. */
+    index_type right() const noexcept;
+
+    /** The direction of the bounds. */
+    Direction direction() const noexcept;
+
+    /** The lowest index. */
+    index_type low() const noexcept;
+
+    /** The highest index. */
+    index_type high() const noexcept;
+
+    /** The number of elements. */
+    size_type length() const noexcept;
+
+    /** Whether all elements are `0` or `1`. */
+    bool is01() const noexcept;
+
+    /** Whether the view is of consecutive elements starting on a word boundary of its array, so words are accessed directly. */
+    bool aligned() const noexcept;
+
+    /** Whether the view reads elements of `array` other than those at `start`, `start + step`, and so on, in that order, so it can not be copied word by word into them. */
+    bool aliases(const void* array, index_type start, index_type step) const noexcept;
+
+public: // element access
+    /** Returns the element at the index. There is *no* bounds checking. */
+    value_type operator[](index_type index) const noexcept;
+
+    /** Returns the element at the index. Fails if the index is not in the bounds. */
+    value_type at(index_type index) const;
+
+    /** Sets the element at the index. Fails if the index is not in the bounds. */
+    void set(index_type index, value_type value) const;
+
+    /** Sets all elements to the given value. */
+    void fill(value_type value) const noexcept;
+
+public: // packed access
+    /** The number of words of packed elements. */
+    size_type words() const noexcept;
+
+    /** Returns the `n`th word of packed elements, from the left. Bits past the end of the view are `0`. */
+    word_type word(size_type n) const noexcept;
+
+    /** Sets the `n`th word of packed elements. Bits past the end of the view are ignored. */
+    void set_word(size_type n, const word_type& w) const noexcept;
+
+public: // views
+    /** View of the elements in the given bounds, like a VHDL slice. Fails if the direction differs, or the bounds are not null and not in the bounds of the view. */
+    BasicVectorView slice(Bounds bounds) const;
+
+    /** View of the same elements with the given bounds, from left to right, like a VHDL alias. Fails if the lengths differ. */
+    BasicVectorView alias(Bounds bounds) const;
+
+    /** View with the opposite direction in which every index refers to the same element, so the elements are in reverse order. */
+    BasicVectorView reversed() const noexcept;
+
+    /** View of every `step`th element from the left, with the same left index and direction. Fails if `step` is `0`. */
+    BasicVectorView stride(size_type step) const;
+
+private: // helpers
+    template <typename Other>
+    friend class BasicVectorView;
+
+    BasicVectorView(Vector* vector, Bounds bounds, index_type start, index_type step) noexcept;
+
+    /** Position in the array of the element at the offset from the left of the view. */
+    index_type position(size_type offset) const noexcept;
+
+    /** Rebinds a read-only view. */
+    void copy(const BasicVectorView& a, std::true_type) noexcept;
+
+    /** Copies the elements of a view that writes elements. */
+    void copy(const BasicVectorView& a, std::false_type);
+
+    /** Copies the elements of an array, view, or expression. */
+    template <typename Source>
+    void assign(const Source& a);
+
+private: // members
+    Vector* vector_ { nullptr };
+    Bounds bounds_ {};
+    index_type start_ { 0 };
+    index_type step_ { 1 };
+};
+
+/** View that reads and writes the elements of a LogicVector. */
+using LogicVectorView = BasicVectorView<LogicVector>;
+
+/** Read-only view of the elements of a LogicVector. */
+using ConstLogicVectorView = BasicVectorView<const LogicVector>;
+
+/** View that reads and writes the elements of a BitVector. */
+using BitVectorView = BasicVectorView<BitVector>;
+
+/** Read-only view of the elements of a BitVector. */
+using ConstBitVectorView = BasicVectorView<const BitVector>;
+
+/** \relates BasicVectorView Copies the elements of a view into a LogicVector with the bounds of the view. */
+LogicVector to_logic_vector(const ConstLogicVectorView& a);
+
+/** \relates BasicVectorView Copies the elements of a view into a BitVector with the bounds of the view. */
+BitVector to_bit_vector(const ConstBitVectorView& a);
+
+/** \relates BasicVectorView Converts the elements of a view into a string, from left to right. */
+template <typename CharType = char>
+std::basic_string<CharType> to_string(const ConstLogicVectorView& a);
+
+/** \relates BasicVectorView Converts the elements of a view into a string, from left to right. */
+template <typename CharType = char>
+std::basic_string<CharType> to_string(const ConstBitVectorView& a);
+
+/** \relates BasicVectorView Value equality. Views of different lengths are never equal; bounds are not compared. */
+bool operator==(const ConstLogicVectorView& a, const ConstLogicVectorView& b) noexcept;
+
+/** \relates BasicVectorView Value inequality. */
+bool operator!=(const ConstLogicVectorView& a, const ConstLogicVectorView& b) noexcept;
+
+/** \relates BasicVectorView Value equality. Views of different lengths are never equal; bounds are not compared. */
+bool operator==(const ConstBitVectorView& a, const ConstBitVectorView& b) noexcept;
+
+/** \relates BasicVectorView Value inequality. */
+bool operator!=(const ConstBitVectorView& a, const ConstBitVectorView& b) noexcept;
+
+}
+
+#include "hdltypes/impl/vector_view.hpp"
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef HDLTYPES_WAVE_HPP
+#define HDLTYPES_WAVE_HPP
+
+#include "hdltypes/bit_vector.hpp"   // BitVector
+#include "hdltypes/bounds.hpp"       // Bounds
+#include "hdltypes/logic.hpp"        // Logic, Bit
+#include "hdltypes/logic_vector.hpp" // LogicVector
+#include "hdltypes/packed.hpp"       // word_type
+#include <condition_variable>        // condition_variable
+#include <cstddef>                   // size_t
+#include <cstdint>                   // uint64_t
+#include <cstdio>                    // FILE
+#include <deque>                     // deque
+#include <exception>                 // exception_ptr
+#include <functional>                // function
+#include <mutex>                     // mutex
+#include <string>                    // string
+#include <thread>                    // thread
+#include <vector>                    // vector
+
+namespace hdltypes {
+
+/** Formats of the waveforms written by a WaveWriter. */
+enum class WaveFormat {
+    /** Value Change Dump text (IEEE 1364), readable by GTKWave and most waveform viewers. */
+    vcd,
+
+    /** Compact binary format: the times are deltas and the values are packed bits; see WaveWriter. */
+    delta
+};
+
+/** Options of a WaveWriter. */
+struct WaveOptions {
+    /** Format of the output. */
+    WaveFormat format { WaveFormat::vcd };
+
+    /** Time unit, written in the VCD `$timescale` section. */
+    std::string timescale { "1 ns" };
+
+    /** Write VCD values as `0`, `1`, `x`, and `z` only: `L` and `H` as `0` and `1`, `U`, `W`, and `-` as `x`. */
+    bool four_state { false };
+
+    /** Encode and write the output on a background thread. */
+    bool background { false };
+
+    /** Bytes of changes collected before they are encoded, and of output collected before it is written. */
+    std::size_t buffer_size { std::size_t(1) << 20 };
+};
+
+/** Destination of a waveform, called with each batch of encoded output. */
+using WaveSink = std::function<void(const char* data, std::size_t size)>;
+
+/** \relates WaveWriter A sink that writes to a C stream, failing with `std::runtime_error` if writing fails. The stream is not closed. */
+WaveSink file_sink(std::FILE* file);
+
+/** Streaming writer of the changes of Logic, Bit, LogicVector, and BitVector signals
+
+    Signals are declared first, then the simulation advances time() and reports the
+    values of signals with change(). Only values that differ from the last one written
+    for the signal are recorded, with a comparison of the packed words; the first value
+    of each signal is always recorded. Recorded changes are copied into a buffer and
+    encoded a buffer at a time, and the encoded output reaches the sink in batches of
+    about WaveOptions::buffer_size bytes, with vectors converted to text by the same
+    kernels as to_chars(). With WaveOptions::background the encoding and writing are
+    done on a thread of the writer, overlapping the simulation; the simulation waits
+    only if it records changes faster than they can be written.
+
+    Dots in the names of signals separate scopes: `top.cpu.clk` is `clk` in the scope
+    `cpu` of the scope `top`. Signals of a scope should be declared together.
+
+    ~~~{.cpp}
+    std::FILE* file = std::fopen("trace.vcd", "wb");
+    WaveWriter wave(file_sink(file));
+    const auto clk = wave.add_logic("top.clk");
+    const auto data = wave.add_logic("top.data", downto(31, 0));
+    for (std::uint64_t t = 0; t < end; t += 5) {
+        step();
+        wave.time(t);
+        wave.change(clk, clk_value);
+        wave.change(data, data_value); // nothing is recorded if the value is unchanged
+    }
+    wave.flush();
+    std::fclose(file);
+    ~~~
+
+    The `delta` format holds the same information in fewer bytes, and is converted to
+    VCD by delta_to_vcd(). Integers are unsigned LEB128 varints, and signed ones are
+    zigzag encoded. The header is the 8 bytes `HDLWAVE1`, the timescale (a varint length
+    and the characters), the number of signals, and for each signal a byte of flags
+    (bit 0 set for Bit values, bit 1 for vectors, bit 2 for descending bounds), its
+    name, and for vectors the left and right bounds. Each record is then either `0` and
+    the time since the last time record, or the signal number plus 1 and its value: a
+    byte holding the Logic::value_type of a scalar; for a BitVector the elements from
+    the left, 8 to a byte from bit 0; and for a LogicVector a byte that is `0` if every
+    element is `0` or `1`, followed by the elements like a BitVector, or `1` followed by
+    the 4 bit-planes of packed::LogicWord, each like a BitVector.
+
+    A writer is used from one thread. Errors of the sink are reported by the next call
+    of change(), time(), or flush(); the destructor flushes the output and ignores them.
+    */
+class WaveWriter {
+
+public: // types
+    /** Type of the handles of signals. */
+    using signal_type = std::size_t;
+
+    /** Type of times, in units of the timescale. */
+    using time_type = std::uint64_t;
+
+    /** Type of lengths and sizes. */
+    using size_type = std::size_t;
+
+public: // constructors
+    /** Create a writer that writes to the sink. */
+    explicit WaveWriter(WaveSink sink, const WaveOptions& options = WaveOptions());
+
+    /** Writes the remaining output, ignoring errors, and stops the background thread. */
+    ~WaveWriter();
+
+    WaveWriter(const WaveWriter&) = delete;
+    WaveWriter& operator=(const WaveWriter&) = delete;
+
+public: // declarations
+    /** Declares a signal of a Logic value. Fails with `std::logic_error` after the first change, time, or flush. */
+    signal_type add_logic(const std::string& name);
+
+    /** Declares a signal of a LogicVector with the given bounds. Fails with `std::logic_error` after the first change, time, or flush. */
+    signal_type add_logic(const std::string& name, Bounds bounds);
+
+    /** Declares a signal of a Bit value. Fails with `std::logic_error` after the first change, time, or flush. */
+    signal_type add_bit(const std::string& name);
+
+    /** Declares a signal of a BitVector with the given bounds. Fails with `std::logic_error` after the first change, time, or flush. */
+    signal_type add_bit(const std::string& name, Bounds bounds);
+
+public: // tracing
+    /** Sets the time of the following changes. Fails with `std::invalid_argument` if time would go backwards. */
+    void time(time_type t);
+
+    /** The time of the following changes. */
+    time_type time() const noexcept;
+
+    /** Records the value of a signal declared by add_logic(name) if it changed. */
+    void change(signal_type signal, Logic value);
+
+    /** Records the value of a signal declared by add_bit(name) if it changed. */
+    void change(signal_type signal, Bit value);
+
+    /** Records the value of a signal declared by add_logic(name, bounds) if it changed. Fails with `std::invalid_argument` if the lengths differ. */
+    void change(signal_type signal, const LogicVector& value);
+
+    /** Records the value of a signal declared by add_bit(name, bounds) if it changed. Fails with `std::invalid_argument` if the lengths differ. */
+    void change(signal_type signal, const BitVector& value);
+
+    /** Encodes all recorded changes and writes them to the sink, waiting for the background thread. */
+    void flush();
+
+public: // attributes
+    /** The number of changes recorded. */
+    std::uint64_t changes() const noexcept;
+
+private: // helpers
+    using word_type = packed::word_type;
+
+    /** A declared signal and the last value recorded for it. */
+    struct Signal {
+        std::string name;
+        Bounds bounds;
+        bool bit;
+        bool vector;
+        size_type length;
+        size_type words;  ///< Words of the value: 1 for scalars, else those of the planes.
+        size_type offset; ///< Position of the value in values_.
+        bool recorded;
+        std::string code; ///< VCD identifier.
+    };
+
+    signal_type add(const std::string& name, Bounds bounds, bool bit, bool vector);
+    Signal& checked(signal_type signal, bool bit, bool vector, size_type length);
+    void record(signal_type signal, Signal& s, const word_type* value);
+    void start();
+    void submit();
+    void rethrow();
+    void work();
+
+    void encode(const word_type* records, size_type n);
+    void encode_header();
+    void encode_vcd(const Signal& signal, const word_type* value);
+    void encode_delta(signal_type signal, const word_type* value);
+    char* output(size_type n);
+    void write_output();
+
+private: // members
+    WaveSink sink_;
+    WaveOptions options_;
+    std::vector<Signal> signals_;
+    std::vector<word_type> values_;
+    std::vector<word_type> records_;
+    time_type time_ { 0 };
+    bool time_recorded_ { false };
+    bool started_ { false };
+    std::uint64_t changes_ { 0 };
+
+    // touched only by the thread that encodes
+    std::vector<char> output_;
+    size_type output_size_ { 0 };
+    time_type encoded_time_ { 0 };
+    bool header_encoded_ { false };
+
+    // handoff of buffers of records to the background thread
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::vector<word_type>> queue_;
+    std::vector<std::vector<word_type>> spare_;
+    bool busy_ { false };
+    bool stop_ { false };
+    std::exception_ptr error_;
+};
+
+/** \relates WaveWriter Converts a waveform in the `delta` format to VCD, written to the sink. Fails with `std::invalid_argument` if the data is not a valid waveform. */
+void delta_to_vcd(const char* data, std::size_t size, WaveSink sink, bool four_state = false);
+
+}
+
+#include "hdltypes/impl/wave.hpp"
+
+#endif
@@ -0,0 +1,136 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include <hdltypes/impl/simd.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace hdltypes;
+
+TEST_CASE("BitVector construction", "[bit_vector]")
+{
+    BitVector a(downto(7, 0));
+    REQUIRE(a.length() == 8);
+    REQUIRE(a[7] == '0'_b);
+
+    BitVector b(130, '1'_b);
+    REQUIRE(b.bounds() == downto(129, 0));
+    REQUIRE(b.words() == 3);
+    REQUIRE(b[0] == '1'_b);
+    REQUIRE(b.word(2) == 0x3);
+}
+
+TEST_CASE("BitVector element access", "[bit_vector]")
+{
+    BitVector a(to(1, 100));
+    a.set(1, '1'_b);
+    a.set(100, '1'_b);
+    REQUIRE(a.at(1) == '1'_b);
+    REQUIRE(a.at(2) == '0'_b);
+    REQUIRE(a.at(100) == '1'_b);
+
+    REQUIRE_THROWS(a.at(0));
+    REQUIRE_THROWS(a.set(101, '0'_b));
+}
+
+TEST_CASE("BitVector conversions", "[bit_vector]")
+{
+    const auto a = "0110"_bv;
+    REQUIRE(a.bounds() == downto(3, 0));
+    REQUIRE(a[3] == '0'_b);
+    REQUIRE(a[2] == '1'_b);
+    REQUIRE(to_string(a) == "0110");
+    REQUIRE_THROWS("01X"_bv);
+
+    const LogicVector l = a;
+    REQUIRE(l == "0110"_lv);
+    REQUIRE(to_bit_vector("1001"_lv) == "1001"_bv);
+    REQUIRE_THROWS(to_bit_vector("10H1"_lv));
+    REQUIRE_THROWS(BitVector("1U"_lv));
+
+    REQUIRE(("01XX"_lv & "0110"_bv) == "01X0"_lv);
+}
+
+TEST_CASE("BitVector operations", "[bit_vector]")
+{
+    REQUIRE(("0011"_bv & "0101"_bv) == "0001"_bv);
+    REQUIRE(("0011"_bv | "0101"_bv) == "0111"_bv);
+    REQUIRE(("0011"_bv ^ "0101"_bv) == "0110"_bv);
+    REQUIRE(~"0011"_bv == "1100"_bv);
+
+    auto a = "0011"_bv;
+    a &= "0111"_bv;
+    a |= "1000"_bv;
+    a ^= "0001"_bv;
+    REQUIRE(a == "1010"_bv);
+    inplace_invert(a);
+    REQUIRE(a == "0101"_bv);
+    REQUIRE(a.word(0) == 0b1010);
+
+    REQUIRE_THROWS("01"_bv & "011"_bv);
+    REQUIRE("01"_bv != "010"_bv);
+}
+
+TEST_CASE("BitVector reductions", "[bit_vector]")
+{
+    REQUIRE(and_reduce(BitVector()) == '1'_b);
+    REQUIRE(or_reduce(BitVector()) == '0'_b);
+    REQUIRE(xor_reduce(BitVector()) == '0'_b);
+
+    for (const std::size_t length : { 1u, 63u, 64u, 65u, 300u, 1000u }) {
+        BitVector a(length, '1'_b);
+        REQUIRE(and_reduce(a) == '1'_b);
+        REQUIRE(or_reduce(a) == '1'_b);
+        REQUIRE(xor_reduce(a) == to_bit(bool(length & 1)));
+
+        a.set(0, '0'_b);
+        REQUIRE(and_reduce(a) == '0'_b);
+        REQUIRE(xor_reduce(a) == to_bit(!(length & 1)));
+
+        a.fill('0'_b);
+        REQUIRE(or_reduce(a) == '0'_b);
+        a.set(Bounds::index_type(length) - 1, '1'_b);
+        REQUIRE(or_reduce(a) == '1'_b);
+    }
+}
+
+TEST_CASE("Word kernels", "[bit_vector]")
+{
+    std::vector<uint64_t> a(37), b(37);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = 0x9E3779B97F4A7C15ULL * (i + 1);
+        b[i] = 0xC2B2AE3D27D4EB4FULL * (i + 7);
+    }
+
+    const auto best = simd::detect_isa();
+    for (const auto isa : { simd::Isa::scalar, simd::Isa::sse2, simd::Isa::ssse3, simd::Isa::avx2 }) {
+        if (int(isa) > int(best)) {
+            continue;
+        }
+        const auto& k = simd::word_kernels(isa);
+        const auto& ref = simd::word_kernels(simd::Isa::scalar);
+        for (std::size_t n = 0; n <= a.size(); ++n) {
+            std::vector<uint64_t> r(n), e(n);
+            k.bit_and(r.data(), a.data(), b.data(), n);
+            ref.bit_and(e.data(), a.data(), b.data(), n);
+            REQUIRE(r == e);
+            k.bit_or(r.data(), a.data(), b.data(), n);
+            ref.bit_or(e.data(), a.data(), b.data(), n);
+            REQUIRE(r == e);
+            k.bit_xor(r.data(), a.data(), b.data(), n);
+            ref.bit_xor(e.data(), a.data(), b.data(), n);
+            REQUIRE(r == e);
+            k.bit_not(r.data(), a.data(), n);
+            ref.bit_not(e.data(), a.data(), n);
+            REQUIRE(r == e);
+            REQUIRE(k.popcount(a.data(), n) == ref.popcount(a.data(), n));
+            REQUIRE(k.any_ones(a.data(), n) == (n != 0));
+            REQUIRE_FALSE(k.all_ones(a.data(), n) != (n == 0));
+
+            std::vector<uint64_t> ones(n, ~uint64_t(0));
+            REQUIRE(k.all_ones(ones.data(), n));
+            std::vector<uint64_t> zeros(n, 0);
+            REQUIRE_FALSE(k.any_ones(zeros.data(), n));
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+
+using namespace hdltypes;
+
+TEST_CASE("Bounds attributes", "[bounds]")
+{
+    constexpr auto a = downto(7, 0);
+    static_assert(a.length() == 8, "");
+    REQUIRE(a.left() == 7);
+    REQUIRE(a.right() == 0);
+    REQUIRE(a.low() == 0);
+    REQUIRE(a.high() == 7);
+    REQUIRE(a.direction() == Direction::descending);
+
+    const auto b = to(-4, 4);
+    REQUIRE(b.length() == 9);
+    REQUIRE(b.low() == -4);
+    REQUIRE(b.high() == 4);
+    REQUIRE(b.direction() == Direction::ascending);
+
+    REQUIRE(Bounds().length() == 0);
+    REQUIRE(to(1, 0).length() == 0);
+    REQUIRE(downto(0, 1).length() == 0);
+}
+
+TEST_CASE("Bounds indexing", "[bounds]")
+{
+    const auto a = downto(7, 0);
+    REQUIRE(a.contains(0));
+    REQUIRE(a.contains(7));
+    REQUIRE_FALSE(a.contains(8));
+    REQUIRE_FALSE(a.contains(-1));
+    REQUIRE(a.offset(7) == 0);
+    REQUIRE(a.offset(0) == 7);
+    REQUIRE(a.index(1) == 6);
+
+    const auto b = to(-4, 4);
+    REQUIRE(b.offset(-4) == 0);
+    REQUIRE(b.offset(4) == 8);
+    REQUIRE(b.index(2) == -2);
+}
+
+TEST_CASE("Bounds comparison", "[bounds]")
+{
+    REQUIRE(downto(7, 0) == downto(7, 0));
+    REQUIRE(downto(7, 0) != to(7, 0));
+    REQUIRE(to(0, 7) != to(1, 8));
+}
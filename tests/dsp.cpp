@@ -0,0 +1,164 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include <hdltypes/impl/dsp_kernels.hpp>
+#include "random.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+using namespace hdltypes;
+
+namespace {
+
+/** Fixed point values with random bits. */
+template <typename F>
+std::vector<F> random_fixed(const std::size_t n, uint64_t& state)
+{
+    std::vector<F> r(n);
+    for (auto& v : r) {
+        typename F::integer_type bits;
+        bits.set_limb(0, next_random(state));
+        v = F::from_bits(bits);
+    }
+    return r;
+}
+
+/** Values with the same bits, so products and sums can reach the ends of their ranges. */
+template <typename F>
+std::vector<F> constant_fixed(const std::size_t n, const typename F::integer_type& bits)
+{
+    return std::vector<F>(n, F::from_bits(bits));
+}
+
+/** dot written with the scalar types. */
+template <typename Acc, typename A, typename B>
+Acc reference_dot(const A* const a, const B* const b, const std::size_t n)
+{
+    Acc s;
+    for (std::size_t i = 0; i < n; ++i) {
+        s = resize<Acc::left(), Acc::right()>(s + a[i] * b[i], FixedOverflow::wrap, FixedRound::truncate);
+    }
+    return s;
+}
+
+template <typename F, typename A, typename B, typename Acc>
+void check_dsp(const std::vector<A>& a, const std::vector<B>& b)
+{
+    for (const std::size_t n : { std::size_t(0), std::size_t(1), std::size_t(7), std::size_t(31), a.size() }) {
+        REQUIRE(dot(a.data(), b.data(), n) == reference_dot<Acc>(a.data(), b.data(), n));
+    }
+
+    std::vector<F> r(a.size());
+    for (const auto overflow : { FixedOverflow::saturate, FixedOverflow::wrap }) {
+        for (const auto round : { FixedRound::round, FixedRound::truncate }) {
+            multiply(r.data(), a.data(), b.data(), a.size(), overflow, round);
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                REQUIRE(r[i] == resize<F::left(), F::right()>(a[i] * b[i], overflow, round));
+            }
+
+            for (const std::size_t taps : { std::size_t(1), std::size_t(5), std::size_t(16), std::size_t(33) }) {
+                const std::size_t n = a.size() - taps + 1;
+                fir(r.data(), a.data(), a.size(), b.data(), taps, overflow, round);
+                for (std::size_t i = 0; i < n; ++i) {
+                    Acc s;
+                    for (std::size_t j = 0; j < taps; ++j) {
+                        s = resize<Acc::left(), Acc::right()>(s + b[j] * a[i + taps - 1 - j], FixedOverflow::wrap, FixedRound::truncate);
+                    }
+                    REQUIRE(r[i] == resize<F::left(), F::right()>(s, overflow, round));
+                }
+            }
+        }
+    }
+}
+
+}
+
+TEST_CASE("DSP kernels", "[dsp]")
+{
+    std::vector<uint64_t> a(300), b(300);
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        // 32-bit values, sign-extended and zero-extended
+        a[i] = uint64_t(int64_t(int32_t(uint32_t(next_random(state)))));
+        b[i] = uint64_t(uint32_t(next_random(state)));
+    }
+    a[0] = uint64_t(int64_t(INT32_MIN));
+    b[0] = 0xFFFFFFFF;
+
+    const auto best = simd::detect_isa();
+    for (const auto isa : { simd::Isa::scalar, simd::Isa::sse2, simd::Isa::ssse3, simd::Isa::avx2 }) {
+        if (int(isa) > int(best)) {
+            continue;
+        }
+        const auto& k = simd::dsp_kernels(isa);
+        const auto& ref = simd::dsp_kernels(simd::Isa::scalar);
+        for (std::size_t n = 0; n <= 40; ++n) {
+            REQUIRE(k.dot_signed(a.data(), a.data() + 1, n) == ref.dot_signed(a.data(), a.data() + 1, n));
+            REQUIRE(k.dot_unsigned(b.data(), b.data() + 1, n) == ref.dot_unsigned(b.data(), b.data() + 1, n));
+
+            std::vector<uint64_t> r(n), e(n);
+            k.multiply_signed(r.data(), a.data(), a.data() + 3, n);
+            ref.multiply_signed(e.data(), a.data(), a.data() + 3, n);
+            REQUIRE(r == e);
+            k.multiply_unsigned(r.data(), b.data(), b.data() + 3, n);
+            ref.multiply_unsigned(e.data(), b.data(), b.data() + 3, n);
+            REQUIRE(r == e);
+
+            for (const std::size_t taps : { std::size_t(1), std::size_t(4), std::size_t(17) }) {
+                k.fir_signed(r.data(), a.data(), a.data() + 200, n, taps);
+                ref.fir_signed(e.data(), a.data(), a.data() + 200, n, taps);
+                REQUIRE(r == e);
+                k.fir_unsigned(r.data(), b.data(), b.data() + 200, n, taps);
+                ref.fir_unsigned(e.data(), b.data(), b.data() + 200, n, taps);
+                REQUIRE(r == e);
+            }
+        }
+    }
+}
+
+TEST_CASE("DSP over StaticSfixed", "[dsp]")
+{
+    static_assert(std::is_same<decltype(dot(static_cast<const StaticSfixed<0, -15>*>(nullptr), static_cast<const StaticSfixed<3, -4>*>(nullptr), 0)), StaticSfixed<44, -19>>::value, "");
+
+    const StaticSfixed<1, -2> x[] = { StaticSfixed<1, -2>(1.25), StaticSfixed<1, -2>(-0.5), StaticSfixed<1, -2>(-2.0) };
+    const StaticSfixed<1, -2> h[] = { StaticSfixed<1, -2>(0.75), StaticSfixed<1, -2>(-2.0) };
+    REQUIRE(to_real(dot(x, h, 2)) == 1.25 * 0.75 + 1.0);
+    StaticSfixed<3, 0> y[2];
+    fir(y, x, 3, h, 2);
+    REQUIRE(to_real(y[0]) == -3.0); // -0.375 - 2.5
+    REQUIRE(to_real(y[1]) == 0.0);  // -1.5 + 1.0, ties to even
+    // no outputs without taps or with fewer samples than taps
+    fir(y, x, 3, h, 0);
+    fir(y, x, 1, h, 2);
+    REQUIRE(to_real(y[0]) == -3.0);
+    REQUIRE(to_real(y[1]) == 0.0);
+    multiply(y, x, x, 2, FixedOverflow::saturate, FixedRound::truncate);
+    REQUIRE(to_real(y[0]) == 1.0);
+    REQUIRE(to_real(y[1]) == 0.0);
+
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    using Q15 = StaticSfixed<0, -15>;
+    check_dsp<StaticSfixed<1, -15>, Q15, Q15, StaticSfixedAccumulator<-15, -15>>(random_fixed<Q15>(300, state), random_fixed<Q15>(300, state));
+    check_dsp<StaticSfixed<1, -15>, Q15, Q15, StaticSfixedAccumulator<-15, -15>>(constant_fixed<Q15>(300, Q15::integer_type(-32768)), constant_fixed<Q15>(300, Q15::integer_type(-32768)));
+    check_dsp<StaticSfixed<1, -15>, Q15, Q15, StaticSfixedAccumulator<-15, -15>>(constant_fixed<Q15>(300, Q15::integer_type(-32768)), constant_fixed<Q15>(300, Q15::integer_type(32767)));
+    using S = StaticSfixed<12, -19>;
+    using T = StaticSfixed<2, 0>;
+    check_dsp<StaticSfixed<20, -2>, S, T, StaticSfixedAccumulator<-19, 0>>(random_fixed<S>(300, state), random_fixed<T>(300, state));
+    check_dsp<StaticSfixed<20, -2>, S, S, StaticSfixedAccumulator<-19, -19>>(constant_fixed<S>(300, S::integer_type(INT32_MIN)), constant_fixed<S>(300, S::integer_type(INT32_MIN)));
+}
+
+TEST_CASE("DSP over StaticUfixed", "[dsp]")
+{
+    const StaticUfixed<1, -2> x[] = { StaticUfixed<1, -2>(1.25), StaticUfixed<1, -2>(0.5), StaticUfixed<1, -2>(3.75) };
+    REQUIRE(to_real(dot(x, x, 3)) == 1.5625 + 0.25 + 14.0625);
+
+    uint64_t state = 0x853C49E6748FEA9BULL;
+    using U = StaticUfixed<-1, -16>;
+    check_dsp<StaticUfixed<0, -8>, U, U, StaticUfixedAccumulator<-16, -16>>(random_fixed<U>(300, state), random_fixed<U>(300, state));
+    check_dsp<StaticUfixed<0, -8>, U, U, StaticUfixedAccumulator<-16, -16>>(constant_fixed<U>(300, U::integer_type(0xFFFF)), constant_fixed<U>(300, U::integer_type(0xFFFF)));
+    using V = StaticUfixed<31, 0>;
+    using W = StaticUfixed<4, -3>;
+    check_dsp<StaticUfixed<40, 2>, V, W, StaticUfixedAccumulator<0, -3>>(random_fixed<V>(300, state), random_fixed<W>(300, state));
+    check_dsp<StaticUfixed<40, 2>, V, V, StaticUfixedAccumulator<0, 0>>(constant_fixed<V>(300, V::integer_type(0xFFFFFFFF)), constant_fixed<V>(300, V::integer_type(0xFFFFFFFF)));
+}
@@ -0,0 +1,122 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+
+#include <cstdint>
+#include <string>
+
+using namespace hdltypes;
+
+namespace {
+
+const Logic logic_values[9] = {
+    'U'_l, 'X'_l, '0'_l, '1'_l, 'Z'_l, 'W'_l, 'L'_l, 'H'_l, '-'_l
+};
+
+// the counters of every operation are zero unless instrumentation is on
+constexpr std::uint64_t counted(const std::uint64_t n)
+{
+    return HDLTYPES_INSTRUMENT ? n : 0;
+}
+
+}
+
+TEST_CASE("InstrumentCounters counts, sums, and prints", "[instrument]")
+{
+    InstrumentCounters a;
+    a.add_call(InstrumentedOperation::logic_xor);
+    a.add_results(InstrumentedOperation::logic_xor, Logic::X);
+    a.add_call(InstrumentedOperation::bit_vector);
+    a.add_results(InstrumentedOperation::bit_vector, Logic::_0, 30);
+    a.add_results(InstrumentedOperation::bit_vector, Logic::_1, 34);
+    REQUIRE(a.calls(InstrumentedOperation::logic_xor) == 1);
+    REQUIRE(a.results(InstrumentedOperation::logic_xor, Logic::X) == 1);
+    REQUIRE(a.results(InstrumentedOperation::logic_xor, Logic::U) == 0);
+    REQUIRE(a.results(InstrumentedOperation::bit_vector) == 64);
+    REQUIRE(a.calls(InstrumentedOperation::logic_and) == 0);
+
+    InstrumentCounters b = a;
+    b += a;
+    REQUIRE(b.calls(InstrumentedOperation::bit_vector) == 2);
+    REQUIRE(b.results(InstrumentedOperation::bit_vector, Logic::_1) == 68);
+
+    const std::string csv = to_string(b);
+    REQUIRE(csv.find("operation,calls,U,X,0,1,Z,W,L,H,-\n") == 0);
+    REQUIRE(csv.find("\nlogic_xor,2,0,2,0,0,0,0,0,0,0\n") != std::string::npos);
+    REQUIRE(csv.find("\nbit_vector,2,0,0,60,68,0,0,0,0,0\n") != std::string::npos);
+    REQUIRE(std::string(to_string(InstrumentedOperation::logic_resolve)) == "logic_resolve");
+
+    b.reset();
+    REQUIRE(b.results(InstrumentedOperation::bit_vector) == 0);
+    REQUIRE(b.calls(InstrumentedOperation::logic_xor) == 0);
+}
+
+TEST_CASE("Logic and Bit operators are counted with the values of their results", "[instrument]")
+{
+    // operators evaluated at compile time are not counted
+    static_assert((('1'_l & 'X'_l) | '0'_l) == 'X'_l, "constant evaluation");
+
+    reset_instrument_counters();
+    std::uint64_t and_results[9] = {};
+    std::uint64_t resolve_results[9] = {};
+    for (const Logic a : logic_values) {
+        for (const Logic b : logic_values) {
+            ++and_results[(a & b).value()];
+            ++resolve_results[resolve(a, b).value()];
+        }
+    }
+    Logic c = '1'_l;
+    c ^= 'H'_l;
+    c = ~c;
+    Bit d = '1'_b;
+    d &= '0'_b;
+    d = ~d;
+
+    const InstrumentCounters& counters = instrument_counters();
+    REQUIRE(counters.calls(InstrumentedOperation::logic_and) == counted(81));
+    REQUIRE(counters.calls(InstrumentedOperation::logic_resolve) == counted(81));
+    for (unsigned value = 0; value < instrumented_values; ++value) {
+        REQUIRE(counters.results(InstrumentedOperation::logic_and, value) == counted(and_results[value]));
+        REQUIRE(counters.results(InstrumentedOperation::logic_resolve, value) == counted(resolve_results[value]));
+    }
+    REQUIRE(and_results[Logic::X] == 32);
+    REQUIRE(counters.results(InstrumentedOperation::logic_xor, Logic::_0) == counted(1));
+    REQUIRE(counters.results(InstrumentedOperation::logic_not, Logic::_1) == counted(1));
+    REQUIRE(counters.calls(InstrumentedOperation::logic_or) == 0);
+    REQUIRE(counters.results(InstrumentedOperation::bit_and, Logic::_0) == counted(1));
+    REQUIRE(counters.results(InstrumentedOperation::bit_not, Logic::_1) == counted(1));
+    REQUIRE(c == '1'_l);
+    REQUIRE(d == '1'_b);
+
+    reset_instrument_counters();
+    REQUIRE(counters.calls(InstrumentedOperation::logic_and) == 0);
+}
+
+TEST_CASE("Vector expressions are counted once with the values of their elements", "[instrument]")
+{
+    LogicVector a(downto(99, 0), '1'_l);
+    a.set(3, 'X'_l);
+    a.set(70, 'U'_l);
+    a.set(71, 'Z'_l);
+    const LogicVector b(downto(99, 0), 'H'_l);
+    const BitVector p(downto(129, 0), '1'_b);
+    BitVector q(downto(129, 0), '0'_b);
+    q.set(100, '1'_b);
+
+    reset_instrument_counters();
+    const LogicVector r = ~(a & b);
+    BitVector s = p ^ q;
+    s &= p;
+
+    const InstrumentCounters& counters = instrument_counters();
+    REQUIRE(counters.calls(InstrumentedOperation::logic_vector) == counted(1));
+    REQUIRE(counters.results(InstrumentedOperation::logic_vector, Logic::_0) == counted(97));
+    REQUIRE(counters.results(InstrumentedOperation::logic_vector, Logic::X) == counted(2));
+    REQUIRE(counters.results(InstrumentedOperation::logic_vector, Logic::U) == counted(1));
+    REQUIRE(counters.results(InstrumentedOperation::logic_vector) == counted(100));
+    REQUIRE(counters.calls(InstrumentedOperation::bit_vector) == counted(2));
+    REQUIRE(counters.results(InstrumentedOperation::bit_vector, Logic::_1) == counted(2 * 129));
+    REQUIRE(counters.results(InstrumentedOperation::bit_vector, Logic::_0) == counted(2));
+    REQUIRE(counters.calls(InstrumentedOperation::logic_and) == 0);
+    REQUIRE(r[70] == 'U'_l);
+    REQUIRE(s[100] == '0'_b);
+}
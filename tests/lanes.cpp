@@ -0,0 +1,114 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include "random.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+
+using namespace hdltypes;
+
+namespace {
+
+/** A model written for Logic, run unchanged on lanes. */
+template <typename T>
+T full_adder(const T& a, const T& b, const T& c_in, T& c_out)
+{
+    const T t = a ^ b;
+    c_out = (a & b) | (t & c_in);
+    return t ^ c_in;
+}
+
+}
+
+TEST_CASE("LogicLanes construction and access", "[lanes]")
+{
+    constexpr LogicLanes<64> a;
+    static_assert(a[63] == 'U'_l, "");
+    static_assert(LogicLanes<3>::lanes() == 3, "");
+    static_assert(LogicLanes<3>('1'_l).word().value == 0b111, "bits past the last lane are 0");
+
+    LogicLanes<5> b('Z'_l);
+    b.set(4, 'H'_l);
+    REQUIRE(b[0] == 'Z'_l);
+    REQUIRE(b.at(4) == 'H'_l);
+    REQUIRE_THROWS_AS(b.at(5), std::out_of_range);
+    REQUIRE_THROWS_AS(b.set(5, '0'_l), std::out_of_range);
+    REQUIRE(b == LogicLanes<5>(packed::LogicWord { 0x0F, 0x1F, 0x10, 0 }));
+    REQUIRE(b != LogicLanes<5>('Z'_l));
+
+    BitLanes<5> c('1'_b);
+    c.set(2, '0'_b);
+    REQUIRE(c.word() == 0b11011);
+    REQUIRE(c[2] == '0'_b);
+    REQUIRE_THROWS_AS(c.at(7), std::out_of_range);
+    REQUIRE(LogicLanes<5>(c)[3] == '1'_l);
+    REQUIRE(BitLanes<5>(LogicLanes<5>(c)) == c);
+    REQUIRE_THROWS_AS(BitLanes<5>(b), std::invalid_argument);
+}
+
+TEST_CASE("LogicLanes operations match Logic operations", "[lanes]")
+{
+    // lanes hold every pair of values
+    LogicLanes<64> a, b;
+    for (std::size_t base = 0; base < 81; base += 64) {
+        for (std::size_t i = 0; i < 64; ++i) {
+            a.set(i, logic_values[((base + i) / 9) % 9]);
+            b.set(i, logic_values[(base + i) % 9]);
+        }
+        const auto r_and = a & b;
+        const auto r_or = a | b;
+        const auto r_xor = a ^ b;
+        const auto r_not = ~a;
+        const auto r_resolved = resolve(a, b);
+        const auto r_is01 = is01(a);
+        for (std::size_t i = 0; i < 64; ++i) {
+            REQUIRE(r_and[i] == (a[i] & b[i]));
+            REQUIRE(r_or[i] == (a[i] | b[i]));
+            REQUIRE(r_xor[i] == (a[i] ^ b[i]));
+            REQUIRE(r_not[i] == ~a[i]);
+            REQUIRE(r_resolved[i] == resolve(a[i], b[i]));
+            REQUIRE(to_bool(r_is01[i]) == is01(a[i]));
+        }
+    }
+
+    // scalars apply to every lane
+    REQUIRE(('0'_l & a) == LogicLanes<64>('0'_l));
+    REQUIRE((a | '1'_l) == LogicLanes<64>('1'_l));
+    REQUIRE(('1'_b ^ BitLanes<64>(0xF0)) == BitLanes<64>(~uint64_t(0xF0)));
+    auto c = a;
+    c &= 'H'_l;
+    c |= BitLanes<64>(1);
+    inplace_invert(c);
+    REQUIRE(c[0] == '0'_l);
+    REQUIRE(c == ~((a & 'H'_l) | BitLanes<64>(1)));
+
+    REQUIRE(to_bool(LogicLanes<4>('1'_l)) == BitLanes<4>('1'_b));
+    REQUIRE_THROWS_AS(to_bool(LogicLanes<4>('H'_l)), std::invalid_argument);
+    REQUIRE(is01(BitLanes<4>()) == BitLanes<4>('1'_b));
+}
+
+TEST_CASE("Lanes run a Logic model for many instances", "[lanes]")
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    LogicLanes<64> a, b, c_in;
+    BitLanes<64> x(next_random(state)), y(next_random(state));
+    for (std::size_t i = 0; i < 64; ++i) {
+        a.set(i, logic_values[next_random(state) % 9]);
+        b.set(i, logic_values[next_random(state) % 9]);
+        c_in.set(i, logic_values[next_random(state) % 9]);
+    }
+
+    LogicLanes<64> c_out;
+    const auto sum = full_adder(a, b, c_in, c_out);
+    BitLanes<64> bit_c_out;
+    const auto bit_sum = full_adder<BitLanes<64>>(x, y, '1'_b, bit_c_out);
+    for (std::size_t i = 0; i < 64; ++i) {
+        Logic scalar_c_out;
+        REQUIRE(sum[i] == full_adder(a[i], b[i], c_in[i], scalar_c_out));
+        REQUIRE(c_out[i] == scalar_c_out);
+
+        Logic bit_scalar_c_out;
+        REQUIRE(bit_sum[i] == full_adder<Logic>(x[i], y[i], '1'_b, bit_scalar_c_out));
+        REQUIRE(bit_c_out[i] == bit_scalar_c_out);
+    }
+}
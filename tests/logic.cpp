@@ -1,6 +1,9 @@
 #include "catch2/catch.hpp"
 #include <hdltypes.hpp>
 
+#include <cstddef>
+#include <utility>
+
 using namespace hdltypes;
 
 TEST_CASE("Logic char conversions", "[logic]")
@@ -57,6 +60,68 @@ TEST_CASE("Logic/Bit conversions", "[logic]")
     REQUIRE_NOTHROW(Logic('0'_b));
 }
 
+TEST_CASE("Non-throwing conversions", "[logic]")
+{
+    static_assert(noexcept(try_to_logic('h', std::declval<Logic&>())), "");
+
+    Logic l = 'U'_l;
+    REQUIRE(try_to_logic('h', l));
+    REQUIRE(l == 'H'_l);
+    REQUIRE(try_to_logic(1, l));
+    REQUIRE(l == '1'_l);
+    REQUIRE_FALSE(try_to_logic('8', l));
+    REQUIRE_FALSE(try_to_logic(2, l));
+    REQUIRE(l == '1'_l);
+
+    int i = 5;
+    bool b = false;
+    REQUIRE(try_to_int('1'_l, i));
+    REQUIRE(i == 1);
+    REQUIRE_FALSE(try_to_int('H'_l, i));
+    REQUIRE(try_to_bool('1'_l, b));
+    REQUIRE(b);
+    REQUIRE_FALSE(try_to_bool('Z'_l, b));
+    REQUIRE(i == 1);
+
+    Bit x;
+    REQUIRE(try_to_bit('1'_l, x));
+    REQUIRE(x == '1'_b);
+    REQUIRE(try_to_bit('0', x));
+    REQUIRE(x == '0'_b);
+    REQUIRE(try_to_bit(1u, x));
+    REQUIRE(x == '1'_b);
+    REQUIRE_FALSE(try_to_bit('X'_l, x));
+    REQUIRE_FALSE(try_to_bit('X', x));
+    REQUIRE_FALSE(try_to_bit(-1, x));
+    REQUIRE(x == '1'_b);
+}
+
+TEST_CASE("Bulk validation and conversion", "[logic]")
+{
+    Logic a[40];
+    for (std::size_t n = 0; n < 40; ++n) {
+        a[n] = ((n * 7) % 3) ? '1'_l : '0'_l;
+    }
+    Bit out[40];
+    REQUIRE(validate01(a, 40) == 40);
+    REQUIRE(convert01(a, 40, out) == 40);
+    for (std::size_t n = 0; n < 40; ++n) {
+        REQUIRE(out[n] == to_bit(a[n]));
+    }
+
+    for (const auto bad : { 'U'_l, 'X'_l, 'Z'_l, 'W'_l, 'L'_l, 'H'_l, '-'_l }) {
+        for (std::size_t n = 0; n < 40; ++n) {
+            const Logic saved = a[n];
+            a[n] = bad;
+            REQUIRE(validate01(a, 40) == n);
+            REQUIRE(convert01(a, 40, out) == n);
+            REQUIRE(validate01(a, n) == n);
+            a[n] = saved;
+        }
+    }
+    REQUIRE(validate01(a, 0) == 0);
+}
+
 TEST_CASE("Logic attributes", "[logic]")
 {
     REQUIRE(is01('0'_l));
@@ -109,6 +174,19 @@ TEST_CASE("Logic operations", "[logic]")
     }
 }
 
+TEST_CASE("Logic operator backends agree", "[logic]")
+{
+    const Logic values[] = { 'U'_l, 'X'_l, '0'_l, '1'_l, 'Z'_l, 'W'_l, 'L'_l, 'H'_l, '-'_l };
+    for (const auto a : values) {
+        REQUIRE(detail::logic_not_formula(a) == detail::logic_not_table(a));
+        for (const auto b : values) {
+            REQUIRE(detail::logic_and_formula(a, b) == detail::logic_and_table(a, b));
+            REQUIRE(detail::logic_or_formula(a, b) == detail::logic_or_table(a, b));
+            REQUIRE(detail::logic_xor_formula(a, b) == detail::logic_xor_table(a, b));
+        }
+    }
+}
+
 TEST_CASE("Bit char conversions", "[logic]")
 {
     REQUIRE(to_char(to_bit('0')) == '0');
@@ -0,0 +1,115 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include "random.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+
+using namespace hdltypes;
+
+namespace {
+
+struct Mux2 {
+    constexpr Logic operator()(const Logic a, const Logic b, const Logic sel) const noexcept
+    {
+        return (a & ~sel) | (b & sel);
+    }
+};
+
+struct Majority {
+    constexpr Logic operator()(const Logic a, const Logic b, const Logic c, const Logic d) const noexcept
+    {
+        return (a & b & (c | d)) | (c & d & (a | b));
+    }
+};
+
+struct IsHigh {
+    constexpr Bit operator()(const Logic a) const noexcept
+    {
+        return to_bit((a == '1'_l) || (a == 'H'_l));
+    }
+};
+
+}
+
+TEST_CASE("LogicLut is built at compile time", "[logic_lut]")
+{
+    constexpr LogicLut<3> mux2 { Mux2 {} };
+    static_assert(mux2('0'_l, '1'_l, '1'_b) == '1'_l, "");
+    static_assert(mux2('0'_l, '1'_l, 'X'_l) == 'X'_l, "");
+    static_assert(LogicLut<3>::arity() == 3, "");
+    static_assert(LogicLut<3>::size() == 729, "");
+
+    constexpr auto is_high = make_logic_lut<1>(IsHigh {});
+    static_assert(is_high('H'_l) == '1'_l, "");
+    static_assert(is_high('Z'_l) == '0'_l, "");
+}
+
+TEST_CASE("LogicLut matches the function it tabulates", "[logic_lut]")
+{
+    constexpr LogicLut<3> mux2 { Mux2 {} };
+    for (const auto a : logic_values) {
+        for (const auto b : logic_values) {
+            for (const auto sel : logic_values) {
+                REQUIRE(mux2(a, b, sel) == Mux2 {}(a, b, sel));
+            }
+        }
+    }
+
+    const auto majority = make_logic_lut<4>(Majority {});
+    for (const auto a : logic_values) {
+        for (const auto b : logic_values) {
+            for (const auto c : logic_values) {
+                for (const auto d : logic_values) {
+                    REQUIRE(majority(a, b, c, d) == Majority {}(a, b, c, d));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("LogicLut evaluates arrays", "[logic_lut]")
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    constexpr LogicLut<3> mux2 { Mux2 {} };
+    Logic a[100], b[100], sel[100], r[100];
+    for (std::size_t i = 0; i < 100; ++i) {
+        a[i] = logic_values[next_random(state) % 9];
+        b[i] = logic_values[next_random(state) % 9];
+        sel[i] = logic_values[next_random(state) % 9];
+    }
+    mux2.apply(r, 100, a, b, sel);
+    for (std::size_t i = 0; i < 100; ++i) {
+        REQUIRE(r[i] == Mux2 {}(a[i], b[i], sel[i]));
+    }
+}
+
+TEST_CASE("LogicLut evaluates LogicVectors", "[logic_lut]")
+{
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    constexpr LogicLut<3> mux2 { Mux2 {} };
+    const auto is_high = make_logic_lut<1>(IsHigh {});
+    for (const std::size_t length : { 0u, 1u, 63u, 64u, 200u }) {
+        for (const bool only01 : { true, false }) {
+            const LogicVector a = random_logic_vector(length, state, only01);
+            const LogicVector b = random_logic_vector(length, state, only01);
+            const LogicVector sel = random_logic_vector(length, state, only01);
+            const LogicVector r = mux2(a, b, sel);
+            const LogicVector h = is_high(a);
+            REQUIRE(r.bounds() == a.bounds());
+            REQUIRE((!only01 || r.is01()));
+            for (std::size_t i = 0; i < length; ++i) {
+                const auto n = a.bounds().index(i);
+                REQUIRE(r[n] == Mux2 {}(a[n], b[n], sel[n]));
+                REQUIRE(h[n] == is_high(a[n]));
+            }
+        }
+    }
+
+    // results that are not 0/1 for 0/1 arguments, and past the end of the array
+    const auto weak = make_logic_lut<1>([](const Logic a) { return (a == '0'_l) ? 'Z'_l : 'L'_l; });
+    REQUIRE(weak("0110"_lv) == "ZLLZ"_lv);
+    REQUIRE(weak(LogicVector(70, '0'_l)) == LogicVector(70, 'Z'_l));
+
+    REQUIRE_THROWS_AS(mux2("01"_lv, "01"_lv, "011"_lv), std::invalid_argument);
+}
@@ -0,0 +1,246 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+
+#include <cstdint>
+
+using namespace hdltypes;
+
+static const Logic logic_values[9] = {
+    'U'_l, 'X'_l, '0'_l, '1'_l, 'Z'_l, 'W'_l, 'L'_l, 'H'_l, '-'_l
+};
+
+TEST_CASE("LogicWord encoding", "[logic_vector]")
+{
+    for (const auto a : logic_values) {
+        REQUIRE(packed::decode(packed::encode(a)) == a);
+        packed::LogicWord w {};
+        packed::set(w, 63, a);
+        REQUIRE(packed::get(w, 63) == a);
+        REQUIRE(packed::get(w, 0) == '0'_l);
+        REQUIRE(packed::get(packed::broadcast(a), 17) == a);
+        REQUIRE(((packed::mask01(packed::broadcast(a)) & 1) != 0) == is01(a));
+    }
+}
+
+TEST_CASE("LogicVector construction", "[logic_vector]")
+{
+    LogicVector a(downto(7, 0));
+    REQUIRE(a.length() == 8);
+    REQUIRE(a.left() == 7);
+    REQUIRE(a.right() == 0);
+    REQUIRE(a[3] == 'U'_l);
+
+    LogicVector b(to(-4, 4), '1'_l);
+    REQUIRE(b.length() == 9);
+    REQUIRE(b[-4] == '1'_l);
+    REQUIRE(b.words() == 1);
+
+    LogicVector c(130, 'Z'_l);
+    REQUIRE(c.bounds() == downto(129, 0));
+    REQUIRE(c.words() == 3);
+    REQUIRE(c[129] == 'Z'_l);
+    REQUIRE(c[0] == 'Z'_l);
+    REQUIRE((c.plane(0)[2] >> 2) == 0);
+
+    REQUIRE(LogicVector().length() == 0);
+}
+
+TEST_CASE("LogicVector element access", "[logic_vector]")
+{
+    LogicVector a(to(1, 100));
+    a.set(1, 'H'_l);
+    a.set(65, '0'_l);
+    a.set(100, '-'_l);
+    REQUIRE(a.at(1) == 'H'_l);
+    REQUIRE(a.at(65) == '0'_l);
+    REQUIRE(a.at(100) == '-'_l);
+    REQUIRE(a.at(2) == 'U'_l);
+
+    REQUIRE_THROWS(a.at(0));
+    REQUIRE_THROWS(a.at(101));
+    REQUIRE_THROWS(a.set(0, '1'_l));
+}
+
+TEST_CASE("LogicVector string conversions", "[logic_vector]")
+{
+    const auto a = "UX01ZWLH-"_lv;
+    REQUIRE(a.bounds() == downto(8, 0));
+    REQUIRE(a[8] == 'U'_l);
+    REQUIRE(a[0] == '-'_l);
+    REQUIRE(to_string(a) == "UX01ZWLH-");
+    REQUIRE(to_string(to_logic_vector(std::string("uxzwlh"))) == "UXZWLH");
+
+    REQUIRE_THROWS(to_logic_vector(std::string("01a")));
+}
+
+TEST_CASE("LogicVector operations match Logic operations", "[logic_vector]")
+{
+    // every pair of values, repeated so elements span multiple words
+    LogicVector a(81 * 3);
+    LogicVector b(81 * 3);
+    for (std::size_t i = 0; i < a.length(); ++i) {
+        a.set(Bounds::index_type(i), logic_values[(i / 9) % 9]);
+        b.set(Bounds::index_type(i), logic_values[i % 9]);
+    }
+
+    const LogicVector r_and = a & b;
+    const LogicVector r_or = a | b;
+    const LogicVector r_xor = a ^ b;
+    const LogicVector r_not = ~a;
+    for (Bounds::index_type i = 0; i < Bounds::index_type(a.length()); ++i) {
+        REQUIRE(r_and[i] == (a[i] & b[i]));
+        REQUIRE(r_or[i] == (a[i] | b[i]));
+        REQUIRE(r_xor[i] == (a[i] ^ b[i]));
+        REQUIRE(r_not[i] == ~a[i]);
+    }
+
+    // bits past the end of the array stay cleared
+    REQUIRE(r_not.plane(0)[r_not.words() - 1] >> (r_not.length() % 64) == 0);
+}
+
+TEST_CASE("LogicVector reductions match folded Logic operations", "[logic_vector]")
+{
+    REQUIRE(and_reduce(LogicVector()) == '1'_l);
+    REQUIRE(or_reduce(LogicVector()) == '0'_l);
+    REQUIRE(xor_reduce(LogicVector()) == '0'_l);
+
+    // a background of one value with a second value placed on either side of word boundaries
+    for (const auto background : logic_values) {
+        for (const auto other : logic_values) {
+            for (const std::size_t length : { 1u, 63u, 64u, 65u, 130u }) {
+                for (const std::size_t pos : { 0u, 62u, 63u, 64u, 129u }) {
+                    if (pos >= length) {
+                        continue;
+                    }
+                    LogicVector a(length, background);
+                    a.set(a.bounds().index(pos), other);
+                    Logic r_and = '1'_l, r_or = '0'_l, r_xor = '0'_l;
+                    for (std::size_t i = 0; i < length; ++i) {
+                        const Logic v = a[a.bounds().index(i)];
+                        r_and = r_and & v;
+                        r_or = r_or | v;
+                        r_xor = r_xor ^ v;
+                    }
+                    REQUIRE(and_reduce(a) == r_and);
+                    REQUIRE(or_reduce(a) == r_or);
+                    REQUIRE(xor_reduce(a) == r_xor);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("LogicVector inplace operations", "[logic_vector]")
+{
+    auto a = "01XH"_lv;
+    a &= "11L1"_lv;
+    REQUIRE(a == "0101"_lv);
+    a |= "0UZ0"_lv;
+    REQUIRE(a == "01X1"_lv);
+    a ^= "U111"_lv;
+    REQUIRE(a == "U0X0"_lv);
+    inplace_invert(a);
+    REQUIRE(a == "U1X1"_lv);
+
+    REQUIRE_THROWS("01"_lv & "011"_lv);
+    REQUIRE_THROWS(a |= "0"_lv);
+}
+
+TEST_CASE("LogicVector comparison", "[logic_vector]")
+{
+    REQUIRE("01XZ"_lv == "01XZ"_lv);
+    REQUIRE("01XZ"_lv != "01XW"_lv);
+    REQUIRE("01"_lv != "010"_lv);
+
+    LogicVector a(to(0, 3));
+    a.fill('1'_l);
+    REQUIRE(a == "1111"_lv);
+}
+
+TEST_CASE("LogicVector tracks whether all elements are 0 or 1", "[logic_vector]")
+{
+    REQUIRE(is01(LogicVector()));
+    REQUIRE_FALSE(is01(LogicVector(130)));
+    LogicVector a(130, '0'_l);
+    REQUIRE(is01(a));
+
+    a.set(129, 'X'_l);
+    a.set(3, 'H'_l);
+    REQUIRE_FALSE(is01(a));
+    a.set(129, '1'_l);
+    REQUIRE_FALSE(is01(a));
+    a.set(3, '0'_l);
+    REQUIRE(is01(a));
+
+    a.set_word(1, packed::broadcast('Z'_l));
+    REQUIRE_FALSE(is01(a));
+    a.fill('1'_l);
+    REQUIRE(is01(a));
+
+    // writing the planes directly is counted when the writer is destroyed
+    {
+        const LogicVector::PlaneWriter writer = a.write_planes();
+        writer.plane(0)[2] = 1;
+    }
+    REQUIRE_FALSE(is01(a));
+    REQUIRE(a[1] == 'Z'_l);
+    a.write_planes().plane(0)[2] = 0;
+    REQUIRE(is01(a));
+
+    // the count follows every write, so expressions never take the path of 0 and 1 by mistake
+    LogicVector b("11111111"_lv);
+    REQUIRE(is01(b));
+    b.set(7, 'Z'_l);
+    REQUIRE_FALSE(is01(b));
+    REQUIRE(LogicVector(b & '1'_l) == "X1111111"_lv);
+
+    REQUIRE(is01("0110"_lv));
+    REQUIRE_FALSE(is01("01L0"_lv));
+    REQUIRE(is01(LogicVector("0110"_bv)));
+}
+
+TEST_CASE("LogicVector operations of 0 and 1 match BitVector operations", "[logic_vector]")
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (const std::size_t length : { 0u, 1u, 64u, 100u, 1000u }) {
+        BitVector x(length), y(length);
+        for (std::size_t i = 0; i < length; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            x.set(x.bounds().index(i), to_bit(bool(state & 1)));
+            y.set(y.bounds().index(i), to_bit(bool(state & 2)));
+        }
+        const LogicVector a = x, b = y;
+        REQUIRE(is01(a));
+        const LogicVector r_and = a & b, r_not = ~a, r_fused = (a & ~b) | ('1'_l ^ b);
+        REQUIRE(is01(r_and));
+        REQUIRE(is01(r_not));
+        REQUIRE(r_and == LogicVector(BitVector(x & y)));
+        REQUIRE(r_not == LogicVector(BitVector(~x)));
+        REQUIRE(r_fused == LogicVector(BitVector((x & ~y) | ('1'_b ^ y))));
+        if (length != 0) {
+            // bits past the end of the array stay cleared
+            REQUIRE((r_not.plane(1)[r_not.words() - 1] & ~packed::tail_mask(length)) == 0);
+        }
+        REQUIRE(and_reduce(a) == and_reduce(x));
+        REQUIRE(or_reduce(a) == or_reduce(x));
+        REQUIRE(xor_reduce(a) == xor_reduce(x));
+        REQUIRE(and_reduce(r_and | '1'_l) == '1'_l);
+
+        // the same operations stay exact once an operand is not 0 or 1
+        if (length != 0) {
+            LogicVector c = a;
+            c.set(c.left(), 'X'_l);
+            const LogicVector r = c & b;
+            REQUIRE_FALSE(is01(c));
+            for (std::size_t i = 0; i < length; ++i) {
+                const auto n = c.bounds().index(i);
+                REQUIRE(r[n] == (c[n] & b[n]));
+            }
+            c = c & '0'_l;
+            REQUIRE(is01(c));
+            REQUIRE(c == LogicVector(length, '0'_l));
+        }
+    }
+}
@@ -0,0 +1,199 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace hdltypes;
+
+namespace {
+
+/** Resource that counts the memory it hands out from the new/delete resource. */
+class CountingResource : public MemoryResource {
+public:
+    std::size_t allocations { 0 };
+    std::size_t outstanding { 0 };
+
+private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        ++allocations;
+        outstanding += bytes;
+        return new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* const p, const std::size_t bytes, const std::size_t alignment) override
+    {
+        outstanding -= bytes;
+        new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const MemoryResource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+std::uintptr_t address(const void* const p)
+{
+    return reinterpret_cast<std::uintptr_t>(p);
+}
+
+}
+
+TEST_CASE("ArenaResource bumps through blocks and frees them all at once", "[memory]")
+{
+    CountingResource upstream;
+    ArenaResource arena(1024, &upstream);
+    REQUIRE(arena.upstream_resource() == &upstream);
+    REQUIRE(arena.capacity() == 0);
+    REQUIRE(upstream.allocations == 0);
+
+    std::vector<std::pair<std::uintptr_t, std::size_t>> first;
+    for (std::size_t i = 0; i < 200; ++i) {
+        const std::size_t bytes = 1 + (i * 37) % 300;
+        const std::size_t alignment = std::size_t(1) << (i % 5);
+        void* const p = arena.allocate(bytes, alignment);
+        REQUIRE(address(p) % alignment == 0);
+        first.emplace_back(address(p), bytes);
+    }
+    for (std::size_t i = 0; i < first.size(); ++i) {
+        for (std::size_t j = i + 1; j < first.size(); ++j) {
+            const bool disjoint = (first[i].first + first[i].second <= first[j].first) || (first[j].first + first[j].second <= first[i].first);
+            REQUIRE(disjoint);
+        }
+    }
+    const std::size_t capacity = arena.capacity();
+    const std::size_t blocks = upstream.allocations;
+    REQUIRE(capacity == upstream.outstanding);
+    REQUIRE(blocks < 10);
+
+    // a reset arena reuses its blocks for the same pattern of allocations
+    arena.reset();
+    for (std::size_t i = 0; i < 200; ++i) {
+        const std::size_t bytes = 1 + (i * 37) % 300;
+        const std::size_t alignment = std::size_t(1) << (i % 5);
+        REQUIRE(address(arena.allocate(bytes, alignment)) == first[i].first);
+    }
+    REQUIRE(arena.capacity() == capacity);
+    REQUIRE(upstream.allocations == blocks);
+
+    // allocations larger than the blocks get a block of their own
+    void* const large = arena.allocate(100000, 64);
+    REQUIRE(address(large) % 64 == 0);
+    REQUIRE(arena.capacity() >= capacity + 100000);
+    arena.deallocate(large, 100000, 64);
+
+    arena.release();
+    REQUIRE(arena.capacity() == 0);
+    REQUIRE(upstream.outstanding == 0);
+    REQUIRE(arena.allocate(8, 8) != nullptr);
+    REQUIRE(arena.capacity() == 1024);
+}
+
+TEST_CASE("ResourceScope sets the default resource of the thread", "[memory]")
+{
+    REQUIRE(thread_resource() == new_delete_resource());
+    ArenaResource a;
+    ArenaResource b;
+    {
+        ResourceScope outer(a);
+        REQUIRE(thread_resource() == &a);
+        {
+            ResourceScope inner(b);
+            REQUIRE(thread_resource() == &b);
+            REQUIRE(ResourceAllocator<int>().resource() == &b);
+        }
+        REQUIRE(thread_resource() == &a);
+    }
+    REQUIRE(thread_resource() == new_delete_resource());
+
+    REQUIRE(set_thread_resource(&a) == new_delete_resource());
+    REQUIRE(set_thread_resource(nullptr) == &a);
+    REQUIRE(thread_resource() == new_delete_resource());
+
+    REQUIRE(ResourceAllocator<int>(&a) == ResourceAllocator<long>(&a));
+    REQUIRE(ResourceAllocator<int>(&a) != ResourceAllocator<int>(&b));
+}
+
+TEST_CASE("Vectors and integers allocate from their allocator", "[memory]")
+{
+    CountingResource resource;
+    {
+        LogicVector a(downto(299, 0), 'X'_l, &resource);
+        BitVector b(downto(299, 0), '1'_b, &resource);
+        Unsigned u(300, 7, &resource);
+        Signed s(300, -7, &resource);
+        REQUIRE(resource.allocations == 4);
+        REQUIRE(a.get_allocator().resource() == &resource);
+        REQUIRE(u.get_allocator().resource() == &resource);
+
+        // copies allocate from the default resource, unless given an allocator
+        const LogicVector c = a;
+        REQUIRE(c.get_allocator().resource() == new_delete_resource());
+        const LogicVector d(c, &resource);
+        REQUIRE(d.get_allocator().resource() == &resource);
+        REQUIRE(d == a);
+        const Unsigned v(u, &resource);
+        REQUIRE(v == 7u);
+        REQUIRE(resource.allocations == 6);
+
+        // assignment keeps the allocator
+        LogicVector e(downto(299, 0), '0'_l);
+        e = std::move(a);
+        REQUIRE(e.get_allocator().resource() == new_delete_resource());
+        REQUIRE(e == d);
+        Unsigned w(300);
+        w = std::move(u);
+        REQUIRE(w.get_allocator().resource() == new_delete_resource());
+        REQUIRE(w == 7u);
+        u = w + 1u;
+        REQUIRE(u.get_allocator().resource() == &resource);
+        REQUIRE(u == 8u);
+        REQUIRE(to_integer(s * Signed(300, 3)) == -21);
+
+        // moving between equal allocators takes the memory
+        const std::size_t allocations = resource.allocations;
+        BitVector f(std::move(b), &resource);
+        REQUIRE(resource.allocations == allocations);
+        REQUIRE(f == BitVector(downto(299, 0), '1'_b));
+    }
+    REQUIRE(resource.outstanding == 0);
+
+    // values created in a scope, including the results of operators, allocate from the arena
+    CountingResource upstream;
+    ArenaResource arena(4096, &upstream);
+    const Unsigned x(1000, 3);
+    const LogicVector y(1000, '1'_l);
+    Unsigned state(1000);
+    for (std::size_t delta = 0; delta < 10; ++delta) {
+        {
+            ResourceScope scope(arena);
+            const Unsigned next = (x * x) + Unsigned(1000, delta) + (x % Unsigned(1000, 2));
+            const LogicVector z = y & ~y;
+            REQUIRE(next.get_allocator().resource() == &arena);
+            REQUIRE(z.get_allocator().resource() == &arena);
+            REQUIRE(is01(z));
+            state = next;
+        }
+        arena.reset();
+        REQUIRE(state == 10u + delta);
+        REQUIRE(state.get_allocator().resource() == new_delete_resource());
+    }
+    REQUIRE(upstream.allocations == 1);
+
+    // so do the temporaries of view assignments that read the array they write
+    CountingResource scoped;
+    LogicVector r(downto(299, 0), 'X'_l);
+    r.set(0, '1'_l);
+    {
+        ResourceScope scope(scoped);
+        LogicVectorView { r } = ConstLogicVectorView(r).reversed();
+    }
+    REQUIRE(scoped.allocations == 1);
+    REQUIRE(scoped.outstanding == 0);
+    REQUIRE(r[299] == '1'_l);
+    REQUIRE(r[0] == 'X'_l);
+}
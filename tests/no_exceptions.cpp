@@ -0,0 +1,53 @@
+// Built with exceptions disabled (-fno-exceptions) to check that the headers compile that
+// way; errors that would throw abort instead. Returns non-zero if a result is wrong.
+
+#include <hdltypes.hpp>
+
+#include <cstddef>
+
+using namespace hdltypes;
+
+int main()
+{
+    int failures = 0;
+    const auto check = [&](const bool ok) {
+        failures += ok ? 0 : 1;
+    };
+
+    const LogicVector a = "0101XXZZ"_lv;
+    const LogicVector b = "11110000"_lv;
+    check((a & b) == "01010000"_lv);
+    check(a[0] == 'Z'_l);
+    check(!is01(a));
+
+    const BitVector c = "10100101"_bv;
+    check(BitVector(b) == "11110000"_bv);
+    check((c ^ BitVector(b)) == "01010101"_bv);
+
+    LogicVector d = a;
+    LogicVectorView { d } = ConstLogicVectorView(d).reversed();
+    check(d == "ZZXX1010"_lv);
+    check(to_logic_vector(ConstLogicVectorView(a).slice(downto(7, 4))) == "0101"_lv);
+
+    const StaticLogicVector<7, 0> e(b);
+    check(StaticBitVector<7, 0>(e) == StaticBitVector<7, 0>("11110000"));
+
+    const Unsigned u(300, 1000);
+    check((u / 7u) == 142u);
+    check((u % Unsigned(300, 7)) == 6u);
+    check(to_integer(Signed(300, -1000) / -7) == 142);
+    check(StaticUnsigned<8>(200) / StaticUnsigned<8>(7) == StaticUnsigned<8>(28));
+
+    char text[to_chars_max_length(300)];
+    const auto written = to_chars(text, text + sizeof(text), u);
+    Unsigned v(300);
+    check(from_chars(text, written.ptr, v).ec == std::errc());
+    check(v == u);
+
+    LogicBus bus(8, 2);
+    bus.drive(0, "0000ZZZZ"_lv);
+    bus.drive(1, "ZZZZ1111"_lv);
+    check(bus.value() == "00001111"_lv);
+
+    return failures;
+}
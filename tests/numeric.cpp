@@ -0,0 +1,378 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include "u128.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using namespace hdltypes;
+
+namespace {
+
+const std::size_t widths[] = { 1, 7, 63, 64, 65, 100, 127, 128 };
+
+}
+
+TEST_CASE("Unsigned construction", "[numeric]")
+{
+    REQUIRE(Unsigned().width() == 0);
+    REQUIRE(to_integer(Unsigned()) == 0);
+
+    const Unsigned a(8, 200);
+    REQUIRE(a.width() == 8);
+    REQUIRE(a.limbs() == 1);
+    REQUIRE(to_integer(a) == 200);
+    REQUIRE_THROWS_AS(Unsigned(8, 256), std::out_of_range);
+    REQUIRE_THROWS_AS(Unsigned(0, 1), std::out_of_range);
+    REQUIRE(to_integer(Unsigned(64, ~0ull)) == ~0ull);
+
+    Unsigned b(200);
+    REQUIRE(b.limbs() == 4);
+    b.set_limb(3, ~0ull);
+    REQUIRE(b.limb(3) == 0xFF);
+    REQUIRE_THROWS_AS(to_integer(b), std::out_of_range);
+}
+
+TEST_CASE("Signed construction", "[numeric]")
+{
+    REQUIRE(Signed().width() == 0);
+    REQUIRE(to_integer(Signed(8, -128)) == -128);
+    REQUIRE(to_integer(Signed(8, 127)) == 127);
+    REQUIRE_THROWS_AS(Signed(8, 128), std::out_of_range);
+    REQUIRE_THROWS_AS(Signed(8, -129), std::out_of_range);
+    REQUIRE(to_integer(Signed(200, -5)) == -5);
+    REQUIRE(Signed(200, -1).limb(3) == ~0ull);
+
+    Signed c(4);
+    c.set_limb(0, 0xA);
+    REQUIRE(to_integer(c) == -6);
+    REQUIRE(to_integer(to_unsigned(c)) == 0xA);
+    REQUIRE(to_integer(to_signed(Unsigned(4, 0xF))) == -1);
+}
+
+TEST_CASE("Unsigned and Signed copies", "[numeric]")
+{
+    Unsigned a(300, 12345);
+    Unsigned b(a);
+    REQUIRE(b == a);
+    b += 1u;
+    REQUIRE(b != a);
+    Unsigned c;
+    c = b;
+    REQUIRE(c == b);
+    c = a;
+    REQUIRE(c == a);
+    Unsigned d(std::move(c));
+    REQUIRE(d == a);
+    c = Unsigned(8, 3);
+    REQUIRE(to_integer(c) == 3);
+    d = std::move(c);
+    REQUIRE(to_integer(d) == 3);
+}
+
+TEST_CASE("Unsigned arithmetic matches integers", "[numeric]")
+{
+    u128 state = 1;
+    for (const auto wa : widths) {
+        for (const auto wb : widths) {
+            for (int trial = 0; trial < 20; ++trial) {
+                const u128 x = next(state) & mask(wa);
+                const u128 y = next(state) & mask(wb);
+                const auto a = make<Unsigned>(wa, x);
+                const auto b = make<Unsigned>(wb, y);
+                const std::size_t w = (wa > wb) ? wa : wb;
+
+                REQUIRE(value(a + b) == ((x + y) & mask(w)));
+                REQUIRE((a + b).width() == w);
+                REQUIRE(value(a - b) == ((x - y) & mask(w)));
+                REQUIRE(value(a + uint64_t(y)) == ((x + uint64_t(y)) & mask(wa)));
+                REQUIRE(value(a - uint64_t(y)) == ((x - uint64_t(y)) & mask(wa)));
+
+                auto c = a;
+                c += b;
+                REQUIRE(value(c) == ((x + y) & mask(wa)));
+                c -= b;
+                REQUIRE(c == a);
+
+                REQUIRE((a == b) == (x == y));
+                REQUIRE((a < b) == (x < y));
+                REQUIRE((a >= b) == (x >= y));
+                REQUIRE((a < uint64_t(y)) == (x < uint64_t(y)));
+                REQUIRE(value(resize(a, wb)) == (x & mask(wb)));
+            }
+        }
+    }
+}
+
+TEST_CASE("Signed arithmetic matches integers", "[numeric]")
+{
+    u128 state = 2;
+    for (const auto wa : widths) {
+        for (const auto wb : widths) {
+            for (int trial = 0; trial < 20; ++trial) {
+                const s128 x = sext(next(state), wa);
+                const s128 y = sext(next(state), wb);
+                const auto a = make<Signed>(wa, u128(x));
+                const auto b = make<Signed>(wb, u128(y));
+                const std::size_t w = (wa > wb) ? wa : wb;
+
+                REQUIRE(svalue(a + b) == sext(u128(x) + u128(y), w));
+                REQUIRE(svalue(a - b) == sext(u128(x) - u128(y), w));
+                REQUIRE(svalue(-a) == sext(0 - u128(x), wa));
+                REQUIRE(svalue(abs(a)) == sext((x < 0) ? 0 - u128(x) : u128(x), wa));
+                REQUIRE(svalue(a + int64_t(y)) == sext(u128(x) + u128(int64_t(y)), wa));
+
+                REQUIRE((a == b) == (x == y));
+                REQUIRE((a < b) == (x < y));
+                REQUIRE((a > int64_t(y)) == (x > int64_t(y)));
+            }
+        }
+    }
+}
+
+TEST_CASE("Resize", "[numeric]")
+{
+    REQUIRE(to_integer(resize(Unsigned(8, 0xAB), 4)) == 0xB);
+    REQUIRE(to_integer(resize(Unsigned(8, 0xAB), 200)) == 0xAB);
+    REQUIRE(to_integer(resize(Signed(8, -3), 200)) == -3);
+    REQUIRE(to_integer(resize(Signed(8, -3), 4)) == -3);
+    // narrowing keeps the sign bit
+    REQUIRE(to_integer(resize(Signed(8, -100), 4)) == -4);
+    REQUIRE(to_integer(resize(Signed(8, 100), 4)) == 4);
+    REQUIRE(to_integer(resize(Signed(200, -100), 4)) == -4);
+}
+
+TEST_CASE("Wide carries", "[numeric]")
+{
+    Unsigned a(200);
+    for (std::size_t i = 0; i < a.limbs(); ++i) {
+        a.set_limb(i, ~0ull);
+    }
+    const Unsigned one(1, 1);
+    REQUIRE((a + one) == 0u);
+    REQUIRE((Unsigned(200) - one) == a);
+    REQUIRE(compare(a, Unsigned(300, 5)) > 0);
+    REQUIRE(Unsigned(300, 5) < a);
+
+    const Signed m(200, -1);
+    REQUIRE((m + Signed(2, 1)) == 0);
+    REQUIRE(Signed(200, -7) < Signed(3, -2));
+    REQUIRE(Signed(200, 7) > Signed(3, -2));
+}
+
+TEST_CASE("Bitwise and shifts", "[numeric]")
+{
+    REQUIRE(to_integer(Unsigned(8, 0xF0) & Unsigned(8, 0x3C)) == 0x30);
+    REQUIRE(to_integer(Unsigned(8, 0xF0) | Unsigned(8, 0x3C)) == 0xFC);
+    REQUIRE(to_integer(Unsigned(8, 0xF0) ^ Unsigned(8, 0x3C)) == 0xCC);
+    REQUIRE(to_integer(~Unsigned(8, 0xF0)) == 0x0F);
+    REQUIRE(to_integer(~Signed(8, 5)) == -6);
+    REQUIRE_THROWS_AS(Unsigned(8) & Unsigned(9), std::invalid_argument);
+
+    REQUIRE(to_integer(Unsigned(8, 0x81) << 1) == 0x02);
+    REQUIRE(to_integer(Unsigned(8, 0x81) >> 1) == 0x40);
+    REQUIRE(to_integer(Unsigned(8, 0x81) << 8) == 0);
+    REQUIRE(to_integer(Signed(8, -128) >> 3) == -16);
+    REQUIRE(to_integer(Signed(8, -128) >> 100) == -1);
+    REQUIRE(to_integer(Signed(8, 64) << 1) == -128);
+    REQUIRE(to_integer(rotate_left(Unsigned(8, 0x81), 1)) == 0x03);
+    REQUIRE(to_integer(rotate_right(Unsigned(8, 0x81), 1)) == 0xC0);
+    REQUIRE(to_integer(rotate_left(Signed(8, -127), 9)) == 3);
+
+    u128 state = 3;
+    for (const auto w : widths) {
+        const u128 x = next(state) & mask(w);
+        const auto a = make<Unsigned>(w, x);
+        for (std::size_t n = 0; n <= w; n += 5) {
+            REQUIRE(value(a << n) == ((n >= 128) ? 0 : ((x << n) & mask(w))));
+            REQUIRE(value(a >> n) == ((n >= 128) ? 0 : (x >> n)));
+            const u128 rot = (n % w == 0) ? x : (((x << (n % w)) | (x >> (w - n % w))) & mask(w));
+            REQUIRE(value(rotate_left(a, n)) == rot);
+            REQUIRE(rotate_right(rotate_left(a, n), n) == a);
+        }
+    }
+
+    Unsigned wide(200, 1);
+    wide = wide << 150;
+    REQUIRE(wide.limb(2) == (1ull << 22));
+    REQUIRE((wide >> 150) == 1u);
+}
+
+namespace {
+
+template <typename T>
+T random_value(const std::size_t width, u128& state)
+{
+    T r(width);
+    for (std::size_t i = 0; i < r.limbs(); ++i) {
+        r.set_limb(i, uint64_t(next(state)));
+    }
+    return r;
+}
+
+}
+
+TEST_CASE("Multiplication and division match integers", "[numeric]")
+{
+    u128 state = 5;
+    const std::size_t narrow[] = { 1, 7, 32, 63, 64 };
+    for (const auto wa : narrow) {
+        for (const auto wb : narrow) {
+            for (int trial = 0; trial < 20; ++trial) {
+                const u128 x = next(state) & mask(wa);
+                const u128 y = next(state) & mask(wb);
+                const auto a = make<Unsigned>(wa, x);
+                const auto b = make<Unsigned>(wb, y);
+                REQUIRE((a * b).width() == wa + wb);
+                REQUIRE(value(a * b) == x * y);
+                REQUIRE(value(a * uint64_t(y)) == x * (y & mask(wa)));
+
+                const s128 sx = sext(x, wa);
+                const s128 sy = sext(y, wb);
+                const auto c = make<Signed>(wa, u128(sx));
+                const auto d = make<Signed>(wb, u128(sy));
+                REQUIRE(svalue(c * d) == sx * sy);
+            }
+        }
+    }
+    for (const auto wa : widths) {
+        for (const auto wb : widths) {
+            for (int trial = 0; trial < 20; ++trial) {
+                const u128 x = next(state) & mask(wa);
+                const u128 y = (next(state) >> (trial % 4 * 30)) & mask(wb);
+                if (y == 0) {
+                    continue;
+                }
+                const auto a = make<Unsigned>(wa, x);
+                const auto b = make<Unsigned>(wb, y);
+                REQUIRE((a / b).width() == wa);
+                REQUIRE(value(a / b) == x / y);
+                REQUIRE((a % b).width() == wb);
+                REQUIRE(value(a % b) == x % y);
+                REQUIRE(value(mod(a, b)) == x % y);
+
+                const s128 sx = sext(x, wa);
+                const s128 sy = sext(y, wb);
+                if ((sy == 0) || (wa == 128)) {
+                    continue;
+                }
+                const auto c = make<Signed>(wa, u128(sx));
+                const auto d = make<Signed>(wb, u128(sy));
+                REQUIRE(svalue(c / d) == sext(u128(sx / sy), wa));
+                REQUIRE(svalue(c % d) == sx % sy);
+                const s128 m = ((sx % sy != 0) && ((sx < 0) != (sy < 0))) ? sx % sy + sy : sx % sy;
+                REQUIRE(svalue(mod(c, d)) == m);
+            }
+        }
+    }
+
+    REQUIRE(to_integer(Unsigned(8, 200) / 7u) == 28);
+    REQUIRE(to_integer(Unsigned(8, 200) % 7u) == 4);
+    REQUIRE(to_integer(Signed(8, -7) / 2) == -3);
+    REQUIRE(to_integer(Signed(8, -7) % 2) == -1);
+    REQUIRE(to_integer(mod(Signed(8, -7), 2)) == 1);
+    REQUIRE(to_integer(mod(Signed(8, 7), Signed(4, -2))) == -1);
+    REQUIRE(to_integer(Signed(8, -128) / Signed(8, -1)) == -128);
+    REQUIRE_THROWS_AS(Unsigned(8, 1) / Unsigned(8), std::domain_error);
+    REQUIRE_THROWS_AS(Unsigned(8, 1) % 0u, std::domain_error);
+    REQUIRE_THROWS_AS(Signed(8, 1) / 0, std::domain_error);
+
+    // integer divisors wider than the array are not wrapped, like numeric_std
+    REQUIRE(to_integer(Unsigned(4, 5) / 21u) == 0);
+    REQUIRE(to_integer(Unsigned(4, 5) % 21u) == 5);
+    REQUIRE(to_integer(mod(Unsigned(4, 5), 21u)) == 5);
+    REQUIRE(to_integer(Unsigned(8, 200) / 256u) == 0);
+    REQUIRE(to_integer(Unsigned(8, 200) % 256u) == 200);
+    REQUIRE((Unsigned(8, 200) / 256u).width() == 8);
+    REQUIRE(to_integer(Unsigned(70, 1) / ~0ull) == 0);
+    REQUIRE(to_integer(Signed(4, -5) / 21) == 0);
+    REQUIRE(to_integer(Signed(4, -5) % 21) == -5);
+    REQUIRE(to_integer(Signed(4, 5) / -8) == 0);
+    REQUIRE(to_integer(Signed(4, -8) / 8) == 0);
+    REQUIRE(to_integer(Signed(4, -8) / -8) == 1);
+    REQUIRE(to_integer(Signed(4, -8) / 7) == -1);
+    REQUIRE(to_integer(Signed(4, 7) % -8) == 7);
+    REQUIRE((Signed(4, -5) % 21).width() == 4);
+    // the modulus has the sign of the divisor and is resized like numeric_std, keeping the sign bit
+    REQUIRE(to_integer(mod(Signed(4, -1), 100)) == 3);
+    REQUIRE(to_integer(mod(Signed(4, 1), -100)) == -3);
+    REQUIRE(to_integer(mod(Signed(8, -7), 200)) == 65);
+    REQUIRE_THROWS_AS(Signed(300, 1) % Signed(300), std::domain_error);
+}
+
+TEST_CASE("Wide multiplication and division", "[numeric]")
+{
+    u128 state = 6;
+    const std::size_t wide[] = { 130, 256, 1000, 2048, 2100, 4096, 6000 };
+    for (const auto wa : wide) {
+        for (const auto wb : wide) {
+            const auto a = random_value<Unsigned>(wa, state);
+            const auto b = random_value<Unsigned>(wb, state);
+            const auto d = random_value<Unsigned>(wb, state) % b;
+
+            // the quotient and remainder recover both operands
+            const auto p = a * b + d;
+            REQUIRE(p.width() == wa + wb);
+            REQUIRE((p / b) == a);
+            REQUIRE((p % b) == d);
+
+            const auto q = a / b;
+            const auto r = a % b;
+            REQUIRE(r < b);
+            REQUIRE((q * b + r) == a);
+
+            // matches the schoolbook product
+            std::vector<uint64_t> expected(a.limbs() + b.limbs());
+            limbs::multiply_schoolbook(expected.data(), a.data(), a.limbs(), b.data(), b.limbs());
+            const auto product = a * b;
+            for (std::size_t i = 0; i < product.limbs(); ++i) {
+                REQUIRE(product.limb(i) == expected[i]);
+            }
+        }
+    }
+
+    const auto a = to_signed(random_value<Unsigned>(3000, state));
+    const auto b = to_signed(random_value<Unsigned>(2000, state));
+    REQUIRE(((a * b) / b) == a);
+    REQUIRE(((-a) * b) == -(a * b));
+    REQUIRE(((a * b) % b) == 0);
+    // a remainder with the sign of the dividend, and a modulus with the sign of the divisor
+    const Signed one = (a * b < 0) ? Signed(2, -1) : Signed(2, 1);
+    REQUIRE(((a * b + one) / b) == a);
+    REQUIRE(((a * b + one) % b) == one);
+    REQUIRE(mod(a * b + one, b) == (((one < 0) == (b < 0)) ? resize(one, b.width()) : (one + b)));
+}
+
+TEST_CASE("Montgomery", "[numeric]")
+{
+    REQUIRE_THROWS_AS(Montgomery(Unsigned(8, 10)), std::invalid_argument);
+    REQUIRE_THROWS_AS(Montgomery(Unsigned()), std::invalid_argument);
+
+    // p = 2^255 - 19 is prime, so a^(p-1) = 1 mod p
+    Unsigned p(255);
+    for (std::size_t i = 0; i < p.limbs(); ++i) {
+        p.set_limb(i, ~0ull);
+    }
+    p -= 18u;
+    const Montgomery ctx(p);
+    REQUIRE(ctx.modulus() == p);
+
+    u128 state = 7;
+    for (int trial = 0; trial < 5; ++trial) {
+        const auto a = random_value<Unsigned>(300, state);
+        const auto b = random_value<Unsigned>(200, state);
+        REQUIRE(ctx.mod_pow(a, p - 1u) == ((a % p == 0) ? 0u : 1u));
+        REQUIRE(ctx.mod_multiply(a, b) == ((a * b) % p));
+        REQUIRE(ctx.from_montgomery(ctx.to_montgomery(a)) == (a % p));
+        REQUIRE(ctx.from_montgomery(ctx.multiply(ctx.to_montgomery(a), ctx.to_montgomery(b))) == ((a * b) % p));
+    }
+
+    // small odd modulus against repeated multiplication
+    const Montgomery small(Unsigned(10, 1001));
+    Unsigned x(10, 1);
+    for (unsigned e = 0; e < 40; ++e) {
+        REQUIRE(small.mod_pow(Unsigned(10, 123), Unsigned(8, e)) == x);
+        x = resize((x * 123u) % 1001u, 10);
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef HDLTYPES_TESTS_RANDOM_HPP
+#define HDLTYPES_TESTS_RANDOM_HPP
+
+#include <hdltypes.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+/** The 9 Logic values, in the order of Logic::value_type. */
+const hdltypes::Logic logic_values[9] = {
+    hdltypes::to_logic('U'), hdltypes::to_logic('X'), hdltypes::to_logic('0'),
+    hdltypes::to_logic('1'), hdltypes::to_logic('Z'), hdltypes::to_logic('W'),
+    hdltypes::to_logic('L'), hdltypes::to_logic('H'), hdltypes::to_logic('-')
+};
+
+/** The next value of a xorshift generator; `state` must not be 0. */
+inline uint64_t next_random(uint64_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+/** A LogicVector of random elements with the given bounds. */
+inline hdltypes::LogicVector random_logic_vector(const hdltypes::Bounds bounds, uint64_t& state, const bool only01 = false)
+{
+    hdltypes::LogicVector r(bounds);
+    for (std::size_t i = 0; i < bounds.length(); ++i) {
+        const auto v = next_random(state);
+        r.set(bounds.index(i), only01 ? logic_values[2 + (v & 1)] : logic_values[v % 9]);
+    }
+    return r;
+}
+
+/** A LogicVector of random elements with the bounds `0 to length-1`. */
+inline hdltypes::LogicVector random_logic_vector(const std::size_t length, uint64_t& state, const bool only01 = false)
+{
+    return random_logic_vector(hdltypes::to(0, hdltypes::Bounds::index_type(length) - 1), state, only01);
+}
+
+#endif
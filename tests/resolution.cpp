@@ -0,0 +1,151 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include "random.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using namespace hdltypes;
+
+namespace {
+
+/** Random values, mostly `Z` like the drivers of a bus. */
+LogicVector random_driver(const std::size_t length, uint64_t& state)
+{
+    LogicVector r(length, 'Z'_l);
+    for (std::size_t i = 0; i < length; ++i) {
+        const uint64_t v = next_random(state) % 16;
+        if (v < 9) {
+            r.set(r.bounds().index(i), logic_values[v]);
+        }
+    }
+    return r;
+}
+
+/** Element-wise fold of the drivers with the scalar resolution. */
+LogicVector reference_resolve(const std::vector<LogicVector>& drivers, const std::size_t length)
+{
+    LogicVector r(length);
+    for (std::size_t i = 0; i < length; ++i) {
+        std::vector<Logic> d;
+        for (const auto& v : drivers) {
+            d.push_back(v[v.bounds().index(i)]);
+        }
+        r.set(r.bounds().index(i), resolve(d.data(), d.size()));
+    }
+    return r;
+}
+
+}
+
+TEST_CASE("Logic resolution", "[resolution]")
+{
+    REQUIRE(resolve('0'_l, '1'_l) == 'X'_l);
+    REQUIRE(resolve('0'_l, 'H'_l) == '0'_l);
+    REQUIRE(resolve('L'_l, 'H'_l) == 'W'_l);
+    REQUIRE(resolve('Z'_l, 'H'_l) == 'H'_l);
+    REQUIRE(resolve('-'_l, 'Z'_l) == 'X'_l);
+    REQUIRE(resolve('X'_l, 'U'_l) == 'U'_l);
+
+    for (const auto a : logic_values) {
+        REQUIRE(resolve(a, 'Z'_l) == ((a == '-'_l) ? 'X'_l : a));
+        for (const auto b : logic_values) {
+            REQUIRE(resolve(a, b) == resolve(b, a));
+            for (const auto c : logic_values) {
+                REQUIRE(resolve(resolve(a, b), c) == resolve(a, resolve(b, c)));
+            }
+        }
+    }
+
+    const Logic drivers[] = { 'Z'_l, 'L'_l, 'Z'_l, '1'_l };
+    REQUIRE(resolve(drivers, 0) == 'Z'_l);
+    REQUIRE(resolve(drivers, 1) == 'Z'_l);
+    REQUIRE(resolve(drivers, 3) == 'L'_l);
+    REQUIRE(resolve(drivers, 4) == '1'_l);
+}
+
+TEST_CASE("LogicWord resolution matches Logic resolution", "[resolution]")
+{
+    packed::LogicWord a {}, b {};
+    for (std::size_t i = 0; i < 64; ++i) {
+        packed::set(a, i, logic_values[(i / 9) % 9]);
+        packed::set(b, i, logic_values[i % 9]);
+    }
+    const auto r = packed::resolve(a, b);
+    for (std::size_t i = 0; i < 64; ++i) {
+        REQUIRE(packed::get(r, i) == resolve(packed::get(a, i), packed::get(b, i)));
+    }
+
+    for (const auto v : logic_values) {
+        REQUIRE(packed::get(packed::resolve(packed::drive(packed::broadcast(v))), 5) == resolve(v, 'Z'_l));
+    }
+    REQUIRE(packed::resolve(packed::DriveWord {}) == packed::broadcast('Z'_l));
+}
+
+TEST_CASE("LogicVector resolution", "[resolution]")
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (const std::size_t length : { 0u, 1u, 64u, 130u }) {
+        for (const std::size_t n : { 0u, 1u, 2u, 5u, 40u }) {
+            std::vector<LogicVector> drivers;
+            for (std::size_t i = 0; i < n; ++i) {
+                drivers.push_back(random_driver(length, state));
+            }
+            LogicVector r(length);
+            resolve(r, drivers.data(), drivers.size());
+            REQUIRE(r == reference_resolve(drivers, length));
+        }
+    }
+
+    LogicVector r(8);
+    const LogicVector drivers[] = { LogicVector(8), LogicVector(9) };
+    REQUIRE_THROWS(resolve(r, drivers, 2));
+}
+
+TEST_CASE("LogicBus", "[resolution]")
+{
+    LogicBus bus(to(0, 99), 24);
+    REQUIRE(bus.bounds() == to(0, 99));
+    REQUIRE(bus.length() == 100);
+    REQUIRE(bus.drivers() == 24);
+    REQUIRE(bus.value() == LogicVector(100, 'Z'_l));
+    REQUIRE(bus.driver(23) == LogicVector(100, 'Z'_l));
+
+    bus.drive(3, LogicVector(100, 'H'_l));
+    REQUIRE(bus.value() == LogicVector(100, 'H'_l));
+    bus.drive(7, LogicVector(100, '0'_l));
+    REQUIRE(bus.value() == LogicVector(100, '0'_l));
+    bus.release(7);
+    REQUIRE(bus.value() == LogicVector(100, 'H'_l));
+    REQUIRE(bus.value().bounds() == to(0, 99));
+
+    // a new value of the same strengths is still stored
+    bus.drive(5, LogicVector(100, 'X'_l));
+    bus.drive(5, LogicVector(100, '-'_l));
+    REQUIRE(bus.driver(5) == LogicVector(100, '-'_l));
+    REQUIRE(bus.value() == LogicVector(100, 'X'_l));
+    bus.release(5);
+    REQUIRE(bus.value() == LogicVector(100, 'H'_l));
+
+    // every change re-resolved incrementally matches resolving all drivers
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    std::vector<LogicVector> drivers(bus.drivers(), LogicVector(100, 'Z'_l));
+    drivers[3] = LogicVector(100, 'H'_l);
+    for (int i = 0; i < 300; ++i) {
+        const std::size_t n = next_random(state) % bus.drivers();
+        if (next_random(state) % 4 == 0) {
+            bus.release(n);
+            drivers[n] = LogicVector(100, 'Z'_l);
+        } else {
+            drivers[n] = random_driver(100, state);
+            bus.drive(n, drivers[n]);
+        }
+        REQUIRE(bus.driver(n) == drivers[n]);
+        REQUIRE(bus.value() == reference_resolve(drivers, 100));
+    }
+
+    REQUIRE_THROWS(bus.driver(24));
+    REQUIRE_THROWS(bus.drive(24, LogicVector(100)));
+    REQUIRE_THROWS(bus.drive(0, LogicVector(99)));
+    REQUIRE(LogicBus().drivers() == 0);
+}
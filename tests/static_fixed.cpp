@@ -0,0 +1,203 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include "random.hpp"
+#include "u128.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+using namespace hdltypes;
+
+namespace {
+
+/** Integer with random bits; the limb setters mask or sign-extend to the width. */
+template <typename I>
+I random_integer(uint64_t& state)
+{
+    I r;
+    for (std::size_t i = 0; i < I::limbs(); ++i) {
+        r.set_limb(i, next_random(state));
+    }
+    return r;
+}
+
+/** Value of the bits of a fixed point number, which must be at most 127 bits wide. */
+template <typename F>
+s128 scaled(const F& a)
+{
+    u128 v = 0;
+    for (std::size_t i = 0; i < F::integer_type::limbs(); ++i) {
+        v |= u128(a.bits().limb(i)) << (64 * i);
+    }
+    const std::size_t w = F::width();
+    const bool is_signed = std::is_same<typename F::integer_type, StaticSigned<F::integer_type::width()>>::value;
+    const u128 m = (u128(1) << w) - 1;
+    if (!is_signed) {
+        return s128(v & m);
+    }
+    const u128 sign = u128(1) << (w - 1);
+    return s128(((v & m) ^ sign) - sign);
+}
+
+/** resize computed with plain integer arithmetic. */
+s128 reference_resize(s128 v, const int right, const int left2, const int right2, const bool is_signed, const FixedOverflow overflow, const FixedRound round)
+{
+    if (right2 <= right) {
+        v = v * (s128(1) << (right - right2));
+    } else {
+        const int s = right2 - right;
+        s128 q = v >> s;
+        const s128 rem = v - q * (s128(1) << s);
+        if (round == FixedRound::round) {
+            const s128 half = s128(1) << (s - 1);
+            if ((rem > half) || ((rem == half) && ((q & 1) != 0))) {
+                ++q;
+            }
+        }
+        v = q;
+    }
+    const int w = left2 - right2 + 1;
+    const s128 lo = is_signed ? -(s128(1) << (w - 1)) : 0;
+    const s128 hi = is_signed ? (s128(1) << (w - 1)) - 1 : (s128(1) << w) - 1;
+    if (overflow == FixedOverflow::saturate) {
+        return (v < lo) ? lo : (v > hi) ? hi : v;
+    }
+    const u128 m = (u128(1) << w) - 1;
+    const u128 wrapped = u128(v) & m;
+    return (is_signed && (wrapped >> (w - 1)) != 0) ? s128(wrapped) - s128(m) - 1 : s128(wrapped);
+}
+
+template <typename F, int L2, int R2>
+void check_resize(uint64_t& state)
+{
+    const bool is_signed = std::is_same<F, StaticSfixed<F::left(), F::right()>>::value;
+    for (int i = 0; i < 200; ++i) {
+        const auto a = F::from_bits(random_integer<typename F::integer_type>(state));
+        for (const auto overflow : { FixedOverflow::saturate, FixedOverflow::wrap }) {
+            for (const auto round : { FixedRound::round, FixedRound::truncate }) {
+                const auto r = resize<L2, R2>(a, overflow, round);
+                REQUIRE(r.left() == L2);
+                REQUIRE(r.right() == R2);
+                REQUIRE(scaled(r) == reference_resize(scaled(a), F::right(), L2, R2, is_signed, overflow, round));
+            }
+        }
+    }
+}
+
+}
+
+TEST_CASE("StaticFixed bounds", "[static_fixed]")
+{
+    using U = StaticUfixed<3, -4>;
+    using S = StaticSfixed<3, -4>;
+    static_assert(U::width() == 8, "");
+    static_assert(sizeof(StaticUfixed<7, -56>) == sizeof(uint64_t), "fits a native integer");
+    static_assert(std::is_same<decltype(U() + StaticUfixed<5, 0>()), StaticUfixed<6, -4>>::value, "");
+    static_assert(std::is_same<decltype(U() - StaticUfixed<1, -6>()), StaticUfixed<4, -6>>::value, "");
+    static_assert(std::is_same<decltype(U() * StaticUfixed<5, -2>()), StaticUfixed<9, -6>>::value, "");
+    static_assert(std::is_same<decltype(S() * S()), StaticSfixed<7, -8>>::value, "");
+    static_assert(std::is_same<decltype(-S()), StaticSfixed<4, -4>>::value, "");
+    static_assert(std::is_same<decltype(abs(S())), StaticSfixed<4, -4>>::value, "");
+    static_assert(std::is_same<decltype(to_sfixed(U())), StaticSfixed<4, -4>>::value, "");
+
+    // fractions only, and integers scaled up
+    static_assert(StaticUfixed<-2, -5>::width() == 4, "");
+    static_assert(StaticSfixed<8, 4>::width() == 5, "");
+}
+
+TEST_CASE("StaticFixed real conversion", "[static_fixed]")
+{
+    REQUIRE(to_real(StaticUfixed<3, -4>(2.75)) == 2.75);
+    REQUIRE(to_integer(StaticUfixed<3, -4>(2.75).bits()) == 44);
+    REQUIRE(to_real(StaticSfixed<3, -4>(-2.75)) == -2.75);
+    REQUIRE(to_real(StaticSfixed<8, 4>(-48.0)) == -48.0);
+
+    // ties round to even
+    REQUIRE(to_real(StaticUfixed<3, 0>(2.5)) == 2.0);
+    REQUIRE(to_real(StaticUfixed<3, 0>(3.5)) == 4.0);
+    REQUIRE(to_real(StaticSfixed<3, 0>(-2.5)) == -2.0);
+    REQUIRE(to_real(StaticSfixed<3, -1>(0.3)) == 0.5);
+
+    // saturation and NaN
+    REQUIRE(to_real(StaticUfixed<3, -4>(100.0)) == 15.9375);
+    REQUIRE(to_real(StaticUfixed<3, -4>(-1.0)) == 0.0);
+    REQUIRE(to_real(StaticSfixed<3, -4>(100.0)) == 7.9375);
+    REQUIRE(to_real(StaticSfixed<3, -4>(-100.0)) == -8.0);
+    REQUIRE(to_real(StaticSfixed<3, -4>(-8.0)) == -8.0);
+    REQUIRE(to_real(StaticSfixed<3, -4>(std::nan(""))) == 0.0);
+
+    // values held in several limbs
+    REQUIRE(to_real(StaticUfixed<100, -100>(std::ldexp(1.0, 90) + 0.5)) == std::ldexp(1.0, 90));
+    REQUIRE(to_real(StaticSfixed<100, -100>(-std::ldexp(3.0, -99))) == -std::ldexp(3.0, -99));
+    REQUIRE(to_real(StaticSfixed<100, -100>(-std::ldexp(1.0, 200))) == -std::ldexp(1.0, 100));
+}
+
+TEST_CASE("StaticFixed arithmetic", "[static_fixed]")
+{
+    constexpr auto a = StaticUfixed<3, -2>::from_bits(StaticUnsigned<6>(0x3F)); // 15.75
+    constexpr auto b = StaticUfixed<1, -4>::from_bits(StaticUnsigned<6>(0x01)); // 0.0625
+    constexpr auto sum = a + b;
+    static_assert(to_integer(sum.bits()) == 0x3F * 4 + 1, "exact sum");
+    REQUIRE(to_real(sum) == 15.8125);
+    REQUIRE(to_real(b - a) == 32.0 - 15.6875); // wraps like fixed_pkg
+    REQUIRE(to_real(a * b) == 15.75 * 0.0625);
+
+    const StaticSfixed<3, -2> c(-8.0);
+    const StaticSfixed<0, -3> d(0.375);
+    REQUIRE(to_real(c + d) == -7.625);
+    REQUIRE(to_real(d - c) == 8.375);
+    REQUIRE(to_real(c * c) == 64.0);
+    REQUIRE(to_real(c * d) == -3.0);
+    REQUIRE(to_real(-c) == 8.0);
+    REQUIRE(to_real(abs(c)) == 8.0);
+    REQUIRE(to_real(to_sfixed(a)) == 15.75);
+
+    const StaticSfixed<70, -70> e(-std::ldexp(1.0, 69));
+    const StaticSfixed<70, -70> f(std::ldexp(1.0, -70));
+    REQUIRE(to_real(e * e) == std::ldexp(1.0, 138));
+    REQUIRE((e + f) - e == f);
+    REQUIRE(-(e - f) == abs(e) + f);
+}
+
+TEST_CASE("StaticFixed comparison", "[static_fixed]")
+{
+    static_assert(StaticUfixed<3, -2>::from_bits(StaticUnsigned<6>(4)) == StaticUfixed<0, -4>::from_bits(StaticUnsigned<5>(16)), "1.0 == 1.0");
+    REQUIRE(StaticSfixed<3, -2>(-1.5) < StaticSfixed<0, -4>(-0.25));
+    REQUIRE(StaticSfixed<3, -2>(2.0) > StaticSfixed<0, -4>(0.75));
+    REQUIRE(StaticSfixed<3, -2>(-1.5) == StaticSfixed<6, -8>(-1.5));
+    REQUIRE(StaticUfixed<3, -2>(1.5) != StaticUfixed<6, -8>(1.5078125));
+    REQUIRE(StaticUfixed<3, -2>(1.5) <= StaticUfixed<6, -8>(1.5));
+    REQUIRE(StaticUfixed<3, -2>(1.5) >= StaticUfixed<6, -8>(1.5));
+    REQUIRE(compare(StaticUfixed<8, 4>(16.0), StaticUfixed<0, 0>(1.0)) > 0);
+}
+
+TEST_CASE("StaticFixed resize", "[static_fixed]")
+{
+    REQUIRE(to_real(resize<3, 0>(StaticUfixed<3, -2>(2.5))) == 2.0);
+    REQUIRE(to_real(resize<3, 0>(StaticUfixed<3, -2>(3.5))) == 4.0);
+    REQUIRE(to_real(resize<3, 0>(StaticUfixed<3, -2>(2.75), FixedOverflow::saturate, FixedRound::truncate)) == 2.0);
+    REQUIRE(to_real(resize<3, 0>(StaticSfixed<3, -2>(-2.5))) == -2.0);
+    REQUIRE(to_real(resize<3, 0>(StaticSfixed<3, -2>(-3.5))) == -4.0);
+    REQUIRE(to_real(resize<3, 0>(StaticSfixed<3, -2>(-2.25), FixedOverflow::saturate, FixedRound::truncate)) == -3.0);
+    REQUIRE(to_real(resize<1, 0>(StaticUfixed<3, -2>(7.5))) == 3.0);
+    REQUIRE(to_real(resize<1, 0>(StaticUfixed<3, -2>(7.5), FixedOverflow::wrap)) == 0.0);
+    REQUIRE(to_real(resize<1, -1>(StaticSfixed<3, -2>(-7.5))) == -2.0);
+    REQUIRE(to_real(resize<1, -1>(StaticSfixed<3, -2>(5.5), FixedOverflow::wrap)) == 1.5);
+    // rounding can carry into a bit that overflows
+    REQUIRE(to_real(resize<1, 0>(StaticSfixed<3, -2>(1.75))) == 1.0);
+    REQUIRE(to_real(resize<1, 0>(StaticSfixed<3, -2>(1.75), FixedOverflow::wrap)) == -2.0);
+
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    check_resize<StaticUfixed<7, -8>, 3, -2>(state);
+    check_resize<StaticUfixed<7, -8>, 10, 0>(state);
+    check_resize<StaticUfixed<7, -8>, 7, -8>(state);
+    check_resize<StaticUfixed<7, -8>, -3, -12>(state);
+    check_resize<StaticUfixed<60, -60>, 20, -3>(state);
+    check_resize<StaticSfixed<7, -8>, 3, -2>(state);
+    check_resize<StaticSfixed<7, -8>, 10, 0>(state);
+    check_resize<StaticSfixed<7, -8>, 7, -8>(state);
+    check_resize<StaticSfixed<7, -8>, -3, -12>(state);
+    check_resize<StaticSfixed<60, -60>, 20, -3>(state);
+    check_resize<StaticSfixed<30, 0>, 62, 1>(state);
+}
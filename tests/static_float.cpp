@@ -0,0 +1,203 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include "random.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+using namespace hdltypes;
+
+namespace {
+
+using Binary16 = StaticFloat<5, 10>;
+using Binary32 = StaticFloat<8, 23>;
+using Binary64 = StaticFloat<11, 52>;
+using Binary128 = StaticFloat<15, 112>;
+using Bfloat16 = StaticFloat<8, 7>;
+
+double from_bits(const uint64_t a)
+{
+    double r;
+    std::memcpy(&r, &a, sizeof(r));
+    return r;
+}
+
+/** Equality of reals where NaN is equal to NaN. */
+bool same_real(const double a, const double b)
+{
+    return (std::isnan(a) && std::isnan(b)) || (a == b);
+}
+
+/** Random bits of a format; every other value has the exponent of the previous one, so differences cancel. */
+template <typename F>
+typename F::bits_type random_bits(uint64_t& state, const typename F::bits_type& previous)
+{
+    constexpr std::size_t W = F::width();
+    const uint64_t m = (W == 64) ? ~uint64_t(0) : ((uint64_t(1) << W) - 1);
+    const uint64_t v = next_random(state) & m;
+    if ((state & 1) != 0) {
+        const uint64_t e = ((uint64_t(1) << F::exponent_width()) - 1) << F::fraction_width();
+        return typename F::bits_type((v & ~e) | (to_integer(previous) & e));
+    }
+    return typename F::bits_type(v);
+}
+
+/** Checks that the arithmetic of a format gives the same bits as the soft floating point engine. */
+template <typename F>
+void check_against_soft(const F& a, const F& b)
+{
+    constexpr std::size_t E = F::exponent_width();
+    constexpr std::size_t M = F::fraction_width();
+    REQUIRE((a + b).bits() == detail::soft_add<E, M>(a.bits(), b.bits()));
+    REQUIRE((a - b).bits() == detail::soft_subtract<E, M>(a.bits(), b.bits()));
+    REQUIRE((a * b).bits() == detail::soft_multiply<E, M>(a.bits(), b.bits()));
+    REQUIRE((a / b).bits() == detail::soft_divide<E, M>(a.bits(), b.bits()));
+}
+
+template <typename F>
+void check_all_against_soft()
+{
+    for (uint64_t x = 0; x < (uint64_t(1) << F::width()); ++x) {
+        for (uint64_t y = 0; y < (uint64_t(1) << F::width()); ++y) {
+            check_against_soft(F::from_bits(typename F::bits_type(x)), F::from_bits(typename F::bits_type(y)));
+        }
+    }
+}
+
+template <typename F>
+void check_random_against_soft(uint64_t& state)
+{
+    typename F::bits_type x;
+    for (int i = 0; i < 20000; ++i) {
+        x = random_bits<F>(state, x);
+        const auto y = random_bits<F>(state, x);
+        check_against_soft(F::from_bits(x), F::from_bits(y));
+    }
+}
+
+}
+
+TEST_CASE("StaticFloat formats", "[static_float]")
+{
+    static_assert(Binary32::width() == 32 && Binary32::bias() == 127, "");
+    static_assert(Binary16::width() == 16 && Binary16::bias() == 15, "");
+    static_assert(Bfloat16::exponent_width() == 8 && Bfloat16::fraction_width() == 7, "");
+    static_assert(Binary32::is_native() && Binary64::is_native(), "");
+    static_assert(Binary16::is_native() && Bfloat16::is_native(), "");
+    static_assert(StaticFloat<4, 3>::is_native() && StaticFloat<5, 2>::is_native(), "");
+    static_assert(StaticFloat<9, 20>::is_native(), "");
+    static_assert(!StaticFloat<8, 30>::is_native(), "more than 24 fraction bits");
+    static_assert(!StaticFloat<11, 20>::is_native(), "products underflow double");
+    static_assert(!Binary128::is_native(), "");
+}
+
+TEST_CASE("StaticFloat real conversion", "[static_float]")
+{
+    REQUIRE(to_real(Bfloat16(3.14159)) == 3.140625);
+    REQUIRE(to_integer(Bfloat16(1.0).bits()) == 0x3F80);
+    REQUIRE(to_integer(Binary16(-2.0).bits()) == 0xC000);
+    REQUIRE(to_real(Binary32(0.1)) == double(0.1f));
+    REQUIRE(to_real(Binary64(0.1)) == 0.1);
+    REQUIRE(to_real(Binary128(0.1)) == 0.1);
+
+    // ties round to even, also at the largest value and below the smallest subnormal
+    REQUIRE(to_real(Binary16(2049.0)) == 2048.0);
+    REQUIRE(to_real(Binary16(2051.0)) == 2052.0);
+    REQUIRE(to_real(Binary16(65504.0)) == 65504.0);
+    REQUIRE(isinf(Binary16(65520.0)));
+    REQUIRE(to_real(Binary16(65519.0)) == 65504.0);
+    REQUIRE(to_real(Binary16(std::ldexp(1.0, -24))) == std::ldexp(1.0, -24));
+    REQUIRE(to_real(Binary16(std::ldexp(1.0, -25))) == 0.0);
+    REQUIRE(to_real(Binary16(std::ldexp(3.0, -26))) == std::ldexp(1.0, -24));
+    REQUIRE(to_real(Binary16(std::ldexp(1023.5, -24))) == std::ldexp(1.0, -14));
+    REQUIRE(signbit(Binary16(-std::ldexp(1.0, -30))));
+    REQUIRE(to_real(StaticFloat<11, 20>(from_bits(1))) == 0.0);
+
+    // special values
+    REQUIRE(isinf(Bfloat16(std::numeric_limits<double>::infinity())));
+    REQUIRE(signbit(Bfloat16(-std::numeric_limits<double>::infinity())));
+    REQUIRE(isnan(Bfloat16(std::nan(""))));
+    REQUIRE(Bfloat16(-std::nan("")).bits() == Bfloat16::nan().bits());
+    REQUIRE(std::isnan(to_real(Binary128::nan())));
+    REQUIRE(to_real(Binary128::infinity()) == std::numeric_limits<double>::infinity());
+    REQUIRE(to_real(-Binary128(1e300) * Binary128(1e300)) == -std::numeric_limits<double>::infinity());
+}
+
+TEST_CASE("StaticFloat resize", "[static_float]")
+{
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    for (int i = 0; i < 10000; ++i) {
+        const double x = from_bits(next_random(state) & 0xBFFFFFFFFFFFFFFFULL);
+        REQUIRE(resize<8, 7>(Binary32(x)).bits() == Bfloat16(double(float(x))).bits());
+        REQUIRE(resize<11, 52>(Binary128(x)).bits() == Binary64(x).bits());
+        REQUIRE(resize<8, 23>(Binary128(x)).bits() == Binary32(x).bits());
+        REQUIRE(to_real(resize<15, 112>(Binary16(x))) == to_real(Binary16(x)));
+    }
+    REQUIRE(isnan(resize<5, 10>(Binary128::nan())));
+    REQUIRE(isinf(resize<5, 10>(Binary32(1e10))));
+    REQUIRE(signbit(resize<5, 10>(-Binary128())));
+}
+
+TEST_CASE("StaticFloat arithmetic", "[static_float]")
+{
+    REQUIRE(to_real(Binary32(1.5) + Binary32(2.25)) == 3.75);
+    REQUIRE(to_real(Bfloat16(1.0) + Bfloat16(1.0 / 256)) == 1.0);
+    REQUIRE(to_real(Bfloat16(1.0) + Bfloat16(3.0 / 256)) == 1.015625);
+    REQUIRE(to_real(Binary16(3.0) / Binary16(7.0)) == double(0.428466796875));
+    REQUIRE(isinf(Binary16(60000.0) * Binary16(2.0)));
+    REQUIRE(isnan(Binary16::infinity() - Binary16::infinity()));
+    REQUIRE(isnan(Binary16() / Binary16()));
+    REQUIRE(isinf(Binary16(1.0) / -Binary16()));
+    REQUIRE(signbit(Binary16(1.0) / -Binary16()));
+    REQUIRE(!signbit(Binary16(1.0) - Binary16(1.0)));
+    REQUIRE(signbit(-Binary16() + -Binary16()));
+    REQUIRE(to_real(abs(Binary16(-3.0))) == 3.0);
+
+    // binary128 holds sums a double cannot
+    const Binary128 one(1.0), tiny(std::ldexp(1.0, -100));
+    REQUIRE(((one + tiny) - one).bits() == tiny.bits());
+    REQUIRE(to_real((Binary128(1.0) / Binary128(3.0)) * Binary128(3.0)) == 1.0);
+    REQUIRE(to_real(Binary128(1e300) * Binary128(1e300) / Binary128(1e300)) == 1e300);
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < 10000; ++i) {
+        const double x = from_bits(next_random(state));
+        const double y = from_bits(next_random(state));
+        const Binary64 a(x), b(y);
+        REQUIRE(same_real(to_real(a + b), x + y));
+        REQUIRE(same_real(to_real(a * b), x * y));
+        REQUIRE(same_real(to_real(a / b), x / y));
+        REQUIRE(same_real(to_real(resize<11, 52>(Binary128(x) * Binary128(y))), x * y));
+    }
+}
+
+TEST_CASE("StaticFloat matches the soft engine", "[static_float]")
+{
+    check_all_against_soft<StaticFloat<4, 3>>();
+    check_all_against_soft<StaticFloat<5, 2>>();
+
+    uint64_t state = 0x853C49E6748FEA9BULL;
+    check_random_against_soft<Binary16>(state);
+    check_random_against_soft<Bfloat16>(state);
+    check_random_against_soft<Binary32>(state);
+    check_random_against_soft<Binary64>(state);
+    check_random_against_soft<StaticFloat<9, 20>>(state);
+}
+
+TEST_CASE("StaticFloat comparison", "[static_float]")
+{
+    REQUIRE(Binary16(1.0) < Binary16(2.0));
+    REQUIRE(Binary16(-2.0) < Binary16(-1.0));
+    REQUIRE(Binary16(-1.0) < Binary16());
+    REQUIRE(Binary16() == -Binary16());
+    REQUIRE(Binary16() <= -Binary16());
+    REQUIRE(Binary16(3.0) >= Binary16(3.0));
+    REQUIRE(Binary16::infinity() > Binary16(65504.0));
+    REQUIRE_FALSE(Binary16::nan() == Binary16::nan());
+    REQUIRE(Binary16::nan() != Binary16::nan());
+    REQUIRE_FALSE(Binary16::nan() < Binary16(1.0));
+    REQUIRE_FALSE(Binary16::nan() >= Binary16(1.0));
+    REQUIRE(Binary128(-1e300) < Binary128(1e-300));
+}
@@ -0,0 +1,272 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include "u128.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+using namespace hdltypes;
+
+namespace {
+
+template <std::size_t N, std::size_t M>
+void check_unsigned(u128& state)
+{
+    constexpr std::size_t W = (N > M) ? N : M;
+    for (int trial = 0; trial < 50; ++trial) {
+        const u128 x = next(state) & mask(N);
+        u128 y = next(state) & mask(M);
+        if (trial % 7 == 0) {
+            y &= 0xFF;
+        }
+        const auto a = make_static<StaticUnsigned<N>>(x);
+        const auto b = make_static<StaticUnsigned<M>>(y);
+
+        REQUIRE(value(a + b) == ((x + y) & mask(W)));
+        REQUIRE(value(a - b) == ((x - y) & mask(W)));
+        if (N + M <= 128) {
+            REQUIRE(value(a * b) == x * y);
+        }
+        if (y != 0) {
+            REQUIRE(value(a / b) == x / y);
+            REQUIRE(value(a % b) == x % y);
+            REQUIRE(value(mod(a, b)) == x % y);
+        }
+
+        auto c = a;
+        c += b;
+        REQUIRE(value(c) == ((x + y) & mask(N)));
+        c -= b;
+        REQUIRE(c == a);
+
+        REQUIRE((a == b) == (x == y));
+        REQUIRE((a < b) == (x < y));
+        REQUIRE((a >= b) == (x >= y));
+        REQUIRE(value(resize<M>(a)) == (x & mask(M)));
+
+        // matches the runtime type
+        REQUIRE(Unsigned(a + b) == (Unsigned(a) + Unsigned(b)));
+        REQUIRE(StaticUnsigned<N>(Unsigned(a)) == a);
+    }
+}
+
+template <std::size_t N, std::size_t M>
+void check_signed(u128& state)
+{
+    constexpr std::size_t W = (N > M) ? N : M;
+    for (int trial = 0; trial < 50; ++trial) {
+        const s128 x = sext(next(state), N);
+        s128 y = sext(next(state), M);
+        if (trial % 7 == 0) {
+            y = sext(u128(y) & 0xFF, M);
+        }
+        const auto a = make_static<StaticSigned<N>>(u128(x), (x < 0) ? ~0ull : 0);
+        const auto b = make_static<StaticSigned<M>>(u128(y), (y < 0) ? ~0ull : 0);
+
+        REQUIRE(svalue(a + b) == sext(u128(x) + u128(y), W));
+        REQUIRE(svalue(a - b) == sext(u128(x) - u128(y), W));
+        if (N + M <= 127) {
+            REQUIRE(svalue(a * b) == x * y);
+        }
+        if ((y != 0) && (N < 128)) {
+            REQUIRE(svalue(a / b) == sext(u128(x / y), N));
+            REQUIRE(svalue(a % b) == x % y);
+            const s128 m = ((x % y != 0) && ((x < 0) != (y < 0))) ? x % y + y : x % y;
+            REQUIRE(svalue(mod(a, b)) == m);
+        }
+        REQUIRE(svalue(-a) == sext(0 - u128(x), N));
+        REQUIRE(svalue(abs(a)) == sext((x < 0) ? 0 - u128(x) : u128(x), N));
+
+        REQUIRE((a == b) == (x == y));
+        REQUIRE((a < b) == (x < y));
+        REQUIRE((a > b) == (x > y));
+
+        REQUIRE(Signed(a + b) == (Signed(a) + Signed(b)));
+        REQUIRE(Signed(resize<M>(a)) == resize(Signed(a), M));
+        REQUIRE(StaticSigned<N>(Signed(a)) == a);
+    }
+}
+
+template <std::size_t N>
+void check_shifts(u128& state)
+{
+    const u128 x = next(state) & mask(N);
+    const auto a = make_static<StaticUnsigned<N>>(x);
+    const auto s = to_signed(a);
+    for (std::size_t n = 0; n <= N + 1; n += 3) {
+        REQUIRE(value(a << n) == ((n >= 128) ? 0 : ((x << n) & mask(N))));
+        REQUIRE(value(a >> n) == ((n >= 128) ? 0 : (x >> n)));
+        if (N <= 128) {
+            const u128 rot = (n % N == 0) ? x : (((x << (n % N)) | (x >> (N - n % N))) & mask(N));
+            REQUIRE(value(rotate_left(a, n)) == rot);
+        }
+        REQUIRE(rotate_right(rotate_left(a, n), n) == a);
+        REQUIRE(Signed(s >> n) == (Signed(s) >> n));
+        REQUIRE(Signed(s << n) == (Signed(s) << n));
+    }
+}
+
+}
+
+static_assert(std::is_same<StaticUnsigned<17>::storage_type, uint64_t>::value, "");
+static_assert(std::is_same<StaticSigned<64>::storage_type, uint64_t>::value, "");
+static_assert(std::is_same<StaticUnsigned<65>::storage_type, u128>::value, "");
+static_assert(std::is_same<StaticUnsigned<129>::storage_type, limbs::LimbArray<3>>::value, "");
+static_assert(sizeof(StaticUnsigned<53>) == sizeof(uint64_t), "");
+
+static_assert(to_integer(StaticUnsigned<17>(0x1FFFF) + StaticUnsigned<17>(1)) == 0, "");
+static_assert(to_integer(StaticUnsigned<53>(1) - StaticUnsigned<53>(2)) == (1ull << 53) - 1, "");
+static_assert(to_integer(StaticSigned<17>(65535) + StaticSigned<17>(1)) == -65536, "");
+static_assert(to_integer(StaticSigned<53>(-3) * StaticSigned<53>(5)) == -15, "");
+static_assert(decltype(StaticUnsigned<17>() * StaticUnsigned<53>())::width() == 70, "");
+static_assert(to_integer(StaticUnsigned<17>(100) / StaticUnsigned<17>(7)) == 14, "");
+static_assert(StaticSigned<200>(-1) < StaticSigned<3>(0), "");
+static_assert(to_integer(StaticUnsigned<200>(3) * StaticUnsigned<200>(5)) == 15, "");
+
+TEST_CASE("StaticUnsigned construction", "[static_numeric]")
+{
+    REQUIRE(to_integer(StaticUnsigned<8>()) == 0);
+    REQUIRE(to_integer(StaticUnsigned<8>(0x1AB)) == 0xAB);
+    REQUIRE(to_integer(StaticUnsigned<64>(~0ull)) == ~0ull);
+    REQUIRE(StaticUnsigned<200>::limbs() == 4);
+
+    StaticUnsigned<200> b;
+    b.set_limb(3, ~0ull);
+    REQUIRE(b.limb(3) == 0xFF);
+
+    REQUIRE(to_integer(StaticUnsigned<8>(Unsigned(8, 200))) == 200);
+    REQUIRE_THROWS_AS(StaticUnsigned<8>(Unsigned(9, 200)), std::invalid_argument);
+    const Unsigned u = StaticUnsigned<100>(12345);
+    REQUIRE(u.width() == 100);
+    REQUIRE(to_integer(u) == 12345);
+}
+
+TEST_CASE("StaticSigned construction", "[static_numeric]")
+{
+    REQUIRE(to_integer(StaticSigned<8>(-128)) == -128);
+    REQUIRE(to_integer(StaticSigned<8>(128)) == -128);
+    REQUIRE(to_integer(StaticSigned<8>(127)) == 127);
+    REQUIRE(StaticSigned<200>(-1).limb(3) == ~0ull);
+    REQUIRE(StaticSigned<100>(-5).limb(1) == ~0ull);
+
+    StaticSigned<4> c;
+    c.set_limb(0, 0xA);
+    REQUIRE(to_integer(c) == -6);
+    REQUIRE(to_integer(to_unsigned(c)) == 0xA);
+    REQUIRE(to_integer(to_signed(StaticUnsigned<4>(0xF))) == -1);
+
+    REQUIRE(to_integer(StaticSigned<8>(Signed(8, -3))) == -3);
+    REQUIRE_THROWS_AS(StaticSigned<8>(Signed(7, -3)), std::invalid_argument);
+    const Signed s = StaticSigned<130>(-7);
+    REQUIRE(to_integer(s) == -7);
+}
+
+TEST_CASE("StaticUnsigned arithmetic matches integers", "[static_numeric]")
+{
+    u128 state = 1;
+    check_unsigned<1, 1>(state);
+    check_unsigned<17, 17>(state);
+    check_unsigned<17, 53>(state);
+    check_unsigned<53, 17>(state);
+    check_unsigned<64, 64>(state);
+    check_unsigned<64, 1>(state);
+    check_unsigned<65, 63>(state);
+    check_unsigned<100, 17>(state);
+    check_unsigned<127, 128>(state);
+    check_unsigned<128, 64>(state);
+    check_unsigned<130, 100>(state);
+    check_unsigned<200, 128>(state);
+}
+
+TEST_CASE("StaticSigned arithmetic matches integers", "[static_numeric]")
+{
+    u128 state = 2;
+    check_signed<1, 1>(state);
+    check_signed<17, 17>(state);
+    check_signed<17, 53>(state);
+    check_signed<53, 17>(state);
+    check_signed<64, 64>(state);
+    check_signed<64, 2>(state);
+    check_signed<65, 63>(state);
+    check_signed<100, 17>(state);
+    check_signed<127, 127>(state);
+    check_signed<128, 64>(state);
+    check_signed<130, 100>(state);
+    check_signed<200, 127>(state);
+}
+
+TEST_CASE("Static resize", "[static_numeric]")
+{
+    REQUIRE(to_integer(resize<4>(StaticUnsigned<8>(0xAB))) == 0xB);
+    REQUIRE(to_integer(resize<200>(StaticUnsigned<8>(0xAB))) == 0xAB);
+    REQUIRE(to_integer(resize<200>(StaticSigned<8>(-3))) == -3);
+    REQUIRE(to_integer(resize<4>(StaticSigned<8>(-3))) == -3);
+    // narrowing keeps the sign bit
+    REQUIRE(to_integer(resize<4>(StaticSigned<8>(-100))) == -4);
+    REQUIRE(to_integer(resize<4>(StaticSigned<8>(100))) == 4);
+    REQUIRE(to_integer(resize<4>(StaticSigned<200>(-100))) == -4);
+}
+
+TEST_CASE("Static wide values", "[static_numeric]")
+{
+    StaticUnsigned<200> a;
+    for (std::size_t i = 0; i < a.limbs(); ++i) {
+        a.set_limb(i, ~0ull);
+    }
+    REQUIRE((a + StaticUnsigned<1>(1)) == StaticUnsigned<1>(0));
+    REQUIRE((StaticUnsigned<200>() - StaticUnsigned<1>(1)) == a);
+    REQUIRE(compare(a, StaticUnsigned<300>(5)) > 0);
+
+    // products and quotients wider than 128 bits against the runtime type
+    u128 state = 4;
+    for (int trial = 0; trial < 20; ++trial) {
+        StaticUnsigned<150> x;
+        StaticUnsigned<90> y;
+        for (std::size_t i = 0; i < x.limbs(); ++i) {
+            x.set_limb(i, uint64_t(next(state)));
+        }
+        for (std::size_t i = 0; i < y.limbs(); ++i) {
+            y.set_limb(i, uint64_t(next(state)));
+        }
+        const auto p = x * y;
+        REQUIRE(p.width() == 240);
+        REQUIRE((p / y) == x);
+        REQUIRE((p % y) == StaticUnsigned<1>(0));
+        REQUIRE(((p + StaticUnsigned<8>(7)) % y) == StaticUnsigned<8>(7));
+
+        const auto sx = to_signed(x);
+        const auto sy = to_signed(y);
+        REQUIRE(((-sx) * sy) == -(sx * sy));
+        REQUIRE(((sx * sy) / sy) == sx);
+        REQUIRE(((sx * sy) % sy) == StaticSigned<1>(0));
+    }
+
+    REQUIRE_THROWS_AS(StaticUnsigned<8>(1) / StaticUnsigned<8>(0), std::domain_error);
+    REQUIRE_THROWS_AS(StaticSigned<200>(1) % StaticSigned<200>(0), std::domain_error);
+}
+
+TEST_CASE("Static bitwise and shifts", "[static_numeric]")
+{
+    REQUIRE(to_integer(StaticUnsigned<8>(0xF0) & StaticUnsigned<8>(0x3C)) == 0x30);
+    REQUIRE(to_integer(StaticUnsigned<8>(0xF0) | StaticUnsigned<8>(0x3C)) == 0xFC);
+    REQUIRE(to_integer(StaticUnsigned<8>(0xF0) ^ StaticUnsigned<8>(0x3C)) == 0xCC);
+    REQUIRE(to_integer(~StaticUnsigned<8>(0xF0)) == 0x0F);
+    REQUIRE(to_integer(~StaticSigned<8>(5)) == -6);
+
+    REQUIRE(to_integer(StaticUnsigned<8>(0x81) << 1) == 0x02);
+    REQUIRE(to_integer(StaticUnsigned<8>(0x81) >> 1) == 0x40);
+    REQUIRE(to_integer(StaticSigned<8>(-128) >> 3) == -16);
+    REQUIRE(to_integer(StaticSigned<8>(-128) >> 100) == -1);
+    REQUIRE(to_integer(StaticSigned<8>(64) << 1) == -128);
+    REQUIRE(to_integer(rotate_left(StaticSigned<8>(-127), 9)) == 3);
+
+    u128 state = 3;
+    check_shifts<1>(state);
+    check_shifts<17>(state);
+    check_shifts<53>(state);
+    check_shifts<64>(state);
+    check_shifts<100>(state);
+    check_shifts<128>(state);
+    check_shifts<150>(state);
+}
@@ -0,0 +1,113 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+
+#include <type_traits>
+
+using namespace hdltypes;
+
+static_assert(std::is_trivially_copyable<StaticLogicVector<7, 0>>::value, "");
+static_assert(std::is_trivially_copyable<StaticBitVector<127, 0>>::value, "");
+static_assert(sizeof(StaticBitVector<63, 0>) == sizeof(uint64_t), "");
+static_assert(sizeof(StaticLogicVector<64, 0>) == 8 * sizeof(uint64_t), "");
+
+TEST_CASE("StaticLogicVector construction", "[static_vector]")
+{
+    constexpr StaticLogicVector<7, 0> a;
+    static_assert(a.bounds() == downto(7, 0), "");
+    static_assert(a.length() == 8, "");
+    static_assert(a[3] == 'U'_l, "");
+
+    constexpr StaticLogicVector<0, 3> b("01XZ");
+    REQUIRE(b.bounds() == to(0, 3));
+    REQUIRE(b[0] == '0'_l);
+    REQUIRE(b[3] == 'Z'_l);
+    REQUIRE(to_string(b) == "01XZ");
+
+    constexpr StaticLogicVector<99, 0> c('H'_l);
+    static_assert(c.words() == 2, "");
+    static_assert(c[99] == 'H'_l, "");
+
+    StaticLogicVector<0, 0, Direction::ascending> d('1'_l);
+    REQUIRE(d.bounds() == to(0, 0));
+}
+
+TEST_CASE("StaticLogicVector element access", "[static_vector]")
+{
+    StaticLogicVector<1, 100> a;
+    a.set(1, 'H'_l);
+    a.set(100, '-'_l);
+    REQUIRE(a.at(1) == 'H'_l);
+    REQUIRE(a.at(100) == '-'_l);
+    REQUIRE(a.at(50) == 'U'_l);
+    REQUIRE_THROWS(a.at(0));
+    REQUIRE_THROWS(a.set(101, '0'_l));
+}
+
+TEST_CASE("StaticLogicVector operations", "[static_vector]")
+{
+    constexpr StaticLogicVector<3, 0> a("01XH");
+    constexpr StaticLogicVector<0, 3> b("11L1");
+    static_assert((a & b) == StaticLogicVector<3, 0>("0101"), "");
+    static_assert((a | b) == StaticLogicVector<3, 0>("11X1"), "");
+    static_assert((a ^ b) == StaticLogicVector<3, 0>("10X0"), "");
+    static_assert(~a == StaticLogicVector<3, 0>("10X0"), "");
+
+    auto c = a;
+    c &= b;
+    c |= StaticLogicVector<3, 0>("UZ00");
+    c ^= StaticLogicVector<3, 0>("0001");
+    inplace_invert(c);
+    REQUIRE(c == StaticLogicVector<3, 0>("U011"));
+    REQUIRE(c != a);
+}
+
+TEST_CASE("StaticBitVector", "[static_vector]")
+{
+    constexpr StaticBitVector<3, 0> a("0011");
+    constexpr StaticBitVector<3, 0> b("0101");
+    static_assert((a & b) == StaticBitVector<3, 0>("0001"), "");
+    static_assert((a | b) == StaticBitVector<3, 0>("0111"), "");
+    static_assert((a ^ b) == StaticBitVector<3, 0>("0110"), "");
+    static_assert(~a == StaticBitVector<3, 0>("1100"), "");
+
+    static_assert(and_reduce(StaticBitVector<69, 0>('1'_b)) == '1'_b, "");
+    static_assert(and_reduce(a) == '0'_b, "");
+    static_assert(or_reduce(a) == '1'_b, "");
+    static_assert(or_reduce(StaticBitVector<69, 0>()) == '0'_b, "");
+    static_assert(xor_reduce(a) == '0'_b, "");
+    static_assert(xor_reduce(StaticBitVector<2, 0>("111")) == '1'_b, "");
+
+    static_assert(and_reduce(StaticLogicVector<69, 0>('H'_l)) == '1'_l, "");
+    static_assert(and_reduce(StaticLogicVector<3, 0>("1UX0")) == '0'_l, "");
+    static_assert(and_reduce(StaticLogicVector<3, 0>("1XU1")) == 'U'_l, "");
+    static_assert(or_reduce(StaticLogicVector<3, 0>("0ZL0")) == 'X'_l, "");
+    static_assert(or_reduce(StaticLogicVector<3, 0>("0UXH")) == '1'_l, "");
+    static_assert(xor_reduce(StaticLogicVector<2, 0>("1HL")) == '0'_l, "");
+    static_assert(xor_reduce(StaticLogicVector<2, 0>("1-U")) == 'U'_l, "");
+
+    StaticBitVector<1, 70> c;
+    c.set(70, '1'_b);
+    REQUIRE(c.at(70) == '1'_b);
+    REQUIRE(c.at(69) == '0'_b);
+    REQUIRE_THROWS(c.set(0, '1'_b));
+    REQUIRE(to_string(a) == "0011");
+}
+
+TEST_CASE("Static vector conversions", "[static_vector]")
+{
+    constexpr StaticBitVector<3, 0> a("0110");
+    constexpr StaticLogicVector<3, 0> l = a;
+    static_assert(l == StaticLogicVector<3, 0>("0110"), "");
+    static_assert(StaticBitVector<3, 0>(l) == a, "");
+    REQUIRE_THROWS(StaticBitVector<1, 0>(StaticLogicVector<1, 0>("0X")));
+
+    const LogicVector dl = l;
+    REQUIRE(dl == "0110"_lv);
+    REQUIRE(dl.bounds() == downto(3, 0));
+    const BitVector db = a;
+    REQUIRE(db == "0110"_bv);
+
+    REQUIRE(StaticLogicVector<3, 0>("01XZ"_lv) == StaticLogicVector<3, 0>("01XZ"));
+    REQUIRE(StaticBitVector<0, 3>("1010"_bv) == StaticBitVector<0, 3>("1010"));
+    REQUIRE_THROWS(StaticLogicVector<3, 0>("01X"_lv));
+}
@@ -0,0 +1,520 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include <hdltypes/impl/text_kernels.hpp>
+#include "random.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace hdltypes;
+
+namespace {
+
+// every character a Logic can be parsed from, repeated to cover vector bodies and tails
+std::string logic_text(const std::size_t n)
+{
+    static const char chars[] = "UXZWLH-01uxzwlh";
+    std::string r(n, '0');
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = chars[(i * 7) % (sizeof(chars) - 1)];
+    }
+    return r;
+}
+
+std::string bit_text(const std::size_t n)
+{
+    std::string r(n, '0');
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = ((i * 5) % 3 == 1) ? '1' : '0';
+    }
+    return r;
+}
+
+}
+
+TEST_CASE("parse_logic", "[text]")
+{
+    const std::string s = logic_text(100);
+    std::vector<Logic> out(s.size());
+    REQUIRE(parse_logic(s.data(), s.size(), out.data()) == s.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        REQUIRE(out[i] == to_logic(s[i]));
+    }
+
+    const std::u32string w = U"01ZX-";
+    std::vector<Logic> wout(w.size());
+    REQUIRE(parse_logic(w.data(), w.size(), wout.data()) == w.size());
+    REQUIRE(wout[4] == '-'_l);
+
+    std::string bad = s;
+    bad[37] = 'q';
+    REQUIRE(parse_logic(bad.data(), bad.size(), out.data()) == 37);
+    bad[3] = '\xD8';
+    REQUIRE(parse_logic(bad.data(), bad.size(), out.data()) == 3);
+    const std::u16string wbad = u"01\u0130";
+    REQUIRE(parse_logic(wbad.data(), wbad.size(), wout.data()) == 2);
+}
+
+TEST_CASE("parse_bit", "[text]")
+{
+    const std::string s = bit_text(100);
+    std::vector<Bit> out(s.size());
+    REQUIRE(parse_bit(s.data(), s.size(), out.data()) == s.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        REQUIRE(out[i] == to_bit(s[i]));
+    }
+
+    std::string bad = s;
+    bad[70] = 'X';
+    REQUIRE(parse_bit(bad.data(), bad.size(), out.data()) == 70);
+    bad[20] = '2';
+    REQUIRE(parse_bit(bad.data(), bad.size(), out.data()) == 20);
+}
+
+TEST_CASE("parse vectors", "[text]")
+{
+    const std::string s = logic_text(130);
+    LogicVector a(s.size());
+    REQUIRE(parse_logic_vector(s.data(), s.size(), a) == s.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        REQUIRE(a[a.bounds().index(i)] == to_logic(s[i]));
+    }
+    REQUIRE(to_string(to_logic_vector(s)) == to_string(a));
+    REQUIRE_THROWS(to_logic_vector(s + "?"));
+
+    const std::string t = bit_text(130);
+    BitVector b(t.size());
+    REQUIRE(parse_bit_vector(t.data(), t.size(), b) == t.size());
+    REQUIRE(to_string(b) == t);
+    REQUIRE(to_bit_vector(std::u16string(u"0110")) == "0110"_bv);
+    REQUIRE_THROWS(to_bit_vector(t + "Z"));
+}
+
+TEST_CASE("Text kernels", "[text]")
+{
+    const auto best = simd::detect_isa();
+    for (const auto isa : { simd::Isa::scalar, simd::Isa::sse2, simd::Isa::ssse3, simd::Isa::avx2 }) {
+        if (int(isa) > int(best)) {
+            continue;
+        }
+        const auto& k = simd::text_kernels(isa);
+        for (std::size_t n = 0; n <= 200; n += 13) {
+            const std::string s = logic_text(n);
+            std::vector<uint8_t> out(n);
+            REQUIRE(k.parse_logic(s.data(), n, out.data()) == n);
+            for (std::size_t i = 0; i < n; ++i) {
+                REQUIRE(Logic(Logic::value_type(out[i])) == to_logic(s[i]));
+            }
+
+            const std::size_t words = packed::word_count(n);
+            std::vector<uint64_t> planes(packed::logic_planes * words);
+            REQUIRE(k.pack_logic(s.data(), n, planes.data(), words) == n);
+            for (std::size_t i = 0; i < n; ++i) {
+                const packed::LogicWord w { planes[i / 64], planes[words + i / 64], planes[2 * words + i / 64], planes[3 * words + i / 64] };
+                REQUIRE(packed::get(w, i % 64) == to_logic(s[i]));
+            }
+
+            const std::string t = bit_text(n);
+            REQUIRE(k.parse_bit(t.data(), n, out.data()) == n);
+            for (std::size_t i = 0; i < n; ++i) {
+                REQUIRE(out[i] == uint8_t(t[i] - '0'));
+            }
+            std::vector<uint64_t> bits(words);
+            REQUIRE(k.pack_bit(t.data(), n, bits.data()) == n);
+            for (std::size_t i = 0; i < n; ++i) {
+                REQUIRE(((bits[i / 64] >> (i % 64)) & 1) == uint64_t(t[i] - '0'));
+            }
+
+            // every invalid byte value is reported at every position class
+            for (std::size_t pos = 0; pos < n; pos += 11) {
+                for (unsigned c = 0; c < 256; ++c) {
+                    std::string bad = s;
+                    bad[pos] = char(c);
+                    const bool valid = (detail::logic_char_value(c) != detail::invalid_char);
+                    REQUIRE(k.parse_logic(bad.data(), n, out.data()) == (valid ? n : pos));
+                    REQUIRE(k.pack_logic(bad.data(), n, planes.data(), words) == (valid ? n : pos));
+                    bad = t;
+                    bad[pos] = char(c);
+                    const bool bit = (c == '0') || (c == '1');
+                    REQUIRE(k.parse_bit(bad.data(), n, out.data()) == (bit ? n : pos));
+                    REQUIRE(k.pack_bit(bad.data(), n, bits.data()) == (bit ? n : pos));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("to_chars", "[text]")
+{
+    const std::string s = logic_text(100);
+    std::vector<Logic> values(s.size());
+    REQUIRE(parse_logic(s.data(), s.size(), values.data()) == s.size());
+    std::string out(s.size(), '\0');
+    REQUIRE(to_chars(&out[0], values.data(), values.size()) == &out[0] + out.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        REQUIRE(out[i] == to_char(values[i]));
+    }
+
+    const std::string t = bit_text(100);
+    std::vector<Bit> bits(t.size());
+    REQUIRE(parse_bit(t.data(), t.size(), bits.data()) == t.size());
+    std::u16string wout(t.size(), u'\0');
+    REQUIRE(to_chars(&wout[0], bits.data(), bits.size()) == &wout[0] + wout.size());
+    REQUIRE(wout == std::u16string(t.begin(), t.end()));
+
+    const auto a = to_logic_vector(s);
+    REQUIRE(to_chars_length(a.length()) == a.length());
+    REQUIRE(to_chars(&out[0], a) == &out[0] + out.size());
+    REQUIRE(out == to_string(a));
+
+    const auto b = to_bit_vector(t);
+    REQUIRE(to_chars(&out[0], b) == &out[0] + out.size());
+    REQUIRE(out == t);
+}
+
+TEST_CASE("to_chars radix", "[text]")
+{
+    const auto hex = [](const LogicVector& a) {
+        std::string r(to_chars_length(a.length(), Radix::hexadecimal), '\0');
+        REQUIRE(to_chars(&r[0], a, Radix::hexadecimal) == &r[0] + r.size());
+        return r;
+    };
+    const auto oct = [](const LogicVector& a) {
+        std::string r(to_chars_length(a.length(), Radix::octal), '\0');
+        REQUIRE(to_chars(&r[0], a, Radix::octal) == &r[0] + r.size());
+        return r;
+    };
+
+    REQUIRE(hex(LogicVector(0)) == "");
+    REQUIRE(hex("1HL0"_lv) == "C");
+    REQUIRE(hex("10101"_lv) == "15");
+    REQUIRE(hex("01XZ"_lv) == "X");
+    REQUIRE(hex("ZZZZ"_lv) == "Z");
+    REQUIRE(hex("ZZZZZ"_lv) == "ZZ");
+    REQUIRE(hex("Z0101"_lv) == "Z5");
+    REQUIRE(hex("0101U"_lv) == "0X");
+    REQUIRE(hex("W1111-000"_lv) == "XFX");
+    REQUIRE(oct("111000111"_lv) == "707");
+    REQUIRE(oct("Z01"_lv) == "X");
+    REQUIRE(oct("ZZZ111"_lv) == "Z7");
+
+    // digits straddling word boundaries
+    LogicVector c(130, '0'_l);
+    c.set(c.bounds().index(1), '1'_l);
+    c.set(c.bounds().index(63), 'H'_l);
+    c.set(c.bounds().index(64), '1'_l);
+    c.set(c.bounds().index(66), 'Z'_l);
+    const std::string h = hex(c);
+    REQUIRE(h.size() == 33);
+    REQUIRE(h.substr(0, 2) == "10");
+    REQUIRE(h.substr(15, 3) == "06X");
+
+    std::string r(2, '\0');
+    REQUIRE(to_chars(&r[0], "10101"_bv, Radix::hexadecimal) == &r[0] + 2);
+    REQUIRE(r == "15");
+    REQUIRE(to_chars(&r[0], "1111"_bv, Radix::octal) == &r[0] + 2);
+    REQUIRE(r == "17");
+}
+
+TEST_CASE("Text format kernels", "[text]")
+{
+    const auto best = simd::detect_isa();
+    for (const auto isa : { simd::Isa::scalar, simd::Isa::sse2, simd::Isa::ssse3, simd::Isa::avx2 }) {
+        if (int(isa) > int(best)) {
+            continue;
+        }
+        const auto& k = simd::text_kernels(isa);
+        for (std::size_t n = 0; n <= 200; n += 13) {
+            const std::string s = logic_text(n);
+            std::vector<uint8_t> values(n);
+            REQUIRE(k.parse_logic(s.data(), n, values.data()) == n);
+            std::string out(n, '\0');
+            k.format_logic(values.data(), n, &out[0]);
+            for (std::size_t i = 0; i < n; ++i) {
+                REQUIRE(out[i] == to_char(to_logic(s[i])));
+            }
+
+            const std::size_t words = packed::word_count(n);
+            std::vector<uint64_t> planes(packed::logic_planes * words);
+            REQUIRE(k.pack_logic(s.data(), n, planes.data(), words) == n);
+            std::string unpacked(n, '\0');
+            k.unpack_logic(planes.data(), words, n, &unpacked[0]);
+            REQUIRE(unpacked == out);
+
+            const std::string t = bit_text(n);
+            REQUIRE(k.parse_bit(t.data(), n, values.data()) == n);
+            k.format_bit(values.data(), n, &out[0]);
+            REQUIRE(out == t);
+            std::vector<uint64_t> bits(words);
+            REQUIRE(k.pack_bit(t.data(), n, bits.data()) == n);
+            k.unpack_bit(bits.data(), n, &out[0]);
+            REQUIRE(out == t);
+        }
+    }
+}
+
+namespace {
+
+std::string hex_text(const std::size_t n)
+{
+    static const char chars[] = "0123456789abcdefABCDEF";
+    std::string r(n, '0');
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = chars[(i * 7 + 3) % (sizeof(chars) - 1)];
+    }
+    return r;
+}
+
+Unsigned random_unsigned(const std::size_t width, uint64_t& state)
+{
+    Unsigned r(width);
+    for (std::size_t i = 0; i < r.limbs(); ++i) {
+        r.set_limb(i, next_random(state));
+    }
+    return r;
+}
+
+template <typename T>
+std::string to_string(const T& a, const int base)
+{
+    std::string s(to_chars_max_length(a.width(), base), '\0');
+    const auto result = to_chars(&s[0], &s[0] + s.size(), a, base);
+    REQUIRE(result.ec == std::errc());
+    s.resize(std::size_t(result.ptr - s.data()));
+    return s;
+}
+
+// a limb of 19 digits at a time, by division
+std::string decimal_reference(Unsigned a)
+{
+    a = resize(a, std::max<std::size_t>(a.width(), 64));
+    std::string r;
+    do {
+        const std::string chunk = std::to_string(to_integer(a % 10000000000000000000ULL));
+        a = a / 10000000000000000000ULL;
+        r = chunk + r;
+        if (a != 0u) {
+            r = std::string(19 - chunk.size(), '0') + r;
+        }
+    } while (a != 0u);
+    return r;
+}
+
+}
+
+TEST_CASE("Hex kernels", "[text]")
+{
+    const auto best = simd::detect_isa();
+    for (const auto isa : { simd::Isa::scalar, simd::Isa::sse2, simd::Isa::ssse3, simd::Isa::avx2 }) {
+        if (int(isa) > int(best)) {
+            continue;
+        }
+        const auto& k = simd::text_kernels(isa);
+        for (std::size_t n = 0; n <= 200; n += 7) {
+            const std::string s = hex_text(n);
+            REQUIRE(k.scan_hex(s.data(), n) == n);
+
+            std::vector<uint64_t> words(packed::word_count(4 * n) + 1, 0xDEAD);
+            k.pack_hex(s.data(), n, words.data());
+            for (std::size_t i = 0; i < n; ++i) {
+                const std::size_t d = n - 1 - i;
+                REQUIRE(((words[d / 16] >> (4 * (d % 16))) & 0xF) == detail::hex_digit_value(s[i]));
+            }
+            REQUIRE(words.back() == 0xDEAD);
+
+            std::string out(n, '\0');
+            k.format_hex(words.data(), n, &out[0]);
+            for (std::size_t i = 0; i < n; ++i) {
+                REQUIRE(out[i] == std::toupper(s[i]));
+            }
+
+            for (std::size_t pos = 0; pos < n; pos += 11) {
+                for (unsigned c = 0; c < 256; ++c) {
+                    std::string bad = s;
+                    bad[pos] = char(c);
+                    const bool valid = std::isxdigit(int(c)) != 0;
+                    REQUIRE(k.scan_hex(bad.data(), n) == (valid ? n : pos));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Unsigned and Signed to_chars", "[text]")
+{
+    REQUIRE(to_string(Unsigned(8, 0), 10) == "0");
+    REQUIRE(to_string(Unsigned(8, 0), 16) == "0");
+    REQUIRE(to_string(Unsigned(8, 250), 10) == "250");
+    REQUIRE(to_string(Unsigned(8, 250), 16) == "FA");
+    REQUIRE(to_string(Unsigned(8, 250), 8) == "372");
+    REQUIRE(to_string(Unsigned(8, 250), 2) == "11111010");
+    REQUIRE(to_string(Unsigned(64, ~0ull), 10) == "18446744073709551615");
+    REQUIRE(to_string(Unsigned(64, ~0ull), 8) == "1777777777777777777777");
+    REQUIRE(to_string(Signed(8, -128), 10) == "-128");
+    REQUIRE(to_string(Signed(8, -1), 16) == "-1");
+    REQUIRE(to_string(Signed(8, 127), 2) == "1111111");
+    REQUIRE(to_string(Signed(200, -7), 10) == "-7");
+    REQUIRE(to_string(StaticUnsigned<17>(0x1FFFF), 16) == "1FFFF");
+
+    // the most negative value of a wide Signed
+    Signed m(130);
+    m.set_limb(2, 2);
+    REQUIRE(to_string(m, 16) == "-200000000000000000000000000000000");
+
+    char buf[4];
+    auto r = to_chars(buf, buf + 3, Unsigned(16, 1000));
+    REQUIRE(r.ec == std::errc::value_too_large);
+    REQUIRE(r.ptr == buf + 3);
+    r = to_chars(buf, buf + 4, Unsigned(16, 1000));
+    REQUIRE(r.ec == std::errc());
+    REQUIRE(std::string(buf, r.ptr) == "1000");
+    r = to_chars(buf, buf + 3, Signed(16, -100));
+    REQUIRE(r.ec == std::errc::value_too_large);
+    r = to_chars(buf, buf, Signed(16, -1));
+    REQUIRE(r.ec == std::errc::value_too_large);
+    r = to_chars(buf, buf + 4, Unsigned(16, 1000), 7);
+    REQUIRE(r.ec == std::errc::invalid_argument);
+
+    char16_t wide[8];
+    const auto w = to_chars(wide, wide + 8, Signed(8, -42), 16);
+    REQUIRE(w.ec == std::errc());
+    REQUIRE(std::u16string(wide, w.ptr) == u"-2A");
+
+    // the bound holds at every width
+    for (std::size_t width = 1; width <= 300; ++width) {
+        Signed s(width);
+        s.set_limb((width - 1) / 64, uint64_t(1) << ((width - 1) % 64));
+        Unsigned u(width);
+        for (std::size_t i = 0; i < u.limbs(); ++i) {
+            u.set_limb(i, ~0ull);
+        }
+        for (const int base : { 2, 8, 10, 16 }) {
+            REQUIRE(to_string(s, base).size() <= to_chars_max_length(width, base));
+            REQUIRE(to_string(u, base).size() < to_chars_max_length(width, base));
+        }
+    }
+}
+
+TEST_CASE("Unsigned and Signed from_chars", "[text]")
+{
+    const std::string text = "12345xyz";
+    Unsigned u(16);
+    auto r = from_chars(text.data(), text.data() + text.size(), u);
+    REQUIRE(r.ec == std::errc());
+    REQUIRE(r.ptr == text.data() + 5);
+    REQUIRE(u == 12345u);
+    REQUIRE(u.width() == 16);
+
+    const std::string hex = "fFaA0g";
+    Unsigned h(24);
+    r = from_chars(hex.data(), hex.data() + hex.size(), h, 16);
+    REQUIRE(r.ec == std::errc());
+    REQUIRE(r.ptr == hex.data() + 5);
+    REQUIRE(h == 0xFFAA0u);
+
+    // too wide for the value: unchanged and past the digits
+    u = Unsigned(8, 7);
+    const std::string big = "256 ";
+    r = from_chars(big.data(), big.data() + big.size(), u);
+    REQUIRE(r.ec == std::errc::result_out_of_range);
+    REQUIRE(r.ptr == big.data() + 3);
+    REQUIRE(u == 7u);
+    const std::string padded = "000000000000000000000000000000000000000255";
+    r = from_chars(padded.data(), padded.data() + padded.size(), u);
+    REQUIRE(r.ec == std::errc());
+    REQUIRE(u == 255u);
+
+    const std::string none = "+1";
+    r = from_chars(none.data(), none.data() + none.size(), u);
+    REQUIRE(r.ec == std::errc::invalid_argument);
+    REQUIRE(r.ptr == none.data());
+    r = from_chars(none.data() + 1, none.data() + 2, u, 3);
+    REQUIRE(r.ec == std::errc::invalid_argument);
+    const std::string octal = "78";
+    r = from_chars(octal.data(), octal.data() + 2, u, 8);
+    REQUIRE(r.ptr == octal.data() + 1);
+    REQUIRE(u == 7u);
+    r = from_chars(octal.data() + 1, octal.data() + 2, u, 8);
+    REQUIRE(r.ec == std::errc::invalid_argument);
+
+    Signed s(8);
+    const char* const cases[] = { "-128", "127", "-0", "0" };
+    const long long values[] = { -128, 127, 0, 0 };
+    for (std::size_t i = 0; i < 4; ++i) {
+        const std::string t = cases[i];
+        const auto sr = from_chars(t.data(), t.data() + t.size(), s);
+        REQUIRE(sr.ec == std::errc());
+        REQUIRE(sr.ptr == t.data() + t.size());
+        REQUIRE(s == values[i]);
+    }
+    for (const std::string t : { "-129", "128", "255", "-256" }) {
+        s = Signed(8, 5);
+        const auto sr = from_chars(t.data(), t.data() + t.size(), s);
+        REQUIRE(sr.ec == std::errc::result_out_of_range);
+        REQUIRE(sr.ptr == t.data() + t.size());
+        REQUIRE(s == 5);
+    }
+    const std::string minus = "-x";
+    const auto sr = from_chars(minus.data(), minus.data() + 2, s);
+    REQUIRE(sr.ec == std::errc::invalid_argument);
+    REQUIRE(sr.ptr == minus.data());
+    const std::string hex_min = "-80";
+    REQUIRE(from_chars(hex_min.data(), hex_min.data() + 3, s, 16).ec == std::errc());
+    REQUIRE(s == -128);
+
+    const std::u32string wide = U"-101";
+    Signed w(3);
+    REQUIRE(from_chars(wide.data(), wide.data() + wide.size(), w, 2).ec == std::errc::result_out_of_range);
+    Signed w4(4);
+    REQUIRE(from_chars(wide.data(), wide.data() + wide.size(), w4, 2).ec == std::errc());
+    REQUIRE(w4 == -5);
+}
+
+TEST_CASE("Wide radix conversion", "[text]")
+{
+    uint64_t state = 0x853C49E6748FEA9BULL;
+    // widths on both sides of the splitting threshold of the decimal conversions
+    const std::size_t widths[] = { 1, 63, 64, 65, 1000, 4095, 8200, 20000, 70000 };
+    for (const std::size_t width : widths) {
+        const Unsigned a = random_unsigned(width, state);
+        for (const int base : { 2, 8, 10, 16 }) {
+            const std::string s = to_string(a, base);
+            Unsigned b(width);
+            const auto r = from_chars(s.data(), s.data() + s.size(), b, base);
+            REQUIRE(r.ec == std::errc());
+            REQUIRE(r.ptr == s.data() + s.size());
+            REQUIRE(b == a);
+        }
+        const std::string d = to_string(a, 10);
+        if (width <= 20000) {
+            REQUIRE(d == decimal_reference(a));
+        }
+
+        // powers of ten and their neighbours stress the corrections of the divisions
+        // 10^k below 2^(width-1), by squaring
+        const std::size_t k = std::size_t(double(width - 1) * 0.30102999566398);
+        Unsigned p(width, 1);
+        Unsigned ten(std::max<std::size_t>(width, 4), 10);
+        for (std::size_t e = k; e != 0; e >>= 1) {
+            if ((e & 1) != 0) {
+                p = resize(p * ten, width);
+            }
+            ten = resize(ten * ten, ten.width());
+        }
+        const std::string ps = to_string(p, 10);
+        REQUIRE(ps.size() == k + 1);
+        REQUIRE(ps[0] == '1');
+        REQUIRE(ps.find_first_not_of('0', 1) == std::string::npos);
+        REQUIRE(to_string(p - 1u, 10) == std::string(ps.size() - 1, '9').append((ps.size() == 1) ? "0" : ""));
+
+        const Signed s = to_signed(a);
+        const std::string ss = to_string(s, 10);
+        Signed t(width);
+        REQUIRE(from_chars(ss.data(), ss.data() + ss.size(), t).ec == std::errc());
+        REQUIRE(t == s);
+    }
+}
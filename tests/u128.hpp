@@ -0,0 +1,74 @@
+#ifndef HDLTYPES_TESTS_U128_HPP
+#define HDLTYPES_TESTS_U128_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+__extension__ typedef unsigned __int128 u128;
+__extension__ typedef __int128 s128;
+
+/** The low `width` bits set. */
+inline u128 mask(const std::size_t width)
+{
+    return (width >= 128) ? ~u128(0) : ((u128(1) << width) - 1);
+}
+
+/** The low `width` bits of `v` as a signed value; from 128 bits on, all of `v`. */
+inline s128 sext(const u128 v, const std::size_t width)
+{
+    if (width >= 128) {
+        return s128(v);
+    }
+    const u128 m = mask(width);
+    const u128 sign = u128(1) << (width - 1);
+    return s128(((v & m) ^ sign) - sign);
+}
+
+/** An Unsigned or Signed of the given width with the low 128 bits of `v`. */
+template <typename T>
+T make(const std::size_t width, const u128 v)
+{
+    T r(width);
+    for (std::size_t i = 0; i < r.limbs(); ++i) {
+        r.set_limb(i, (i < 2) ? uint64_t(v >> (64 * i)) : uint64_t(0));
+    }
+    return r;
+}
+
+/** A StaticUnsigned or StaticSigned with the value `v`, and limbs above 128 bits set to `fill`. */
+template <typename T>
+T make_static(const u128 v, const uint64_t fill = 0)
+{
+    T r;
+    for (std::size_t i = 0; i < T::limbs(); ++i) {
+        r.set_limb(i, (i < 2) ? uint64_t(v >> (64 * i)) : fill);
+    }
+    return r;
+}
+
+/** The low 128 bits of an integer type. */
+template <typename T>
+u128 value(const T& a)
+{
+    u128 r = 0;
+    for (std::size_t i = 0; (i < a.limbs()) && (i < 2); ++i) {
+        r |= u128(a.limb(i)) << (64 * i);
+    }
+    return r;
+}
+
+/** The low 128 bits of a signed integer type, sign extended from its width. */
+template <typename T>
+s128 svalue(const T& a)
+{
+    return sext(value(a), a.width());
+}
+
+/** The next value of a 128-bit linear congruential generator, with its halves swapped. */
+inline u128 next(u128& state)
+{
+    state = state * u128(0x5851F42D4C957F2DULL) + 0x14057B7EF767814FULL;
+    return (state >> 64) | (state << 64);
+}
+
+#endif
@@ -0,0 +1,121 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include "random.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+using namespace hdltypes;
+
+namespace {
+
+BitVector random_bit_vector(const std::size_t length, uint64_t& state)
+{
+    BitVector r(length);
+    for (std::size_t i = 0; i < length; ++i) {
+        r.set(r.bounds().index(i), to_bit(bool(next_random(state) & 1)));
+    }
+    return r;
+}
+
+}
+
+TEST_CASE("LogicVector expressions match element-wise Logic operations", "[vector_expression]")
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (const std::size_t length : { 0u, 1u, 63u, 64u, 200u }) {
+        const LogicVector a = random_logic_vector(length, state);
+        const LogicVector b = random_logic_vector(length, state);
+        const BitVector c = random_bit_vector(length, state);
+        for (const auto sel : logic_values) {
+            const LogicVector mux = (a & ~sel) | (b & sel);
+            const LogicVector mixed = ~(a ^ c) & (c | 'H'_l);
+            REQUIRE(mux.bounds() == a.bounds());
+            REQUIRE(mixed.bounds() == a.bounds());
+            for (std::size_t i = 0; i < length; ++i) {
+                const auto n = a.bounds().index(i);
+                const auto m = c.bounds().index(i);
+                REQUIRE(mux[n] == ((a[n] & ~sel) | (b[n] & sel)));
+                REQUIRE(mixed[n] == (~(a[n] ^ c[m]) & (c[m] | 'H'_l)));
+            }
+        }
+    }
+
+    // scalars on the left take the bounds of the array
+    const LogicVector r = '1'_b ^ "01XZ"_lv;
+    REQUIRE(r.bounds() == downto(3, 0));
+    REQUIRE(r == "10XX"_lv);
+    REQUIRE(to_string(~"01UH"_lv) == "10U0");
+}
+
+TEST_CASE("BitVector expressions match element-wise Bit operations", "[vector_expression]")
+{
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    for (const std::size_t length : { 0u, 1u, 63u, 64u, 200u, 1000u }) {
+        const BitVector a = random_bit_vector(length, state);
+        const BitVector b = random_bit_vector(length, state);
+        const BitVector c = random_bit_vector(length, state);
+        const BitVector r_and = a & b;
+        const BitVector r_not = ~a;
+        const BitVector r_fused = (a & ~c) | (b ^ c) | '0'_b;
+        for (std::size_t i = 0; i < length; ++i) {
+            const auto n = a.bounds().index(i);
+            REQUIRE(r_and[n] == (a[n] & b[n]));
+            REQUIRE(r_not[n] == ~a[n]);
+            REQUIRE(r_fused[n] == ((a[n] & ~c[n]) | (b[n] ^ c[n])));
+        }
+        // bits past the end of the array stay cleared
+        REQUIRE(r_not == BitVector(~LogicVector(a)));
+        REQUIRE(BitVector(~'0'_b & a) == a);
+    }
+}
+
+TEST_CASE("Expressions evaluate into their operands", "[vector_expression]")
+{
+    auto a = "01XZ"_lv;
+    const auto b = "1100"_lv;
+    a = a & b;
+    REQUIRE(a == "0100"_lv);
+    a = b ^ ~a;
+    REQUIRE(a == "0111"_lv);
+    a |= "0101"_bv;
+    REQUIRE(a == "0111"_lv);
+    a &= 'X'_l;
+    REQUIRE(a == "0XXX"_lv);
+
+    auto c = "0011"_bv;
+    c = ~c;
+    REQUIRE(c == "1100"_bv);
+    c ^= c | "0101"_bv;
+    REQUIRE(c == "0001"_bv);
+    c &= '0'_b;
+    REQUIRE(c == "0000"_bv);
+
+    // an assignment of a different length takes the bounds and length of the expression
+    LogicVector d(to(0, 1));
+    d = a | b;
+    REQUIRE(d.bounds() == downto(3, 0));
+    REQUIRE(d == "11XX"_lv);
+}
+
+TEST_CASE("Expressions of temporaries own them", "[vector_expression]")
+{
+    const auto e = ~("0011"_bv & "0101"_bv);
+    static_assert(!std::is_same<std::decay<decltype(e)>::type, BitVector>::value, "operators yield expressions");
+    REQUIRE(BitVector(e) == "1110"_bv);
+
+    const auto b = "01"_lv;
+    const LogicVector r = b ^ (b & "1X"_lv);
+    REQUIRE(r == "0X"_lv);
+}
+
+TEST_CASE("Expressions of different lengths fail", "[vector_expression]")
+{
+    const auto a = "0101"_lv;
+    REQUIRE_THROWS_AS(a & "01"_lv, std::invalid_argument);
+    REQUIRE_THROWS_AS(a | ~"01"_bv, std::invalid_argument);
+    REQUIRE_THROWS_AS("01"_bv ^ "011"_bv, std::invalid_argument);
+    auto b = "0011"_bv;
+    REQUIRE_THROWS(b &= "01"_bv);
+    REQUIRE(b == "0011"_bv);
+}
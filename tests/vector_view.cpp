@@ -0,0 +1,192 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include "random.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+
+using namespace hdltypes;
+
+namespace {
+
+using index_type = Bounds::index_type;
+
+/** Checks a view against the elements of its array at the given positions. */
+template <typename View, typename Vector>
+void require_elements(const View& v, const Vector& a, const std::size_t first, const std::ptrdiff_t step)
+{
+    for (std::size_t i = 0; i < v.length(); ++i) {
+        const auto expected = a[a.bounds().index(std::size_t(std::ptrdiff_t(first) + std::ptrdiff_t(i) * step))];
+        REQUIRE(v[v.bounds().index(i)] == expected);
+    }
+    for (std::size_t n = 0; n < v.words(); ++n) {
+        const auto w = v.word(n);
+        for (std::size_t b = 0; (b < 64) && (n * 64 + b < v.length()); ++b) {
+            REQUIRE(v[v.bounds().index(n * 64 + b)] == packed::get(w, b));
+        }
+    }
+}
+
+}
+
+TEST_CASE("Views slice, alias, reverse, and stride without copying", "[vector_view]")
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    const LogicVector a = random_logic_vector(downto(299, 0), state);
+    const ConstLogicVectorView v = a;
+    REQUIRE(v.bounds() == a.bounds());
+    REQUIRE(v.aligned());
+    REQUIRE(v == a);
+    require_elements(v, a, 0, 1);
+
+    for (const auto left : { 299, 250, 235, 191, 64, 5 }) {
+        for (const auto right : { 0, 1, 63, 64, 100, 190 }) {
+            if (right > left) {
+                continue;
+            }
+            const auto s = v.slice(downto(left, right));
+            REQUIRE(s.length() == std::size_t(left - right + 1));
+            REQUIRE(s.aligned() == ((299 - left) % 64 == 0));
+            require_elements(s, a, std::size_t(299 - left), 1);
+            REQUIRE(to_logic_vector(s) == s);
+            REQUIRE(to_string(s) == to_string(to_logic_vector(s)));
+
+            const auto r = s.reversed();
+            REQUIRE(r.bounds() == to(right, left));
+            REQUIRE(r[left] == s[left]);
+            require_elements(r, a, std::size_t(299 - right), -1);
+
+            const auto renamed = r.alias(downto(left - right, 0));
+            require_elements(renamed, a, std::size_t(299 - right), -1);
+
+            for (const std::size_t step : { 1u, 2u, 7u }) {
+                const auto t = s.stride(step);
+                REQUIRE(t.left() == left);
+                REQUIRE(t.length() == (s.length() + step - 1) / step);
+                require_elements(t, a, std::size_t(299 - left), std::ptrdiff_t(step));
+            }
+        }
+    }
+
+    REQUIRE(v.slice(downto(3, 4)).length() == 0);
+    REQUIRE(v.slice(to(4, 3)).length() == 0);
+    REQUIRE_THROWS_AS(v.slice(to(3, 4)), std::invalid_argument);
+    REQUIRE_THROWS_AS(v.slice(downto(300, 4)), std::out_of_range);
+    REQUIRE_THROWS_AS(v.alias(to(0, 4)), std::invalid_argument);
+    REQUIRE_THROWS_AS(v.stride(0), std::invalid_argument);
+    REQUIRE_THROWS_AS(v.at(300), std::out_of_range);
+}
+
+TEST_CASE("Views write the elements of their array", "[vector_view]")
+{
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    for (const auto right : { 0, 3, 64, 70 }) {
+        for (const std::size_t step : { 1u, 3u }) {
+            LogicVector a = random_logic_vector(to(0, 399), state);
+            const LogicVector before = a;
+            const LogicVector b = random_logic_vector(to(0, 99), state);
+            LogicVectorView v = LogicVectorView(a).slice(to(right, right + 99 * index_type(step))).stride(step);
+            REQUIRE(v.length() == 100);
+            v = b;
+            for (std::size_t i = 0; i < 400; ++i) {
+                const auto n = index_type(i);
+                const bool viewed = (n >= right) && ((n - right) % index_type(step) == 0) && (n - right) / index_type(step) < 100;
+                REQUIRE(a[n] == (viewed ? b[(n - right) / index_type(step)] : before[n]));
+            }
+            bool all01 = true;
+            for (std::size_t i = 0; i < 400; ++i) {
+                all01 = all01 && is01(a[index_type(i)]);
+            }
+            REQUIRE(a.is01() == all01);
+
+            v.fill('H'_l);
+            v.set(v.right(), 'Z'_l);
+            REQUIRE(a[right + 99 * index_type(step)] == 'Z'_l);
+            REQUIRE(a[right] == 'H'_l);
+            REQUIRE_THROWS_AS(v.set(v.right() + 1, '0'_l), std::out_of_range);
+        }
+    }
+
+    LogicVector c("0000"_lv);
+    LogicVectorView(c).slice(downto(2, 1)) = "11"_bv;
+    REQUIRE(c == "0110"_lv);
+    LogicVectorView(c).reversed() = "0001"_lv;
+    REQUIRE(c == "1000"_lv);
+    REQUIRE_THROWS_AS(LogicVectorView(c) = "01"_lv, std::invalid_argument);
+    REQUIRE(c.is01());
+    LogicVectorView(c).slice(downto(0, 0)) = "X"_lv;
+    REQUIRE(!c.is01());
+
+    BitVector d("00000000"_bv);
+    BitVectorView(d).stride(2) = "1011"_bv;
+    REQUIRE(d == "10001010"_bv);
+    REQUIRE(to_bit_vector(ConstBitVectorView(d).reversed()) == "01010001"_bv);
+}
+
+TEST_CASE("Views are operands of element-wise operations", "[vector_view]")
+{
+    uint64_t state = 0x0123456789ABCDEFULL;
+    LogicVector bus = random_logic_vector(downto(255, 0), state);
+    const LogicVector mask = random_logic_vector(downto(99, 0), state);
+    const ConstLogicVectorView field = ConstLogicVectorView(bus).slice(downto(163, 64));
+    const LogicVector r = (field & mask) | ~ConstLogicVectorView(bus).slice(downto(99, 0));
+    for (std::size_t i = 0; i < 100; ++i) {
+        const auto n = index_type(i);
+        REQUIRE(r[n + 64] == ((bus[n + 64] & mask[n]) | ~bus[n]));
+    }
+
+    // inplace operations on a field of the bus
+    const LogicVector before = bus;
+    LogicVectorView(bus).slice(downto(163, 64)) ^= mask;
+    for (std::size_t i = 0; i < 256; ++i) {
+        const auto n = index_type(i);
+        REQUIRE(bus[n] == (((n >= 64) && (n <= 163)) ? (before[n] ^ mask[n - 64]) : before[n]));
+    }
+
+    BitVector bits("00001111"_bv);
+    BitVectorView(bits).slice(downto(5, 2)) |= "1001"_bv;
+    REQUIRE(bits == "00101111"_bv);
+    const BitVector swapped = ConstBitVectorView(bits).reversed() & "11110000"_bv;
+    REQUIRE(swapped == "11110000"_bv);
+    REQUIRE(LogicVector(ConstBitVectorView(bits).slice(downto(7, 4)) ^ "01X1"_lv) == "01X1"_lv);
+}
+
+TEST_CASE("Views and expressions may read the array they are assigned to at other positions", "[vector_view]")
+{
+    uint64_t state = 0x5851F42D4C957F2DULL;
+    const LogicVector a = random_logic_vector(downto(127, 0), state);
+
+    // reversed into itself, through a view and through an expression
+    LogicVector b = a;
+    LogicVectorView { b } = ConstLogicVectorView(b).reversed();
+    REQUIRE(b == to_logic_vector(ConstLogicVectorView(a).reversed()));
+    b = a;
+    b = ConstLogicVectorView(b).reversed() & '1'_l;
+    REQUIRE(b == LogicVector(ConstLogicVectorView(a).reversed() & '1'_l));
+
+    // shifted down and up by one element, overlapping the source
+    for (const index_type shift : { 1, -1, 65 }) {
+        LogicVector c = a;
+        const Bounds to_bounds = (shift > 0) ? downto(127 - shift, 0) : downto(127, -shift);
+        const Bounds from_bounds = (shift > 0) ? downto(127, shift) : downto(127 + shift, 0);
+        LogicVectorView(c).slice(to_bounds) = ConstLogicVectorView(c).slice(from_bounds);
+        for (std::size_t i = 0; i < 128; ++i) {
+            const auto n = index_type(i);
+            REQUIRE(c[n] == (to_bounds.contains(n) ? a[n + shift] : a[n]));
+        }
+    }
+
+    // the same positions are still written in place
+    LogicVector d = a;
+    LogicVectorView(d).slice(downto(100, 3)) &= ConstLogicVectorView(d).slice(downto(100, 3));
+    for (std::size_t i = 0; i < 128; ++i) {
+        const auto n = index_type(i);
+        REQUIRE(d[n] == (((n >= 3) && (n <= 100)) ? (a[n] & a[n]) : a[n]));
+    }
+
+    BitVector e("1100101011110000"_bv);
+    BitVectorView(e).stride(2) = ConstBitVectorView(e).slice(downto(7, 0));
+    REQUIRE(e == "1110101001010000"_bv);
+    e = ~ConstBitVectorView(e).reversed();
+    REQUIRE(e == "1111010110101000"_bv);
+}
@@ -0,0 +1,241 @@
+#include "catch2/catch.hpp"
+#include <hdltypes.hpp>
+#include <hdltypes/wave.hpp>
+#include "random.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace hdltypes;
+
+namespace {
+
+WaveSink string_sink(std::string& out)
+{
+    return [&out](const char* const data, const std::size_t size) {
+        out.append(data, size);
+    };
+}
+
+/** Writes the same random trace of every kind of signal, some of them wider than a word. */
+void random_trace(WaveWriter& w)
+{
+    std::vector<WaveWriter::signal_type> signals;
+    std::vector<LogicVector> logic;
+    std::vector<BitVector> bits;
+    for (int i = 0; i < 6; ++i) {
+        const std::string scope = "top.block" + std::to_string(i % 3) + ".";
+        signals.push_back(w.add_logic(scope + "l" + std::to_string(i)));
+        signals.push_back(w.add_bit(scope + "b" + std::to_string(i)));
+        const Bounds bounds = (i % 2 == 0) ? downto(Bounds::index_type(i * 29), 0) : to(1, Bounds::index_type(i * 31));
+        signals.push_back(w.add_logic(scope + "lv" + std::to_string(i), bounds));
+        signals.push_back(w.add_bit(scope + "bv" + std::to_string(i), bounds));
+        logic.emplace_back(bounds, '0'_l);
+        bits.emplace_back(bounds, '0'_b);
+    }
+
+    uint64_t state = 0x2545F4914F6CDD1D;
+    for (WaveWriter::time_type t = 0; t < 400; t += 1 + next_random(state) % 3) {
+        w.time(t);
+        for (std::size_t i = 0; i < logic.size(); ++i) {
+            // mostly unchanged values, and mostly 0 and 1 elements
+            if (next_random(state) % 4 == 0) {
+                w.change(signals[4 * i], logic_values[next_random(state) % 9]);
+            }
+            if (next_random(state) % 4 == 0) {
+                w.change(signals[4 * i + 1], to_bit(next_random(state) % 2 == 0));
+            }
+            LogicVector& a = logic[i];
+            const std::size_t offset = next_random(state) % a.length();
+            const bool unknown = next_random(state) % 8 == 0;
+            a.set(a.bounds().index(offset), unknown ? logic_values[next_random(state) % 9] : to_logic(next_random(state) % 2 == 0));
+            w.change(signals[4 * i + 2], a);
+            BitVector& b = bits[i];
+            if (next_random(state) % 2 == 0) {
+                b.set(b.bounds().index(next_random(state) % b.length()), to_bit(next_random(state) % 2 == 0));
+            }
+            w.change(signals[4 * i + 3], b);
+        }
+    }
+    w.flush();
+}
+
+}
+
+TEST_CASE("WaveWriter writes the changed values as VCD", "[wave]")
+{
+    std::string out;
+    {
+        WaveWriter w(string_sink(out));
+        const auto clk = w.add_logic("top.clk");
+        const auto rst = w.add_bit("top.rst");
+        const auto data = w.add_logic("top.cpu.data", downto(3, 0));
+        const auto flags = w.add_bit("flags", to(0, 2));
+        REQUIRE(clk == 0);
+        REQUIRE(flags == 3);
+
+        w.change(clk, '0'_l);
+        w.change(rst, '1'_b);
+        w.change(data, "01XZ"_lv);
+        w.change(flags, "100"_bv);
+        w.time(5);
+        w.change(clk, '1'_l);
+        w.change(rst, '1'_b);
+        w.change(data, "01X1"_lv);
+        w.change(flags, "100"_bv);
+        w.time(7);
+        w.change(clk, '1'_l);
+        w.time(10);
+        w.change(clk, 'H'_l);
+        w.change(rst, '0'_b);
+        REQUIRE(w.changes() == 8);
+        REQUIRE(w.time() == 10);
+    }
+    REQUIRE(out
+        == "$timescale 1 ns $end\n"
+           "$scope module top $end\n"
+           "$var wire 1 ! clk $end\n"
+           "$var wire 1 \" rst $end\n"
+           "$scope module cpu $end\n"
+           "$var wire 4 # data [3:0] $end\n"
+           "$upscope $end\n"
+           "$upscope $end\n"
+           "$var wire 3 $ flags [0:2] $end\n"
+           "$enddefinitions $end\n"
+           "#0\n"
+           "0!\n"
+           "1\"\n"
+           "b01XZ #\n"
+           "b100 $\n"
+           "#5\n"
+           "1!\n"
+           "b01X1 #\n"
+           "#10\n"
+           "H!\n"
+           "0\"\n");
+
+    // the four state values of VCD only
+    out.clear();
+    WaveOptions options;
+    options.four_state = true;
+    options.timescale = "10 ps";
+    {
+        WaveWriter w(string_sink(out), options);
+        const auto a = w.add_logic("a");
+        const auto b = w.add_logic("b", downto(8, 0));
+        w.change(a, 'L'_l);
+        w.change(b, "UX01ZWLH-"_lv);
+    }
+    REQUIRE(out
+        == "$timescale 10 ps $end\n"
+           "$var wire 1 ! a $end\n"
+           "$var wire 9 \" b [8:0] $end\n"
+           "$enddefinitions $end\n"
+           "#0\n"
+           "0!\n"
+           "bxx01zx01x \"\n");
+}
+
+TEST_CASE("WaveWriter writes the same waveform in every format and on a background thread", "[wave]")
+{
+    std::string vcd;
+    {
+        WaveWriter w(string_sink(vcd));
+        random_trace(w);
+    }
+    REQUIRE(vcd.find("$enddefinitions $end\n#0\n") != std::string::npos);
+
+    for (const bool background : { false, true }) {
+        for (const std::size_t buffer_size : { std::size_t(64), std::size_t(1) << 20 }) {
+            WaveOptions options;
+            options.background = background;
+            options.buffer_size = buffer_size;
+
+            std::string text;
+            std::size_t writes = 0;
+            {
+                WaveWriter w([&](const char* const data, const std::size_t size) {
+                    text.append(data, size);
+                    ++writes;
+                },
+                    options);
+                random_trace(w);
+            }
+            REQUIRE(text == vcd);
+            REQUIRE(writes >= ((buffer_size == 64) ? 100 : 1));
+
+            options.format = WaveFormat::delta;
+            std::string delta;
+            {
+                WaveWriter w(string_sink(delta), options);
+                random_trace(w);
+            }
+            REQUIRE(delta.compare(0, 8, "HDLWAVE1") == 0);
+            REQUIRE(delta.size() * 2 < vcd.size());
+            std::string converted;
+            delta_to_vcd(delta.data(), delta.size(), string_sink(converted));
+            REQUIRE(converted == vcd);
+        }
+    }
+
+    // four state conversion of the delta format matches four state VCD
+    WaveOptions options;
+    options.four_state = true;
+    std::string four;
+    {
+        WaveWriter w(string_sink(four), options);
+        random_trace(w);
+    }
+    options.four_state = false;
+    options.format = WaveFormat::delta;
+    std::string delta;
+    {
+        WaveWriter w(string_sink(delta), options);
+        random_trace(w);
+    }
+    std::string converted;
+    delta_to_vcd(delta.data(), delta.size(), string_sink(converted), true);
+    REQUIRE(converted == four);
+    REQUIRE(four != vcd);
+}
+
+TEST_CASE("WaveWriter rejects invalid signals, values, and times", "[wave]")
+{
+    std::string out;
+    WaveWriter w(string_sink(out));
+    const auto a = w.add_logic("a");
+    const auto b = w.add_bit("b", downto(7, 0));
+    REQUIRE_THROWS_AS(w.change(a, '1'_b), std::invalid_argument);
+    REQUIRE_THROWS_AS(w.change(b, BitVector(downto(6, 0))), std::invalid_argument);
+    REQUIRE_THROWS_AS(w.change(b, LogicVector(downto(7, 0))), std::invalid_argument);
+    REQUIRE_THROWS_AS(w.change(2, '1'_l), std::out_of_range);
+    w.time(10);
+    REQUIRE_THROWS_AS(w.time(9), std::invalid_argument);
+    REQUIRE_THROWS_AS(w.add_logic("c"), std::logic_error);
+    w.change(a, '1'_l);
+    w.flush();
+    REQUIRE(out.find("#10\n1!\n") != std::string::npos);
+
+    // errors of the sink are reported by change() or flush(), also from the background thread
+    for (const bool background : { false, true }) {
+        WaveOptions options;
+        options.background = background;
+        options.buffer_size = 16;
+        WaveWriter failing([](const char*, std::size_t) { throw std::runtime_error("disk full"); }, options);
+        const auto c = failing.add_logic("c");
+        const auto trace = [&] {
+            failing.change(c, '1'_l);
+            failing.flush();
+        };
+        REQUIRE_THROWS_AS(trace(), std::runtime_error);
+    }
+
+    // a record of signal 2 of 1, and the same waveform truncated
+    const char bad[] = "HDLWAVE1\x04" "1 ns\x01\x00\x01" "a\x02\x09";
+    REQUIRE_THROWS_AS(delta_to_vcd(bad, sizeof(bad) - 1, string_sink(out)), std::invalid_argument);
+    REQUIRE_THROWS_AS(delta_to_vcd(bad, 12, string_sink(out)), std::invalid_argument);
+    REQUIRE_THROWS_AS(delta_to_vcd("VCD", 3, string_sink(out)), std::invalid_argument);
+}